@@ -0,0 +1,156 @@
+// Rickshaw position updates: location journal + group commit vs an UPDATE per fix
+//
+//   npm run build:native && npm run bench:locations [-- rickshaws fixes sqlFixes]
+//
+// Journal side: append() for every fix from a fleet reporting round-robin,
+// drain() + committed() once per commit window. SQLite side (when sqlite3
+// loads): the old /rickshaw/location path, one autocommit UPDATE per fix,
+// against the journal path end to end, where each window's fixes become
+// one transaction holding one UPDATE per rickshaw that moved. Then a crash:
+// fixes appended but never committed, recovered by reopening the file.
+
+const fs = require('fs');
+const os = require('os');
+const path = require('path');
+const { performance } = require('perf_hooks');
+
+let LocationJournal;
+try {
+  ({ LocationJournal } = require('../native/build/Release/aeras_locations.node'));
+} catch (err) {
+  console.error('Native journal not built - run `npm run build:native` first');
+  process.exit(1);
+}
+
+const RICKSHAWS = parseInt(process.argv[2], 10) || 500;
+const FIXES = parseInt(process.argv[3], 10) || 1000000;
+const SQL_FIXES = parseInt(process.argv[4], 10) || 20000;
+const WINDOW = RICKSHAWS * 2;      // Fixes per commit window: each rickshaw twice a second
+
+const LAT0 = 22.33, LNG0 = 91.84;
+const dir = fs.mkdtempSync(path.join(os.tmpdir(), 'aeras-locations-'));
+const ids = Array.from({ length: RICKSHAWS }, (_, i) => `R${i + 1}`);
+
+function rate(label, count, ms) {
+  console.log(`${label.padEnd(36)} ${Math.round(count * 1000 / ms).toLocaleString().padStart(12)} updates/s`);
+  return count * 1000 / ms;
+}
+
+function fix(i) {
+  return [ids[i % RICKSHAWS], LAT0 + (i % 997) / 1e5, LNG0 + (i % 991) / 1e5];
+}
+
+console.log(`${RICKSHAWS} rickshaws, ${WINDOW} fixes per commit window\n`);
+
+// ===== Journal only =====
+
+const journal = new LocationJournal({ path: path.join(dir, 'bench.journal'), capacity: 65536 });
+let start = performance.now();
+for (let i = 0; i < FIXES; i++) journal.append(...fix(i));
+rate('journal: append (no commits)', FIXES, performance.now() - start);
+
+const windowed = new LocationJournal({ path: path.join(dir, 'windowed.journal'), capacity: 65536 });
+let folded = 0;
+start = performance.now();
+for (let i = 0; i < FIXES; i++) {
+  windowed.append(...fix(i));
+  if ((i + 1) % WINDOW === 0) {
+    const { through, fixes } = windowed.drain();
+    folded += fixes.length;
+    windowed.committed(through);
+  }
+}
+rate('journal: append + drain/commit', FIXES, performance.now() - start);
+console.log(`  ${FIXES} fixes folded to ${folded} rows (${(FIXES / folded).toFixed(1)}x)`);
+console.log('  stats:', windowed.stats());
+
+// ===== Crash recovery =====
+
+const crashPath = path.join(dir, 'crash.journal');
+const crashed = new LocationJournal({ path: crashPath, capacity: 65536 });
+for (let i = 0; i < 50000; i++) crashed.append(...fix(i));
+const { through } = crashed.drain();
+crashed.committed(through);
+for (let i = 0; i < 30000; i++) crashed.append(...fix(i + 7));
+// No commit: a second process opening the file sees what a restart would
+start = performance.now();
+const reopened = new LocationJournal({ path: crashPath });
+const replayMs = performance.now() - start;
+const expected = new Map();
+for (let i = 0; i < 30000; i++) {
+  const [id, lat, lng] = fix(i + 7);
+  expected.set(id, { lat, lng });
+}
+const wrong = ids.filter(id => {
+  const got = reopened.position(id);
+  return !got || got.lat !== expected.get(id).lat || got.lng !== expected.get(id).lng;
+}).length;
+console.log(`\nrecovery: ${reopened.stats().recovered} positions replayed in ${replayMs.toFixed(2)} ms, ` +
+            `${wrong} wrong`);
+
+// ===== SQLite =====
+
+let sqlite3;
+try {
+  sqlite3 = require('sqlite3');
+} catch (err) {
+  console.log('\nsqlite3 not loadable - skipping the SQLite comparison');
+  fs.rmSync(dir, { recursive: true, force: true });
+  process.exit(0);
+}
+
+function run(db, sql, params = []) {
+  return new Promise((resolve, reject) => db.run(sql, params, err => (err ? reject(err) : resolve())));
+}
+
+async function openFleet(name) {
+  const db = new sqlite3.Database(path.join(dir, name));
+  await run(db, `CREATE TABLE rickshaws (rickshawID TEXT PRIMARY KEY, currentLat REAL, currentLng REAL,
+                 lastUpdated DATETIME)`);
+  await run(db, 'BEGIN');
+  for (const id of ids) await run(db, 'INSERT INTO rickshaws (rickshawID) VALUES (?)', [id]);
+  await run(db, 'COMMIT');
+  return db;
+}
+
+async function compare() {
+  console.log('');
+  let db = await openFleet('single.db');
+  start = performance.now();
+  for (let i = 0; i < SQL_FIXES; i++) {
+    const [id, lat, lng] = fix(i);
+    await run(db, 'UPDATE rickshaws SET currentLat = ?, currentLng = ?, lastUpdated = CURRENT_TIMESTAMP WHERE rickshawID = ?',
+              [lat, lng, id]);
+  }
+  const single = rate('sqlite: UPDATE per fix', SQL_FIXES, performance.now() - start);
+  db.close();
+
+  db = await openFleet('group.db');
+  const grouped = new LocationJournal({ path: path.join(dir, 'group.journal'), capacity: 65536 });
+  const commit = async () => {
+    const { through, fixes } = grouped.drain();
+    await run(db, 'BEGIN TRANSACTION');
+    for (const f of fixes) {
+      await run(db, 'UPDATE rickshaws SET currentLat = ?, currentLng = ?, lastUpdated = ? WHERE rickshawID = ?',
+                [f.lat, f.lng, new Date(f.at).toISOString(), f.rickshawID]);
+    }
+    await run(db, 'COMMIT');
+    grouped.committed(through);
+  };
+  start = performance.now();
+  for (let i = 0; i < SQL_FIXES; i++) {
+    grouped.append(...fix(i));
+    if ((i + 1) % WINDOW === 0) await commit();
+  }
+  await commit();
+  const group = rate('sqlite: journal + group commit', SQL_FIXES, performance.now() - start);
+  db.close();
+
+  console.log(`\ngroup commit speedup: ${(group / single).toFixed(1)}x`);
+  fs.rmSync(dir, { recursive: true, force: true });
+}
+
+compare().catch(err => {
+  console.error('✗', err.message);
+  process.exit(1);
+});
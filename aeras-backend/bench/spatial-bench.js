@@ -0,0 +1,114 @@
+// Pending-ride proximity: native grid index vs the scan-and-sort path
+//
+//   npm run build:native && npm run bench:spatial [-- pending rickshaws queries]
+//
+// Both sides answer "the nearest k pending rides within R km" for each
+// rickshaw. The scan side is pendingRidesNear()'s fallback minus the SQL
+// read: a haversine per pending ride, filter, sort. Pickups sit at random
+// points over a city-sized area (the real seed has four blocks; a bench
+// on four would measure nothing).
+
+const { performance } = require('perf_hooks');
+
+let SpatialIndex;
+try {
+  ({ SpatialIndex } = require('../native/build/Release/aeras_spatial.node'));
+} catch (err) {
+  console.error('Native index not built - run `npm run build:native` first');
+  process.exit(1);
+}
+
+const PENDING = parseInt(process.argv[2], 10) || 10000;
+const RICKSHAWS = parseInt(process.argv[3], 10) || 500;
+const QUERIES = parseInt(process.argv[4], 10) || 2000;
+const K = 20;
+const RADIUS_KM = 10;
+
+// Around CUET, about 30 x 30 km
+const LAT0 = 22.33, LNG0 = 91.84, SPAN = 0.27;
+
+// Same as calculateDistance() in server.js
+function calculateDistance(lat1, lon1, lat2, lon2) {
+  const R = 6371000;
+  const φ1 = lat1 * Math.PI / 180;
+  const φ2 = lat2 * Math.PI / 180;
+  const Δφ = (lat2 - lat1) * Math.PI / 180;
+  const Δλ = (lon2 - lon1) * Math.PI / 180;
+  const a = Math.sin(Δφ/2) * Math.sin(Δφ/2) +
+            Math.cos(φ1) * Math.cos(φ2) *
+            Math.sin(Δλ/2) * Math.sin(Δλ/2);
+  return R * 2 * Math.atan2(Math.sqrt(a), Math.sqrt(1-a));
+}
+
+// Deterministic, so runs compare
+let seed = 42;
+function random() {
+  seed = (seed * 1103515245 + 12345) & 0x7fffffff;
+  return seed / 0x7fffffff;
+}
+
+const rides = [];
+for (let i = 1; i <= PENDING; i++) {
+  rides.push({ rideID: i, latitude: LAT0 + random() * SPAN, longitude: LNG0 + random() * SPAN });
+}
+const rickshaws = [];
+for (let i = 1; i <= RICKSHAWS; i++) {
+  rickshaws.push({ id: `R${i}`, lat: LAT0 + random() * SPAN, lng: LNG0 + random() * SPAN });
+}
+
+function scan(lat, lng) {
+  return rides
+    .map(ride => ({ ride, meters: calculateDistance(lat, lng, ride.latitude, ride.longitude) }))
+    .filter(hit => hit.meters <= RADIUS_KM * 1000)
+    .sort((a, b) => a.meters - b.meters || a.ride.rideID - b.ride.rideID)
+    .slice(0, K);
+}
+
+function time(label, count, fn) {
+  fn(0);  // Warm up
+  const start = performance.now();
+  for (let i = 0; i < count; i++) fn(i);
+  const us = (performance.now() - start) * 1000 / count;
+  console.log(`${label.padEnd(28)} ${us.toFixed(2).padStart(10)} us/op`);
+  return us;
+}
+
+console.log(`${PENDING} pending rides, ${RICKSHAWS} rickshaws, k=${K}, R=${RADIUS_KM} km\n`);
+
+const index = new SpatialIndex({ cellMeters: 500, refLat: LAT0 + SPAN / 2 });
+time('index: load every ride', 1, () => rides.forEach(r => index.upsertRide(r.rideID, r.latitude, r.longitude)));
+rickshaws.forEach(r => index.upsertRickshaw(r.id, r.lat, r.lng));
+
+// Same answers before timing anything
+let mismatches = 0;
+for (let i = 0; i < 200; i++) {
+  const r = rickshaws[i % RICKSHAWS];
+  const expected = scan(r.lat, r.lng).map(hit => hit.ride.rideID).join();
+  const got = index.nearestTo(r.id, K, RADIUS_KM).map(hit => hit.rideID).join();
+  if (expected !== got) mismatches++;
+}
+console.log(`agreement: ${200 - mismatches}/200 queries\n`);
+
+const scanUs = time('scan: map + haversine + sort', Math.max(1, QUERIES / 20), i => {
+  const r = rickshaws[i % RICKSHAWS];
+  scan(r.lat, r.lng);
+});
+const indexUs = time('index: nearestTo', QUERIES, i => index.nearestTo(rickshaws[i % RICKSHAWS].id, K, RADIUS_KM));
+time('index: nearest (1 km)', QUERIES, i => {
+  const r = rickshaws[i % RICKSHAWS];
+  index.nearest(r.lat, r.lng, K, 1);
+});
+
+// Request / accept churn: one ride in, one out
+let next = PENDING + 1;
+time('index: upsert + remove', QUERIES, i => {
+  index.upsertRide(next++, LAT0 + random() * SPAN, LNG0 + random() * SPAN);
+  index.removeRide(rides[i % PENDING].rideID);
+});
+time('index: rickshaw move', QUERIES, i => {
+  const r = rickshaws[i % RICKSHAWS];
+  index.upsertRickshaw(r.id, r.lat + 0.0001, r.lng);
+});
+
+console.log(`\nnearest-k speedup: ${(scanUs / indexUs).toFixed(0)}x`);
+console.log('index stats:', index.stats());
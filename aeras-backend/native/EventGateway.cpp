@@ -0,0 +1,607 @@
+// AERAS event gateway - device push streams on epoll, outside the server
+
+#include "EventGateway.h"
+
+#include <arpa/inet.h>
+#include <cctype>
+#include <cerrno>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+namespace aeras {
+
+static const size_t MAX_REQUEST_BYTES = 8 * 1024;
+static const size_t MAX_PUBLISH_LINE = 1024 * 1024;
+static const int EVENTS_PER_WAIT = 256;
+
+static const char CORS[] = "Access-Control-Allow-Origin: *\r\n";
+
+static uint64_t nowMillis() {
+  return std::chrono::duration_cast<std::chrono::milliseconds>(
+           std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+static std::string urlDecode(const std::string& text) {
+  std::string out;
+  for (size_t i = 0; i < text.size(); i++) {
+    if (text[i] == '+') {
+      out += ' ';
+    } else if (text[i] == '%' && i + 2 < text.size() && isxdigit((unsigned char)text[i + 1]) &&
+               isxdigit((unsigned char)text[i + 2])) {
+      out += (char)std::stoi(text.substr(i + 1, 2), nullptr, 16);
+      i += 2;
+    } else {
+      out += text[i];
+    }
+  }
+  return out;
+}
+
+static std::string queryParam(const std::string& query, const char* name) {
+  size_t length = strlen(name);
+  size_t at = 0;
+  while (at <= query.size()) {
+    size_t end = query.find('&', at);
+    if (end == std::string::npos) end = query.size();
+    if (end - at > length && query.compare(at, length, name) == 0 && query[at + length] == '=') {
+      return urlDecode(query.substr(at + length + 1, end - at - length - 1));
+    }
+    at = end + 1;
+  }
+  return std::string();
+}
+
+static uint64_t parseID(const std::string& text) {
+  char* end = nullptr;
+  unsigned long long value = strtoull(text.c_str(), &end, 10);
+  return end != text.c_str() ? (uint64_t)value : 0;
+}
+
+static const char* reason(int status) {
+  switch (status) {
+    case 200: return "OK";
+    case 204: return "No Content";
+    case 400: return "Bad Request";
+    case 404: return "Not Found";
+    case 405: return "Method Not Allowed";
+  }
+  return "Error";
+}
+
+static std::string sseFrame(uint64_t id, const std::string& name, const std::string& data) {
+  return "id: " + std::to_string(id) + "\nevent: " + name + "\ndata: " + data + "\n\n";
+}
+
+EventGateway::Conn::Conn(int fd, Kind kind, uint64_t deadlineMs)
+  : fd(fd),
+    kind(kind),
+    streaming(false),
+    polling(false),
+    deadlineMs(deadlineMs),
+    lastSent(0),
+    keepAlive(true),
+    closing(false),
+    closed(false) {}
+
+EventGateway::EventGateway(const GatewayConfig& config)
+  : config(config),
+    epollFd(-1),
+    wakeFd(-1),
+    boundPort(0),
+    running(false),
+    nextEventID(1),
+    nextSweepMs(0),
+    socketBound(false),
+    clients(0),
+    streams(0),
+    polls(0),
+    publishers(0),
+    published(0),
+    delivered(0),
+    slowClosed(0) {}
+
+EventGateway::~EventGateway() {
+  for (auto& entry : conns) ::close(entry.first);
+  if (epollFd >= 0) ::close(epollFd);
+  if (socketBound) ::unlink(config.socketPath.c_str());
+}
+
+// ===== Listeners =====
+
+bool EventGateway::start() {
+  epollFd = ::epoll_create1(EPOLL_CLOEXEC);
+  wakeFd = ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+  if (epollFd < 0 || wakeFd < 0 || !listenOn(wakeFd, WAKE)) {
+    failure = std::string("epoll: ") + strerror(errno);
+    return false;
+  }
+
+  int http = ::socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+  int reuse = 1;
+  sockaddr_in address{};
+  address.sin_family = AF_INET;
+  address.sin_addr.s_addr = htonl(INADDR_ANY);
+  address.sin_port = htons(config.port);
+  socklen_t length = sizeof(address);
+  if (http < 0 || ::setsockopt(http, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse)) != 0 ||
+      ::bind(http, (sockaddr*)&address, sizeof(address)) != 0 || ::listen(http, 4096) != 0 ||
+      ::getsockname(http, (sockaddr*)&address, &length) != 0 || !listenOn(http, HTTP_LISTENER)) {
+    failure = "port " + std::to_string(config.port) + ": " + strerror(errno);
+    if (http >= 0 && !conns.count(http)) ::close(http);
+    return false;
+  }
+  boundPort = ntohs(address.sin_port);
+
+  sockaddr_un local{};
+  local.sun_family = AF_UNIX;
+  if (config.socketPath.size() >= sizeof(local.sun_path)) {
+    failure = "socket path too long: " + config.socketPath;
+    return false;
+  }
+  strcpy(local.sun_path, config.socketPath.c_str());
+  // A socket file left by a gateway that did not exit cleanly
+  ::unlink(local.sun_path);
+  int publish = ::socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+  if (publish < 0 || ::bind(publish, (sockaddr*)&local, sizeof(local)) != 0 || ::listen(publish, 16) != 0 ||
+      !listenOn(publish, PUBLISH_LISTENER)) {
+    failure = config.socketPath + ": " + strerror(errno);
+    if (publish >= 0 && !conns.count(publish)) ::close(publish);
+    return false;
+  }
+  socketBound = true;
+  return true;
+}
+
+bool EventGateway::listenOn(int fd, Kind kind) {
+  epoll_event event{};
+  event.events = EPOLLIN | EPOLLET;
+  event.data.fd = fd;
+  if (::epoll_ctl(epollFd, EPOLL_CTL_ADD, fd, &event) != 0) return false;
+  conns[fd].reset(new Conn(fd, kind, 0));
+  return true;
+}
+
+// Edge-triggered: take every pending connection now, there is no second call
+void EventGateway::accept(Conn& listener) {
+  for (;;) {
+    int fd = ::accept4(listener.fd, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+    if (fd < 0) {
+      if (errno == EINTR || errno == ECONNABORTED) continue;
+      return;   // EAGAIN, or out of descriptors until some close
+    }
+
+    Kind kind = listener.kind == HTTP_LISTENER ? CLIENT : PUBLISHER;
+    if (kind == CLIENT) {
+      int on = 1;
+      ::setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &on, sizeof(on));
+    }
+
+    epoll_event event{};
+    event.events = EPOLLIN | EPOLLOUT | EPOLLRDHUP | EPOLLET;
+    event.data.fd = fd;
+    if (::epoll_ctl(epollFd, EPOLL_CTL_ADD, fd, &event) != 0) {
+      ::close(fd);
+      continue;
+    }
+    conns[fd].reset(new Conn(fd, kind, kind == CLIENT ? nowMillis() + config.requestTimeoutMs : 0));
+    if (kind == CLIENT) clients++;
+    else publishers++;
+  }
+}
+
+// ===== Loop =====
+
+void EventGateway::run() {
+  epoll_event events[EVENTS_PER_WAIT];
+  running = true;
+
+  while (running) {
+    int ready = ::epoll_wait(epollFd, events, EVENTS_PER_WAIT, 1000);
+    if (ready < 0 && errno != EINTR) break;
+
+    for (int i = 0; i < ready; i++) {
+      auto found = conns.find(events[i].data.fd);
+      if (found == conns.end() || found->second->closed) continue;
+      Conn& conn = *found->second;
+      uint32_t flags = events[i].events;
+
+      switch (conn.kind) {
+        case HTTP_LISTENER:
+        case PUBLISH_LISTENER:
+          accept(conn);
+          break;
+        case WAKE:
+          running = false;
+          break;
+        default:
+          if (flags & EPOLLERR) {
+            close(conn);
+            break;
+          }
+          if (flags & (EPOLLIN | EPOLLRDHUP | EPOLLHUP)) readable(conn);
+          if ((flags & EPOLLOUT) && !conn.closed) writable(conn);
+      }
+    }
+    // Descriptors are only released here, so none is reused within a batch
+    reap();
+
+    uint64_t now = nowMillis();
+    if (now >= nextSweepMs) {
+      sweep(now);
+      reap();
+      nextSweepMs = now + 1000;
+    }
+  }
+}
+
+void EventGateway::stop() {
+  uint64_t one = 1;
+  if (wakeFd >= 0) (void)!::write(wakeFd, &one, sizeof(one));
+}
+
+void EventGateway::readable(Conn& conn) {
+  char buffer[16 * 1024];
+  size_t limit = conn.kind == PUBLISHER ? MAX_PUBLISH_LINE : MAX_REQUEST_BYTES;
+
+  for (;;) {
+    ssize_t n = ::recv(conn.fd, buffer, sizeof(buffer), 0);
+    if (n > 0) {
+      if (conn.streaming) continue;   // Nothing more is expected on a stream
+      conn.in.append(buffer, (size_t)n);
+      // A publisher's backlog can be any length; only one line is capped
+      if (conn.kind == PUBLISHER) publishLines(conn);
+      if (conn.in.size() > limit) return close(conn);
+      continue;
+    }
+    if (n < 0 && errno == EINTR) continue;
+    if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) break;
+    return close(conn);   // EOF or error
+  }
+
+  if (conn.kind != PUBLISHER && !conn.streaming && !conn.polling) request(conn);
+}
+
+// Publishes every complete line; the unterminated tail stays in conn.in
+void EventGateway::publishLines(Conn& conn) {
+  size_t start = 0, end;
+  while ((end = conn.in.find('\n', start)) != std::string::npos) {
+    publishLine(conn.in.substr(start, end - start));
+    start = end + 1;
+  }
+  conn.in.erase(0, start);
+}
+
+void EventGateway::writable(Conn& conn) {
+  size_t sent = 0;
+  while (sent < conn.out.size()) {
+    ssize_t n = ::send(conn.fd, conn.out.data() + sent, conn.out.size() - sent, MSG_NOSIGNAL);
+    if (n > 0) {
+      sent += (size_t)n;
+      continue;
+    }
+    if (n < 0 && errno == EINTR) continue;
+    if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) break;
+    return close(conn);
+  }
+  conn.out.erase(0, sent);
+
+  if (conn.out.empty()) {
+    // A burst can leave a large buffer behind; idle streams should not keep it
+    if (conn.out.capacity() > 4096) std::string().swap(conn.out);
+    if (conn.closing) close(conn);
+  }
+}
+
+void EventGateway::close(Conn& conn) {
+  if (conn.closed) return;
+  conn.closed = true;
+  unsubscribe(conn);
+  if (conn.streaming) streams--;
+  if (conn.polling) polls--;
+  if (conn.kind == CLIENT) clients--;
+  if (conn.kind == PUBLISHER) publishers--;
+  doomed.push_back(conn.fd);
+}
+
+void EventGateway::reap() {
+  for (int fd : doomed) {
+    ::epoll_ctl(epollFd, EPOLL_CTL_DEL, fd, nullptr);
+    ::close(fd);
+    conns.erase(fd);
+  }
+  doomed.clear();
+}
+
+// Once a second: keep-alive pings, expired polls, silent connections
+void EventGateway::sweep(uint64_t nowMs) {
+  static const char PING[] = ": ping\n\n";
+  for (auto& entry : conns) {
+    Conn& conn = *entry.second;
+    if (conn.kind != CLIENT || conn.closed || conn.deadlineMs == 0 || nowMs < conn.deadlineMs) continue;
+
+    if (conn.streaming) {
+      conn.deadlineMs = nowMs + config.pingMs;
+      queue(conn, PING, sizeof(PING) - 1);
+    } else if (conn.polling) {
+      answerPoll(conn, {}, false);
+    } else {
+      close(conn);
+    }
+  }
+}
+
+// ===== HTTP =====
+
+// Handles every complete request buffered, stopping at one that holds the
+// connection (a stream or a parked poll)
+void EventGateway::request(Conn& conn) {
+  size_t end;
+  while (!conn.closed && !conn.closing && !conn.streaming && !conn.polling &&
+         (end = conn.in.find("\r\n\r\n")) != std::string::npos) {
+    std::string head = conn.in.substr(0, end);
+    conn.in.erase(0, end + 4);
+
+    size_t lineEnd = head.find("\r\n");
+    std::string requestLine = head.substr(0, lineEnd);
+    size_t space1 = requestLine.find(' ');
+    size_t space2 = requestLine.find(' ', space1 + 1);
+    if (space1 == std::string::npos || space2 == std::string::npos) {
+      respond(conn, 400, "application/json", "{\"error\":\"bad request\"}", false);
+      return;
+    }
+    std::string method = requestLine.substr(0, space1);
+    std::string target = requestLine.substr(space1 + 1, space2 - space1 - 1);
+    conn.keepAlive = requestLine.compare(space2 + 1, std::string::npos, "HTTP/1.1") == 0;
+
+    uint64_t lastEventID = 0;
+    for (size_t at = lineEnd; at != std::string::npos && at < head.size();) {
+      size_t next = head.find("\r\n", at + 2);
+      std::string line = head.substr(at + 2, next == std::string::npos ? std::string::npos : next - at - 2);
+      at = next;
+      size_t colon = line.find(':');
+      if (colon == std::string::npos) continue;
+      std::string name = line.substr(0, colon);
+      for (char& c : name) c = (char)tolower((unsigned char)c);
+      std::string value = line.substr(colon + 1);
+      value.erase(0, value.find_first_not_of(' '));
+      if (name == "last-event-id") lastEventID = parseID(value);
+      if (name == "connection") {
+        for (char& c : value) c = (char)tolower((unsigned char)c);
+        if (value == "close") conn.keepAlive = false;
+        if (value == "keep-alive") conn.keepAlive = true;
+      }
+    }
+
+    size_t question = target.find('?');
+    std::string path = target.substr(0, question);
+    std::string query = question == std::string::npos ? std::string() : target.substr(question + 1);
+
+    if (method == "OPTIONS") {
+      respond(conn, 204, "text/plain", "", conn.keepAlive);
+      continue;
+    }
+    if (method != "GET") {
+      respond(conn, 405, "application/json", "{\"error\":\"GET only\"}", conn.keepAlive);
+      continue;
+    }
+    if (path == "/stats") {
+      respond(conn, 200, "application/json", statsJson(), conn.keepAlive);
+      continue;
+    }
+    if (path != "/api/events" && path != "/api/events/poll") {
+      respond(conn, 404, "application/json", "{\"error\":\"not found\"}", conn.keepAlive);
+      continue;
+    }
+
+    // Same keys the server publishes under
+    std::string blockID = queryParam(query, "blockID");
+    std::string rickshawID = queryParam(query, "rickshawID");
+    conn.keys.clear();
+    if (!blockID.empty()) conn.keys.push_back("b:" + blockID);
+    if (!rickshawID.empty()) {
+      conn.keys.push_back("r:" + rickshawID);
+      conn.keys.push_back("r:*");
+    }
+    if (conn.keys.empty()) {
+      respond(conn, 400, "application/json", "{\"error\":\"blockID or rickshawID required\"}", conn.keepAlive);
+      continue;
+    }
+
+    if (path == "/api/events") {
+      if (lastEventID == 0) lastEventID = parseID(queryParam(query, "lastEventId"));
+      openStream(conn, lastEventID);
+    } else {
+      std::string after = queryParam(query, "after");
+      openPoll(conn, after.empty() ? nextEventID - 1 : parseID(after));
+    }
+  }
+}
+
+void EventGateway::respond(Conn& conn, int status, const char* type, const std::string& body, bool keepAlive) {
+  std::string response = "HTTP/1.1 " + std::to_string(status) + " " + reason(status) + "\r\n" +
+                         "Content-Type: " + type + "\r\n" +
+                         "Content-Length: " + std::to_string(body.size()) + "\r\n" +
+                         "Cache-Control: no-cache\r\n" + CORS +
+                         (status == 204 ? "Access-Control-Allow-Headers: Last-Event-ID\r\n" : "") +
+                         "Connection: " + (keepAlive ? "keep-alive" : "close") + "\r\n\r\n" + body;
+  conn.closing = !keepAlive;
+  conn.deadlineMs = nowMillis() + config.requestTimeoutMs;
+  queue(conn, response.data(), response.size());
+}
+
+// No Content-Length: the stream runs until either side closes it
+void EventGateway::openStream(Conn& conn, uint64_t lastEventID) {
+  std::string head = std::string("HTTP/1.1 200 OK\r\n") +
+                     "Content-Type: text/event-stream\r\n"
+                     "Cache-Control: no-cache\r\n" + CORS +
+                     "Connection: keep-alive\r\n\r\n"
+                     ": connected\n\n";
+  conn.streaming = true;
+  conn.deadlineMs = nowMillis() + config.pingMs;
+  std::string().swap(conn.in);
+  streams++;
+  subscribe(conn);
+  queue(conn, head.data(), head.size());
+
+  if (lastEventID == 0) return;
+  for (const Event& event : recent) {
+    if (event.id <= lastEventID || !matches(event, conn.keys)) continue;
+    std::string frame = sseFrame(event.id, event.name, event.data);
+    conn.lastSent = event.id;
+    queue(conn, frame.data(), frame.size());
+  }
+}
+
+void EventGateway::openPoll(Conn& conn, uint64_t after) {
+  uint64_t oldest = recent.empty() ? nextEventID : recent.front().id;
+  bool reset = after + 1 < oldest && after < nextEventID - 1;
+
+  std::vector<const Event*> missed;
+  for (const Event& event : recent) {
+    if (event.id > after && matches(event, conn.keys)) missed.push_back(&event);
+  }
+  if (!missed.empty() || reset) return answerPoll(conn, missed, reset);
+
+  conn.polling = true;
+  conn.deadlineMs = nowMillis() + config.pollTimeoutMs;
+  polls++;
+  subscribe(conn);
+}
+
+// The cursor is the newest event overall: the rest were not for these keys
+void EventGateway::answerPoll(Conn& conn, const std::vector<const Event*>& events, bool reset) {
+  std::string body = "{\"id\":" + std::to_string(nextEventID - 1) + ",\"events\":[";
+  for (size_t i = 0; i < events.size(); i++) {
+    if (i > 0) body += ',';
+    body += "{\"id\":" + std::to_string(events[i]->id) + ",\"event\":\"" + events[i]->name +
+            "\",\"data\":" + events[i]->data + "}";
+  }
+  body += reset ? "],\"reset\":true}" : "]}";
+
+  if (conn.polling) {
+    conn.polling = false;
+    polls--;
+    unsubscribe(conn);
+  }
+  respond(conn, 200, "application/json", body, conn.keepAlive);
+  // A pipelined request behind this one
+  if (!conn.in.empty()) request(conn);
+}
+
+std::string EventGateway::statsJson() const {
+  GatewayStats counters = stats();
+  return "{\"connections\":" + std::to_string(counters.connections) +
+         ",\"streams\":" + std::to_string(counters.streams) +
+         ",\"polls\":" + std::to_string(counters.polls) +
+         ",\"publishers\":" + std::to_string(counters.publishers) +
+         ",\"published\":" + std::to_string(counters.published) +
+         ",\"delivered\":" + std::to_string(counters.delivered) +
+         ",\"slowClosed\":" + std::to_string(counters.slowClosed) +
+         ",\"history\":" + std::to_string(recent.size()) + "}";
+}
+
+GatewayStats EventGateway::stats() const {
+  return GatewayStats{ clients, streams, polls, publishers, published, delivered, slowClosed };
+}
+
+// ===== Fan-out =====
+
+void EventGateway::publishLine(const std::string& line) {
+  size_t space1 = line.find(' ');
+  size_t space2 = space1 == std::string::npos ? std::string::npos : line.find(' ', space1 + 1);
+  if (space2 == std::string::npos || space1 == 0 || space2 == space1 + 1) return;
+
+  recent.push_back(Event{ nextEventID++, {}, line.substr(space1 + 1, space2 - space1 - 1), line.substr(space2 + 1) });
+  Event& event = recent.back();
+  for (size_t at = 0; at < space1;) {
+    size_t comma = line.find(',', at);
+    if (comma == std::string::npos || comma > space1) comma = space1;
+    if (comma > at) event.keys.push_back(line.substr(at, comma - at));
+    at = comma + 1;
+  }
+  published++;
+
+  // Collected first: queueing can close a connection and edit these sets
+  std::vector<Conn*> targets;
+  for (const std::string& key : event.keys) {
+    auto found = subscribers.find(key);
+    if (found == subscribers.end()) continue;
+    for (Conn* conn : found->second) {
+      if (conn->lastSent == event.id) continue;
+      conn->lastSent = event.id;
+      targets.push_back(conn);
+    }
+  }
+
+  std::string frame = sseFrame(event.id, event.name, event.data);
+  for (Conn* conn : targets) {
+    if (conn->closed) continue;
+    delivered++;
+    if (conn->streaming) queue(*conn, frame.data(), frame.size());
+    else if (conn->polling) answerPoll(*conn, { &event }, false);
+  }
+
+  if (recent.size() > config.history) recent.pop_front();
+}
+
+void EventGateway::subscribe(Conn& conn) {
+  for (const std::string& key : conn.keys) subscribers[key].insert(&conn);
+}
+
+void EventGateway::unsubscribe(Conn& conn) {
+  for (const std::string& key : conn.keys) {
+    auto found = subscribers.find(key);
+    if (found == subscribers.end()) continue;
+    found->second.erase(&conn);
+    if (found->second.empty()) subscribers.erase(found);
+  }
+}
+
+bool EventGateway::matches(const Event& event, const std::vector<std::string>& keys) const {
+  for (const std::string& key : event.keys) {
+    for (const std::string& mine : keys) {
+      if (key == mine) return true;
+    }
+  }
+  return false;
+}
+
+// Straight to the socket when nothing is queued ahead; the rest waits for
+// EPOLLOUT. Past maxQueuedBytes the reader is too far behind to keep.
+void EventGateway::queue(Conn& conn, const char* data, size_t length) {
+  if (conn.closed) return;
+
+  if (conn.out.empty()) {
+    while (length > 0) {
+      ssize_t n = ::send(conn.fd, data, length, MSG_NOSIGNAL);
+      if (n > 0) {
+        data += n;
+        length -= (size_t)n;
+        continue;
+      }
+      if (n < 0 && errno == EINTR) continue;
+      if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) break;
+      return close(conn);
+    }
+  }
+
+  if (length == 0) {
+    if (conn.out.empty() && conn.closing) close(conn);
+    return;
+  }
+  if (conn.out.size() + length > config.maxQueuedBytes) {
+    if (conn.streaming) slowClosed++;
+    return close(conn);
+  }
+  conn.out.append(data, length);
+}
+
+}  // namespace aeras
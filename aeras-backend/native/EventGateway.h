@@ -0,0 +1,162 @@
+// AERAS event gateway - device push streams on epoll, outside the server
+//
+// Every /api/events stream used to be an open Express response inside the
+// server process, and the web app polls instead of streaming at all. The
+// gateway holds those connections in one epoll loop (edge-triggered,
+// non-blocking sockets), so thousands of idle streams cost a small struct
+// each and no server event-loop time. The server publishes each event once
+// over a local Unix socket; the gateway fans it out by key:
+//
+//   publisher -> gateway    <keys> <event> <data>\n
+//                           keys: comma-separated b:<blockID>, r:<rickshawID>,
+//                           r:* (every rickshaw stream); data: one-line JSON
+//
+//   GET /api/events?blockID=X | ?rickshawID=Y
+//       SSE: id:, event:, data: frames and a ": ping" every pingMs.
+//       Last-Event-ID replays missed events still in the history. Event
+//       names and data match the server's own /api/events, but that
+//       stream sends no id: and ignores Last-Event-ID, so an id from here
+//       means nothing there: a device moving between the two starts
+//       afresh and its next heartbeat catches it up.
+//   GET /api/events/poll?rickshawID=Y&after=N
+//       Long poll: answers at once with any history event after N for the
+//       keys, else holds the request until one is published or
+//       pollTimeoutMs passes. {"id":N,"events":[{id,event,data}]}, plus
+//       "reset":true when events after N have already left the history.
+//   GET /stats
+//
+// A stream that falls more than maxQueuedBytes behind is closed (the
+// device reconnects); one slow reader never holds up the rest. Single
+// threaded: run() is the loop, stop() may be called from any thread or a
+// signal handler. Linux only.
+
+#ifndef AERAS_EVENT_GATEWAY_H
+#define AERAS_EVENT_GATEWAY_H
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace aeras {
+
+struct GatewayConfig {
+  uint16_t port = 3001;                         // 0: any free port, see port()
+  std::string socketPath = "aeras-gateway.sock";
+  uint32_t pingMs = 15000;
+  uint32_t pollTimeoutMs = 25000;
+  uint32_t requestTimeoutMs = 10000;            // To send the request headers
+  size_t maxQueuedBytes = 64 * 1024;
+  size_t history = 1024;                        // Events kept for replay
+};
+
+struct GatewayStats {
+  uint64_t connections;     // Open HTTP connections
+  uint64_t streams;         // Of which SSE
+  uint64_t polls;           // Of which parked long polls
+  uint64_t publishers;
+  uint64_t published;
+  uint64_t delivered;       // Events written to streams and polls
+  uint64_t slowClosed;      // Streams dropped for falling behind
+};
+
+class EventGateway {
+public:
+  explicit EventGateway(const GatewayConfig& config);
+  ~EventGateway();
+
+  EventGateway(const EventGateway&) = delete;
+  EventGateway& operator=(const EventGateway&) = delete;
+
+  // Binds both listeners; false with a message in error()
+  bool start();
+  // Serves until stop()
+  void run();
+  void stop();
+
+  const std::string& error() const { return failure; }
+  uint16_t port() const { return boundPort; }
+  GatewayStats stats() const;
+
+private:
+  enum Kind { HTTP_LISTENER, PUBLISH_LISTENER, WAKE, CLIENT, PUBLISHER };
+
+  struct Conn {
+    Conn(int fd, Kind kind, uint64_t deadlineMs);
+
+    int fd;
+    Kind kind;
+    std::string in;                 // Request or publisher bytes not yet parsed
+    std::string out;                // Queued bytes the socket has not taken
+    std::vector<std::string> keys;  // Subscribed while streaming or parked
+    bool streaming;
+    bool polling;
+    uint64_t deadlineMs;            // Request headers, parked poll or next ping
+    uint64_t lastSent;              // Event ID last queued here (dedupes keys)
+    bool keepAlive;
+    bool closing;                   // Close once out is written
+    bool closed;                    // Waiting for reap()
+  };
+
+  struct Event {
+    uint64_t id;
+    std::vector<std::string> keys;
+    std::string name;
+    std::string data;
+  };
+
+  bool listenOn(int fd, Kind kind);
+  void accept(Conn& listener);
+  void readable(Conn& conn);
+  void writable(Conn& conn);
+  void close(Conn& conn);
+  void reap();
+  void sweep(uint64_t nowMs);
+
+  // ===== HTTP =====
+  void request(Conn& conn);
+  void respond(Conn& conn, int status, const char* type, const std::string& body, bool keepAlive);
+  void openStream(Conn& conn, uint64_t lastEventID);
+  void openPoll(Conn& conn, uint64_t after);
+  void answerPoll(Conn& conn, const std::vector<const Event*>& events, bool reset);
+  std::string statsJson() const;
+
+  // ===== Fan-out =====
+  void publishLines(Conn& conn);
+  void publishLine(const std::string& line);
+  void subscribe(Conn& conn);
+  void unsubscribe(Conn& conn);
+  bool matches(const Event& event, const std::vector<std::string>& keys) const;
+  void queue(Conn& conn, const char* data, size_t length);
+
+  GatewayConfig config;
+  std::string failure;
+  int epollFd;
+  int wakeFd;
+  uint16_t boundPort;
+  bool running;
+
+  std::unordered_map<int, std::unique_ptr<Conn>> conns;
+  std::vector<int> doomed;            // Closed after the current event batch
+  std::unordered_map<std::string, std::unordered_set<Conn*>> subscribers;
+  std::deque<Event> recent;
+  uint64_t nextEventID;
+  uint64_t nextSweepMs;
+  bool socketBound;
+
+  uint64_t clients;
+  uint64_t streams;
+  uint64_t polls;
+  uint64_t publishers;
+  uint64_t published;
+  uint64_t delivered;
+  uint64_t slowClosed;
+};
+
+}  // namespace aeras
+
+#endif
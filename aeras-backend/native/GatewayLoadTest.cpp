@@ -0,0 +1,293 @@
+// AERAS event gateway - connection and fan-out load test
+//
+//   npm run build:native && npm run bench:gateway [-- connections events blocks rate]
+//
+// Forks a gateway, opens `connections` SSE streams to it (half block units
+// spread over `blocks` blocks, half rickshaws), then publishes `events` ride
+// events at `rate` per second over the Unix socket, the way the server
+// does: each to one block, every tenth also to every rickshaw (a new offer).
+// Each event carries its publish time; every stream records when it got
+// it. Reports the gateway's memory per connection (RSS growth over the
+// streams opened, so kernel socket buffers are not counted) and
+// publish-to-delivery latency percentiles, for block events (a few
+// streams each) and offers to every rickshaw (the widest fan-out) apart.
+
+#include <arpa/inet.h>
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fcntl.h>
+#include <fstream>
+#include <netinet/in.h>
+#include <string>
+#include <sys/epoll.h>
+#include <sys/resource.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <sys/wait.h>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+#include "EventGateway.h"
+
+using Clock = std::chrono::steady_clock;
+
+struct Client {
+  int fd;
+  std::string request;
+  std::string partial;     // Bytes after the last complete line
+  bool sent;
+  bool connected;          // ": connected" seen
+};
+
+static uint64_t nowNanos() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now().time_since_epoch()).count();
+}
+
+static long rssKiB(pid_t pid) {
+  std::ifstream status("/proc/" + std::to_string(pid) + "/status");
+  std::string line;
+  while (std::getline(status, line)) {
+    if (line.compare(0, 6, "VmRSS:") == 0) return atol(line.c_str() + 6);
+  }
+  return -1;
+}
+
+static void raiseDescriptorLimit() {
+  rlimit limit;
+  if (getrlimit(RLIMIT_NOFILE, &limit) != 0) return;
+  limit.rlim_cur = limit.rlim_max;
+  setrlimit(RLIMIT_NOFILE, &limit);
+}
+
+// One blocking GET, the body as a string
+static std::string fetch(uint16_t port, const char* path) {
+  int fd = socket(AF_INET, SOCK_STREAM, 0);
+  sockaddr_in address{};
+  address.sin_family = AF_INET;
+  address.sin_port = htons(port);
+  address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  std::string response;
+  if (connect(fd, (sockaddr*)&address, sizeof(address)) == 0) {
+    std::string request = std::string("GET ") + path + " HTTP/1.1\r\nConnection: close\r\n\r\n";
+    (void)!write(fd, request.data(), request.size());
+    char buffer[4096];
+    ssize_t n;
+    while ((n = read(fd, buffer, sizeof(buffer))) > 0) response.append(buffer, (size_t)n);
+  }
+  close(fd);
+  size_t body = response.find("\r\n\r\n");
+  return body == std::string::npos ? response : response.substr(body + 4);
+}
+
+// Publish-to-delivery microseconds, per kind of event
+struct Latencies {
+  std::vector<uint32_t> block;
+  std::vector<uint32_t> offer;
+  size_t size() const { return block.size() + offer.size(); }
+};
+
+static void handleLines(Client& client, Latencies& latencies, size_t& connected) {
+  size_t start = 0, end;
+  while ((end = client.partial.find('\n', start)) != std::string::npos) {
+    const char* line = client.partial.c_str() + start;
+    if (!client.connected && strncmp(line, ": connected", 11) == 0) {
+      client.connected = true;
+      connected++;
+    } else if (strncmp(line, "data: ", 6) == 0) {
+      const char* sent = strstr(line, "\"t\":");
+      if (sent != nullptr) {
+        uint32_t us = (uint32_t)((nowNanos() - strtoull(sent + 4, nullptr, 10)) / 1000);
+        (strstr(line, "\"offer\":true") != nullptr ? latencies.offer : latencies.block).push_back(us);
+      }
+    }
+    start = end + 1;
+  }
+  client.partial.erase(0, start);
+}
+
+// Drives every client socket once; returns false on a hard error
+static bool pump(int epollFd, std::vector<Client>& clients, Latencies& latencies, size_t& connected,
+                 int timeoutMs) {
+  epoll_event events[512];
+  int ready = epoll_wait(epollFd, events, 512, timeoutMs);
+  if (ready < 0) return errno == EINTR;
+  char buffer[16 * 1024];
+
+  for (int i = 0; i < ready; i++) {
+    Client& client = clients[events[i].data.u32];
+    if ((events[i].events & EPOLLOUT) && !client.sent) {
+      client.sent = true;
+      (void)!write(client.fd, client.request.data(), client.request.size());
+    }
+    if (events[i].events & EPOLLIN) {
+      ssize_t n;
+      while ((n = read(client.fd, buffer, sizeof(buffer))) > 0) client.partial.append(buffer, (size_t)n);
+      handleLines(client, latencies, connected);
+    }
+  }
+  return true;
+}
+
+static void report(const char* label, std::vector<uint32_t> latencies) {
+  std::sort(latencies.begin(), latencies.end());
+  auto percentile = [&](double p) {
+    return latencies.empty() ? 0u : latencies[std::min(latencies.size() - 1, (size_t)(p * latencies.size()))];
+  };
+  printf("%-14s p50 %u  p90 %u  p99 %u  p99.9 %u  max %u\n", label, percentile(0.5), percentile(0.9),
+         percentile(0.99), percentile(0.999), latencies.empty() ? 0u : latencies.back());
+}
+
+int main(int argc, char** argv) {
+  size_t connections = argc > 1 ? strtoul(argv[1], nullptr, 10) : 5000;
+  size_t eventCount = argc > 2 ? strtoul(argv[2], nullptr, 10) : 2000;
+  size_t blocks = argc > 3 ? strtoul(argv[3], nullptr, 10) : 50;
+  double rate = argc > 4 ? atof(argv[4]) : 200;
+  if (connections < 2 || blocks < 1 || rate <= 0) {
+    fprintf(stderr, "usage: %s [connections] [events] [blocks] [rate]\n", argv[0]);
+    return 2;
+  }
+
+  raiseDescriptorLimit();
+  signal(SIGPIPE, SIG_IGN);
+  std::string socketPath = "/tmp/aeras-gateway-load-" + std::to_string(getpid()) + ".sock";
+
+  int portPipe[2];
+  if (pipe(portPipe) != 0) return 1;
+  pid_t child = fork();
+  if (child == 0) {
+    close(portPipe[0]);
+    aeras::GatewayConfig config;
+    config.port = 0;
+    config.socketPath = socketPath;
+    aeras::EventGateway gateway(config);
+    uint16_t port = gateway.start() ? gateway.port() : 0;
+    if (port == 0) fprintf(stderr, "✗ %s\n", gateway.error().c_str());
+    (void)!write(portPipe[1], &port, sizeof(port));
+    close(portPipe[1]);
+    if (port != 0) gateway.run();
+    _exit(0);
+  }
+  close(portPipe[1]);
+  uint16_t port = 0;
+  if (read(portPipe[0], &port, sizeof(port)) != sizeof(port) || port == 0) return 1;
+  close(portPipe[0]);
+  usleep(100 * 1000);
+  long baseRss = rssKiB(child);
+
+  // ===== Connect =====
+
+  int epollFd = epoll_create1(0);
+  std::vector<Client> clients(connections);
+  Latencies latencies;
+  size_t connected = 0;
+  sockaddr_in address{};
+  address.sin_family = AF_INET;
+  address.sin_port = htons(port);
+  address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+
+  auto connectStart = Clock::now();
+  const size_t BATCH = 500;   // Stay inside the listen backlog
+  for (size_t first = 0; first < connections; first += BATCH) {
+    for (size_t i = first; i < std::min(connections, first + BATCH); i++) {
+      Client& client = clients[i];
+      client.fd = socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK, 0);
+      if (client.fd < 0) {
+        fprintf(stderr, "✗ socket %zu: %s\n", i, strerror(errno));
+        kill(child, SIGTERM);
+        return 1;
+      }
+      client.request = i % 2 == 0 ? "GET /api/events?blockID=B" + std::to_string((i / 2) % blocks)
+                                  : "GET /api/events?rickshawID=R" + std::to_string(i);
+      client.request += " HTTP/1.1\r\nHost: localhost\r\nAccept: text/event-stream\r\n\r\n";
+      connect(client.fd, (sockaddr*)&address, sizeof(address));
+      epoll_event event{};
+      event.events = EPOLLIN | EPOLLOUT | EPOLLET;
+      event.data.u32 = (uint32_t)i;
+      epoll_ctl(epollFd, EPOLL_CTL_ADD, client.fd, &event);
+    }
+    size_t target = std::min(connections, first + BATCH);
+    auto deadline = Clock::now() + std::chrono::seconds(10);
+    while (connected < target && Clock::now() < deadline) pump(epollFd, clients, latencies, connected, 100);
+  }
+  double connectS = std::chrono::duration<double>(Clock::now() - connectStart).count();
+  usleep(200 * 1000);
+  long loadedRss = rssKiB(child);
+
+  printf("gateway stats: %s\n", fetch(port, "/stats").c_str());
+  printf("connections:   %zu of %zu open in %.2f s\n", connected, connections, connectS);
+  printf("gateway RSS:   %ld KiB idle, %ld KiB with streams -> %.2f KiB per connection\n\n", baseRss, loadedRss,
+         (double)(loadedRss - baseRss) / (double)std::max<size_t>(connected, 1));
+
+  // ===== Publish =====
+
+  int publisher = socket(AF_UNIX, SOCK_STREAM, 0);
+  sockaddr_un local{};
+  local.sun_family = AF_UNIX;
+  strncpy(local.sun_path, socketPath.c_str(), sizeof(local.sun_path) - 1);
+  if (connect(publisher, (sockaddr*)&local, sizeof(local)) != 0) {
+    fprintf(stderr, "✗ publisher: %s\n", strerror(errno));
+    kill(child, SIGTERM);
+    return 1;
+  }
+
+  // Who gets what, from the same layout the clients were opened with
+  std::vector<size_t> perBlock(blocks, 0);
+  size_t rickshaws = 0;
+  for (size_t i = 0; i < connections; i++) {
+    if (!clients[i].connected) continue;
+    if (i % 2 == 0) perBlock[(i / 2) % blocks]++;
+    else rickshaws++;
+  }
+  size_t expected = 0;
+  for (size_t i = 0; i < eventCount; i++) expected += perBlock[i % blocks] + (i % 10 == 0 ? rickshaws : 0);
+  latencies.block.reserve(expected);
+  latencies.offer.reserve(expected);
+
+  std::atomic<bool> publishing(true);
+  auto publishStart = Clock::now();
+  std::thread publish([&] {
+    auto interval = std::chrono::nanoseconds((int64_t)(1e9 / rate));
+    auto next = Clock::now();
+    for (size_t i = 0; i < eventCount; i++) {
+      std::this_thread::sleep_until(next);
+      next += interval;
+      bool offer = i % 10 == 0;
+      std::string keys = "b:B" + std::to_string(i % blocks) + (offer ? ",r:*" : "");
+      std::string line = keys + " ride {\"rideID\":" + std::to_string(i + 1) + ",\"status\":\"PENDING\",\"offer\":" +
+                         (offer ? "true" : "false") + ",\"t\":" + std::to_string(nowNanos()) + "}\n";
+      (void)!write(publisher, line.data(), line.size());
+    }
+    publishing = false;
+  });
+
+  auto drainUntil = Clock::time_point::max();
+  while (latencies.size() < expected && Clock::now() < drainUntil) {
+    pump(epollFd, clients, latencies, connected, 100);
+    if (!publishing && drainUntil == Clock::time_point::max()) drainUntil = Clock::now() + std::chrono::seconds(5);
+  }
+  publish.join();
+  double publishS = std::chrono::duration<double>(Clock::now() - publishStart).count();
+
+  printf("published:     %zu events at %.0f/s, %zu deliveries expected\n", eventCount, rate, expected);
+  printf("delivered:     %zu (%zu missing), %.0f deliveries/s\n", latencies.size(),
+         expected - std::min(expected, latencies.size()), latencies.size() / publishS);
+  std::vector<uint32_t> all(latencies.block);
+  all.insert(all.end(), latencies.offer.begin(), latencies.offer.end());
+  report("latency (us)", all);
+  report("  block", latencies.block);
+  report("  offer to all", latencies.offer);
+  printf("gateway RSS:   %ld KiB after publishing\n", rssKiB(child));
+
+  kill(child, SIGTERM);
+  waitpid(child, nullptr, 0);
+  unlink(socketPath.c_str());
+  for (Client& client : clients) close(client.fd);
+  return latencies.size() == expected ? 0 : 1;
+}
@@ -0,0 +1,65 @@
+// AERAS event gateway - standalone process
+//
+//   npm run build:native && npm run gateway [-- --port 3001 --socket aeras-gateway.sock]
+//
+// Run it next to the server (same working directory, or point the server's
+// GATEWAY_SOCKET at --socket) and aim devices' event URL at --port.
+
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <sys/resource.h>
+
+#include "EventGateway.h"
+
+static aeras::EventGateway* running = nullptr;
+
+static void onSignal(int) {
+  if (running != nullptr) running->stop();
+}
+
+// Every stream is a descriptor; the soft limit is often 1024
+static rlim_t raiseDescriptorLimit() {
+  rlimit limit;
+  if (getrlimit(RLIMIT_NOFILE, &limit) != 0) return 0;
+  limit.rlim_cur = limit.rlim_max;
+  setrlimit(RLIMIT_NOFILE, &limit);
+  getrlimit(RLIMIT_NOFILE, &limit);
+  return limit.rlim_cur;
+}
+
+int main(int argc, char** argv) {
+  aeras::GatewayConfig config;
+  for (int i = 1; i + 1 < argc; i += 2) {
+    if (strcmp(argv[i], "--port") == 0) config.port = (uint16_t)atoi(argv[i + 1]);
+    else if (strcmp(argv[i], "--socket") == 0) config.socketPath = argv[i + 1];
+    else if (strcmp(argv[i], "--ping") == 0) config.pingMs = (uint32_t)atoi(argv[i + 1]) * 1000;
+    else {
+      fprintf(stderr, "usage: %s [--port 3001] [--socket aeras-gateway.sock] [--ping seconds]\n", argv[0]);
+      return 2;
+    }
+  }
+
+  rlim_t descriptors = raiseDescriptorLimit();
+  aeras::EventGateway gateway(config);
+  if (!gateway.start()) {
+    fprintf(stderr, "✗ Event gateway: %s\n", gateway.error().c_str());
+    return 1;
+  }
+
+  running = &gateway;
+  signal(SIGINT, onSignal);
+  signal(SIGTERM, onSignal);
+  signal(SIGPIPE, SIG_IGN);
+
+  printf("✓ Event gateway on port %u, publishers on %s (%llu descriptors)\n", gateway.port(),
+         config.socketPath.c_str(), (unsigned long long)descriptors);
+  fflush(stdout);
+  gateway.run();
+
+  aeras::GatewayStats stats = gateway.stats();
+  printf("✓ Event gateway stopped: %llu published, %llu delivered\n", (unsigned long long)stats.published,
+         (unsigned long long)stats.delivered);
+  return 0;
+}
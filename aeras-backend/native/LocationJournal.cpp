@@ -0,0 +1,218 @@
+// AERAS location journal - rickshaw positions ahead of SQLite
+
+#include "LocationJournal.h"
+
+#include <cstdlib>
+#include <cstring>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace aeras {
+
+static const uint64_t MAGIC = 0x314A4C5341524541ull;   // "AERASLJ1"
+
+static size_t roundUp(size_t n) {
+  size_t power = 1;
+  while (power < n) power <<= 1;
+  return power;
+}
+
+LocationJournal::LocationJournal(const std::string& path, size_t capacity)
+  : fd(-1),
+    base(nullptr),
+    bytes(0),
+    mapped(false),
+    header(nullptr),
+    ring(nullptr),
+    mask(0),
+    nextSeq(1),
+    appended(0),
+    overruns(0),
+    commits(0),
+    folded(0),
+    recovered(0) {
+  static_assert(sizeof(Header) == 64 && sizeof(Record) == 64, "journal layout is 64-byte slots");
+
+  capacity = roundUp(capacity < 64 ? 64 : capacity);
+  if (!map(path, capacity)) {
+    bytes = sizeof(Header) + capacity * sizeof(Record);
+    base = std::calloc(1, bytes);
+    header = static_cast<Header*>(base);
+    header->magic = MAGIC;
+    header->capacity = capacity;
+  }
+  ring = reinterpret_cast<Record*>(header + 1);
+  mask = (size_t)header->capacity - 1;
+  recover();
+}
+
+LocationJournal::~LocationJournal() {
+#ifndef _WIN32
+  if (mapped) {
+    ::msync(base, bytes, MS_ASYNC);
+    ::munmap(base, bytes);
+    ::close(fd);
+    return;
+  }
+#endif
+  std::free(base);
+}
+
+// FNV-1a over everything before the check field
+uint32_t LocationJournal::checksum(const Record& record) {
+  const unsigned char* at = reinterpret_cast<const unsigned char*>(&record);
+  uint32_t hash = 2166136261u;
+  for (size_t i = 0; i < offsetof(Record, check); i++) {
+    hash ^= at[i];
+    hash *= 16777619u;
+  }
+  return hash;
+}
+
+// ===== File =====
+
+// Maps an existing journal as it is, or creates a fresh one; false leaves
+// the caller to fall back to memory
+bool LocationJournal::map(const std::string& path, size_t capacity) {
+#ifdef _WIN32
+  (void)path;
+  (void)capacity;
+  return false;
+#else
+  fd = ::open(path.c_str(), O_RDWR | O_CREAT, 0644);
+  if (fd < 0) return false;
+
+  Header existing;
+  struct stat info;
+  bool reuse = ::fstat(fd, &info) == 0 &&
+               ::pread(fd, &existing, sizeof(existing), 0) == (ssize_t)sizeof(existing) &&
+               existing.magic == MAGIC && existing.capacity >= 64 &&
+               (existing.capacity & (existing.capacity - 1)) == 0 &&
+               (uint64_t)info.st_size == sizeof(Header) + existing.capacity * sizeof(Record);
+  if (reuse) capacity = (size_t)existing.capacity;
+
+  bytes = sizeof(Header) + capacity * sizeof(Record);
+  // Truncating first zeroes whatever was there
+  if (!reuse && (::ftruncate(fd, 0) != 0 || ::ftruncate(fd, (off_t)bytes) != 0)) {
+    ::close(fd);
+    fd = -1;
+    return false;
+  }
+
+  base = ::mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  if (base == MAP_FAILED) {
+    base = nullptr;
+    ::close(fd);
+    fd = -1;
+    return false;
+  }
+
+  mapped = true;
+  header = static_cast<Header*>(base);
+  if (!reuse) {
+    header->magic = MAGIC;
+    header->capacity = capacity;
+    header->committed = 0;
+  }
+  return true;
+#endif
+}
+
+// Folds every intact record newer than the committed seq back into the table
+void LocationJournal::recover() {
+  uint64_t last = header->committed;
+  for (size_t slot = 0; slot <= mask; slot++) {
+    const Record& record = ring[slot];
+    if (record.seq == 0 || (record.seq & mask) != slot || record.check != checksum(record)) continue;
+    if (record.seq > last) last = record.seq;
+    if (record.seq <= header->committed) continue;
+
+    std::string rickshawID(record.rickshawID, strnlen(record.rickshawID, sizeof(record.rickshawID)));
+    auto found = latest.find(rickshawID);
+    if (found != latest.end() && found->second.seq > record.seq) continue;
+    latest[rickshawID] = Latest{ record.seq, record.atMs, record.lat, record.lng, true };
+  }
+  nextSeq = last + 1;
+
+  for (const auto& entry : latest) dirty.push_back(entry.first);
+  recovered = dirty.size();
+}
+
+// ===== Positions =====
+
+uint64_t LocationJournal::append(const std::string& rickshawID, double lat, double lng, uint64_t atMs) {
+  if (rickshawID.empty() || rickshawID.size() > ID_MAX) return 0;
+
+  uint64_t seq = nextSeq++;
+  Record& record = ring[seq & mask];
+  if (record.seq > header->committed) overruns++;
+
+  record.seq = seq;
+  record.atMs = atMs;
+  record.lat = lat;
+  record.lng = lng;
+  std::memset(record.rickshawID, 0, sizeof(record.rickshawID));
+  std::memcpy(record.rickshawID, rickshawID.data(), rickshawID.size());
+  record.reserved = 0;
+  record.check = checksum(record);   // Last: a torn record fails it
+  appended++;
+
+  Latest& entry = latest[rickshawID];
+  if (!entry.dirty) dirty.push_back(rickshawID);
+  entry = Latest{ seq, atMs, lat, lng, true };
+  return seq;
+}
+
+bool LocationJournal::position(const std::string& rickshawID, Fix& out) const {
+  auto found = latest.find(rickshawID);
+  if (found == latest.end()) return false;
+  out = Fix{ rickshawID, found->second.lat, found->second.lng, found->second.atMs };
+  return true;
+}
+
+// ===== Group commit =====
+
+void LocationJournal::drain(std::vector<Fix>& out, uint64_t& through) const {
+  out.clear();
+  out.reserve(dirty.size());
+  for (const std::string& rickshawID : dirty) {
+    const Latest& entry = latest.at(rickshawID);
+    out.push_back(Fix{ rickshawID, entry.lat, entry.lng, entry.atMs });
+  }
+  through = nextSeq - 1;
+}
+
+// Rickshaws that moved again after the drain stay dirty for the next one
+void LocationJournal::committed(uint64_t through) {
+  if (through <= header->committed || through >= nextSeq) return;
+
+  size_t kept = 0;
+  for (size_t i = 0; i < dirty.size(); i++) {
+    Latest& entry = latest[dirty[i]];
+    if (entry.seq <= through) {
+      entry.dirty = false;
+      folded++;
+    } else {
+      dirty[kept++] = dirty[i];
+    }
+  }
+  dirty.resize(kept);
+
+  header->committed = through;
+  commits++;
+#ifndef _WIN32
+  if (mapped) ::msync(base, bytes, MS_ASYNC);
+#endif
+}
+
+JournalStats LocationJournal::stats() const {
+  return JournalStats{ appended, overruns, commits, folded, recovered, header->committed,
+                       header->capacity, mapped };
+}
+
+}  // namespace aeras
@@ -0,0 +1,129 @@
+// AERAS location journal - rickshaw positions ahead of SQLite
+//
+// /api/rickshaw/location used to be one autocommit UPDATE per fix, so at
+// fleet scale position writes were most of the database's work and queued
+// ride transactions behind them. Here a fix is a 64-byte record stored in
+// a memory-mapped ring file and in an in-memory table of each rickshaw's
+// latest position. Readers are answered from that table at once. Every
+// so often the caller drain()s the rickshaws that moved, writes one row
+// each in a single transaction (however many fixes arrived, only the last
+// is written) and reports committed(through).
+//
+//   header (64 bytes):  magic | capacity | committed seq
+//   record (64 bytes):  seq | atMs | lat | lng | rickshawID[24] | check
+//
+// A record lives in slot seq & (capacity - 1). The pages belong to the OS
+// once written, so a killed process loses nothing. On open, every record
+// that passes its check and is newer than the committed seq is folded back
+// into the table as still to be written. A fix that is overwritten before
+// it is committed is counted as an overrun; only a rickshaw whose last fix
+// was overwritten loses anything, and only if the process dies first.
+//
+// Rickshaw IDs longer than ID_MAX are not journaled (append returns 0).
+// Not thread-safe; the addon calls it from the JS thread only. Without
+// mmap (_WIN32) the ring is plain memory and nothing is recovered.
+
+#ifndef AERAS_LOCATION_JOURNAL_H
+#define AERAS_LOCATION_JOURNAL_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace aeras {
+
+struct Fix {
+  std::string rickshawID;
+  double lat;
+  double lng;
+  uint64_t atMs;
+};
+
+struct JournalStats {
+  uint64_t appended;
+  uint64_t overruns;       // Uncommitted records overwritten by the ring
+  uint64_t commits;
+  uint64_t folded;         // Rows written by those commits
+  uint64_t recovered;      // Positions replayed from the file on open
+  uint64_t committed;      // Highest seq in SQLite
+  uint64_t capacity;
+  bool mapped;             // Backed by the file (false: memory only)
+};
+
+class LocationJournal {
+public:
+  static const size_t ID_MAX = 23;
+
+  // capacity (records) is rounded up to a power of two; an existing
+  // journal keeps the capacity it was created with
+  LocationJournal(const std::string& path, size_t capacity = 1 << 16);
+  ~LocationJournal();
+
+  LocationJournal(const LocationJournal&) = delete;
+  LocationJournal& operator=(const LocationJournal&) = delete;
+
+  // Returns the record's seq, or 0 if rickshawID is too long to journal
+  uint64_t append(const std::string& rickshawID, double lat, double lng, uint64_t atMs);
+  bool position(const std::string& rickshawID, Fix& out) const;
+
+  // Latest fix of every rickshaw that moved since its last commit; through
+  // is the seq to pass to committed() once they are written
+  void drain(std::vector<Fix>& out, uint64_t& through) const;
+  void committed(uint64_t through);
+
+  size_t pending() const { return dirty.size(); }
+  JournalStats stats() const;
+
+private:
+  struct Header {
+    uint64_t magic;
+    uint64_t capacity;
+    uint64_t committed;
+    uint64_t reserved[5];
+  };
+
+  struct Record {
+    uint64_t seq;
+    uint64_t atMs;
+    double lat;
+    double lng;
+    char rickshawID[24];
+    uint32_t check;
+    uint32_t reserved;
+  };
+
+  struct Latest {
+    uint64_t seq;
+    uint64_t atMs;
+    double lat;
+    double lng;
+    bool dirty;
+  };
+
+  static uint32_t checksum(const Record& record);
+  bool map(const std::string& path, size_t capacity);
+  void recover();
+
+  int fd;
+  void* base;
+  size_t bytes;
+  bool mapped;
+  Header* header;
+  Record* ring;
+  size_t mask;
+  uint64_t nextSeq;
+
+  std::unordered_map<std::string, Latest> latest;
+  std::vector<std::string> dirty;     // Rickshaws with a fix newer than the last commit
+  uint64_t appended;
+  uint64_t overruns;
+  uint64_t commits;
+  uint64_t folded;
+  uint64_t recovered;
+};
+
+}  // namespace aeras
+
+#endif
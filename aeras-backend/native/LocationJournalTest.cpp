@@ -0,0 +1,177 @@
+// AERAS location journal - behaviour tests
+//
+//   npm run build:native && npm run test:native
+//
+// Group commit folds each rickshaw's fixes to its latest, committed()
+// leaves rickshaws that moved after the drain dirty, a killed process's
+// uncommitted fixes are folded back in on the next open (and committed
+// ones are not), a torn record is skipped, and a fix the ring overwrites
+// before it is committed is counted as an overrun.
+
+#include <cstdio>
+#include <cstring>
+#include <fcntl.h>
+#include <string>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <vector>
+
+#include "LocationJournal.h"
+
+using namespace aeras;
+
+static int failures = 0;
+
+#define CHECK(condition)                                                     \
+  do {                                                                       \
+    if (!(condition)) {                                                      \
+      printf("  FAIL %s:%d  %s\n", __FILE__, __LINE__, #condition);          \
+      failures++;                                                            \
+    }                                                                        \
+  } while (0)
+
+static const char* JOURNAL_PATH = "location_journal_test.journal";
+
+static const Fix* find(const std::vector<Fix>& fixes, const char* rickshawID) {
+  for (const Fix& fix : fixes) {
+    if (fix.rickshawID == rickshawID) return &fix;
+  }
+  return nullptr;
+}
+
+static void testGroupCommitFoldsToLatest() {
+  remove(JOURNAL_PATH);
+  LocationJournal journal(JOURNAL_PATH, 64);
+  CHECK(journal.stats().mapped);
+
+  journal.append("R1", 22.4600, 91.9700, 1000);
+  journal.append("R2", 22.4700, 91.9800, 1100);
+  journal.append("R1", 22.4610, 91.9710, 1200);
+  CHECK(journal.pending() == 2);
+
+  std::vector<Fix> fixes;
+  uint64_t through = 0;
+  journal.drain(fixes, through);
+  CHECK(through == 3);
+  CHECK(fixes.size() == 2);
+  const Fix* r1 = find(fixes, "R1");
+  CHECK(r1 != nullptr && r1->lat == 22.4610 && r1->atMs == 1200);
+
+  // R2 moves while the transaction is out: it stays dirty for the next one
+  journal.append("R2", 22.4710, 91.9810, 1300);
+  journal.committed(through);
+  CHECK(journal.pending() == 1);
+  journal.drain(fixes, through);
+  CHECK(fixes.size() == 1 && fixes[0].rickshawID == "R2" && fixes[0].lat == 22.4710);
+  CHECK(through == 4);
+
+  // A stale or out-of-range commit changes nothing
+  journal.committed(2);
+  journal.committed(99);
+  CHECK(journal.pending() == 1 && journal.stats().committed == 3);
+
+  // Too long for the 24-byte slot: the caller writes it itself
+  CHECK(journal.append(std::string(LocationJournal::ID_MAX + 1, 'X'), 1, 1, 1) == 0);
+}
+
+static void testReplayAfterUncleanClose() {
+  remove(JOURNAL_PATH);
+
+  // Commit R1's first fix, then die with three fixes after it
+  pid_t child = fork();
+  if (child == 0) {
+    LocationJournal* journal = new LocationJournal(JOURNAL_PATH, 64);
+    journal->append("R1", 22.46, 91.97, 1000);
+    std::vector<Fix> fixes;
+    uint64_t through;
+    journal->drain(fixes, through);
+    journal->committed(through);
+    journal->append("R1", 22.47, 91.98, 2000);
+    journal->append("R2", 22.48, 91.99, 2100);
+    journal->append("R3", 22.49, 92.00, 2200);
+    _exit(0);   // No munmap, no msync: the pages already belong to the OS
+  }
+  int status = 0;
+  waitpid(child, &status, 0);
+  CHECK(WIFEXITED(status) && WEXITSTATUS(status) == 0);
+
+  // Tear R3's record as a crash mid-write would: its check no longer matches
+  int fd = open(JOURNAL_PATH, O_RDWR);
+  CHECK(fd >= 0);
+  double torn = 0;
+  CHECK(pwrite(fd, &torn, sizeof(torn), 64 + 4 * 64 + 16) == (ssize_t)sizeof(torn));
+  close(fd);
+
+  LocationJournal journal(JOURNAL_PATH, 64);
+  JournalStats stats = journal.stats();
+  CHECK(stats.committed == 1);
+  CHECK(stats.recovered == 2);
+
+  std::vector<Fix> fixes;
+  uint64_t through = 0;
+  journal.drain(fixes, through);
+  CHECK(fixes.size() == 2);
+  const Fix* r1 = find(fixes, "R1");
+  const Fix* r2 = find(fixes, "R2");
+  CHECK(r1 != nullptr && r1->lat == 22.47 && r1->atMs == 2000);
+  CHECK(r2 != nullptr && r2->lat == 22.48);
+  CHECK(find(fixes, "R3") == nullptr);
+
+  // Seqs carry on from the last intact record; the torn slot is reused
+  CHECK(through == 3);
+  CHECK(journal.append("R4", 22.50, 92.01, 3000) == 4);
+
+  // Once committed, a reopen has nothing to fold back in
+  journal.drain(fixes, through);
+  journal.committed(through);
+  LocationJournal reopened(JOURNAL_PATH, 64);
+  CHECK(reopened.stats().recovered == 0);
+  CHECK(reopened.pending() == 0);
+  Fix fix;
+  CHECK(!reopened.position("R1", fix));
+}
+
+static void testOverrunAccounting() {
+  remove(JOURNAL_PATH);
+  LocationJournal journal(JOURNAL_PATH, 64);
+
+  // A full ring of uncommitted fixes, then 10 more: each overwrites one
+  for (int i = 0; i < 64 + 10; i++) journal.append("R" + std::to_string(i % 8), 22.0 + i * 1e-4, 91.0, i);
+  CHECK(journal.stats().overruns == 10);
+
+  // Overwriting committed records is not an overrun
+  std::vector<Fix> fixes;
+  uint64_t through;
+  journal.drain(fixes, through);
+  journal.committed(through);
+  for (int i = 0; i < 64; i++) journal.append("R0", 23.0, 92.0, 1000 + i);
+  CHECK(journal.stats().overruns == 10);
+  CHECK(journal.stats().capacity == 64);
+
+  // A journal reopened with another capacity keeps the one it was made with
+  LocationJournal reopened(JOURNAL_PATH, 1024);
+  CHECK(reopened.stats().capacity == 64);
+  CHECK(reopened.stats().recovered == 1);
+  Fix fix;
+  CHECK(reopened.position("R0", fix) && fix.atMs == 1063);
+}
+
+int main() {
+  struct {
+    const char* name;
+    void (*run)();
+  } tests[] = {
+    { "group commit folds to latest", testGroupCommitFoldsToLatest },
+    { "replay after unclean close", testReplayAfterUncleanClose },
+    { "overrun accounting", testOverrunAccounting },
+  };
+
+  for (const auto& test : tests) {
+    int before = failures;
+    test.run();
+    printf("%s %s\n", failures == before ? "PASS" : "FAIL", test.name);
+  }
+  remove(JOURNAL_PATH);
+  printf("\n%s\n", failures == 0 ? "All location journal tests passed" : "Location journal tests FAILED");
+  return failures == 0 ? 0 : 1;
+}
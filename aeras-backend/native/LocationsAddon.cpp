@@ -0,0 +1,152 @@
+// AERAS location journal - Node binding (node-addon-api)
+//
+//   const { LocationJournal } = require('./native/build/Release/aeras_locations.node');
+//   const journal = new LocationJournal({ path: './aeras-locations.journal', capacity: 65536 });
+//   journal.append(rickshawID, lat, lng[, atMs])   -> seq, or 0 if not journaled
+//   journal.position(rickshawID)                   -> { lat, lng, at } or null
+//   journal.drain()       -> { through, fixes: [{ rickshawID, lat, lng, at }] }
+//   journal.committed(through)                     SQLite holds those fixes
+//   journal.stats()
+//
+// at is epoch milliseconds; append() stamps the current time when it is
+// left out.
+
+#include <napi.h>
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include "LocationJournal.h"
+
+static uint64_t epochMillis() {
+  return std::chrono::duration_cast<std::chrono::milliseconds>(
+           std::chrono::system_clock::now().time_since_epoch()).count();
+}
+
+class LocationJournalWrap : public Napi::ObjectWrap<LocationJournalWrap> {
+public:
+  static Napi::Object Init(Napi::Env env, Napi::Object exports) {
+    Napi::Function constructor = DefineClass(env, "LocationJournal", {
+      InstanceMethod("append", &LocationJournalWrap::Append),
+      InstanceMethod("position", &LocationJournalWrap::Position),
+      InstanceMethod("drain", &LocationJournalWrap::Drain),
+      InstanceMethod("committed", &LocationJournalWrap::Committed),
+      InstanceMethod("stats", &LocationJournalWrap::Stats),
+    });
+    exports.Set("LocationJournal", constructor);
+    return exports;
+  }
+
+  LocationJournalWrap(const Napi::CallbackInfo& info)
+    : Napi::ObjectWrap<LocationJournalWrap>(info),
+      journal(stringOption(info, "path", "aeras-locations.journal"),
+              (size_t)numberOption(info, "capacity", 1 << 16)) {}
+
+private:
+  static double numberOption(const Napi::CallbackInfo& info, const char* name, double fallback) {
+    if (info.Length() < 1 || !info[0].IsObject()) return fallback;
+    Napi::Value value = info[0].As<Napi::Object>().Get(name);
+    return value.IsNumber() ? value.As<Napi::Number>().DoubleValue() : fallback;
+  }
+
+  static std::string stringOption(const Napi::CallbackInfo& info, const char* name, const char* fallback) {
+    if (info.Length() < 1 || !info[0].IsObject()) return fallback;
+    Napi::Value value = info[0].As<Napi::Object>().Get(name);
+    return value.IsString() ? value.As<Napi::String>().Utf8Value() : fallback;
+  }
+
+  // false (and a pending TypeError) unless info[at] is a string
+  static bool stringArg(const Napi::CallbackInfo& info, size_t at, std::string& out) {
+    if (info.Length() <= at || !info[at].IsString()) {
+      Napi::TypeError::New(info.Env(), "expected a string at argument " + std::to_string(at))
+        .ThrowAsJavaScriptException();
+      return false;
+    }
+    out = info[at].As<Napi::String>().Utf8Value();
+    return true;
+  }
+
+  static bool numberArg(const Napi::CallbackInfo& info, size_t at, double& out) {
+    if (info.Length() <= at || !info[at].IsNumber()) {
+      Napi::TypeError::New(info.Env(), "expected a number at argument " + std::to_string(at))
+        .ThrowAsJavaScriptException();
+      return false;
+    }
+    out = info[at].As<Napi::Number>().DoubleValue();
+    return true;
+  }
+
+  static Napi::Object fixObject(Napi::Env env, const aeras::Fix& fix, bool withID) {
+    Napi::Object out = Napi::Object::New(env);
+    if (withID) out.Set("rickshawID", fix.rickshawID);
+    out.Set("lat", Napi::Number::New(env, fix.lat));
+    out.Set("lng", Napi::Number::New(env, fix.lng));
+    out.Set("at", Napi::Number::New(env, (double)fix.atMs));
+    return out;
+  }
+
+  Napi::Value Append(const Napi::CallbackInfo& info) {
+    std::string rickshawID;
+    double lat, lng;
+    if (!stringArg(info, 0, rickshawID) || !numberArg(info, 1, lat) || !numberArg(info, 2, lng)) {
+      return info.Env().Undefined();
+    }
+    uint64_t atMs = info.Length() > 3 && info[3].IsNumber() ? (uint64_t)info[3].As<Napi::Number>().DoubleValue()
+                                                            : epochMillis();
+    return Napi::Number::New(info.Env(), (double)journal.append(rickshawID, lat, lng, atMs));
+  }
+
+  Napi::Value Position(const Napi::CallbackInfo& info) {
+    std::string rickshawID;
+    if (!stringArg(info, 0, rickshawID)) return info.Env().Undefined();
+    aeras::Fix fix;
+    if (!journal.position(rickshawID, fix)) return info.Env().Null();
+    return fixObject(info.Env(), fix, false);
+  }
+
+  Napi::Value Drain(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    uint64_t through;
+    journal.drain(fixes, through);
+
+    Napi::Array list = Napi::Array::New(env, fixes.size());
+    for (size_t i = 0; i < fixes.size(); i++) list.Set((uint32_t)i, fixObject(env, fixes[i], true));
+    Napi::Object out = Napi::Object::New(env);
+    out.Set("through", Napi::Number::New(env, (double)through));
+    out.Set("fixes", list);
+    return out;
+  }
+
+  Napi::Value Committed(const Napi::CallbackInfo& info) {
+    double through;
+    if (!numberArg(info, 0, through)) return info.Env().Undefined();
+    journal.committed(through > 0 ? (uint64_t)through : 0);
+    return info.Env().Undefined();
+  }
+
+  Napi::Value Stats(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    aeras::JournalStats counters = journal.stats();
+    Napi::Object stats = Napi::Object::New(env);
+    stats.Set("mapped", Napi::Boolean::New(env, counters.mapped));
+    stats.Set("capacity", Napi::Number::New(env, (double)counters.capacity));
+    stats.Set("appended", Napi::Number::New(env, (double)counters.appended));
+    stats.Set("pending", Napi::Number::New(env, (double)journal.pending()));
+    stats.Set("overruns", Napi::Number::New(env, (double)counters.overruns));
+    stats.Set("commits", Napi::Number::New(env, (double)counters.commits));
+    stats.Set("folded", Napi::Number::New(env, (double)counters.folded));
+    stats.Set("recovered", Napi::Number::New(env, (double)counters.recovered));
+    stats.Set("committed", Napi::Number::New(env, (double)counters.committed));
+    return stats;
+  }
+
+  aeras::LocationJournal journal;
+  std::vector<aeras::Fix> fixes;   // Reused across drain() calls
+};
+
+static Napi::Object Init(Napi::Env env, Napi::Object exports) {
+  return LocationJournalWrap::Init(env, exports);
+}
+
+NODE_API_MODULE(aeras_locations, Init)
@@ -0,0 +1,124 @@
+// AERAS ride state table - multi-threaded first-accept contention benchmark
+//
+//   npm run build:native && npm run bench:rides [-- rides maxThreads]
+//
+// Every thread tries to accept every ride, in the same order, so each ride
+// is fought over by all threads at once: the worst case of a burst of
+// pullers on one block. Checks that each ride has exactly one winner and
+// reports accept attempts per second for the CAS table, the same table
+// with winners appended to the write-behind log, and a std::mutex +
+// unordered_map baseline.
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "RideStateTable.h"
+#include "WriteBehindLog.h"
+
+using namespace aeras;
+
+// Mutex-guarded map with the same accept semantics
+class LockedTable {
+public:
+  void insert(uint32_t rideID) { rides[rideID] = Entry{ STATE_PENDING, 0 }; }
+
+  bool accept(uint32_t rideID, uint32_t owner) {
+    std::lock_guard<std::mutex> guard(lock);
+    auto found = rides.find(rideID);
+    if (found == rides.end() || found->second.state != STATE_PENDING) return false;
+    found->second = Entry{ STATE_ACCEPTED, owner };
+    return true;
+  }
+
+private:
+  struct Entry {
+    RideState state;
+    uint32_t owner;
+  };
+  std::mutex lock;
+  std::unordered_map<uint32_t, Entry> rides;
+};
+
+// Runs accept(ride, thread) for every ride on every thread; returns total wins
+static uint64_t race(unsigned threads, uint32_t rides, double& seconds,
+                     const std::function<bool(uint32_t, uint32_t)>& accept) {
+  std::vector<uint64_t> wins(threads * 8, 0);  // One cache line per thread
+  std::vector<std::thread> pool;
+  auto start = std::chrono::steady_clock::now();
+  for (unsigned t = 0; t < threads; t++) {
+    pool.emplace_back([&, t]() {
+      uint64_t won = 0;
+      for (uint32_t ride = 1; ride <= rides; ride++) {
+        if (accept(ride, t + 1)) won++;
+      }
+      wins[t * 8] = won;
+    });
+  }
+  for (std::thread& thread : pool) thread.join();
+  seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+  uint64_t total = 0;
+  for (unsigned t = 0; t < threads; t++) total += wins[t * 8];
+  return total;
+}
+
+static void report(const char* label, unsigned threads, uint32_t rides, uint64_t wins, double seconds) {
+  double attempts = (double)threads * rides;
+  printf("%-16s %2u threads  %8.1f M accepts/s  %7.1f ns/accept  %s\n", label, threads,
+         attempts / seconds / 1e6, seconds * 1e9 / attempts, wins == rides ? "one winner each" : "WINNERS WRONG");
+}
+
+int main(int argc, char** argv) {
+  uint32_t rides = argc > 1 ? (uint32_t)atoi(argv[1]) : 200000;
+  unsigned maxThreads = argc > 2 ? (unsigned)atoi(argv[2]) : std::thread::hardware_concurrency();
+  if (maxThreads < 4) maxThreads = 4;
+
+  printf("%u rides, every thread accepts every ride\n\n", rides);
+  bool allCorrect = true;
+
+  for (unsigned threads = 1; threads <= maxThreads; threads *= 2) {
+    double seconds;
+    uint64_t wins;
+
+    RideStateTable table(rides * 2);
+    for (uint32_t ride = 1; ride <= rides; ride++) table.insert(ride, STATE_PENDING);
+    wins = race(threads, rides, seconds, [&](uint32_t ride, uint32_t owner) {
+      return table.accept(ride, owner).outcome == OUTCOME_WON;
+    });
+    report("cas", threads, rides, wins, seconds);
+    allCorrect &= wins == rides;
+
+    RideStateTable logged(rides * 2);
+    for (uint32_t ride = 1; ride <= rides; ride++) logged.insert(ride, STATE_PENDING);
+    {
+      WriteBehindLog log("ride_state_bench.log");
+      wins = race(threads, rides, seconds, [&](uint32_t ride, uint32_t owner) {
+        if (logged.accept(ride, owner).outcome != OUTCOME_WON) return false;
+        log.append(std::to_string(ride) + " ACCEPTED R" + std::to_string(owner) + " 0");
+        return true;
+      });
+      LogStats stats = log.stats();
+      log.applied(stats.appended);
+      report("cas + log", threads, rides, wins, seconds);
+      printf("%-16s %llu records in %llu synced batches\n", "", (unsigned long long)stats.appended,
+             (unsigned long long)stats.batches);
+    }
+    allCorrect &= wins == rides;
+
+    LockedTable locked;
+    for (uint32_t ride = 1; ride <= rides; ride++) locked.insert(ride);
+    wins = race(threads, rides, seconds, [&](uint32_t ride, uint32_t owner) { return locked.accept(ride, owner); });
+    report("mutex + map", threads, rides, wins, seconds);
+    allCorrect &= wins == rides;
+    printf("\n");
+  }
+
+  remove("ride_state_bench.log");
+  return allCorrect ? 0 : 1;
+}
@@ -0,0 +1,90 @@
+// AERAS ride state table - lock-free first-accept-wins
+
+#include "RideStateTable.h"
+
+namespace aeras {
+
+RideStateTable::RideStateTable(size_t capacity)
+  : mask(0) {
+  size_t size = 1;
+  while (size < capacity) size <<= 1;
+  slots.reset(new std::atomic<uint64_t>[size]);
+  for (size_t i = 0; i < size; i++) slots[i].store(0, std::memory_order_relaxed);
+  mask = size - 1;
+}
+
+// ===== Single writer =====
+
+bool RideStateTable::insert(uint32_t rideID, RideState state, uint32_t owner) {
+  if (rideID == 0) return false;
+  uint64_t word = pack(rideID, owner, state);
+
+  // The ride may already sit further along, past a closed slot
+  std::atomic<uint64_t>* free = nullptr;
+  for (size_t i = 0; i < MAX_PROBE; i++) {
+    std::atomic<uint64_t>& slot = slots[(rideID + i) & mask];
+    uint64_t current = slot.load(std::memory_order_acquire);
+    if (current != 0 && rideOf(current) == rideID) {
+      while (!slot.compare_exchange_weak(current, word, std::memory_order_acq_rel)) {}
+      return true;
+    }
+    if (current == 0) {
+      if (free == nullptr) free = &slot;
+      break;                       // Nothing lies past an empty slot
+    }
+    if (stateOf(current) == STATE_CLOSED && free == nullptr) free = &slot;
+  }
+  if (free == nullptr) return false;
+
+  // Closed and empty words only change here, so this cannot race
+  free->store(word, std::memory_order_release);
+  return true;
+}
+
+bool RideStateTable::close(uint32_t rideID) {
+  Transition closed = transition(rideID, 0xFF, STATE_CLOSED, 0, KEEP_OWNER);
+  return closed.outcome == OUTCOME_WON;
+}
+
+// ===== Any thread =====
+
+Transition RideStateTable::transition(uint32_t rideID, uint8_t fromMask, RideState to,
+                                      uint32_t requiredOwner, uint32_t newOwner) {
+  for (size_t i = 0; i < MAX_PROBE; i++) {
+    std::atomic<uint64_t>& slot = slots[(rideID + i) & mask];
+    uint64_t current = slot.load(std::memory_order_acquire);
+    if (current == 0) break;
+
+    // A failed CAS reloads current; if the slot was reused meanwhile the
+    // ride is no longer here and the probe moves on
+    while (rideOf(current) == rideID) {
+      RideState state = stateOf(current);
+      uint32_t owner = ownerOf(current);
+      if (!(fromMask & stateBit(state)) || (requiredOwner != 0 && owner != requiredOwner)) {
+        return Transition{ OUTCOME_LOST, state, owner };
+      }
+
+      uint32_t nextOwner = newOwner == KEEP_OWNER ? owner : newOwner;
+      if (slot.compare_exchange_weak(current, pack(rideID, nextOwner, to), std::memory_order_acq_rel,
+                                     std::memory_order_acquire)) {
+        return Transition{ OUTCOME_WON, to, nextOwner & OWNER_MAX };
+      }
+    }
+  }
+  return Transition{ OUTCOME_UNKNOWN, STATE_EMPTY, 0 };
+}
+
+bool RideStateTable::lookup(uint32_t rideID, RideState& state, uint32_t& owner) const {
+  for (size_t i = 0; i < MAX_PROBE; i++) {
+    uint64_t current = slots[(rideID + i) & mask].load(std::memory_order_acquire);
+    if (current == 0) break;
+    if (rideOf(current) == rideID) {
+      state = stateOf(current);
+      owner = ownerOf(current);
+      return true;
+    }
+  }
+  return false;
+}
+
+}  // namespace aeras
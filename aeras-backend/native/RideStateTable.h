@@ -0,0 +1,101 @@
+// AERAS ride state table - lock-free first-accept-wins
+//
+// /api/ride/accept used to decide a race with a SQLite BEGIN / SELECT /
+// UPDATE / COMMIT chain, so a burst of pullers on one popular block queued
+// behind the database. Here every live ride is one 64-bit atomic word:
+//
+//   rideID (32) | owner (24) | state (8)
+//
+// and each transition (PENDING -> ACCEPTED -> PICKUP, a timeout, a cancel
+// back to PENDING) is a single compare-and-swap on that word. Exactly one
+// caller wins; the rest learn the state that beat them. Persisting the
+// winner is the caller's job (WriteBehindLog, then SQLite).
+//
+// Open addressing with linear probing over a power-of-two array. The home
+// slot is rideID & mask: rideIDs are sequential, so live rides sit in
+// consecutive slots and probes stay short. Slots are never emptied, only
+// closed; a closed slot is reused by the next ride whose probe reaches it,
+// which keeps every probe chain intact without tombstones. A ride that is
+// not found within MAX_PROBE slots reads as unknown, and the caller falls
+// back to the database.
+//
+// Owners are small numbers (1..OWNER_MAX) the caller maps rickshaw IDs to;
+// 0 is "no owner". insert() and close() are for a single writer (the JS
+// thread); lookup() and transition() are safe from any thread.
+
+#ifndef AERAS_RIDE_STATE_TABLE_H
+#define AERAS_RIDE_STATE_TABLE_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace aeras {
+
+enum RideState : uint8_t {
+  STATE_EMPTY = 0,
+  STATE_PENDING,
+  STATE_ACCEPTED,
+  STATE_PICKUP,
+  STATE_CLOSED          // Completed, timed out or under review: the slot is free
+};
+
+inline uint8_t stateBit(RideState state) { return (uint8_t)(1u << state); }
+
+enum Outcome {
+  OUTCOME_WON,          // This call made the transition
+  OUTCOME_LOST,         // The ride is in another state (or another owner's)
+  OUTCOME_UNKNOWN       // Not in the table
+};
+
+struct Transition {
+  Outcome outcome;
+  RideState state;      // After the transition if won, as found if lost
+  uint32_t owner;
+};
+
+class RideStateTable {
+public:
+  static const uint32_t OWNER_MAX = 0xFFFFFF;
+  static const uint32_t KEEP_OWNER = 0xFFFFFFFF;
+  static const size_t MAX_PROBE = 64;
+
+  // capacity is rounded up to a power of two
+  explicit RideStateTable(size_t capacity = 1 << 16);
+
+  // Add (or overwrite) a live ride; false if no slot is free in its probe range
+  bool insert(uint32_t rideID, RideState state, uint32_t owner = 0);
+  // Mark a ride closed whatever its state; false if it was not in the table
+  bool close(uint32_t rideID);
+
+  // One CAS: move the ride to `to` if its state is in fromMask (stateBit()
+  // values) and, when requiredOwner != 0, it belongs to requiredOwner.
+  // newOwner replaces the owner unless it is KEEP_OWNER.
+  Transition transition(uint32_t rideID, uint8_t fromMask, RideState to, uint32_t requiredOwner,
+                        uint32_t newOwner);
+
+  // PENDING -> ACCEPTED by owner
+  Transition accept(uint32_t rideID, uint32_t owner) {
+    return transition(rideID, stateBit(STATE_PENDING), STATE_ACCEPTED, 0, owner);
+  }
+
+  bool lookup(uint32_t rideID, RideState& state, uint32_t& owner) const;
+
+  size_t capacity() const { return mask + 1; }
+
+private:
+  static uint64_t pack(uint32_t rideID, uint32_t owner, RideState state) {
+    return ((uint64_t)rideID << 32) | ((uint64_t)(owner & OWNER_MAX) << 8) | state;
+  }
+  static uint32_t rideOf(uint64_t word) { return (uint32_t)(word >> 32); }
+  static uint32_t ownerOf(uint64_t word) { return (uint32_t)(word >> 8) & OWNER_MAX; }
+  static RideState stateOf(uint64_t word) { return (RideState)(word & 0xFF); }
+
+  std::unique_ptr<std::atomic<uint64_t>[]> slots;
+  size_t mask;
+};
+
+}  // namespace aeras
+
+#endif
@@ -0,0 +1,246 @@
+// AERAS ride state table and write-behind log - behaviour tests
+//
+//   npm run build:native && npm run test:native
+//
+// The CAS outcomes every /api/ride endpoint relies on, and the log's
+// crash-recovery contract: records a killed process synced are still in
+// the file for the next start to replay, the file is truncated only once
+// applied() covers everything written, and a batch the disk refuses is
+// never reported durable.
+
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <functional>
+#include <string>
+#include <sys/wait.h>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+#include "RideStateTable.h"
+#include "WriteBehindLog.h"
+
+using namespace aeras;
+
+static int failures = 0;
+
+#define CHECK(condition)                                                     \
+  do {                                                                       \
+    if (!(condition)) {                                                      \
+      printf("  FAIL %s:%d  %s\n", __FILE__, __LINE__, #condition);          \
+      failures++;                                                            \
+    }                                                                        \
+  } while (0)
+
+static const char* LOG_PATH = "ride_state_test.log";
+
+static std::vector<std::string> logLines() {
+  std::vector<std::string> lines;
+  std::ifstream file(LOG_PATH);
+  std::string line;
+  while (std::getline(file, line)) lines.push_back(line);
+  return lines;
+}
+
+// The writer is asynchronous: poll its stats for up to a second
+static bool waitFor(WriteBehindLog& log, const std::function<bool(const LogStats&)>& done) {
+  for (int i = 0; i < 200; i++) {
+    if (done(log.stats())) return true;
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+  }
+  return false;
+}
+
+// ===== RideStateTable =====
+
+static void testAcceptOutcomes() {
+  RideStateTable table(64);
+  CHECK(table.insert(7, STATE_PENDING));
+
+  Transition first = table.accept(7, 1);
+  CHECK(first.outcome == OUTCOME_WON);
+  CHECK(first.state == STATE_ACCEPTED && first.owner == 1);
+
+  // The loser learns who beat it, which lets the owner's retry succeed
+  Transition second = table.accept(7, 2);
+  CHECK(second.outcome == OUTCOME_LOST);
+  CHECK(second.state == STATE_ACCEPTED && second.owner == 1);
+
+  CHECK(table.accept(8, 1).outcome == OUTCOME_UNKNOWN);
+}
+
+static void testPickupReleaseAndClose() {
+  RideStateTable table(64);
+  table.insert(3, STATE_PENDING);
+
+  // Pickup needs ACCEPTED
+  CHECK(table.transition(3, stateBit(STATE_ACCEPTED), STATE_PICKUP, 0, RideStateTable::KEEP_OWNER).outcome ==
+        OUTCOME_LOST);
+  table.accept(3, 5);
+  Transition pickup = table.transition(3, stateBit(STATE_ACCEPTED), STATE_PICKUP, 0, RideStateTable::KEEP_OWNER);
+  CHECK(pickup.outcome == OUTCOME_WON && pickup.state == STATE_PICKUP && pickup.owner == 5);
+
+  // Only the owner puts it back on offer
+  uint8_t held = stateBit(STATE_ACCEPTED) | stateBit(STATE_PICKUP);
+  CHECK(table.transition(3, held, STATE_PENDING, 6, 0).outcome == OUTCOME_LOST);
+  Transition released = table.transition(3, held, STATE_PENDING, 5, 0);
+  CHECK(released.outcome == OUTCOME_WON && released.state == STATE_PENDING && released.owner == 0);
+
+  // An expiry racing a late accept: whichever CAS lands first wins
+  CHECK(table.transition(3, stateBit(STATE_PENDING), STATE_CLOSED, 0, RideStateTable::KEEP_OWNER).outcome ==
+        OUTCOME_WON);
+  Transition late = table.accept(3, 6);
+  CHECK(late.outcome == OUTCOME_LOST && late.state == STATE_CLOSED);
+
+  CHECK(table.close(3));
+  RideState state;
+  uint32_t owner;
+  CHECK(table.lookup(3, state, owner) && state == STATE_CLOSED);
+}
+
+static void testClosedSlotsReused() {
+  // 64 slots: ride 65 homes onto ride 1's slot and probes past it
+  RideStateTable table(64);
+  table.insert(1, STATE_PENDING);
+  table.insert(65, STATE_PENDING);
+  CHECK(table.accept(65, 2).outcome == OUTCOME_WON);
+
+  // Closing 1 must not cut 65's probe chain; 129 takes the closed slot
+  CHECK(table.close(1));
+  CHECK(table.accept(65, 3).outcome == OUTCOME_LOST);
+  CHECK(table.insert(129, STATE_PENDING));
+  RideState state;
+  uint32_t owner;
+  CHECK(!table.lookup(1, state, owner));
+  CHECK(table.lookup(65, state, owner) && state == STATE_ACCEPTED && owner == 2);
+  CHECK(table.accept(129, 4).outcome == OUTCOME_WON);
+}
+
+static void testOneWinnerUnderContention() {
+  const uint32_t rides = 20000;
+  const unsigned threads = 8;
+  RideStateTable table(rides * 2);
+  for (uint32_t ride = 1; ride <= rides; ride++) table.insert(ride, STATE_PENDING);
+
+  std::vector<uint32_t> winners(rides + 1, 0);
+  std::vector<std::thread> pool;
+  for (unsigned t = 1; t <= threads; t++) {
+    pool.emplace_back([&, t]() {
+      for (uint32_t ride = 1; ride <= rides; ride++) {
+        if (table.accept(ride, t).outcome == OUTCOME_WON) winners[ride] = t;
+      }
+    });
+  }
+  for (std::thread& thread : pool) thread.join();
+
+  uint32_t wrong = 0;
+  for (uint32_t ride = 1; ride <= rides; ride++) {
+    RideState state;
+    uint32_t owner;
+    if (!table.lookup(ride, state, owner) || state != STATE_ACCEPTED || owner != winners[ride]) wrong++;
+  }
+  CHECK(wrong == 0);
+}
+
+// ===== WriteBehindLog =====
+
+static void testTruncatesOnlyAfterApply() {
+  remove(LOG_PATH);
+  WriteBehindLog log(LOG_PATH);
+  CHECK(log.ok());
+  CHECK(log.append("{\"rideID\":1}") == 1);
+  CHECK(log.append("{\"rideID\":2}") == 2);
+  CHECK(log.append("{\"rideID\":3}") == 3);
+  CHECK(waitFor(log, [](const LogStats& s) { return s.durable == 3; }));
+  CHECK(logLines().size() == 3);
+
+  // Two of three in SQLite: the file must keep all of them
+  log.applied(2);
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  CHECK(log.stats().truncations == 0);
+  CHECK(logLines().size() == 3);
+
+  log.applied(3);
+  CHECK(waitFor(log, [](const LogStats& s) { return s.truncations == 1; }));
+  CHECK(logLines().empty());
+
+  // A newer record keeps the file until it is applied too
+  CHECK(log.append("{\"rideID\":4}") == 4);
+  CHECK(waitFor(log, [](const LogStats& s) { return s.durable == 4; }));
+  CHECK(log.stats().truncations == 1);
+  CHECK(logLines().size() == 1);
+  log.applied(4);
+  CHECK(waitFor(log, [](const LogStats& s) { return s.truncations == 2; }));
+}
+
+static void testReplayAfterUncleanClose() {
+  remove(LOG_PATH);
+
+  // A server killed after its records were synced but before SQLite had them
+  pid_t child = fork();
+  if (child == 0) {
+    WriteBehindLog* log = new WriteBehindLog(LOG_PATH);
+    log->append("{\"rideID\":10,\"status\":\"ACCEPTED\"}");
+    log->append("{\"rideID\":11,\"status\":\"PICKUP\"}");
+    bool synced = waitFor(*log, [](const LogStats& s) { return s.durable == 2; });
+    _exit(synced ? 0 : 1);   // No destructor, no applied()
+  }
+  int status = 0;
+  waitpid(child, &status, 0);
+  CHECK(WIFEXITED(status) && WEXITSTATUS(status) == 0);
+
+  std::vector<std::string> lines = logLines();
+  CHECK(lines.size() == 2);
+  CHECK(lines.size() == 2 && lines[0] == "1 {\"rideID\":10,\"status\":\"ACCEPTED\"}");
+  CHECK(lines.size() == 2 && lines[1] == "2 {\"rideID\":11,\"status\":\"PICKUP\"}");
+
+  // The next start reopens for appending and relogs what it replays; the
+  // old records stay until the relogged ones are applied
+  WriteBehindLog log(LOG_PATH);
+  CHECK(log.append("{\"rideID\":10,\"status\":\"ACCEPTED\"}") == 1);
+  CHECK(log.append("{\"rideID\":11,\"status\":\"PICKUP\"}") == 2);
+  CHECK(waitFor(log, [](const LogStats& s) { return s.durable == 2; }));
+  CHECK(logLines().size() == 4);
+  log.applied(1);
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  CHECK(logLines().size() == 4);
+  log.applied(2);
+  CHECK(waitFor(log, [](const LogStats& s) { return s.truncations == 1; }));
+  CHECK(logLines().empty());
+}
+
+static void testFailedWriteNeverDurable() {
+  // Every write to /dev/full fails with ENOSPC
+  WriteBehindLog log("/dev/full");
+  if (!log.ok()) return;
+  CHECK(log.append("{\"rideID\":1}") == 1);
+  CHECK(waitFor(log, [](const LogStats& s) { return s.failures >= 2; }));  // Retried
+  LogStats stats = log.stats();
+  CHECK(stats.durable == 0);
+  CHECK(stats.batches == 0);
+}
+
+int main() {
+  struct {
+    const char* name;
+    void (*run)();
+  } tests[] = {
+    { "accept outcomes", testAcceptOutcomes },
+    { "pickup, release and close", testPickupReleaseAndClose },
+    { "closed slots reused", testClosedSlotsReused },
+    { "one winner under contention", testOneWinnerUnderContention },
+    { "log truncates only after apply", testTruncatesOnlyAfterApply },
+    { "log replay after unclean close", testReplayAfterUncleanClose },
+    { "failed write never durable", testFailedWriteNeverDurable },
+  };
+
+  for (const auto& test : tests) {
+    int before = failures;
+    test.run();
+    printf("%s %s\n", failures == before ? "PASS" : "FAIL", test.name);
+  }
+  remove(LOG_PATH);
+  printf("\n%s\n", failures == 0 ? "All ride state tests passed" : "Ride state tests FAILED");
+  return failures == 0 ? 0 : 1;
+}
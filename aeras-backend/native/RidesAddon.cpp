@@ -0,0 +1,367 @@
+// AERAS ride state table and deadlines - Node binding (node-addon-api)
+//
+//   const { RideStates } = require('./native/build/Release/aeras_rides.node');
+//   const rides = new RideStates({ capacity: 65536, logPath: './aeras-rides.log' });
+//   rides.insert(rideID, 'PENDING');
+//   rides.accept(rideID, rickshawID)    PENDING -> ACCEPTED
+//   rides.pickup(rideID)                ACCEPTED -> PICKUP
+//   rides.expire(rideID)                PENDING -> closed (TIMEOUT)
+//   rides.release(rideID, rickshawID)   ACCEPTED/PICKUP -> PENDING, owner only
+//     -> { outcome: 'won' | 'lost' | 'unknown', status, rickshawID, seq }
+//   rides.close(rideID)                 any -> closed (completed, reviewed)
+//   rides.get(rideID)                   -> { status, rickshawID } or null
+//   rides.applied(seq)                  SQLite holds every record up to seq
+//   rides.relog(record)                 -> seq; re-append a record replayed at start
+//   rides.stats()
+//
+// A won transition is appended to the write-behind log before it returns;
+// seq is that record (0 if the log is not open). Records are one-line JSON,
+// since a rickshaw ID may hold any character:
+//
+//   <seq> {"rideID":N,"status":"ACCEPTED","rickshawID":"R1","at":ms}
+//
+//   const deadlines = new RideDeadlines({ tickMs: 1000, slots: 128 });
+//   deadlines.schedule(rideID, dueMs);  deadlines.cancel(rideID);
+//   deadlines.advance(Date.now())       -> [rideID] that came due
+
+#include <napi.h>
+
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "RideStateTable.h"
+#include "TimerWheel.h"
+#include "WriteBehindLog.h"
+
+using aeras::RideState;
+using aeras::RideStateTable;
+using aeras::Transition;
+
+static const char* STATE_NAMES[] = { "NONE", "PENDING", "ACCEPTED", "PICKUP", "CLOSED" };
+
+static bool parseState(const std::string& name, RideState& state) {
+  for (uint8_t i = aeras::STATE_PENDING; i <= aeras::STATE_CLOSED; i++) {
+    if (name == STATE_NAMES[i]) {
+      state = (RideState)i;
+      return true;
+    }
+  }
+  return false;
+}
+
+// JSON string literal; control characters are escaped so a record stays one line
+static std::string jsonString(const std::string& text) {
+  std::string out = "\"";
+  for (unsigned char c : text) {
+    if (c == '"' || c == '\\') {
+      out += '\\';
+      out += (char)c;
+    } else if (c < 0x20) {
+      char escaped[8];
+      snprintf(escaped, sizeof(escaped), "\\u%04x", c);
+      out += escaped;
+    } else {
+      out += (char)c;
+    }
+  }
+  return out + "\"";
+}
+
+static uint64_t epochMillis() {
+  return std::chrono::duration_cast<std::chrono::milliseconds>(
+           std::chrono::system_clock::now().time_since_epoch()).count();
+}
+
+class RideStatesWrap : public Napi::ObjectWrap<RideStatesWrap> {
+public:
+  static Napi::Object Init(Napi::Env env, Napi::Object exports) {
+    Napi::Function constructor = DefineClass(env, "RideStates", {
+      InstanceMethod("insert", &RideStatesWrap::Insert),
+      InstanceMethod("accept", &RideStatesWrap::Accept),
+      InstanceMethod("pickup", &RideStatesWrap::Pickup),
+      InstanceMethod("expire", &RideStatesWrap::Expire),
+      InstanceMethod("release", &RideStatesWrap::Release),
+      InstanceMethod("close", &RideStatesWrap::Close),
+      InstanceMethod("get", &RideStatesWrap::Get),
+      InstanceMethod("applied", &RideStatesWrap::Applied),
+      InstanceMethod("relog", &RideStatesWrap::Relog),
+      InstanceMethod("stats", &RideStatesWrap::Stats),
+    });
+    exports.Set("RideStates", constructor);
+    return exports;
+  }
+
+  RideStatesWrap(const Napi::CallbackInfo& info)
+    : Napi::ObjectWrap<RideStatesWrap>(info),
+      table((size_t)numberOption(info, "capacity", 1 << 16)),
+      log(stringOption(info, "logPath", "aeras-rides.log")),
+      owners(1, std::string()),
+      wins(0),
+      losses(0),
+      unknown(0) {}
+
+private:
+  static double numberOption(const Napi::CallbackInfo& info, const char* name, double fallback) {
+    if (info.Length() < 1 || !info[0].IsObject()) return fallback;
+    Napi::Value value = info[0].As<Napi::Object>().Get(name);
+    return value.IsNumber() ? value.As<Napi::Number>().DoubleValue() : fallback;
+  }
+
+  static std::string stringOption(const Napi::CallbackInfo& info, const char* name, const char* fallback) {
+    if (info.Length() < 1 || !info[0].IsObject()) return fallback;
+    Napi::Value value = info[0].As<Napi::Object>().Get(name);
+    return value.IsString() ? value.As<Napi::String>().Utf8Value() : fallback;
+  }
+
+  // false (and a pending TypeError) unless info[at] is a positive ride ID
+  static bool rideArg(const Napi::CallbackInfo& info, size_t at, uint32_t& rideID) {
+    double value = info.Length() > at && info[at].IsNumber() ? info[at].As<Napi::Number>().DoubleValue() : 0;
+    if (value < 1 || value > 0xFFFFFFFF) {
+      Napi::TypeError::New(info.Env(), "expected a ride ID at argument " + std::to_string(at))
+        .ThrowAsJavaScriptException();
+      return false;
+    }
+    rideID = (uint32_t)value;
+    return true;
+  }
+
+  static bool stringArg(const Napi::CallbackInfo& info, size_t at, std::string& out) {
+    if (info.Length() <= at || !info[at].IsString()) {
+      Napi::TypeError::New(info.Env(), "expected a string at argument " + std::to_string(at))
+        .ThrowAsJavaScriptException();
+      return false;
+    }
+    out = info[at].As<Napi::String>().Utf8Value();
+    return true;
+  }
+
+  // Rickshaw ID -> owner number, assigned on first sight; 0 once the table's
+  // owner field is exhausted (callers then fall back to the database)
+  uint32_t ownerOf(const std::string& rickshawID) {
+    auto found = ownerIDs.find(rickshawID);
+    if (found != ownerIDs.end()) return found->second;
+    if (owners.size() > RideStateTable::OWNER_MAX) return 0;
+    uint32_t owner = (uint32_t)owners.size();
+    owners.push_back(rickshawID);
+    ownerIDs[rickshawID] = owner;
+    return owner;
+  }
+
+  Napi::Value result(Napi::Env env, uint32_t rideID, const Transition& done, const char* record) {
+    Napi::Object out = Napi::Object::New(env);
+    uint64_t seq = 0;
+    if (done.outcome == aeras::OUTCOME_WON) {
+      wins++;
+      const std::string& rickshawID = owners[done.owner];
+      seq = log.append("{\"rideID\":" + std::to_string(rideID) + ",\"status\":\"" + record +
+                       "\",\"rickshawID\":" + (rickshawID.empty() ? "null" : jsonString(rickshawID)) +
+                       ",\"at\":" + std::to_string(epochMillis()) + "}");
+      out.Set("outcome", "won");
+    } else if (done.outcome == aeras::OUTCOME_LOST) {
+      losses++;
+      out.Set("outcome", "lost");
+    } else {
+      unknown++;
+      out.Set("outcome", "unknown");
+      return out;
+    }
+    out.Set("status", STATE_NAMES[done.state]);
+    out.Set("rickshawID", done.owner != 0 ? Napi::Value(Napi::String::New(env, owners[done.owner])) : env.Null());
+    out.Set("seq", Napi::Number::New(env, (double)seq));
+    return out;
+  }
+
+  Napi::Value Insert(const Napi::CallbackInfo& info) {
+    uint32_t rideID;
+    std::string name;
+    RideState state;
+    if (!rideArg(info, 0, rideID) || !stringArg(info, 1, name)) return info.Env().Undefined();
+    if (!parseState(name, state)) {
+      Napi::TypeError::New(info.Env(), "unknown ride state " + name).ThrowAsJavaScriptException();
+      return info.Env().Undefined();
+    }
+    uint32_t owner = info.Length() > 2 && info[2].IsString() ? ownerOf(info[2].As<Napi::String>().Utf8Value()) : 0;
+    return Napi::Boolean::New(info.Env(), table.insert(rideID, state, owner));
+  }
+
+  Napi::Value Accept(const Napi::CallbackInfo& info) {
+    uint32_t rideID;
+    std::string rickshawID;
+    if (!rideArg(info, 0, rideID) || !stringArg(info, 1, rickshawID)) return info.Env().Undefined();
+    uint32_t owner = ownerOf(rickshawID);
+    if (owner == 0) return result(info.Env(), rideID, Transition{ aeras::OUTCOME_UNKNOWN, aeras::STATE_EMPTY, 0 }, "");
+    return result(info.Env(), rideID, table.accept(rideID, owner), "ACCEPTED");
+  }
+
+  Napi::Value Pickup(const Napi::CallbackInfo& info) {
+    uint32_t rideID;
+    if (!rideArg(info, 0, rideID)) return info.Env().Undefined();
+    Transition done = table.transition(rideID, aeras::stateBit(aeras::STATE_ACCEPTED), aeras::STATE_PICKUP, 0,
+                                       RideStateTable::KEEP_OWNER);
+    return result(info.Env(), rideID, done, "PICKUP");
+  }
+
+  Napi::Value Expire(const Napi::CallbackInfo& info) {
+    uint32_t rideID;
+    if (!rideArg(info, 0, rideID)) return info.Env().Undefined();
+    Transition done = table.transition(rideID, aeras::stateBit(aeras::STATE_PENDING), aeras::STATE_CLOSED, 0,
+                                       RideStateTable::KEEP_OWNER);
+    return result(info.Env(), rideID, done, "TIMEOUT");
+  }
+
+  Napi::Value Release(const Napi::CallbackInfo& info) {
+    uint32_t rideID;
+    std::string rickshawID;
+    if (!rideArg(info, 0, rideID) || !stringArg(info, 1, rickshawID)) return info.Env().Undefined();
+    uint32_t owner = ownerOf(rickshawID);
+    if (owner == 0) return result(info.Env(), rideID, Transition{ aeras::OUTCOME_UNKNOWN, aeras::STATE_EMPTY, 0 }, "");
+    Transition done = table.transition(rideID, aeras::stateBit(aeras::STATE_ACCEPTED) | aeras::stateBit(aeras::STATE_PICKUP),
+                                       aeras::STATE_PENDING, owner, 0);
+    // The record names who released it; the row still holds that rickshaw
+    if (done.outcome == aeras::OUTCOME_WON) done.owner = owner;
+    Napi::Value out = result(info.Env(), rideID, done, "PENDING");
+    if (done.outcome == aeras::OUTCOME_WON) out.As<Napi::Object>().Set("rickshawID", info.Env().Null());
+    return out;
+  }
+
+  Napi::Value Close(const Napi::CallbackInfo& info) {
+    uint32_t rideID;
+    if (!rideArg(info, 0, rideID)) return info.Env().Undefined();
+    return Napi::Boolean::New(info.Env(), table.close(rideID));
+  }
+
+  Napi::Value Get(const Napi::CallbackInfo& info) {
+    uint32_t rideID;
+    if (!rideArg(info, 0, rideID)) return info.Env().Undefined();
+    RideState state;
+    uint32_t owner;
+    if (!table.lookup(rideID, state, owner)) return info.Env().Null();
+    Napi::Object out = Napi::Object::New(info.Env());
+    out.Set("status", STATE_NAMES[state]);
+    out.Set("rickshawID", owner != 0 ? Napi::Value(Napi::String::New(info.Env(), owners[owner])) : info.Env().Null());
+    return out;
+  }
+
+  Napi::Value Applied(const Napi::CallbackInfo& info) {
+    if (info.Length() > 0 && info[0].IsNumber()) log.applied((uint64_t)info[0].As<Napi::Number>().DoubleValue());
+    return info.Env().Undefined();
+  }
+
+  // A replayed record gets a fresh seq, so the log cannot truncate it away
+  // while SQLite still lacks it
+  Napi::Value Relog(const Napi::CallbackInfo& info) {
+    std::string record;
+    if (!stringArg(info, 0, record)) return info.Env().Undefined();
+    return Napi::Number::New(info.Env(), (double)log.append(record));
+  }
+
+  Napi::Value Stats(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    aeras::LogStats logged = log.stats();
+    Napi::Object stats = Napi::Object::New(env);
+    stats.Set("wins", Napi::Number::New(env, (double)wins));
+    stats.Set("losses", Napi::Number::New(env, (double)losses));
+    stats.Set("unknown", Napi::Number::New(env, (double)unknown));
+    stats.Set("rickshaws", Napi::Number::New(env, (double)(owners.size() - 1)));
+    stats.Set("logOpen", Napi::Boolean::New(env, log.ok()));
+    stats.Set("logged", Napi::Number::New(env, (double)logged.appended));
+    stats.Set("logBatches", Napi::Number::New(env, (double)logged.batches));
+    stats.Set("logTruncations", Napi::Number::New(env, (double)logged.truncations));
+    stats.Set("logFailures", Napi::Number::New(env, (double)logged.failures));
+    stats.Set("durable", Napi::Number::New(env, (double)logged.durable));
+    stats.Set("applied", Napi::Number::New(env, (double)logged.applied));
+    return stats;
+  }
+
+  RideStateTable table;
+  aeras::WriteBehindLog log;
+  std::vector<std::string> owners;                    // Owner number -> rickshaw ID; [0] is nobody
+  std::unordered_map<std::string, uint32_t> ownerIDs;
+  uint64_t wins;
+  uint64_t losses;
+  uint64_t unknown;
+};
+
+class RideDeadlinesWrap : public Napi::ObjectWrap<RideDeadlinesWrap> {
+public:
+  static Napi::Object Init(Napi::Env env, Napi::Object exports) {
+    Napi::Function constructor = DefineClass(env, "RideDeadlines", {
+      InstanceMethod("schedule", &RideDeadlinesWrap::Schedule),
+      InstanceMethod("cancel", &RideDeadlinesWrap::Cancel),
+      InstanceMethod("advance", &RideDeadlinesWrap::Advance),
+      InstanceMethod("stats", &RideDeadlinesWrap::Stats),
+    });
+    exports.Set("RideDeadlines", constructor);
+    return exports;
+  }
+
+  RideDeadlinesWrap(const Napi::CallbackInfo& info)
+    : Napi::ObjectWrap<RideDeadlinesWrap>(info),
+      wheel(epochMillis(), (uint32_t)option(info, "tickMs", 1000), (uint32_t)option(info, "slots", 128)) {}
+
+private:
+  static double option(const Napi::CallbackInfo& info, const char* name, double fallback) {
+    if (info.Length() < 1 || !info[0].IsObject()) return fallback;
+    Napi::Value value = info[0].As<Napi::Object>().Get(name);
+    return value.IsNumber() ? value.As<Napi::Number>().DoubleValue() : fallback;
+  }
+
+  static bool number(const Napi::CallbackInfo& info, size_t at, double& out) {
+    if (info.Length() <= at || !info[at].IsNumber()) {
+      Napi::TypeError::New(info.Env(), "expected a number at argument " + std::to_string(at))
+        .ThrowAsJavaScriptException();
+      return false;
+    }
+    out = info[at].As<Napi::Number>().DoubleValue();
+    return true;
+  }
+
+  Napi::Value Schedule(const Napi::CallbackInfo& info) {
+    double rideID, dueMs;
+    if (!number(info, 0, rideID) || !number(info, 1, dueMs)) return info.Env().Undefined();
+    wheel.schedule((uint32_t)rideID, dueMs > 0 ? (uint64_t)dueMs : 0);
+    return info.Env().Undefined();
+  }
+
+  Napi::Value Cancel(const Napi::CallbackInfo& info) {
+    double rideID;
+    if (!number(info, 0, rideID)) return info.Env().Undefined();
+    return Napi::Boolean::New(info.Env(), wheel.cancel((uint32_t)rideID));
+  }
+
+  Napi::Value Advance(const Napi::CallbackInfo& info) {
+    double nowMs;
+    if (!number(info, 0, nowMs)) return info.Env().Undefined();
+    due.clear();
+    wheel.advance(nowMs > 0 ? (uint64_t)nowMs : 0, due);
+
+    Napi::Array rides = Napi::Array::New(info.Env(), due.size());
+    for (size_t i = 0; i < due.size(); i++) rides.Set((uint32_t)i, Napi::Number::New(info.Env(), due[i]));
+    return rides;
+  }
+
+  Napi::Value Stats(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    const aeras::WheelStats& counters = wheel.stats();
+    Napi::Object stats = Napi::Object::New(env);
+    stats.Set("armed", Napi::Number::New(env, (double)wheel.size()));
+    stats.Set("scheduled", Napi::Number::New(env, (double)counters.scheduled));
+    stats.Set("cancelled", Napi::Number::New(env, (double)counters.cancelled));
+    stats.Set("expired", Napi::Number::New(env, (double)counters.expired));
+    stats.Set("ticks", Napi::Number::New(env, (double)counters.ticks));
+    return stats;
+  }
+
+  aeras::TimerWheel wheel;
+  std::vector<uint32_t> due;   // Reused across advance() calls
+};
+
+static Napi::Object Init(Napi::Env env, Napi::Object exports) {
+  RideStatesWrap::Init(env, exports);
+  return RideDeadlinesWrap::Init(env, exports);
+}
+
+NODE_API_MODULE(aeras_rides, Init)
@@ -0,0 +1,163 @@
+// AERAS spatial index - Node binding (node-addon-api)
+//
+//   const { SpatialIndex } = require('./native/build/Release/aeras_spatial.node');
+//   const index = new SpatialIndex({ cellMeters: 500, refLat: 22.46 });
+//   index.upsertRide(rideID, lat, lng);        index.removeRide(rideID);
+//   index.upsertRickshaw(id, lat, lng);        index.removeRickshaw(id);
+//   index.nearest(lat, lng, k, radiusKm)       -> [{ rideID, distance }] (meters)
+//   index.nearestTo(rickshawID, k, radiusKm)   -> same, or null if the rickshaw is unknown
+//   index.pruneRickshaws(maxAgeS)              -> rickshaws dropped
+//   index.stats()
+
+#include <napi.h>
+
+#include <chrono>
+#include <limits>
+
+#include "SpatialIndex.h"
+
+static double nowSeconds() {
+  return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+class SpatialIndexWrap : public Napi::ObjectWrap<SpatialIndexWrap> {
+public:
+  static Napi::Object Init(Napi::Env env, Napi::Object exports) {
+    Napi::Function constructor = DefineClass(env, "SpatialIndex", {
+      InstanceMethod("upsertRide", &SpatialIndexWrap::UpsertRide),
+      InstanceMethod("removeRide", &SpatialIndexWrap::RemoveRide),
+      InstanceMethod("clearRides", &SpatialIndexWrap::ClearRides),
+      InstanceMethod("upsertRickshaw", &SpatialIndexWrap::UpsertRickshaw),
+      InstanceMethod("removeRickshaw", &SpatialIndexWrap::RemoveRickshaw),
+      InstanceMethod("pruneRickshaws", &SpatialIndexWrap::PruneRickshaws),
+      InstanceMethod("nearest", &SpatialIndexWrap::Nearest),
+      InstanceMethod("nearestTo", &SpatialIndexWrap::NearestTo),
+      InstanceMethod("stats", &SpatialIndexWrap::Stats),
+    });
+    exports.Set("SpatialIndex", constructor);
+    return exports;
+  }
+
+  SpatialIndexWrap(const Napi::CallbackInfo& info)
+    : Napi::ObjectWrap<SpatialIndexWrap>(info), index(option(info, "cellMeters", 500), option(info, "refLat", 22.46)) {}
+
+private:
+  static double option(const Napi::CallbackInfo& info, const char* name, double fallback) {
+    if (info.Length() < 1 || !info[0].IsObject()) return fallback;
+    Napi::Value value = info[0].As<Napi::Object>().Get(name);
+    return value.IsNumber() ? value.As<Napi::Number>().DoubleValue() : fallback;
+  }
+
+  // false (and a pending TypeError) unless args [first, first + count) are numbers
+  static bool numbers(const Napi::CallbackInfo& info, size_t first, size_t count) {
+    for (size_t i = first; i < first + count; i++) {
+      if (info.Length() <= i || !info[i].IsNumber()) {
+        Napi::TypeError::New(info.Env(), "expected a number at argument " + std::to_string(i))
+          .ThrowAsJavaScriptException();
+        return false;
+      }
+    }
+    return true;
+  }
+
+  static bool string(const Napi::CallbackInfo& info, size_t at) {
+    if (info.Length() > at && info[at].IsString()) return true;
+    Napi::TypeError::New(info.Env(), "expected a string at argument " + std::to_string(at))
+      .ThrowAsJavaScriptException();
+    return false;
+  }
+
+  static double number(const Napi::CallbackInfo& info, size_t at) {
+    return info[at].As<Napi::Number>().DoubleValue();
+  }
+
+  Napi::Value UpsertRide(const Napi::CallbackInfo& info) {
+    if (!numbers(info, 0, 3)) return info.Env().Undefined();
+    index.upsertRide(info[0].As<Napi::Number>().Int64Value(), number(info, 1), number(info, 2));
+    return info.Env().Undefined();
+  }
+
+  Napi::Value RemoveRide(const Napi::CallbackInfo& info) {
+    if (!numbers(info, 0, 1)) return info.Env().Undefined();
+    return Napi::Boolean::New(info.Env(), index.removeRide(info[0].As<Napi::Number>().Int64Value()));
+  }
+
+  Napi::Value ClearRides(const Napi::CallbackInfo& info) {
+    index.clearRides();
+    return info.Env().Undefined();
+  }
+
+  Napi::Value UpsertRickshaw(const Napi::CallbackInfo& info) {
+    if (!string(info, 0) || !numbers(info, 1, 2)) return info.Env().Undefined();
+    index.upsertRickshaw(info[0].As<Napi::String>().Utf8Value(), number(info, 1), number(info, 2), nowSeconds());
+    return info.Env().Undefined();
+  }
+
+  Napi::Value RemoveRickshaw(const Napi::CallbackInfo& info) {
+    if (!string(info, 0)) return info.Env().Undefined();
+    return Napi::Boolean::New(info.Env(), index.removeRickshaw(info[0].As<Napi::String>().Utf8Value()));
+  }
+
+  Napi::Value PruneRickshaws(const Napi::CallbackInfo& info) {
+    if (!numbers(info, 0, 1)) return info.Env().Undefined();
+    return Napi::Number::New(info.Env(), (double)index.pruneRickshaws(nowSeconds(), number(info, 0)));
+  }
+
+  // k and radiusKm are optional: every ride, any distance
+  Napi::Value Query(const Napi::CallbackInfo& info, double lat, double lng, size_t at) {
+    size_t k = std::numeric_limits<size_t>::max();
+    double radiusM = std::numeric_limits<double>::infinity();
+    if (info.Length() > at && info[at].IsNumber()) {
+      double limit = number(info, at);
+      k = limit > 0 ? (size_t)limit : 0;
+    }
+    if (info.Length() > at + 1 && info[at + 1].IsNumber()) radiusM = number(info, at + 1) * 1000;
+
+    index.nearest(lat, lng, k, radiusM, found);
+
+    Napi::Env env = info.Env();
+    Napi::Array rides = Napi::Array::New(env, found.size());
+    for (size_t i = 0; i < found.size(); i++) {
+      Napi::Object ride = Napi::Object::New(env);
+      ride.Set("rideID", Napi::Number::New(env, (double)found[i].rideID));
+      ride.Set("distance", Napi::Number::New(env, found[i].distanceM));
+      rides.Set((uint32_t)i, ride);
+    }
+    return rides;
+  }
+
+  Napi::Value Nearest(const Napi::CallbackInfo& info) {
+    if (!numbers(info, 0, 2)) return info.Env().Undefined();
+    return Query(info, number(info, 0), number(info, 1), 2);
+  }
+
+  Napi::Value NearestTo(const Napi::CallbackInfo& info) {
+    if (!string(info, 0)) return info.Env().Undefined();
+    double lat, lng;
+    if (!index.rickshawPosition(info[0].As<Napi::String>().Utf8Value(), lat, lng)) return info.Env().Null();
+    return Query(info, lat, lng, 1);
+  }
+
+  Napi::Value Stats(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    const aeras::SpatialStats& counters = index.stats();
+    Napi::Object stats = Napi::Object::New(env);
+    stats.Set("rides", Napi::Number::New(env, (double)index.rideCount()));
+    stats.Set("rickshaws", Napi::Number::New(env, (double)index.rickshawCount()));
+    stats.Set("cells", Napi::Number::New(env, (double)index.cellCount()));
+    stats.Set("queries", Napi::Number::New(env, (double)counters.queries));
+    stats.Set("cellsVisited", Napi::Number::New(env, (double)counters.cellsVisited));
+    stats.Set("candidates", Napi::Number::New(env, (double)counters.candidates));
+    stats.Set("fullScans", Napi::Number::New(env, (double)counters.fullScans));
+    return stats;
+  }
+
+  aeras::SpatialIndex index;
+  std::vector<aeras::Neighbour> found;   // Reused across queries
+};
+
+static Napi::Object Init(Napi::Env env, Napi::Object exports) {
+  return SpatialIndexWrap::Init(env, exports);
+}
+
+NODE_API_MODULE(aeras_spatial, Init)
@@ -0,0 +1,183 @@
+// AERAS spatial index - pending pickups on a uniform grid, nearest-first
+
+#include "SpatialIndex.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace aeras {
+
+static const double EARTH_RADIUS_M = 6371000;
+static const double METERS_PER_DEGREE = 111320;
+static const double DEG_TO_RAD = M_PI / 180;
+
+// Heap order: nearer first, then the older (lower) ride ID
+static bool before(const Neighbour& a, const Neighbour& b) {
+  return a.distanceM < b.distanceM || (a.distanceM == b.distanceM && a.rideID < b.rideID);
+}
+
+SpatialIndex::SpatialIndex(double cellMeters, double refLat)
+  : cellMeters(cellMeters),
+    rowsPerDegree(METERS_PER_DEGREE / cellMeters),
+    colsPerDegree(METERS_PER_DEGREE * std::cos(refLat * DEG_TO_RAD) / cellMeters),
+    refCos(std::cos(refLat * DEG_TO_RAD)),
+    counters() {}
+
+double SpatialIndex::distance(double lat1, double lng1, double lat2, double lng2) {
+  double phi1 = lat1 * DEG_TO_RAD;
+  double phi2 = lat2 * DEG_TO_RAD;
+  double dPhi = (lat2 - lat1) * DEG_TO_RAD;
+  double dLambda = (lng2 - lng1) * DEG_TO_RAD;
+
+  double a = std::sin(dPhi / 2) * std::sin(dPhi / 2) +
+             std::cos(phi1) * std::cos(phi2) * std::sin(dLambda / 2) * std::sin(dLambda / 2);
+  return EARTH_RADIUS_M * 2 * std::atan2(std::sqrt(a), std::sqrt(1 - a));
+}
+
+uint64_t SpatialIndex::pack(int32_t row, int32_t col) {
+  return ((uint64_t)(uint32_t)row << 32) | (uint32_t)col;
+}
+
+uint64_t SpatialIndex::cellOf(double lat, double lng) const {
+  return pack((int32_t)std::floor(lat * rowsPerDegree), (int32_t)std::floor(lng * colsPerDegree));
+}
+
+// ===== Rides =====
+
+void SpatialIndex::upsertRide(int64_t rideID, double lat, double lng) {
+  uint64_t cell = cellOf(lat, lng);
+  auto found = rides.find(rideID);
+  if (found != rides.end()) {
+    if (found->second.cell == cell) {
+      Entry& entry = cells[cell][found->second.index];
+      entry.lat = lat;
+      entry.lng = lng;
+      return;
+    }
+    removeRide(rideID);
+  }
+
+  std::vector<Entry>& entries = cells[cell];
+  rides[rideID] = Slot{ cell, entries.size() };
+  entries.push_back(Entry{ rideID, lat, lng });
+}
+
+// Swap-and-pop: O(1), the moved entry's slot is patched
+bool SpatialIndex::removeRide(int64_t rideID) {
+  auto found = rides.find(rideID);
+  if (found == rides.end()) return false;
+
+  Slot slot = found->second;
+  std::vector<Entry>& entries = cells[slot.cell];
+  entries[slot.index] = entries.back();
+  rides[entries[slot.index].rideID].index = slot.index;
+  entries.pop_back();
+  if (entries.empty()) cells.erase(slot.cell);
+
+  rides.erase(rideID);
+  return true;
+}
+
+void SpatialIndex::clearRides() {
+  cells.clear();
+  rides.clear();
+}
+
+// ===== Rickshaws =====
+
+void SpatialIndex::upsertRickshaw(const std::string& id, double lat, double lng, double nowS) {
+  rickshaws[id] = Position{ lat, lng, nowS };
+}
+
+bool SpatialIndex::removeRickshaw(const std::string& id) {
+  return rickshaws.erase(id) > 0;
+}
+
+bool SpatialIndex::rickshawPosition(const std::string& id, double& lat, double& lng) const {
+  auto found = rickshaws.find(id);
+  if (found == rickshaws.end()) return false;
+  lat = found->second.lat;
+  lng = found->second.lng;
+  return true;
+}
+
+size_t SpatialIndex::pruneRickshaws(double nowS, double maxAgeS) {
+  size_t dropped = 0;
+  for (auto it = rickshaws.begin(); it != rickshaws.end();) {
+    if (nowS - it->second.seenS > maxAgeS) {
+      it = rickshaws.erase(it);
+      dropped++;
+    } else {
+      ++it;
+    }
+  }
+  return dropped;
+}
+
+// ===== Query =====
+
+void SpatialIndex::scanCell(const std::vector<Entry>& entries, double lat, double lng, size_t k,
+                            double radiusM, std::vector<Neighbour>& heap) {
+  for (const Entry& entry : entries) {
+    Neighbour candidate{ entry.rideID, distance(lat, lng, entry.lat, entry.lng) };
+    counters.candidates++;
+    if (candidate.distanceM > radiusM) continue;
+
+    if (heap.size() < k) {
+      heap.push_back(candidate);
+      std::push_heap(heap.begin(), heap.end(), before);
+    } else if (before(candidate, heap.front())) {
+      std::pop_heap(heap.begin(), heap.end(), before);
+      heap.back() = candidate;
+      std::push_heap(heap.begin(), heap.end(), before);
+    }
+  }
+}
+
+void SpatialIndex::nearest(double lat, double lng, size_t k, double radiusM, std::vector<Neighbour>& out) {
+  out.clear();
+  counters.queries++;
+  if (k == 0 || rides.empty()) return;
+
+  // Max-heap on distance: front() is the k-th best so far
+  std::vector<Neighbour>& heap = out;
+
+  int32_t row0 = (int32_t)std::floor(lat * rowsPerDegree);
+  int32_t col0 = (int32_t)std::floor(lng * colsPerDegree);
+  // Columns narrow with latitude; the smaller side bounds every ring
+  double colMeters = cellMeters * std::cos(lat * DEG_TO_RAD) / refCos;
+  double minSide = std::min(cellMeters, colMeters);
+
+  size_t visited = 0;
+  for (int32_t ring = 0;; ring++) {
+    // Every point in ring r is at least r - 1 whole cells from the query
+    double bound = ring == 0 ? 0 : (ring - 1) * minSide;
+    if (bound > radiusM) break;
+    if (heap.size() == k && bound > heap.front().distanceM) break;
+
+    // Sparse grid or huge radius: the occupied cells are fewer than the ring
+    size_t ringCells = ring == 0 ? 1 : 8 * (size_t)ring;
+    if (visited + ringCells > cells.size()) {
+      heap.clear();
+      for (const auto& cell : cells) scanCell(cell.second, lat, lng, k, radiusM, heap);
+      counters.cellsVisited += cells.size();
+      counters.fullScans++;
+      break;
+    }
+
+    for (int32_t row = row0 - ring; row <= row0 + ring; row++) {
+      bool edgeRow = row == row0 - ring || row == row0 + ring;
+      int32_t step = edgeRow ? 1 : 2 * ring;
+      for (int32_t col = col0 - ring; col <= col0 + ring; col += step) {
+        auto cell = cells.find(pack(row, col));
+        if (cell != cells.end()) scanCell(cell->second, lat, lng, k, radiusM, heap);
+      }
+    }
+    visited += ringCells;
+    counters.cellsVisited += ringCells;
+  }
+
+  std::sort_heap(heap.begin(), heap.end(), before);
+}
+
+}  // namespace aeras
@@ -0,0 +1,102 @@
+// AERAS spatial index - pending pickups on a uniform grid, nearest-first
+//
+// /api/ride/pending used to scan every PENDING ride, run a haversine per
+// row and sort them all, for every poll of every rickshaw. Here each
+// pending pickup sits in a grid cell of cellMeters. A query walks the
+// cells in rings outward from the rickshaw and keeps the best k in a
+// bounded heap. It stops once no farther ring can beat the k-th ride found
+// or lies past the radius, so the cost is set by the rides nearby, not by
+// every ride pending.
+//
+// Rickshaw positions (register, track, heartbeat) are kept alongside, so a
+// query can name the rickshaw instead of reading its row.
+//
+// Distances are the same haversine as calculateDistance() in server.js.
+// Not thread-safe; the addon calls it from the JS thread only.
+
+#ifndef AERAS_SPATIAL_INDEX_H
+#define AERAS_SPATIAL_INDEX_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace aeras {
+
+struct Neighbour {
+  int64_t rideID;
+  double distanceM;
+};
+
+struct SpatialStats {
+  uint64_t queries;
+  uint64_t cellsVisited;
+  uint64_t candidates;      // Haversines computed
+  uint64_t fullScans;       // Queries that fell back to walking every cell
+};
+
+class SpatialIndex {
+public:
+  // refLat sets the cell width in longitude; the service area is small
+  explicit SpatialIndex(double cellMeters = 500, double refLat = 22.46);
+
+  void upsertRide(int64_t rideID, double lat, double lng);
+  bool removeRide(int64_t rideID);
+  void clearRides();
+
+  void upsertRickshaw(const std::string& id, double lat, double lng, double nowS);
+  bool removeRickshaw(const std::string& id);
+  bool rickshawPosition(const std::string& id, double& lat, double& lng) const;
+  // Drop rickshaws not heard from since nowS - maxAgeS; returns how many
+  size_t pruneRickshaws(double nowS, double maxAgeS);
+
+  // Up to k rides within radiusM of (lat, lng), nearest first, ties to the
+  // lower (older) ride ID
+  void nearest(double lat, double lng, size_t k, double radiusM, std::vector<Neighbour>& out);
+
+  size_t rideCount() const { return rides.size(); }
+  size_t rickshawCount() const { return rickshaws.size(); }
+  size_t cellCount() const { return cells.size(); }
+  const SpatialStats& stats() const { return counters; }
+
+  static double distance(double lat1, double lng1, double lat2, double lng2);
+
+private:
+  struct Entry {
+    int64_t rideID;
+    double lat;
+    double lng;
+  };
+
+  struct Slot {
+    uint64_t cell;
+    size_t index;           // Position in that cell's vector
+  };
+
+  struct Position {
+    double lat;
+    double lng;
+    double seenS;
+  };
+
+  uint64_t cellOf(double lat, double lng) const;
+  static uint64_t pack(int32_t row, int32_t col);
+  void scanCell(const std::vector<Entry>& entries, double lat, double lng, size_t k, double radiusM,
+                std::vector<Neighbour>& heap);
+
+  double cellMeters;
+  double rowsPerDegree;
+  double colsPerDegree;
+  double refCos;
+
+  std::unordered_map<uint64_t, std::vector<Entry>> cells;
+  std::unordered_map<int64_t, Slot> rides;
+  std::unordered_map<std::string, Position> rickshaws;
+  SpatialStats counters;
+};
+
+}  // namespace aeras
+
+#endif
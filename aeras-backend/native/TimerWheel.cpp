@@ -0,0 +1,93 @@
+// AERAS timer wheel - ride deadlines without a JS timer per ride
+
+#include "TimerWheel.h"
+
+namespace aeras {
+
+const int32_t TimerWheel::NONE;
+
+TimerWheel::TimerWheel(uint64_t nowMs, uint32_t tickMs, uint32_t slots)
+  : tickMs(tickMs > 0 ? tickMs : 1),
+    cursor(nowMs / (tickMs > 0 ? tickMs : 1)),
+    mask(0),
+    freeList(NONE),
+    counters() {
+  uint32_t size = 1;
+  while (size < slots) size <<= 1;
+  heads.assign(size, NONE);
+  mask = size - 1;
+}
+
+void TimerWheel::schedule(uint32_t id, uint64_t dueMs) {
+  cancel(id);
+
+  // Round up: never fire early
+  uint64_t dueTick = (dueMs + tickMs - 1) / tickMs;
+  if (dueTick <= cursor) dueTick = cursor + 1;
+  uint64_t wait = dueTick - cursor - 1;
+
+  int32_t node;
+  if (freeList != NONE) {
+    node = freeList;
+    freeList = nodes[node].next;
+  } else {
+    node = (int32_t)nodes.size();
+    nodes.push_back(Node());
+  }
+
+  uint32_t slot = (uint32_t)(dueTick & mask);
+  nodes[node] = Node{ id, (uint32_t)(wait / heads.size()), slot, NONE, heads[slot] };
+  if (heads[slot] != NONE) nodes[heads[slot]].prev = node;
+  heads[slot] = node;
+  index[id] = node;
+  counters.scheduled++;
+}
+
+bool TimerWheel::cancel(uint32_t id) {
+  auto found = index.find(id);
+  if (found == index.end()) return false;
+  unlink(found->second);
+  index.erase(found);
+  counters.cancelled++;
+  return true;
+}
+
+void TimerWheel::unlink(int32_t node) {
+  Node& entry = nodes[node];
+  if (entry.prev != NONE) nodes[entry.prev].next = entry.next;
+  else heads[entry.slot] = entry.next;
+  if (entry.next != NONE) nodes[entry.next].prev = entry.prev;
+
+  entry.next = freeList;
+  freeList = node;
+}
+
+void TimerWheel::advance(uint64_t nowMs, std::vector<uint32_t>& due) {
+  uint64_t nowTick = nowMs / tickMs;
+
+  while (cursor < nowTick) {
+    // Nothing armed: jump straight to now
+    if (index.empty()) {
+      cursor = nowTick;
+      break;
+    }
+    cursor++;
+    counters.ticks++;
+
+    int32_t node = heads[cursor & mask];
+    while (node != NONE) {
+      int32_t next = nodes[node].next;
+      if (nodes[node].turns == 0) {
+        due.push_back(nodes[node].id);
+        index.erase(nodes[node].id);
+        unlink(node);
+        counters.expired++;
+      } else {
+        nodes[node].turns--;
+      }
+      node = next;
+    }
+  }
+}
+
+}  // namespace aeras
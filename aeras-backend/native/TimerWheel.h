@@ -0,0 +1,76 @@
+// AERAS timer wheel - ride deadlines without a JS timer per ride
+//
+// /api/ride/request used to arm a 60 s setTimeout per ride, each ending in
+// a SELECT and a conditional UPDATE, even for rides accepted long before;
+// a restart dropped them all. Here deadlines sit in a hashed timing wheel:
+// slots of tickMs each, a deadline goes in slot (dueTick % slots) with the
+// number of full turns still to wait. schedule() and cancel() are O(1)
+// (a hash lookup and a doubly linked list splice); advance() walks only
+// the slots the clock has passed and hands back every ride that came due,
+// so the caller can expire them in one statement.
+//
+// One level with a turn count rather than cascading levels: deadlines are
+// all about a minute out, so one turn of the wheel covers them and the
+// count is zero for nearly every entry.
+//
+// Times are whatever the caller's clock says (server.js: epoch ms). A
+// deadline already past fires on the next advance(). Single-threaded.
+
+#ifndef AERAS_TIMER_WHEEL_H
+#define AERAS_TIMER_WHEEL_H
+
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace aeras {
+
+struct WheelStats {
+  uint64_t scheduled;
+  uint64_t cancelled;
+  uint64_t expired;
+  uint64_t ticks;        // Slots walked by advance()
+};
+
+class TimerWheel {
+public:
+  // slots is rounded up to a power of two
+  TimerWheel(uint64_t nowMs, uint32_t tickMs = 1000, uint32_t slots = 128);
+
+  // Arm (or re-arm) id for dueMs
+  void schedule(uint32_t id, uint64_t dueMs);
+  // Disarm; false if it was not armed
+  bool cancel(uint32_t id);
+  // Move the clock to nowMs; appends every id that came due to `due`
+  void advance(uint64_t nowMs, std::vector<uint32_t>& due);
+
+  size_t size() const { return index.size(); }
+  const WheelStats& stats() const { return counters; }
+
+private:
+  static const int32_t NONE = -1;
+
+  struct Node {
+    uint32_t id;
+    uint32_t turns;       // Full turns of the wheel still to wait
+    uint32_t slot;
+    int32_t prev;
+    int32_t next;         // Also links the free list
+  };
+
+  void unlink(int32_t node);
+
+  uint64_t tickMs;
+  uint64_t cursor;                     // Last tick advance() processed
+  uint32_t mask;
+  std::vector<int32_t> heads;          // Per slot
+  std::vector<Node> nodes;
+  int32_t freeList;
+  std::unordered_map<uint32_t, int32_t> index;
+  WheelStats counters;
+};
+
+}  // namespace aeras
+
+#endif
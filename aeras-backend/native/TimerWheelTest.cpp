@@ -0,0 +1,144 @@
+// AERAS timer wheel - behaviour tests
+//
+//   npm run build:native && npm run test:native
+//
+// A deadline fires on the first advance() whose tick covers it - never
+// early, never a tick late - however many turns of the wheel away it is;
+// a deadline already past fires on the next advance(); cancel and
+// re-schedule disarm the old deadline.
+
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#include "TimerWheel.h"
+
+using namespace aeras;
+
+static int failures = 0;
+
+#define CHECK(condition)                                                     \
+  do {                                                                       \
+    if (!(condition)) {                                                      \
+      printf("  FAIL %s:%d  %s\n", __FILE__, __LINE__, #condition);          \
+      failures++;                                                            \
+    }                                                                        \
+  } while (0)
+
+static bool fires(TimerWheel& wheel, uint64_t nowMs, uint32_t id) {
+  std::vector<uint32_t> due;
+  wheel.advance(nowMs, due);
+  for (uint32_t fired : due) {
+    if (fired == id) return true;
+  }
+  return false;
+}
+
+static void testTurnsAcrossTheWheel() {
+  // 8 one-second slots: 20.5 s out is two full turns plus four slots
+  TimerWheel wheel(0, 1000, 8);
+  wheel.schedule(1, 20500);
+  CHECK(!fires(wheel, 8000, 1));
+  CHECK(!fires(wheel, 16000, 1));
+  CHECK(!fires(wheel, 20999, 1));   // Rounded up: never early
+  CHECK(fires(wheel, 21000, 1));
+  CHECK(wheel.size() == 0);
+}
+
+static void testEveryDeadlineOnItsTick() {
+  // Random deadlines up to 40 turns out, advanced a tick at a time
+  const uint32_t tickMs = 250, slots = 16, count = 2000;
+  TimerWheel wheel(1000000, tickMs, slots);
+  std::vector<uint64_t> dueTick(count + 1);
+  srand(7);
+  for (uint32_t id = 1; id <= count; id++) {
+    uint64_t dueMs = 1000000 + 1 + (uint64_t)(rand() % (tickMs * slots * 40));
+    wheel.schedule(id, dueMs);
+    dueTick[id] = (dueMs + tickMs - 1) / tickMs;
+  }
+
+  uint32_t early = 0, late = 0, fired = 0;
+  std::vector<uint32_t> due;
+  for (uint64_t tick = 1000000 / tickMs + 1; wheel.size() > 0 && tick < 1000000 / tickMs + slots * 42; tick++) {
+    due.clear();
+    wheel.advance(tick * tickMs, due);
+    for (uint32_t id : due) {
+      fired++;
+      if (tick < dueTick[id]) early++;
+      if (tick > dueTick[id]) late++;
+    }
+  }
+  CHECK(fired == count);
+  CHECK(early == 0);
+  CHECK(late == 0);
+  CHECK(wheel.stats().expired == count);
+}
+
+static void testPastDeadlineAndBigJump() {
+  TimerWheel wheel(10000, 1000, 8);
+  wheel.schedule(1, 5000);            // Already past
+  CHECK(fires(wheel, 11000, 1));
+
+  // One advance() far past several turns hands back everything due
+  wheel.schedule(2, 15000);
+  wheel.schedule(3, 40000);
+  wheel.schedule(4, 90000);
+  std::vector<uint32_t> due;
+  wheel.advance(45000, due);
+  CHECK(due.size() == 2);
+  CHECK(wheel.size() == 1);
+  CHECK(fires(wheel, 90000, 4));
+
+  // Nothing armed: the clock jumps without walking the slots
+  uint64_t ticks = wheel.stats().ticks;
+  due.clear();
+  wheel.advance(10000000, due);
+  CHECK(due.empty());
+  CHECK(wheel.stats().ticks == ticks);
+  wheel.schedule(5, 10001000);
+  CHECK(fires(wheel, 10001000, 5));
+}
+
+static void testCancelAndReschedule() {
+  TimerWheel wheel(0, 1000, 8);
+  wheel.schedule(1, 3000);
+  wheel.schedule(2, 3000);
+  CHECK(wheel.cancel(1));
+  CHECK(!wheel.cancel(1));
+  CHECK(!fires(wheel, 3000, 1));
+
+  // A ride back on offer gets a fresh window; the old deadline is gone
+  wheel.schedule(3, 5000);
+  wheel.schedule(3, 12000);
+  CHECK(wheel.size() == 1);
+  CHECK(!fires(wheel, 11000, 3));
+  CHECK(fires(wheel, 12000, 3));
+
+  // Freed nodes are reused
+  for (uint32_t id = 10; id < 20; id++) wheel.schedule(id, 20000);
+  for (uint32_t id = 10; id < 20; id++) wheel.cancel(id);
+  for (uint32_t id = 20; id < 30; id++) wheel.schedule(id, 20000);
+  std::vector<uint32_t> due;
+  wheel.advance(20000, due);
+  CHECK(due.size() == 10);
+}
+
+int main() {
+  struct {
+    const char* name;
+    void (*run)();
+  } tests[] = {
+    { "turns across the wheel", testTurnsAcrossTheWheel },
+    { "every deadline on its tick", testEveryDeadlineOnItsTick },
+    { "past deadline and big jump", testPastDeadlineAndBigJump },
+    { "cancel and reschedule", testCancelAndReschedule },
+  };
+
+  for (const auto& test : tests) {
+    int before = failures;
+    test.run();
+    printf("%s %s\n", failures == before ? "PASS" : "FAIL", test.name);
+  }
+  printf("\n%s\n", failures == 0 ? "All timer wheel tests passed" : "Timer wheel tests FAILED");
+  return failures == 0 ? 0 : 1;
+}
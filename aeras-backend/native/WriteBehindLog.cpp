@@ -0,0 +1,145 @@
+// AERAS write-behind log - durable record of ride transitions ahead of SQLite
+
+#include "WriteBehindLog.h"
+
+#include <cerrno>
+#include <chrono>
+#include <fcntl.h>
+
+#ifdef _WIN32
+#include <io.h>
+#define open _open
+#define write _write
+#define close _close
+#define lseek _lseek
+#define fdatasync _commit
+#define ftruncate _chsize_s
+#else
+#include <unistd.h>
+#endif
+
+namespace aeras {
+
+WriteBehindLog::WriteBehindLog(const std::string& path)
+  : fd(::open(path.c_str(), O_WRONLY | O_CREAT | O_APPEND, 0644)),
+    nextSeq(1),
+    appliedSeq(0),
+    batches(0),
+    truncations(0),
+    failures(0),
+    stopping(false),
+    durableSeq(0) {
+  if (fd >= 0) writer = std::thread(&WriteBehindLog::run, this);
+}
+
+WriteBehindLog::~WriteBehindLog() {
+  if (fd < 0) return;
+  {
+    std::lock_guard<std::mutex> guard(lock);
+    stopping = true;
+  }
+  wake.notify_one();
+  writer.join();
+  ::close(fd);
+}
+
+uint64_t WriteBehindLog::append(const std::string& record) {
+  if (fd < 0) return 0;
+  uint64_t seq;
+  {
+    std::lock_guard<std::mutex> guard(lock);
+    seq = nextSeq++;
+    queue.push_back(std::to_string(seq) + " " + record + "\n");
+  }
+  wake.notify_one();
+  return seq;
+}
+
+void WriteBehindLog::applied(uint64_t seq) {
+  {
+    std::lock_guard<std::mutex> guard(lock);
+    if (seq > appliedSeq) appliedSeq = seq;
+  }
+  wake.notify_one();
+}
+
+LogStats WriteBehindLog::stats() {
+  std::lock_guard<std::mutex> guard(lock);
+  return LogStats{ nextSeq - 1, batches, truncations, failures, durableSeq.load(), appliedSeq };
+}
+
+// ===== Writer thread =====
+
+// Appends lines and syncs them; on failure cuts the file back to where it
+// was, so a retry never leaves a torn line ahead of the next record
+bool WriteBehindLog::writeOut(const std::string& lines) {
+  auto start = ::lseek(fd, 0, SEEK_END);
+  const char* at = lines.data();
+  size_t left = lines.size();
+  while (left > 0) {
+    auto n = ::write(fd, at, (unsigned)left);
+    if (n < 0 && errno == EINTR) continue;
+    if (n <= 0) break;
+    at += n;
+    left -= (size_t)n;
+  }
+  if (left == 0 && ::fdatasync(fd) == 0) return true;
+  if (start >= 0) ::ftruncate(fd, start);
+  return false;
+}
+
+void WriteBehindLog::run() {
+  std::string lines;         // Batch being written; kept until it is on disk
+  uint64_t queued = 0;       // Highest seq in lines
+  uint64_t written = 0;      // Highest seq in the file
+  bool dirty = false;        // The file holds records not yet applied
+  bool failing = false;      // The last write, sync or truncate failed
+
+  for (;;) {
+    uint64_t applied;
+    {
+      std::unique_lock<std::mutex> guard(lock);
+      if (failing) {
+        wake.wait_for(guard, std::chrono::milliseconds(RETRY_MS), [&] { return stopping; });
+      } else {
+        wake.wait(guard, [&] { return stopping || !queue.empty() || (dirty && appliedSeq >= written); });
+      }
+      if (stopping && queue.empty() && lines.empty()) return;
+      for (const std::string& line : queue) lines += line;
+      queued += queue.size();
+      queue.clear();
+      applied = appliedSeq;
+    }
+
+    if (!lines.empty()) {
+      // Whole batch in one write and one sync
+      failing = !writeOut(lines);
+      std::lock_guard<std::mutex> guard(lock);
+      if (failing) {
+        failures++;
+        if (stopping) return;  // Shutting down: give up on this batch
+        continue;
+      }
+      lines.clear();
+      written = queued;
+      durableSeq.store(written);
+      dirty = true;
+      batches++;
+      applied = appliedSeq;
+    }
+
+    // Everything in the file is in SQLite: start it over
+    if (dirty && applied >= written) {
+      failing = ::ftruncate(fd, 0) != 0;
+      if (!failing) dirty = false;
+      std::lock_guard<std::mutex> guard(lock);
+      if (failing) {
+        failures++;
+      } else {
+        truncations++;
+      }
+    }
+  }
+}
+
+}  // namespace aeras
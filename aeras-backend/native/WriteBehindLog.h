@@ -0,0 +1,83 @@
+// AERAS write-behind log - durable record of ride transitions ahead of SQLite
+//
+// A won transition is acknowledged as soon as its CAS succeeds; the SQLite
+// write follows in a batch. This log covers the gap: append() queues one
+// text line, a writer thread appends whatever has queued to the file and
+// fdatasync()s it once per batch. After a crash the server replays the
+// file into SQLite (every record is a guarded UPDATE, so replaying one
+// already applied is a no-op).
+//
+// The caller reports applied(seq) once SQLite has committed every record
+// up to seq; when nothing written is left unapplied the file is truncated,
+// so it holds only the last few records instead of growing forever.
+//
+// A batch that fails to write or sync is cut back off the file, kept, and
+// retried every RETRY_MS; durable stays at the last batch that made it.
+//
+//   <seq> <record>\n
+//
+// append() and applied() are safe from any thread.
+
+#ifndef AERAS_WRITE_BEHIND_LOG_H
+#define AERAS_WRITE_BEHIND_LOG_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace aeras {
+
+struct LogStats {
+  uint64_t appended;
+  uint64_t batches;        // Writes + syncs; appended / batches is the batching factor
+  uint64_t truncations;
+  uint64_t failures;       // Batch writes or syncs that failed (and were retried)
+  uint64_t durable;        // Highest seq on disk
+  uint64_t applied;        // Highest seq the caller says is in SQLite
+};
+
+class WriteBehindLog {
+public:
+  static const int RETRY_MS = 100;
+
+  // Appends to path (existing records are kept until the first truncation)
+  explicit WriteBehindLog(const std::string& path);
+  // Writes out what is queued, then stops the writer
+  ~WriteBehindLog();
+
+  WriteBehindLog(const WriteBehindLog&) = delete;
+  WriteBehindLog& operator=(const WriteBehindLog&) = delete;
+
+  bool ok() const { return fd >= 0; }
+
+  // Returns the record's seq, or 0 if the log could not be opened
+  uint64_t append(const std::string& record);
+  void applied(uint64_t seq);
+
+  LogStats stats();
+
+private:
+  void run();
+  bool writeOut(const std::string& lines);
+
+  int fd;
+  std::mutex lock;
+  std::condition_variable wake;
+  std::vector<std::string> queue;   // Lines not yet written
+  uint64_t nextSeq;
+  uint64_t appliedSeq;
+  uint64_t batches;
+  uint64_t truncations;
+  uint64_t failures;
+  bool stopping;
+  std::atomic<uint64_t> durableSeq;
+  std::thread writer;
+};
+
+}  // namespace aeras
+
+#endif
@@ -0,0 +1,90 @@
+{
+  "targets": [
+    {
+      "target_name": "aeras_spatial",
+      "sources": ["SpatialIndex.cpp", "SpatialAddon.cpp"],
+      "include_dirs": ["<!(node -p \"require('node-addon-api').include_dir\")"],
+      "defines": ["NAPI_DISABLE_CPP_EXCEPTIONS", "NAPI_VERSION=8"],
+      "cflags_cc": ["-std=c++17", "-O2"],
+      "xcode_settings": {
+        "CLANG_CXX_LANGUAGE_STANDARD": "c++17",
+        "GCC_OPTIMIZATION_LEVEL": "2"
+      }
+    },
+    {
+      "target_name": "aeras_rides",
+      "sources": ["RideStateTable.cpp", "WriteBehindLog.cpp", "TimerWheel.cpp", "RidesAddon.cpp"],
+      "include_dirs": ["<!(node -p \"require('node-addon-api').include_dir\")"],
+      "defines": ["NAPI_DISABLE_CPP_EXCEPTIONS", "NAPI_VERSION=8"],
+      "cflags_cc": ["-std=c++17", "-O2"],
+      "xcode_settings": {
+        "CLANG_CXX_LANGUAGE_STANDARD": "c++17",
+        "GCC_OPTIMIZATION_LEVEL": "2"
+      }
+    },
+    {
+      "target_name": "aeras_locations",
+      "sources": ["LocationJournal.cpp", "LocationsAddon.cpp"],
+      "include_dirs": ["<!(node -p \"require('node-addon-api').include_dir\")"],
+      "defines": ["NAPI_DISABLE_CPP_EXCEPTIONS", "NAPI_VERSION=8"],
+      "cflags_cc": ["-std=c++17", "-O2"],
+      "xcode_settings": {
+        "CLANG_CXX_LANGUAGE_STANDARD": "c++17",
+        "GCC_OPTIMIZATION_LEVEL": "2"
+      }
+    },
+    {
+      "target_name": "ride_state_bench",
+      "type": "executable",
+      "sources": ["RideStateBench.cpp", "RideStateTable.cpp", "WriteBehindLog.cpp"],
+      "cflags_cc": ["-std=c++17", "-O2"],
+      "ldflags": ["-pthread"],
+      "xcode_settings": {
+        "CLANG_CXX_LANGUAGE_STANDARD": "c++17",
+        "GCC_OPTIMIZATION_LEVEL": "2"
+      }
+    },
+    {
+      "target_name": "timer_wheel_test",
+      "type": "executable",
+      "sources": ["TimerWheelTest.cpp", "TimerWheel.cpp"],
+      "cflags_cc": ["-std=c++17", "-O2"],
+      "xcode_settings": {
+        "CLANG_CXX_LANGUAGE_STANDARD": "c++17",
+        "GCC_OPTIMIZATION_LEVEL": "2"
+      }
+    }
+  ],
+  "conditions": [
+    ["OS=='linux'", {
+      "targets": [
+        {
+          "target_name": "aeras_gateway",
+          "type": "executable",
+          "sources": ["EventGateway.cpp", "GatewayMain.cpp"],
+          "cflags_cc": ["-std=c++17", "-O2"]
+        },
+        {
+          "target_name": "gateway_load_test",
+          "type": "executable",
+          "sources": ["EventGateway.cpp", "GatewayLoadTest.cpp"],
+          "cflags_cc": ["-std=c++17", "-O2"],
+          "ldflags": ["-pthread"]
+        },
+        {
+          "target_name": "ride_state_test",
+          "type": "executable",
+          "sources": ["RideStateTest.cpp", "RideStateTable.cpp", "WriteBehindLog.cpp"],
+          "cflags_cc": ["-std=c++17", "-O2"],
+          "ldflags": ["-pthread"]
+        },
+        {
+          "target_name": "location_journal_test",
+          "type": "executable",
+          "sources": ["LocationJournalTest.cpp", "LocationJournal.cpp"],
+          "cflags_cc": ["-std=c++17", "-O2"]
+        }
+      ]
+    }]
+  ]
+}
@@ -1,5 +1,7 @@
 // AERAS Backend Server - FIXED VERSION
 // All test cases 8-12 with proper error handling
+const fs = require('fs');
+const net = require('net');
 const path = require('path');
 const express = require('express');
 const cors = require('cors');
@@ -18,6 +20,36 @@ const db = new sqlite3.Database('./aeras.db', (err) => {
   }
 });
 
+// A statement run without a callback reports failure here instead of
+// throwing from the connection
+db.on('error', (err) => console.error('✗ Database error:', err.message));
+
+// One connection, so one transaction at a time: a BEGIN from a timer must
+// not land inside a transaction whose statements span callbacks (the SQL
+// accept). work(done) queues its BEGIN ... COMMIT and calls done() once
+// its COMMIT or ROLLBACK has come back; the next transaction starts then.
+// An idle queue runs work at once, so callers inside db.serialize() keep
+// their place behind the statements already queued.
+const transactions = [];
+let transactionOpen = false;
+
+function inTransaction(work) {
+  transactions.push(work);
+  if (!transactionOpen) nextTransaction();
+}
+
+function nextTransaction() {
+  const work = transactions.shift();
+  transactionOpen = !!work;
+  if (!work) return;
+  let finished = false;
+  work(() => {
+    if (finished) return;
+    finished = true;
+    nextTransaction();
+  });
+}
+
 // Create schema
 db.serialize(() => {
   // Users
@@ -73,6 +105,22 @@ db.serialize(() => {
     longitude REAL NOT NULL
   )`);
   
+  // Versioned settings; locationsVersion is bumped on every locations edit
+  db.run(`CREATE TABLE IF NOT EXISTS meta (
+    key TEXT PRIMARY KEY,
+    value INTEGER NOT NULL
+  )`);
+  
+  // Trajectory points uploaded in batches by POST /api/rickshaw/track
+  db.run(`CREATE TABLE IF NOT EXISTS rickshaw_tracks (
+    trackID INTEGER PRIMARY KEY AUTOINCREMENT,
+    rickshawID TEXT NOT NULL,
+    lat REAL NOT NULL,
+    lng REAL NOT NULL,
+    recordedAt DATETIME NOT NULL,
+    FOREIGN KEY(rickshawID) REFERENCES rickshaws(rickshawID)
+  )`);
+  
   // Points History (TEST CASE 11)
   db.run(`CREATE TABLE IF NOT EXISTS points_history (
     historyID INTEGER PRIMARY KEY AUTOINCREMENT,
@@ -94,6 +142,7 @@ db.serialize(() => {
   db.run(`CREATE INDEX IF NOT EXISTS idx_rides_status ON rides(status)`);
   db.run(`CREATE INDEX IF NOT EXISTS idx_rides_time ON rides(requestTime DESC)`);
   db.run(`CREATE INDEX IF NOT EXISTS idx_rickshaw_status ON rickshaws(status, isOnline)`);
+  db.run(`CREATE INDEX IF NOT EXISTS idx_tracks_rickshaw ON rickshaw_tracks(rickshawID, recordedAt)`);
   
   // Insert exact locations from TEST CASE 7
   const locations = [
@@ -107,6 +156,10 @@ db.serialize(() => {
   locations.forEach(loc => stmt.run(loc));
   stmt.finalize();
   
+  // Version 1 = the seed above, which the firmware compiles in
+  // (AERAS_BLOCKS_VERSION in common-hardware/AerasBlocks)
+  db.run(`INSERT OR IGNORE INTO meta VALUES ('locationsVersion', 1)`);
+  
   console.log('✓ Database schema created');
 });
 
@@ -127,6 +180,50 @@ function calculateDistance(lat1, lon1, lat2, lon2) {
   return R * c; // meters
 }
 
+// UTC in CURRENT_TIMESTAMP's layout, keeping milliseconds
+function sqliteTime(ms) {
+  return new Date(ms).toISOString().replace('T', ' ').replace('Z', '');
+}
+
+// Expands a /rickshaw/track batch (common-hardware/AerasTrack): the first
+// point in microdegrees plus base64url zigzag varints of
+// (dLatE6, dLngE6, dt in 100 ms) for each following point.
+// Returns [{lat, lng, recordedAt}] oldest first, or null if malformed.
+function decodeTrack({ latE6, lngE6, age, d }) {
+  if (!Number.isInteger(latE6) || !Number.isInteger(lngE6) || !Number.isInteger(age) || age < 0) {
+    return null;
+  }
+  
+  const bytes = Buffer.from(typeof d === 'string' ? d : '', 'base64url');
+  let offset = 0;
+  const varint = () => {
+    let value = 0;
+    for (let shift = 0; shift < 35; shift += 7) {
+      if (offset >= bytes.length) return null;
+      const byte = bytes[offset++];
+      value += (byte & 0x7f) * 2 ** shift;
+      if ((byte & 0x80) === 0) return value;
+    }
+    return null;
+  };
+  const unzigzag = (v) => (v % 2 ? -(v + 1) / 2 : v / 2);
+  
+  const start = Date.now() - age;
+  const points = [];
+  let lat = latE6, lng = lngE6, units = 0;
+  points.push({ lat: lat / 1e6, lng: lng / 1e6, recordedAt: sqliteTime(start) });
+  
+  while (offset < bytes.length) {
+    const dLat = varint(), dLng = varint(), dt = varint();
+    if (dLat === null || dLng === null || dt === null) return null;
+    lat += unzigzag(dLat);
+    lng += unzigzag(dLng);
+    units += dt;
+    points.push({ lat: lat / 1e6, lng: lng / 1e6, recordedAt: sqliteTime(start + units * 100) });
+  }
+  return points;
+}
+
 // TEST CASE 7: Point calculation formula from rubric
 function calculatePoints(distanceMeters) {
   const basePoints = 10;
@@ -149,6 +246,462 @@ function calculatePoints(distanceMeters) {
   return 0;
 }
 
+// ========== PROXIMITY INDEX ==========
+// Pending pickups and rickshaw positions on a native grid (native/, built
+// with `npm run build:native`), so a pending-ride query touches the rides
+// near the rickshaw instead of scanning and sorting every pending ride.
+// Kept current by publishRideUpdate() and the position endpoints. Without
+// the addon pendingRidesNear() falls back to the SQL scan.
+const PENDING_LIMIT = 20;          // Rides per pending list; devices keep the nearest few
+const PENDING_RADIUS_KM = 10;
+const RICKSHAW_STALE_S = 300;      // Positions not refreshed for this long are dropped
+
+let spatial = null;
+try {
+  const { SpatialIndex } = require('./native/build/Release/aeras_spatial.node');
+  spatial = new SpatialIndex({ cellMeters: 500, refLat: 22.46 });
+  console.log('✓ Native proximity index loaded');
+} catch (err) {
+  console.log('⚠️ Native proximity index not built, pending rides use the SQL scan');
+}
+
+// blockID -> { lat, lng }: where a ride's pickup goes in the index
+const blockCoords = new Map();
+
+function indexRide(ride) {
+  const block = blockCoords.get(ride.pickupBlock);
+  if (ride.status === 'PENDING' && block) spatial.upsertRide(ride.rideID, block.lat, block.lng);
+  else spatial.removeRide(ride.rideID);
+}
+
+function trackRickshaw(rickshawID, lat, lng) {
+  if (spatial && rickshawID && Number.isFinite(lat) && Number.isFinite(lng)) {
+    spatial.upsertRickshaw(String(rickshawID), lat, lng);
+  }
+}
+
+function loadProximityIndex() {
+  db.all('SELECT blockID, latitude, longitude FROM locations', (err, rows) => {
+    if (err) return;
+    rows.forEach(l => blockCoords.set(l.blockID, { lat: l.latitude, lng: l.longitude }));
+  });
+  if (!spatial) return;
+  db.all(
+    `SELECT r.rideID, r.status, r.pickupBlock FROM rides r WHERE r.status = 'PENDING'`,
+    (err, rides) => {
+      if (err) return;
+      rides.forEach(indexRide);
+      console.log(`✓ Proximity index: ${rides.length} pending rides`);
+    }
+  );
+  db.all('SELECT rickshawID, currentLat, currentLng FROM rickshaws WHERE isOnline = 1', (err, rows) => {
+    if (err) return;
+    rows.forEach(r => {
+      const { lat, lng } = knownPosition(r.rickshawID, r);
+      trackRickshaw(r.rickshawID, lat, lng);
+    });
+  });
+}
+
+// Serialized behind the schema and seed statements queued above
+db.serialize(loadProximityIndex);
+
+setInterval(() => {
+  if (spatial) spatial.pruneRickshaws(RICKSHAW_STALE_S);
+}, 60000);
+
+// ========== LOCATION JOURNAL ==========
+// Position fixes land in a memory-mapped journal (native/LocationJournal)
+// instead of costing an UPDATE each. Readers get the latest fix from
+// memory, and once a second the rickshaws that moved are written in one
+// transaction, last fix only. Fixes a killed process left uncommitted are
+// replayed by the first commit. Without the addon every fix is its own
+// UPDATE, as before.
+const LOCATION_JOURNAL = './aeras-locations.journal';
+const LOCATION_COMMIT_MS = 1000;
+
+let locationJournal = null;
+try {
+  const { LocationJournal } = require('./native/build/Release/aeras_locations.node');
+  locationJournal = new LocationJournal({ path: LOCATION_JOURNAL, capacity: 65536 });
+  console.log('✓ Native location journal loaded');
+  const { recovered } = locationJournal.stats();
+  if (recovered > 0) console.log(`✓ Replaying ${recovered} rickshaw positions from ${LOCATION_JOURNAL}`);
+} catch (err) {
+  console.log('⚠️ Native location journal not built, each position fix is its own UPDATE');
+}
+
+// Indexes the fix and journals it; false when the caller must write it
+// (no addon, a non-numeric position, an ID too long for the journal)
+function journalPosition(rickshawID, lat, lng) {
+  trackRickshaw(rickshawID, lat, lng);
+  return !!locationJournal && Number.isFinite(lat) && Number.isFinite(lng) &&
+         locationJournal.append(String(rickshawID), lat, lng) > 0;
+}
+
+// The journal runs ahead of the rickshaws row by up to one commit
+function knownPosition(rickshawID, row) {
+  const fix = locationJournal && locationJournal.position(String(rickshawID));
+  return fix ? { lat: fix.lat, lng: fix.lng } : { lat: row.currentLat, lng: row.currentLng };
+}
+
+let committingPositions = false;
+
+// Group commit: one UPDATE per rickshaw that moved, in one transaction
+function commitPositions() {
+  if (committingPositions) return;
+  const { through, fixes } = locationJournal.drain();
+  if (fixes.length === 0) return;
+  committingPositions = true;
+  
+  inTransaction((done) => db.serialize(() => {
+    db.run('BEGIN TRANSACTION');
+    fixes.forEach(fix => db.run(
+      'UPDATE rickshaws SET currentLat = ?, currentLng = ?, lastUpdated = ? WHERE rickshawID = ?',
+      [fix.lat, fix.lng, sqliteTime(fix.at), fix.rickshawID]
+    ));
+    db.run('COMMIT', (err) => {
+      committingPositions = false;
+      if (err) {
+        // Still dirty in the journal; the next commit retries them
+        console.error('✗ Position group commit failed:', err.message);
+        return db.run('ROLLBACK', () => done());  // SQLite may have rolled back already
+      }
+      locationJournal.committed(through);
+      done();
+    });
+  }));
+}
+
+if (locationJournal) {
+  // The first commit, behind the schema, lands anything replayed
+  db.serialize(commitPositions);
+  setInterval(commitPositions, LOCATION_COMMIT_MS);
+}
+
+// ========== RIDE STATE TABLE ==========
+// First-accept-wins without a database transaction (native/RideStateTable):
+// each live ride is one atomic word, and accept, pickup, timeout and cancel
+// are single compare-and-swaps answered at once. A won transition is
+// appended to a write-behind log (synced off the event loop), then written
+// to SQLite with the rest of that event-loop turn's transitions in one
+// transaction. At start the log is replayed: every write is guarded by the
+// state it leaves, so one that already landed changes nothing. Rides the
+// table does not hold (addon not built, table full) take the SQL path.
+const RIDE_LOG = './aeras-rides.log';
+const RIDE_TIMEOUT_MS = 60000;     // TEST CASE 8d: unanswered requests expire
+
+// Read before the addon reopens the file for appending
+const unappliedTransitions = fs.existsSync(RIDE_LOG) ?
+  fs.readFileSync(RIDE_LOG, 'utf8').split('\n').filter(Boolean) : [];
+
+let rideStates = null;
+// Pending-ride deadlines on a timer wheel (native/TimerWheel), advanced once
+// a second; without the addon each request arms its own setTimeout
+let rideDeadlines = null;
+try {
+  const { RideStates, RideDeadlines } = require('./native/build/Release/aeras_rides.node');
+  rideStates = new RideStates({ capacity: 65536, logPath: RIDE_LOG });
+  rideDeadlines = new RideDeadlines({ tickMs: 1000, slots: 128 });
+  console.log('✓ Native ride state table loaded');
+} catch (err) {
+  console.log('⚠️ Native ride state table not built, accepts use SQL transactions');
+}
+
+// rideID -> { pickupBlock, destination } of rides on offer, for accept replies
+const rideDetails = new Map();
+
+// Request bodies may carry ride IDs as strings; 0 means "use the SQL path"
+function tableRideID(rideID) {
+  const id = parseInt(rideID, 10);
+  return rideStates && id > 0 ? id : 0;
+}
+
+// Completed or closed by an admin: nothing left to race for or expire
+function retireRide(rideID) {
+  const id = tableRideID(rideID);
+  if (!id) return;
+  rideStates.close(id);
+  rideDeadlines.cancel(id);
+}
+
+// Back on offer after a cancel: a fresh window before it expires
+function rearmRide(rideID) {
+  const id = tableRideID(rideID);
+  if (id) rideDeadlines.schedule(id, Date.now() + RIDE_TIMEOUT_MS);
+}
+
+// The table runs ahead of SQLite by up to one write-behind batch
+function withLiveState(ride) {
+  const live = ride && rideStates && rideStates.get(ride.rideID);
+  if (!live || live.status === 'CLOSED') return ride;
+  return { ...ride, status: live.status, rickshawID: live.rickshawID };
+}
+
+// Every timeout in a batch is one statement
+function timeoutStatement(rideIDs) {
+  return [`UPDATE rides SET status = 'TIMEOUT' 
+           WHERE status = 'PENDING' AND rideID IN (${rideIDs.map(() => '?').join(', ')})`, rideIDs];
+}
+
+function transitionStatements({ rideID, status, rickshawID, at }) {
+  switch (status) {
+    case 'ACCEPTED': return [
+      [`UPDATE rides SET status = 'ACCEPTED', rickshawID = ?, acceptTime = ? 
+        WHERE rideID = ? AND status = 'PENDING'`, [rickshawID, sqliteTime(at), rideID]],
+      [`UPDATE rickshaws SET status = 'ON_RIDE' WHERE rickshawID = ?`, [rickshawID]]
+    ];
+    case 'PICKUP': return [
+      [`UPDATE rides SET status = 'PICKUP', pickupTime = ? WHERE rideID = ? AND status = 'ACCEPTED'`,
+       [sqliteTime(at), rideID]]
+    ];
+    case 'TIMEOUT': return [timeoutStatement([rideID])];
+    case 'PENDING': return [  // Cancelled by the rickshaw that held it
+      [`UPDATE rides SET status = 'PENDING', rickshawID = NULL, acceptTime = NULL 
+        WHERE rideID = ? AND rickshawID = ? AND status IN ('ACCEPTED', 'PICKUP')`, [rideID, rickshawID]],
+      [`UPDATE rickshaws SET status = 'AVAILABLE' WHERE rickshawID = ?`, [rickshawID]]
+    ];
+  }
+  return [];
+}
+
+const TRANSITION_RETRY_MS = 1000;
+let pendingTransitions = [];
+// Batches handed to SQLite whose COMMIT has not come back yet
+const unflushedBatches = new Set();
+let committedSeq = 0;
+let replayedLeft = 0;   // Replayed log records not yet committed (no addon)
+
+function queueTransition(result, rideID, status, rickshawID) {
+  pendingTransitions.push({ seq: result.seq || 0, rideID, status, rickshawID, at: Date.now() });
+  if (pendingTransitions.length === 1) setImmediate(flushTransitions);
+}
+
+// One transaction for everything queued; publishes once it has committed
+function flushTransitions() {
+  const batch = pendingTransitions;
+  pendingTransitions = [];
+  if (batch.length === 0) return;
+  
+  const timeouts = batch.filter(t => t.status === 'TIMEOUT').map(t => t.rideID);
+  unflushedBatches.add(batch);
+  
+  inTransaction((done) => db.serialize(() => {
+    db.run('BEGIN TRANSACTION');
+    batch.filter(t => t.status !== 'TIMEOUT')
+      .forEach(t => transitionStatements(t).forEach(([sql, params]) => db.run(sql, params)));
+    if (timeouts.length > 0) db.run(...timeoutStatement(timeouts));
+    db.run('COMMIT', (err) => {
+      unflushedBatches.delete(batch);
+      if (err) {
+        // Back to the head of the queue; the log keeps it until it lands
+        console.error('✗ Ride state write-behind failed, retrying:', err.message);
+        db.run('ROLLBACK', () => done());  // SQLite may have rolled back already
+        pendingTransitions = batch.concat(pendingTransitions);
+        return setTimeout(flushTransitions, TRANSITION_RETRY_MS);
+      }
+      done();
+      batch.forEach(t => publishRideUpdate(t.rideID));
+      reportApplied(batch);
+    });
+  }));
+}
+
+// The log truncates once applied() covers everything written, so it must
+// never be told more than the seq below the oldest transition still unapplied
+function reportApplied(batch) {
+  if (!rideStates) {
+    // Nothing appends to the log without the addon: empty it once the last
+    // replayed record has committed
+    const replayed = batch.filter(t => t.replayed).length;
+    replayedLeft -= replayed;
+    if (replayed > 0 && replayedLeft === 0) fs.writeFileSync(RIDE_LOG, '');
+    return;
+  }
+  const oldest = (transitions, low) =>
+    transitions.reduce((min, t) => (t.seq > 0 && t.seq < min ? t.seq : min), low);
+  
+  committedSeq = batch.reduce((max, t) => Math.max(max, t.seq), committedSeq);
+  let unapplied = oldest(pendingTransitions, Infinity);
+  unflushedBatches.forEach(b => { unapplied = oldest(b, unapplied); });
+  rideStates.applied(Math.min(committedSeq, unapplied - 1));
+}
+
+// Due rides leave the table by CAS (an accept racing the tick wins or loses
+// cleanly) and reach SQLite in the next write-behind batch
+function expireRides() {
+  const due = rideDeadlines.advance(Date.now());
+  let expired = 0;
+  due.forEach(rideID => {
+    const result = rideStates.expire(rideID);
+    if (result.outcome === 'lost') return;
+    // 'unknown': not in the table, so the guarded UPDATE decides
+    rideDetails.delete(rideID);
+    queueTransition(result, rideID, 'TIMEOUT', null);
+    expired++;
+  });
+  if (expired > 0) console.log(`⏱ ${expired} rides TIMEOUT (${RIDE_TIMEOUT_MS / 1000}s expired)`);
+}
+
+// Serialized behind the schema: replay the log, then load the live rides
+// and re-arm the pending ones from their request time
+function loadRideStates() {
+  if (unappliedTransitions.length > 0) {
+    unappliedTransitions.forEach(line => {
+      // <seq> <JSON record>; logged again under a new seq, which holds off
+      // truncation until the replay itself has committed
+      const record = line.slice(line.indexOf(' ') + 1);
+      try {
+        const { rideID, status, rickshawID, at } = JSON.parse(record);
+        const seq = rideStates ? rideStates.relog(record) : 0;
+        pendingTransitions.push({ seq, rideID, status, rickshawID, at, replayed: true });
+        replayedLeft++;
+      } catch (err) {
+        console.error('⚠️ Skipping unreadable ride log record:', line);
+      }
+    });
+    console.log(`✓ Replaying ${unappliedTransitions.length} ride transitions from ${RIDE_LOG}`);
+    flushTransitions();
+  }
+  if (!rideStates) return;
+  
+  db.all(
+    `SELECT rideID, status, rickshawID, pickupBlock, destination,
+            CAST(strftime('%s', requestTime) AS INTEGER) * 1000 AS requestMs
+     FROM rides 
+     WHERE status IN ('PENDING', 'ACCEPTED', 'PICKUP')`,
+    (err, rides) => {
+      if (err) return;
+      rides.forEach(ride => {
+        rideStates.insert(ride.rideID, ride.status, ride.rickshawID || undefined);
+        if (ride.status === 'PENDING') {
+          rideDetails.set(ride.rideID, { pickupBlock: ride.pickupBlock, destination: ride.destination });
+          rideDeadlines.schedule(ride.rideID, ride.requestMs + RIDE_TIMEOUT_MS);
+        }
+      });
+      console.log(`✓ Ride state table: ${rides.length} live rides`);
+      setInterval(expireRides, 1000);
+    }
+  );
+}
+
+db.serialize(loadRideStates);
+
+// ========== PUSH EVENTS (SSE) ==========
+// Hardware units hold one /api/events connection instead of polling.
+// Block units get updates for rides from their block; rickshaws get new
+// offers, offers being withdrawn, and updates for rides assigned to them.
+// Events are addressed by key - b:<blockID>, r:<rickshawID>, r:* for every
+// rickshaw - the same keys the native gateway routes on.
+const eventSubscribers = new Set();
+
+function streamKeys(blockID, rickshawID) {
+  const keys = [];
+  if (blockID) keys.push(`b:${blockID}`);
+  if (rickshawID) keys.push(`r:${rickshawID}`, 'r:*');
+  return keys;
+}
+
+app.get('/api/events', (req, res) => {
+  const { blockID, rickshawID } = req.query;
+
+  if (!blockID && !rickshawID) {
+    return res.status(400).json({ error: 'blockID or rickshawID required' });
+  }
+
+  res.writeHead(200, {
+    'Content-Type': 'text/event-stream',
+    'Cache-Control': 'no-cache',
+    'Connection': 'keep-alive'
+  });
+  res.write(': connected\n\n');
+  req.socket.setNoDelay(true);
+
+  const subscriber = { res, keys: streamKeys(blockID, rickshawID) };
+  eventSubscribers.add(subscriber);
+  console.log(`📡 Event stream opened (${blockID || rickshawID}), ${eventSubscribers.size} open`);
+
+  req.on('close', () => {
+    eventSubscribers.delete(subscriber);
+  });
+});
+
+// Keep idle streams (and NAT entries) alive
+setInterval(() => {
+  eventSubscribers.forEach(sub => sub.res.write(': ping\n\n'));
+}, 15000);
+
+function pushEvent(event, data, keys) {
+  const frame = `event: ${event}\ndata: ${JSON.stringify(data)}\n\n`;
+  eventSubscribers.forEach(sub => {
+    if (sub.keys.some(key => keys.includes(key))) sub.res.write(frame);
+  });
+  forwardToGateway(event, data, keys);
+}
+
+// Statuses every rickshaw cares about: new offers and offers going away
+const OFFER_STATUSES = ['PENDING', 'ACCEPTED', 'TIMEOUT', 'CANCELLED'];
+
+// Bumped whenever the pending set changes; every such change is published
+// below. Heartbeats carry the value the device last saw. Seeded from the
+// clock so a restarted server never repeats a version a device holds.
+let pendingVersion = Math.floor(Date.now() / 1000);
+
+function publishRideUpdate(rideID) {
+  db.get(
+    'SELECT rideID, status, rickshawID, pickupBlock, destination FROM rides WHERE rideID = ?',
+    [rideID],
+    (err, ride) => {
+      if (err || !ride) return;
+      if (OFFER_STATUSES.includes(ride.status)) pendingVersion++;
+      if (spatial) indexRide(ride);
+
+      const keys = [`b:${ride.pickupBlock}`];
+      if (ride.rickshawID) keys.push(`r:${ride.rickshawID}`);
+      if (OFFER_STATUSES.includes(ride.status)) keys.push('r:*');
+      pushEvent('ride', ride, keys);
+    }
+  );
+}
+
+// ========== EVENT GATEWAY ==========
+// The native gateway (native/EventGateway, `npm run gateway`) holds device
+// streams in one epoll loop instead of this process; devices and the web
+// app point their event URL at it. Every event pushed above is forwarded
+// over its Unix socket as one "<keys> <event> <json>" line. Connects and
+// reconnects quietly, so the gateway can start after the server or
+// restart under it.
+const GATEWAY_SOCKET = process.env.GATEWAY_SOCKET || './aeras-gateway.sock';
+const GATEWAY_RETRY_MS = 5000;
+const GATEWAY_MAX_BUFFER = 1 << 20;   // Bytes queued before events are dropped
+
+let gateway = null;
+
+function connectGateway() {
+  const socket = net.createConnection(GATEWAY_SOCKET);
+  socket.on('connect', () => {
+    gateway = socket;
+    console.log(`✓ Event gateway connected (${GATEWAY_SOCKET})`);
+  });
+  socket.on('error', () => {});  // 'close' follows
+  socket.on('close', () => {
+    if (gateway === socket) {
+      gateway = null;
+      console.log('⚠️ Event gateway disconnected, retrying');
+    }
+    setTimeout(connectGateway, GATEWAY_RETRY_MS).unref();
+  });
+}
+
+// Keys with spaces or commas cannot be routed; those streams stay here
+function forwardToGateway(event, data, keys) {
+  if (!gateway || gateway.writableLength > GATEWAY_MAX_BUFFER) return;
+  const routable = keys.filter(key => !/[\s,]/.test(key));
+  if (routable.length > 0) gateway.write(`${routable.join(',')} ${event} ${JSON.stringify(data)}\n`);
+}
+
+connectGateway();
+
 // ========== USER SIDE ENDPOINTS ==========
 // Serve static files for user app
 app.use('/rickshaw', express.static(path.join(__dirname, 'public/rickshaw-app')));
@@ -177,15 +730,27 @@ app.post('/api/ride/request', (req, res) => {
       const rideID = this.lastID;
       console.log(`✓ Ride created: ID ${rideID}`);
       
-      // TEST CASE 8d: Set timeout for 60 seconds
-      setTimeout(() => {
-        db.get('SELECT status FROM rides WHERE rideID = ?', [rideID], (err, row) => {
-          if (row && row.status === 'PENDING') {
-            db.run('UPDATE rides SET status = "TIMEOUT" WHERE rideID = ?', [rideID]);
-            console.log(`⏱ Ride ${rideID} TIMEOUT (60s expired)`);
-          }
-        });
-      }, 60000);
+      // Listed from the next poll, not once publishRideUpdate() has read it back
+      if (spatial) indexRide({ rideID, status: 'PENDING', pickupBlock: blockID });
+      
+      // TEST CASE 8d: expire after RIDE_TIMEOUT_MS unless accepted
+      if (rideStates) {
+        if (rideStates.insert(rideID, 'PENDING')) {
+          rideDetails.set(rideID, { pickupBlock: blockID, destination });
+        }
+        rideDeadlines.schedule(rideID, Date.now() + RIDE_TIMEOUT_MS);
+      } else {
+        setTimeout(() => {
+          db.get('SELECT status FROM rides WHERE rideID = ?', [rideID], (err, row) => {
+            if (row && row.status === 'PENDING') {
+              db.run('UPDATE rides SET status = "TIMEOUT" WHERE rideID = ?', [rideID], () => publishRideUpdate(rideID));
+              console.log(`⏱ Ride ${rideID} TIMEOUT (60s expired)`);
+            }
+          });
+        }, RIDE_TIMEOUT_MS);
+      }
+      
+      publishRideUpdate(rideID);
       
       res.json({ 
         success: true, 
@@ -230,6 +795,69 @@ app.get('/api/ride/status', (req, res) => {
   );
 });
 
+// 2b. SINGLE RIDE STATE (rickshaw polling fallback)
+// Primary-key lookup with an ETag derived from the fields that matter, so an
+// unchanged ride costs a bodyless 304 instead of an /admin/rides scan.
+app.get('/api/ride/:rideID/state', (req, res) => {
+  db.get(
+    `SELECT rideID, status, rickshawID, pickupBlock, destination 
+     FROM rides WHERE rideID = ?`,
+    [req.params.rideID],
+    (err, row) => {
+      if (err) {
+        return res.status(500).json({ error: err.message });
+      }
+      if (!row) {
+        return res.status(404).json({ error: 'Ride not found' });
+      }
+      row = withLiveState(row);
+
+      const etag = `"${row.rideID}-${row.status}-${row.rickshawID || ''}"`;
+      res.set('ETag', etag);
+      res.set('Cache-Control', 'no-cache');
+
+      if (req.get('If-None-Match') === etag) {
+        return res.status(304).end();
+      }
+
+      res.json(row);
+    }
+  );
+});
+
+
+// 2c. BLOCK LOCATIONS (device block table overlay)
+// Devices send the ETag of the table they hold; 304 unless an admin has
+// edited locations since. "version" is written first so the firmware can
+// read it before streaming the rows.
+app.get('/api/locations', (req, res) => {
+  db.get(`SELECT value FROM meta WHERE key = 'locationsVersion'`, (err, meta) => {
+    if (err) {
+      return res.status(500).json({ error: err.message });
+    }
+    
+    const version = meta ? meta.value : 1;
+    const etag = `"locations-${version}"`;
+    res.set('ETag', etag);
+    res.set('Cache-Control', 'no-cache');
+    
+    if (req.get('If-None-Match') === etag) {
+      return res.status(304).end();
+    }
+    
+    db.all(
+      `SELECT blockID, locationName AS name, latitude AS lat, longitude AS lng 
+       FROM locations ORDER BY blockID`,
+      (err, rows) => {
+        if (err) {
+          return res.status(500).json({ error: err.message });
+        }
+        res.json({ version, locations: rows });
+      }
+    );
+  });
+});
+
 
 // ========== RICKSHAW SIDE ENDPOINTS ==========
 
@@ -248,12 +876,68 @@ app.post('/api/rickshaw/register', (req, res) => {
       if (err) {
         return res.status(500).json({ error: err.message });
       }
+      // Supersedes any fix of an earlier registration not yet committed
+      journalPosition(rickshawID, currentLat, currentLng);
       console.log(`✓ ${rickshawID} registered`);
       res.json({ success: true });
     }
   );
 });
 
+const PENDING_COLUMNS = `r.*, l.latitude, l.longitude, l.locationName,
+            CAST(strftime('%s', 'now') - strftime('%s', r.requestTime) AS INTEGER) AS age`;
+
+// TEST CASE 8a/8b: the nearest `limit` pending rides within `radiusKm` of
+// (lat, lng) with their pickup location, nearest first, ties to the older
+// ride. age (seconds waiting) lets devices rank offers themselves. Shared
+// by /ride/pending and the heartbeat.
+function pendingRidesNear(lat, lng, { limit = PENDING_LIMIT, radiusKm = PENDING_RADIUS_KM } = {}, callback) {
+  if (spatial) {
+    return pendingRidesByIndex(spatial.nearest(lat, lng, limit, radiusKm), callback);
+  }
+  
+  db.all(
+    `SELECT ${PENDING_COLUMNS}
+     FROM rides r 
+     JOIN locations l ON r.pickupBlock = l.blockID 
+     WHERE r.status = 'PENDING'`,
+    (err, rows) => {
+      if (err) return callback(err);
+      
+      const rides = rows
+        .map(ride => ({ ride, meters: calculateDistance(lat, lng, ride.latitude, ride.longitude) }))
+        .filter(hit => hit.meters <= radiusKm * 1000)
+        .sort((a, b) => a.meters - b.meters || a.ride.rideID - b.ride.rideID)
+        .slice(0, limit)
+        .map(hit => ({ ...hit.ride, distance: (hit.meters / 1000).toFixed(2) })); // km
+      callback(null, rides);
+    }
+  );
+}
+
+// Rows for index hits ([{rideID, distance}] in meters), in the index's order.
+// A ride accepted since it was indexed drops out on the status check.
+function pendingRidesByIndex(hits, callback) {
+  if (hits.length === 0) return callback(null, []);
+  
+  db.all(
+    `SELECT ${PENDING_COLUMNS}
+     FROM rides r 
+     JOIN locations l ON r.pickupBlock = l.blockID 
+     WHERE r.status = 'PENDING' AND r.rideID IN (${hits.map(() => '?').join(', ')})`,
+    hits.map(hit => hit.rideID),
+    (err, rows) => {
+      if (err) return callback(err);
+      
+      const byID = new Map(rows.map(ride => [ride.rideID, ride]));
+      const rides = hits
+        .filter(hit => byID.has(hit.rideID))
+        .map(hit => ({ ...byID.get(hit.rideID), distance: (hit.distance / 1000).toFixed(2) })); // km
+      callback(null, rides);
+    }
+  );
+}
+
 // 4. GET PENDING RIDES (TEST CASE 8: Alert distribution with proximity)
 app.get('/api/ride/pending', (req, res) => {
   const { rickshawID } = req.query;
@@ -262,6 +946,29 @@ app.get('/api/ride/pending', (req, res) => {
     return res.status(400).json({ error: 'rickshawID required' });
   }
   
+  // Devices send their live position with the poll; it is fresher than the
+  // last track batch
+  const lat = parseFloat(req.query.lat);
+  const lng = parseFloat(req.query.lng);
+  const live = Number.isFinite(lat) && Number.isFinite(lng);
+  
+  const limit = parseInt(req.query.limit, 10) > 0 ? parseInt(req.query.limit, 10) : PENDING_LIMIT;
+  const radiusKm = parseFloat(req.query.radiusKm) > 0 ? parseFloat(req.query.radiusKm) : PENDING_RADIUS_KM;
+  const respond = (err, rides) => {
+    if (err) {
+      return res.status(500).json({ error: err.message });
+    }
+    res.json({ rides });
+  };
+  
+  if (live) {
+    trackRickshaw(rickshawID, lat, lng);
+  } else {
+    // Last known position from the index, without reading the rickshaw row
+    const hits = spatial && spatial.nearestTo(String(rickshawID), limit, radiusKm);
+    if (hits) return pendingRidesByIndex(hits, respond);
+  }
+  
   // Get rickshaw location
   db.get('SELECT currentLat, currentLng FROM rickshaws WHERE rickshawID = ?', 
     [rickshawID], 
@@ -269,34 +976,8 @@ app.get('/api/ride/pending', (req, res) => {
       if (err || !rickshaw) {
         return res.json({ rides: [] });
       }
-      
-      // TEST CASE 8a: Get all pending rides with location
-      db.all(
-        `SELECT r.*, l.latitude, l.longitude, l.locationName 
-         FROM rides r 
-         JOIN locations l ON r.pickupBlock = l.blockID 
-         WHERE r.status = 'PENDING' 
-         ORDER BY r.requestTime ASC`,
-        (err, rows) => {
-          if (err) {
-            return res.status(500).json({ error: err.message });
-          }
-          
-          // TEST CASE 8b: Calculate distances and sort by proximity
-          const ridesWithDistance = rows.map(ride => {
-            const distance = calculateDistance(
-              rickshaw.currentLat, rickshaw.currentLng,
-              ride.latitude, ride.longitude
-            );
-            return { 
-              ...ride, 
-              distance: (distance / 1000).toFixed(2) // km
-            };
-          }).sort((a, b) => parseFloat(a.distance) - parseFloat(b.distance));
-          
-          res.json({ rides: ridesWithDistance });
-        }
-      );
+      const position = live ? { lat, lng } : knownPosition(rickshawID, rickshaw);
+      pendingRidesNear(position.lat, position.lng, { limit, radiusKm }, respond);
     }
   );
 });
@@ -311,7 +992,44 @@ app.post('/api/ride/accept', (req, res) => {
 
   console.log(`\n🤝 ${rickshawID} attempting to accept ride ${rideID}`);
 
-  db.serialize(() => {
+  // Decided by one CAS; SQLite catches up behind the reply
+  const id = tableRideID(rideID);
+  const accepted = id ? rideStates.accept(id, String(rickshawID)) : { outcome: 'unknown' };
+  const reply = (ride) => res.json({
+    success: true,
+    rideID: id,
+    pickupBlock: ride.pickupBlock,
+    destination: ride.destination,
+    message: "Ride accepted"
+  });
+  
+  if (accepted.outcome === 'lost') {
+    // A retried accept from the rickshaw that already holds the ride
+    if (accepted.status === 'ACCEPTED' && accepted.rickshawID === String(rickshawID)) {
+      console.log(`✓ Ride ${rideID} already accepted by ${rickshawID}`);
+      return db.get('SELECT pickupBlock, destination FROM rides WHERE rideID = ?', [id],
+                    (err, ride) => reply(ride || {}));
+    }
+    console.log(`✗ Ride ${rideID} already taken`);
+    return res.json({
+      success: false,
+      message: 'Ride already taken by another puller'
+    });
+  }
+  if (accepted.outcome === 'won') {
+    queueTransition(accepted, id, 'ACCEPTED', String(rickshawID));
+    rideDeadlines.cancel(id);
+    console.log(`✓ Ride ${rideID} accepted by ${rickshawID}`);
+    
+    const details = rideDetails.get(id);
+    rideDetails.delete(id);
+    if (details) return reply(details);
+    // Back on offer after a cancel: only the reply waits for the row
+    return db.get('SELECT pickupBlock, destination FROM rides WHERE rideID = ?', [id],
+                  (err, ride) => reply(ride || {}));
+  }
+
+  inTransaction((done) => db.serialize(() => {
     db.run('BEGIN TRANSACTION');
 
     // 1. Check if the ride is still pending
@@ -320,12 +1038,27 @@ app.post('/api/ride/accept', (req, res) => {
       [rideID],
       (err, ride) => {
         if (err) {
-          db.run('ROLLBACK');
+          db.run('ROLLBACK', done);
           return res.status(500).json({ error: err.message });
         }
 
+        if (ride && ride.status === 'ACCEPTED' && ride.rickshawID === String(rickshawID)) {
+          // A retried accept from the rickshaw that already holds the ride
+          db.run('ROLLBACK', done);
+          console.log(`✓ Ride ${rideID} already accepted by ${rickshawID}`);
+          return res.json({
+            success: true,
+            rideID: ride.rideID,
+            pickupBlock: ride.pickupBlock,
+            destination: ride.destination,
+            userLat: ride.userLat,
+            userLng: ride.userLng,
+            message: "Ride accepted"
+          });
+        }
+
         if (!ride || ride.status !== 'PENDING') {
-          db.run('ROLLBACK');
+          db.run('ROLLBACK', done);
           console.log(`✗ Ride ${rideID} already taken`);
           return res.json({
             success: false,
@@ -343,12 +1076,12 @@ app.post('/api/ride/accept', (req, res) => {
           [rickshawID, rideID],
           function(err) {
             if (err) {
-              db.run('ROLLBACK');
+              db.run('ROLLBACK', done);
               return res.status(500).json({ error: err.message });
             }
 
             if (this.changes === 0) {
-              db.run('ROLLBACK');
+              db.run('ROLLBACK', done);
               return res.json({ success: false, message: 'Race condition' });
             }
 
@@ -359,7 +1092,11 @@ app.post('/api/ride/accept', (req, res) => {
             );
 
             // 4. Commit the transaction
-            db.run('COMMIT');
+            db.run('COMMIT', () => {
+              done();
+              publishRideUpdate(rideID);
+            });
+            if (tableRideID(rideID)) rideDeadlines.cancel(tableRideID(rideID));
 
             console.log(`✓ Ride ${rideID} accepted by ${rickshawID}`);
 
@@ -377,7 +1114,7 @@ app.post('/api/ride/accept', (req, res) => {
         );
       }
     );
-  });
+  }));
 });
 
 
@@ -391,6 +1128,17 @@ app.post('/api/ride/pickup', (req, res) => {
   
   console.log(`\n🚗 Pickup confirmed for ride ${rideID}`);
   
+  const id = tableRideID(rideID);
+  const picked = id ? rideStates.pickup(id) : { outcome: 'unknown' };
+  if (picked.outcome === 'lost') {
+    return res.status(400).json({ error: 'Ride not in accepted state' });
+  }
+  if (picked.outcome === 'won') {
+    queueTransition(picked, id, 'PICKUP', picked.rickshawID);
+    console.log(`✓ Pickup confirmed`);
+    return res.json({ success: true });
+  }
+  
   db.run(
     `UPDATE rides 
      SET status = 'PICKUP', 
@@ -407,6 +1155,7 @@ app.post('/api/ride/pickup', (req, res) => {
       }
       
       console.log(`✓ Pickup confirmed`);
+      publishRideUpdate(rideID);
       res.json({ success: true });
     }
   );
@@ -423,86 +1172,92 @@ app.post('/api/ride/complete', (req, res) => {
   console.log(`\n🏁 Completing ride ${rideID}`);
   console.log(`   Drop location: ${dropLat}, ${dropLng}`);
   
-  // Get ride with destination coordinates
-  db.get(
-    `SELECT r.*, l.latitude as destLat, l.longitude as destLng, l.locationName 
-     FROM rides r 
-     JOIN locations l ON r.destination = l.blockID 
-     WHERE r.rideID = ?`,
-    [rideID],
-    (err, ride) => {
-      if (err) {
-        return res.status(500).json({ error: err.message });
-      }
+  // Land a write-behind pickup first; serialized, the read below follows it
+  flushTransitions();
+  db.serialize(() => {
+    // Get ride with destination coordinates
+    db.get(
+      `SELECT r.*, l.latitude as destLat, l.longitude as destLng, l.locationName 
+       FROM rides r 
+       JOIN locations l ON r.destination = l.blockID 
+       WHERE r.rideID = ?`,
+      [rideID],
+      (err, ride) => {
+        if (err) {
+          return res.status(500).json({ error: err.message });
+        }
       
-      if (!ride) {
-        return res.status(404).json({ error: 'Ride not found' });
-      }
+        if (!ride) {
+          return res.status(404).json({ error: 'Ride not found' });
+        }
       
-      // TEST CASE 7: Calculate distance from destination
-      const distanceFromDest = calculateDistance(
-        dropLat, dropLng, 
-        ride.destLat, ride.destLng
-      );
+        // TEST CASE 7: Calculate distance from destination
+        const distanceFromDest = calculateDistance(
+          dropLat, dropLng, 
+          ride.destLat, ride.destLng
+        );
       
-      console.log(`   Target: ${ride.locationName} (${ride.destLat}, ${ride.destLng})`);
-      console.log(`   Distance from destination: ${distanceFromDest.toFixed(2)} m`);
+        console.log(`   Target: ${ride.locationName} (${ride.destLat}, ${ride.destLng})`);
+        console.log(`   Distance from destination: ${distanceFromDest.toFixed(2)} m`);
       
-      // TEST CASE 7: Calculate points
-      const points = calculatePoints(distanceFromDest);
-      const status = distanceFromDest <= 100 ? 'COMPLETED' : 'PENDING_REVIEW';
+        // TEST CASE 7: Calculate points
+        const points = calculatePoints(distanceFromDest);
+        const status = distanceFromDest <= 100 ? 'COMPLETED' : 'PENDING_REVIEW';
       
-      console.log(`   Points awarded: ${points}`);
-      console.log(`   Status: ${status}`);
+        console.log(`   Points awarded: ${points}`);
+        console.log(`   Status: ${status}`);
       
-      if (status === 'PENDING_REVIEW') {
-        console.log(`   ⚠ Distance > 100m - Requires admin review`);
-      }
+        if (status === 'PENDING_REVIEW') {
+          console.log(`   ⚠ Distance > 100m - Requires admin review`);
+        }
       
-      // Update ride
-      db.run(
-        `UPDATE rides 
-         SET status = ?, 
-             dropTime = CURRENT_TIMESTAMP, 
-             dropLat = ?, 
-             dropLng = ?, 
-             dropDistance = ?,
-             pointsAwarded = ? 
-         WHERE rideID = ?`,
-        [status, dropLat, dropLng, distanceFromDest, points, rideID],
-        (err) => {
-          if (err) {
-            return res.status(500).json({ error: err.message });
-          }
+        // Update ride
+        db.run(
+          `UPDATE rides 
+           SET status = ?, 
+               dropTime = CURRENT_TIMESTAMP, 
+               dropLat = ?, 
+               dropLng = ?, 
+               dropDistance = ?,
+               pointsAwarded = ? 
+           WHERE rideID = ?`,
+          [status, dropLat, dropLng, distanceFromDest, points, rideID],
+          (err) => {
+            if (err) {
+              return res.status(500).json({ error: err.message });
+            }
           
-          // TEST CASE 11: Award points
-          if (points > 0) {
-            db.run(
-              'UPDATE rickshaws SET totalPoints = totalPoints + ?, status = "AVAILABLE" WHERE rickshawID = ?', 
-              [points, ride.rickshawID]
-            );
+            // TEST CASE 11: Award points
+            if (points > 0) {
+              db.run(
+                'UPDATE rickshaws SET totalPoints = totalPoints + ?, status = "AVAILABLE" WHERE rickshawID = ?', 
+                [points, ride.rickshawID]
+              );
             
-            db.run(
-              `INSERT INTO points_history (rickshawID, rideID, pointsEarned, transactionType, notes) 
-               VALUES (?, ?, ?, 'EARNED', ?)`,
-              [ride.rickshawID, rideID, points, `Ride completed - ${distanceFromDest.toFixed(1)}m from target`]
-            );
-          } else {
-            db.run('UPDATE rickshaws SET status = "AVAILABLE" WHERE rickshawID = ?', [ride.rickshawID]);
-          }
+              db.run(
+                `INSERT INTO points_history (rickshawID, rideID, pointsEarned, transactionType, notes) 
+                 VALUES (?, ?, ?, 'EARNED', ?)`,
+                [ride.rickshawID, rideID, points, `Ride completed - ${distanceFromDest.toFixed(1)}m from target`]
+              );
+            } else {
+              db.run('UPDATE rickshaws SET status = "AVAILABLE" WHERE rickshawID = ?', [ride.rickshawID]);
+            }
           
-          console.log(`✓ Ride completed`);
+            console.log(`✓ Ride completed`);
+            retireRide(rideID);
+            publishRideUpdate(rideID);
           
-          res.json({ 
-            success: true, 
-            points: points,
-            distance: distanceFromDest.toFixed(2),
-            status: status
-          });
-        }
-      );
-    }
-  );
+            res.json({ 
+              success: true, 
+              points: points,
+              distance: distanceFromDest.toFixed(2),
+              status: status
+            });
+          }
+        );
+      }
+    );
+  });
 });
 
 // 8. UPDATE RICKSHAW LOCATION (TEST CASE 9: Real-time sync)
@@ -513,6 +1268,11 @@ app.post('/api/rickshaw/location', (req, res) => {
     return res.status(400).json({ error: 'Missing fields' });
   }
   
+  // Journaled: in SQLite with the next group commit
+  if (journalPosition(rickshawID, lat, lng)) {
+    return res.json({ success: true });
+  }
+  
   db.run(
     'UPDATE rickshaws SET currentLat = ?, currentLng = ?, lastUpdated = CURRENT_TIMESTAMP WHERE rickshawID = ?',
     [lat, lng, rickshawID],
@@ -525,6 +1285,109 @@ app.post('/api/rickshaw/location', (req, res) => {
   );
 });
 
+// 8b. TRAJECTORY BATCH: one transaction per batch - a multi-row INSERT of
+// the points (and one position UPDATE when the journal cannot take the
+// latest), instead of a request per fix
+app.post('/api/rickshaw/track', (req, res) => {
+  const { rickshawID } = req.body;
+  const points = rickshawID ? decodeTrack(req.body) : null;
+  
+  if (!points) {
+    return res.status(400).json({ error: 'rickshawID, latE6, lngE6, age and d required' });
+  }
+  
+  const latest = points[points.length - 1];
+  const rows = points.map(() => '(?, ?, ?, ?)').join(', ');
+  const values = points.flatMap(p => [rickshawID, p.lat, p.lng, p.recordedAt]);
+  
+  // Queued together behind any open transaction. A failed INSERT leaves no
+  // rows; the position is still good to keep.
+  const journaled = journalPosition(rickshawID, latest.lat, latest.lng);
+  inTransaction((done) => db.serialize(() => {
+    let insertErr = null;
+    db.run('BEGIN TRANSACTION');
+    db.run(
+      `INSERT INTO rickshaw_tracks (rickshawID, lat, lng, recordedAt) VALUES ${rows}`,
+      values,
+      (err) => { insertErr = err; }
+    );
+    if (!journaled) {
+      db.run(
+        'UPDATE rickshaws SET currentLat = ?, currentLng = ?, lastUpdated = CURRENT_TIMESTAMP WHERE rickshawID = ?',
+        [latest.lat, latest.lng, rickshawID]
+      );
+    }
+    db.run('COMMIT', (err) => {
+      if (err) {
+        db.run('ROLLBACK', () => done());
+      } else {
+        done();
+      }
+      if (insertErr || err) {
+        return res.status(500).json({ error: (insertErr || err).message });
+      }
+      res.json({ success: true, points: points.length });
+    });
+  }));
+});
+
+// 8c. HEARTBEAT: one round trip per cycle instead of separate pending-ride
+// and ride-state polls. The device sends its live position, the ride it
+// holds with the status it knows, and the pending-list version it last got.
+// The reply carries only what differs: "ride" when that ride changed or a
+// ride was assigned to this rickshaw elsewhere, "rides" when the pending
+// list changed. Keys stay in this order - the firmware streams them.
+// The position ranks the list only; stored positions come from /track.
+const ACTIVE_STATUSES = ['ACCEPTED', 'PICKUP'];
+
+app.post('/api/rickshaw/heartbeat', (req, res) => {
+  const { rickshawID, status } = req.body;
+  const rideID = parseInt(req.body.rideID, 10) || 0;
+  const version = parseInt(req.body.v, 10) || 0;
+  const lat = parseFloat(req.body.lat);
+  const lng = parseFloat(req.body.lng);
+  
+  if (!rickshawID || !Number.isFinite(lat) || !Number.isFinite(lng)) {
+    return res.status(400).json({ error: 'rickshawID, lat and lng required' });
+  }
+  
+  // Read before the queries, so a change racing them is resent next time
+  const current = pendingVersion;
+  trackRickshaw(rickshawID, lat, lng);
+  
+  db.all(
+    `SELECT rideID, status, rickshawID, pickupBlock, destination FROM rides 
+     WHERE rideID = ? OR (rickshawID = ? AND status IN ('ACCEPTED', 'PICKUP'))`,
+    [rideID, rickshawID],
+    (err, rows) => {
+      if (err) {
+        return res.status(500).json({ error: err.message });
+      }
+      
+      const held = withLiveState(rows.find(r => r.rideID === rideID));
+      const assigned = withLiveState(rows.find(r => r.rideID !== rideID));
+      let ride = null;
+      // A device resuming a ride after a reset learns here if it closed or moved on
+      if (held && (held.status !== status ||
+                   (ACTIVE_STATUSES.includes(status) && held.rickshawID !== rickshawID))) ride = held;
+      else if (assigned && !ACTIVE_STATUSES.includes(status)) ride = assigned;
+      
+      const onRide = ACTIVE_STATUSES.includes(status) || (ride && ride.rickshawID === rickshawID &&
+                                                          ACTIVE_STATUSES.includes(ride.status));
+      if (onRide || version === current) {
+        return res.json({ v: version, ride, rides: null });  // Keep the version the list was not sent for
+      }
+      
+      pendingRidesNear(lat, lng, {}, (err, rides) => {
+        if (err) {
+          return res.status(500).json({ error: err.message });
+        }
+        res.json({ v: current, ride, rides });
+      });
+    }
+  );
+});
+
 // ========== ADMIN ENDPOINTS (TEST CASE 10) ==========
 
 // 9. ADMIN DASHBOARD STATS
@@ -582,6 +1445,53 @@ app.get('/api/admin/rides', (req, res) => {
   });
 });
 
+// 10b. ADMIN ADD/MOVE A BLOCK
+// Bumps locationsVersion so devices pick the change up on their next boot
+app.post('/api/admin/locations', (req, res) => {
+  const { blockID, name, lat, lng } = req.body;
+  
+  if (!blockID || typeof lat !== 'number' || typeof lng !== 'number') {
+    return res.status(400).json({ error: 'blockID, lat and lng required' });
+  }
+  if (blockID.length > 23) {
+    return res.status(400).json({ error: 'blockID longer than 23 characters' });
+  }
+  
+  db.run(
+    `INSERT INTO locations (blockID, locationName, latitude, longitude) VALUES (?, ?, ?, ?)
+     ON CONFLICT(blockID) DO UPDATE SET 
+       locationName = excluded.locationName, latitude = excluded.latitude, longitude = excluded.longitude`,
+    [blockID, name || blockID, lat, lng],
+    (err) => {
+      if (err) {
+        // No version bump: devices must not see an overlay without the block
+        console.error(`✗ Block ${blockID} not saved:`, err.message);
+        return res.status(500).json({ error: err.message });
+      }
+      blockCoords.set(blockID, { lat, lng });
+      if (spatial) {
+        // Rides already waiting at a moved (or newly added) block
+        db.all(
+          `SELECT rideID, status, pickupBlock FROM rides WHERE pickupBlock = ? AND status = 'PENDING'`,
+          [blockID],
+          (err, rides) => { if (!err) rides.forEach(indexRide); }
+        );
+      }
+      db.run(
+        `UPDATE meta SET value = value + 1 WHERE key = 'locationsVersion'`,
+        function(err) {
+          if (err) {
+            return res.status(500).json({ error: err.message });
+          }
+          db.get(`SELECT value FROM meta WHERE key = 'locationsVersion'`, (err, meta) => {
+            res.json({ success: true, blockID, version: meta ? meta.value : null });
+          });
+        }
+      );
+    }
+  );
+});
+
 // 11. ADMIN ADJUST POINTS (TEST CASE 11)
 app.post('/api/admin/adjust-points', (req, res) => {
   const { rideID, newPoints, reason = 'Admin adjustment' } = req.body;
@@ -605,6 +1515,8 @@ app.post('/api/admin/adjust-points', (req, res) => {
       }
       
       db.run('UPDATE rickshaws SET totalPoints = totalPoints + ? WHERE rickshawID = ?', [pointDiff, ride.rickshawID]);
+      retireRide(rideID);
+      publishRideUpdate(rideID);
       
       db.run(
         `INSERT INTO points_history (rickshawID, rideID, pointsEarned, transactionType, notes) 
@@ -659,6 +1571,18 @@ app.post('/api/ride/cancel', (req, res) => {
   
   console.log(`\n❌ Rickshaw ${rickshawID} cancelling ride ${rideID}`);
   
+  const id = tableRideID(rideID);
+  const released = id ? rideStates.release(id, String(rickshawID)) : { outcome: 'unknown' };
+  if (released.outcome === 'lost') {
+    return res.status(400).json({ error: 'Cannot cancel ride' });
+  }
+  if (released.outcome === 'won') {
+    queueTransition(released, id, 'PENDING', String(rickshawID));
+    rearmRide(id);
+    console.log(`✓ Ride ${rideID} returned to PENDING - Re-alerting other pullers`);
+    return res.json({ success: true, message: 'Ride cancelled, re-alerting others' });
+  }
+  
   // Update ride back to PENDING
   db.run(
     `UPDATE rides 
@@ -680,6 +1604,8 @@ app.post('/api/ride/cancel', (req, res) => {
       db.run('UPDATE rickshaws SET status = "AVAILABLE" WHERE rickshawID = ?', [rickshawID]);
       
       console.log(`✓ Ride ${rideID} returned to PENDING - Re-alerting other pullers`);
+      rearmRide(rideID);
+      publishRideUpdate(rideID);
       
       res.json({ success: true, message: 'Ride cancelled, re-alerting others' });
     }
@@ -874,7 +1800,7 @@ app.post('/api/admin/anonymize', (req, res) => {
 
 // ========== START SERVER ==========
 const PORT = process.env.PORT || 3000;
-app.listen(PORT, () => {
+const server = app.listen(PORT, () => {
   console.log('\n╔════════════════════════════════════════════╗');
   console.log('║   AERAS Backend Server - FIXED VERSION    ║');
   console.log('╠════════════════════════════════════════════╣');
@@ -887,4 +1813,9 @@ app.listen(PORT, () => {
   console.log('║   ✓ TC11: Point management                ║');
   console.log('║   ✓ TC12: Database design                 ║');
   console.log('╚════════════════════════════════════════════╝\n');
-});
\ No newline at end of file
+});
+
+// Hardware units keep one connection open and poll every few seconds;
+// Node's default 5s keep-alive would close it between polls.
+server.keepAliveTimeout = 65000;
+server.headersTimeout = 66000;
\ No newline at end of file
@@ -0,0 +1,115 @@
+#include "AerasBlocks.h"
+
+namespace blocks {
+
+struct Overlay {
+  uint16_t version;
+  uint8_t count;
+  uint8_t dropped;                    // Rows that did not fit or had a bad ID
+  Block entries[OVERLAY_CAPACITY];
+  char ids[OVERLAY_CAPACITY][CODEC_BLOCK_LEN];
+  uint8_t slot[OVERLAY_SLOTS];
+};
+
+// Double-buffered: the network task stages into `spare` while the UI task
+// keeps reading `live`
+static Overlay tables[2];
+static Overlay* live = nullptr;       // nullptr = built-ins only
+static Overlay* spare = &tables[0];
+
+static const size_t BUILTIN_SLOTS = decltype(BUILTIN_HASH)::SLOTS;
+
+// Probe sequence shared by insert and lookup; returns the slot holding
+// `id` or the first empty one
+static uint8_t probe(const Overlay& table, const char* id) {
+  uint8_t s = hashId(id, 0) & (OVERLAY_SLOTS - 1);
+  while (table.slot[s] != EMPTY_SLOT && strcmp(table.entries[table.slot[s]].id, id) != 0) {
+    s = (s + 1) & (OVERLAY_SLOTS - 1);
+  }
+  return s;
+}
+
+const Block* findBuiltin(const char* id) {
+  uint8_t i = BUILTIN_HASH.slot[hashId(id, BUILTIN_HASH.seed) & (BUILTIN_SLOTS - 1)];
+  if (i == EMPTY_SLOT || strcmp(BUILTIN[i].id, id) != 0) return nullptr;
+  return &BUILTIN[i];
+}
+
+const Block* find(const char* id) {
+  if (id == nullptr || id[0] == '\0') return nullptr;
+
+  if (live != nullptr) {
+    uint8_t i = live->slot[probe(*live, id)];
+    if (i != EMPTY_SLOT) return &live->entries[i];
+  }
+  return findBuiltin(id);
+}
+
+uint16_t version() {
+  return live != nullptr ? live->version : BUILTIN_VERSION;
+}
+
+const char* etag() {
+  if (live == nullptr) return BUILTIN_ETAG;
+
+  static char buffer[24];
+  snprintf(buffer, sizeof(buffer), "\"locations-%u\"", live->version);
+  return buffer;
+}
+
+uint8_t overlayCount() {
+  return live != nullptr ? live->count : 0;
+}
+
+// ===== Overlay download =====
+
+void beginStaging() {
+  spare->version = 0;
+  spare->count = 0;
+  spare->dropped = 0;
+  memset(spare->slot, EMPTY_SLOT, sizeof(spare->slot));
+}
+
+void stage(const char* id, double lat, double lng) {
+  if (id == nullptr || id[0] == '\0' || strlen(id) >= CODEC_BLOCK_LEN) {
+    spare->dropped++;
+    return;
+  }
+
+  // Unchanged built-ins need no overlay slot
+  const Block* builtin = findBuiltin(id);
+  if (builtin != nullptr && builtin->lat == lat && builtin->lng == lng) return;
+
+  uint8_t s = probe(*spare, id);
+  if (spare->slot[s] != EMPTY_SLOT) {
+    Block& existing = spare->entries[spare->slot[s]];
+    existing.lat = lat;
+    existing.lng = lng;
+    return;
+  }
+  if (spare->count >= OVERLAY_CAPACITY) {
+    spare->dropped++;
+    return;
+  }
+
+  uint8_t i = spare->count++;
+  strcpy(spare->ids[i], id);
+  spare->entries[i] = {spare->ids[i], lat, lng};
+  spare->slot[s] = i;
+}
+
+bool commitStaged(uint16_t newVersion) {
+  if (newVersion <= version()) return false;
+
+  spare->version = newVersion;
+  if (spare->dropped > 0) {
+    Serial.println("⚠️ Block overlay: " + String(spare->dropped) + " rows dropped");
+  }
+
+  Overlay* previous = live;
+  live = spare;
+  spare = previous != nullptr ? previous : &tables[1];
+  return true;
+}
+
+}  // namespace blocks
@@ -0,0 +1,132 @@
+/*
+ * AERAS Blocks - constant-time block ID -> coordinates lookup
+ * The blocks seeded into the backend's `locations` table are compiled in
+ * as a constexpr table with a perfect hash: the hash seed is searched at
+ * compile time until every built-in ID lands in a slot of its own, so a
+ * lookup is one FNV-1a pass over the ID, one slot read and one strcmp -
+ * on a raw const char*, no String, no heap.
+ *
+ * Blocks added on the backend after a firmware was built arrive as an
+ * overlay: at boot the device asks GET /locations with the built-in
+ * table's ETag. A 304 means the compiled table is current; a newer
+ * version is decoded into a fixed-capacity open-addressed table that is
+ * searched before the built-ins.
+ *
+ * Threading: find/commitStaged/etag on the UI task. beginStaging/stage run
+ * on the network task while a DECODE_LOCATIONS request is in flight; they
+ * only touch the spare table, which commitStaged swaps in once the reply
+ * has been polled.
+ */
+
+#ifndef AERAS_BLOCKS_H
+#define AERAS_BLOCKS_H
+
+#include <Arduino.h>
+#include <AerasCodec.h>
+
+// Version of the compiled-in table; must match the backend's seeded
+// locationsVersion (aeras-backend/server.js)
+#define AERAS_BLOCKS_VERSION 1
+#define AERAS_BLOCKS_STR(x) #x
+#define AERAS_BLOCKS_ETAG(v) "\"locations-" AERAS_BLOCKS_STR(v) "\""
+
+namespace blocks {
+
+struct Block {
+  const char* id;
+  double lat;
+  double lng;
+};
+
+// Same rows as the backend's `locations` seed
+inline constexpr Block BUILTIN[] = {
+  {"CUET_CAMPUS", 22.4633, 91.9714},
+  {"PAHARTOLI",   22.4725, 91.9845},
+  {"NOAPARA",     22.4580, 91.9920},
+  {"RAOJAN",      22.4520, 91.9650}
+};
+
+const uint16_t BUILTIN_VERSION = AERAS_BLOCKS_VERSION;
+const char BUILTIN_ETAG[] = AERAS_BLOCKS_ETAG(AERAS_BLOCKS_VERSION);
+
+const uint8_t OVERLAY_CAPACITY = 32;
+const uint8_t OVERLAY_SLOTS = 64;     // Power of two, <= 50% load
+const uint8_t EMPTY_SLOT = 0xFF;
+
+// ----- Compile-time perfect hash -----
+
+constexpr uint32_t hashId(const char* id, uint32_t seed) {
+  uint32_t h = 2166136261u ^ seed;    // FNV-1a
+  for (; *id != '\0'; id++) h = (h ^ (uint8_t)*id) * 16777619u;
+  return h ^ (h >> 16);               // Fold the high bits into the slot bits
+}
+
+constexpr size_t slotCount(size_t entries) {
+  size_t slots = 1;
+  while (slots < entries * 4) slots <<= 1;   // ~25% load: a seed is found in a few tries
+  return slots;
+}
+
+template <size_t N>
+struct PerfectHash {
+  static constexpr size_t SLOTS = slotCount(N);
+  uint32_t seed;
+  bool found;
+  uint8_t slot[SLOTS];                // Entry index, or EMPTY_SLOT
+};
+
+template <size_t N>
+constexpr PerfectHash<N> buildPerfectHash(const Block (&table)[N]) {
+  static_assert(N < EMPTY_SLOT, "Block table too large for 8-bit slots");
+  PerfectHash<N> hash{};
+  for (uint32_t seed = 0; seed < 4096; seed++) {
+    for (size_t s = 0; s < PerfectHash<N>::SLOTS; s++) hash.slot[s] = EMPTY_SLOT;
+
+    bool collision = false;
+    for (size_t i = 0; i < N && !collision; i++) {
+      size_t s = hashId(table[i].id, seed) & (PerfectHash<N>::SLOTS - 1);
+      if (hash.slot[s] != EMPTY_SLOT) {
+        collision = true;
+      } else {
+        hash.slot[s] = (uint8_t)i;
+      }
+    }
+
+    if (!collision) {
+      hash.seed = seed;
+      hash.found = true;
+      return hash;
+    }
+  }
+  return hash;
+}
+
+inline constexpr PerfectHash<sizeof(BUILTIN) / sizeof(BUILTIN[0])> BUILTIN_HASH =
+  buildPerfectHash(BUILTIN);
+static_assert(BUILTIN_HASH.found, "No perfect hash seed for BUILTIN - duplicate block ID?");
+
+// ----- Lookup (UI task) -----
+
+// Overlay first, then the built-ins; nullptr if unknown. Overlay entries
+// stay valid until the next commitStaged().
+const Block* find(const char* id);
+const Block* findBuiltin(const char* id);
+
+uint16_t version();                   // Active table version
+const char* etag();                   // If-None-Match for GET /locations
+uint8_t overlayCount();
+
+// ----- Overlay download -----
+
+// Network task: reset the spare table, then feed it decoded rows
+// (stage matches codec::LocationSink)
+void beginStaging();
+void stage(const char* id, double lat, double lng);
+
+// UI task, after the DECODE_LOCATIONS reply: swap the staged rows in if
+// `version` is newer than the active table
+bool commitStaged(uint16_t version);
+
+}  // namespace blocks
+
+#endif
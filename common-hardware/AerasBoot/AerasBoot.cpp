@@ -0,0 +1,287 @@
+/*
+ * AERAS Boot - NVS-cached connection settings and Wi-Fi fast reconnect
+ */
+
+#include "AerasBoot.h"
+#include <Preferences.h>
+
+static const char* NVS_NAMESPACE = "aeras";
+static const char* NVS_KEY = "boot";
+
+FastBoot::FastBoot()
+  : state(STATE_IDLE), fastJoin(false), leaseChecked(false), attemptStart(0), phaseCount(0),
+    fastJoins(0), scannedJoins(0), fallbacks(0), drops(0), nvsWrites(0), lastJoinMs(0) {
+  memset(&config, 0, sizeof(config));
+}
+
+// FNV-1a over the compiled-in defaults: a reflash with new ones replaces NVS
+static uint32_t hashDefaults(const char* const* values, uint8_t count) {
+  uint32_t hash = 2166136261UL;
+  for (uint8_t i = 0; i < count; i++) {
+    for (const char* c = values[i]; *c != '\0'; c++) {
+      hash = (hash ^ (uint8_t)*c) * 16777619UL;
+    }
+    hash = (hash ^ 0xFF) * 16777619UL;  // Separator: "ab","c" != "a","bc"
+  }
+  return hash;
+}
+
+static bool copyField(char* dest, size_t size, const char* src) {
+  if (strlen(src) >= size) return false;
+  strcpy(dest, src);
+  return true;
+}
+
+// ===== NVS =====
+
+void FastBoot::load(const char* ssid, const char* password, const char* backendUrl, const char* deviceId) {
+  const char* defaults[] = { ssid, password, backendUrl, deviceId };
+  uint32_t hash = hashDefaults(defaults, 4);
+
+  Preferences prefs;
+  bool loaded = false;
+  if (prefs.begin(NVS_NAMESPACE, true)) {
+    loaded = prefs.getBytesLength(NVS_KEY) == sizeof(config) &&
+             prefs.getBytes(NVS_KEY, &config, sizeof(config)) == sizeof(config);
+    prefs.end();
+  }
+  if (loaded && config.defaultsHash == hash) return;
+
+  memset(&config, 0, sizeof(config));
+  config.defaultsHash = hash;
+  copyField(config.ssid, sizeof(config.ssid), ssid);
+  copyField(config.password, sizeof(config.password), password);
+  copyField(config.backendUrl, sizeof(config.backendUrl), backendUrl);
+  copyField(config.deviceId, sizeof(config.deviceId), deviceId);
+  save();
+}
+
+void FastBoot::save() {
+  Preferences prefs;
+  if (!prefs.begin(NVS_NAMESPACE, false)) return;
+  if (prefs.putBytes(NVS_KEY, &config, sizeof(config)) == sizeof(config)) nvsWrites++;
+  prefs.end();
+}
+
+// ===== Link =====
+
+void FastBoot::begin(const char* ssid, const char* password, const char* backendUrl, const char* deviceId) {
+  load(ssid, password, backendUrl, deviceId);
+  mark("nvs");
+
+  WiFi.persistent(false);      // The driver's own flash copy is a write per begin()
+  WiFi.mode(WIFI_STA);
+  WiFi.setAutoReconnect(true);
+
+  attemptStart = millis();
+  if (config.channel != 0) {
+    joinCached();
+  } else {
+    joinScanned();
+  }
+}
+
+void FastBoot::joinCached() {
+  state = STATE_FAST;
+  WiFi.config(IPAddress(config.ip), IPAddress(config.gateway), IPAddress(config.subnet), IPAddress(config.dns));
+  WiFi.begin(config.ssid, config.password, config.channel, config.bssid);
+}
+
+void FastBoot::joinScanned() {
+  state = STATE_SCAN;
+  WiFi.disconnect();
+  WiFi.config(IPAddress(), IPAddress(), IPAddress());  // All zero: back to DHCP
+  WiFi.begin(config.ssid, config.password);
+}
+
+LinkEvent FastBoot::poll() {
+  bool up = WiFi.status() == WL_CONNECTED;
+
+  if (state == STATE_UP) {
+    if (up) return LINK_NONE;
+    state = STATE_OFFLINE;
+    attemptStart = millis();
+    drops++;
+    Serial.println("✗ WiFi lost - reconnecting");
+    return LINK_DOWN;
+  }
+  if (state == STATE_IDLE) return LINK_NONE;
+
+  if (up) {
+    lastJoinMs = millis() - attemptStart;
+    fastJoin = state == STATE_FAST;
+    if (fastJoin) {
+      fastJoins++;
+    } else {
+      scannedJoins++;
+      learn();
+    }
+    state = STATE_UP;
+    mark("wifi");
+    Serial.println("✓ WiFi Connected in " + String(lastJoinMs) + " ms (" +
+                   (fastJoin ? "cached AP" : "scan + DHCP") + ")");
+    Serial.println("IP: " + WiFi.localIP().toString());
+    return LINK_UP;
+  }
+
+  uint32_t waited = millis() - attemptStart;
+  if (state == STATE_FAST && waited > FAST_CONNECT_MS) {
+    fallbacks++;
+    Serial.println("✗ Cached AP not answering - scanning");
+    joinScanned();
+  } else if (state == STATE_SCAN && waited > SCAN_CONNECT_MS) {
+    state = STATE_OFFLINE;
+    attemptStart = millis();
+    Serial.println("✗ WiFi Failed - Offline Mode");
+    return LINK_FAILED;
+  } else if (state == STATE_OFFLINE && waited > SCAN_CONNECT_MS) {
+    attemptStart = millis();
+    WiFi.reconnect();
+  }
+  return LINK_NONE;
+}
+
+// Keep what the scan and DHCP found for the next boot; writes only on change
+void FastBoot::learn() {
+  BootConfig before = config;
+
+  const uint8_t* bssid = WiFi.BSSID();
+  if (bssid != nullptr) memcpy(config.bssid, bssid, sizeof(config.bssid));
+  config.channel = (uint8_t)WiFi.channel();
+  config.ip = (uint32_t)WiFi.localIP();
+  config.gateway = (uint32_t)WiFi.gatewayIP();
+  config.subnet = (uint32_t)WiFi.subnetMask();
+  config.dns = (uint32_t)WiFi.dnsIP(0);
+  if (bssid == nullptr || config.ip == 0) config.channel = 0;
+
+  if (memcmp(&before, &config, sizeof(config)) != 0) save();
+}
+
+void FastBoot::forget() {
+  memset(config.bssid, 0, sizeof(config.bssid));
+  config.channel = 0;
+  config.ip = config.gateway = config.subnet = config.dns = 0;
+  save();
+}
+
+void FastBoot::backendReply(int httpCode) {
+  if (httpCode > 0 && !marked("backend")) {
+    mark("backend");
+    Serial.println("✓ Backend reached " + String(millis()) + " ms after reset (target " +
+                   String(TARGET_MS) + ")");
+  }
+
+  // A lease reused as a static address can be stale: the AP answers but
+  // nothing routes. Only the first reply after a cached join is judged.
+  if (leaseChecked || state != STATE_UP) return;
+  leaseChecked = true;
+  if (fastJoin && httpCode < 0) {
+    fallbacks++;
+    Serial.println("✗ Cached lease not routing - rejoining with DHCP");
+    forget();
+    attemptStart = millis();
+    joinScanned();
+  }
+}
+
+// ===== Boot timer =====
+
+void FastBoot::mark(const char* phase) {
+  if (marked(phase) || phaseCount >= MAX_PHASES) return;
+  phases[phaseCount].name = phase;
+  phases[phaseCount].ms = millis();
+  phaseCount++;
+}
+
+bool FastBoot::marked(const char* phase) const {
+  for (uint8_t i = 0; i < phaseCount; i++) {
+    if (strcmp(phases[i].name, phase) == 0) return true;
+  }
+  return false;
+}
+
+// ===== Console =====
+
+void FastBoot::command(const char* args) {
+  if (*args == '\0') {
+    Serial.println("\n===== CONFIG =====");
+    Serial.println("SSID: " + String(config.ssid));
+    Serial.println("PASS: " + String(config.password[0] != '\0' ? "(set)" : "(none)"));
+    Serial.println("URL:  " + String(config.backendUrl));
+    Serial.println("ID:   " + String(config.deviceId));
+    if (config.channel != 0) {
+      char bssid[18];
+      snprintf(bssid, sizeof(bssid), "%02X:%02X:%02X:%02X:%02X:%02X", config.bssid[0], config.bssid[1],
+               config.bssid[2], config.bssid[3], config.bssid[4], config.bssid[5]);
+      Serial.println("Cached AP " + String(bssid) + " ch " + String(config.channel) + ", IP " +
+                     IPAddress(config.ip).toString() + " gw " + IPAddress(config.gateway).toString());
+    } else {
+      Serial.println("No cached AP: next boot scans");
+    }
+    printStats();
+    Serial.println("==================\n");
+    return;
+  }
+
+  char key[8];
+  uint8_t length = 0;
+  while (args[length] != '\0' && args[length] != ' ' && length < sizeof(key) - 1) {
+    char c = args[length];
+    key[length++] = (c >= 'a' && c <= 'z') ? c - ('a' - 'A') : c;
+  }
+  key[length] = '\0';
+  const char* value = args + length;
+  while (*value == ' ') value++;
+
+  if (strcmp(key, "FORGET") == 0) {
+    forget();
+    Serial.println("✓ Cached AP dropped - next boot scans");
+    return;
+  }
+
+  if (*value == '\0') {
+    Serial.println("✗ CONFIG " + String(key) + " needs a value");
+    return;
+  }
+
+  bool ok;
+  bool radio = false;
+  if (strcmp(key, "SSID") == 0) {
+    ok = copyField(config.ssid, sizeof(config.ssid), value);
+    radio = true;
+  } else if (strcmp(key, "PASS") == 0) {
+    ok = copyField(config.password, sizeof(config.password), value);
+    radio = true;
+  } else if (strcmp(key, "URL") == 0) {
+    ok = copyField(config.backendUrl, sizeof(config.backendUrl), value);
+  } else if (strcmp(key, "ID") == 0) {
+    ok = copyField(config.deviceId, sizeof(config.deviceId), value);
+  } else {
+    Serial.println("✗ CONFIG [SSID|PASS|URL|ID <value>] or CONFIG FORGET");
+    return;
+  }
+
+  if (!ok) {
+    Serial.println("✗ Too long");
+    return;
+  }
+  if (radio) {
+    forget();  // The cached AP belongs to the old network
+  } else {
+    save();
+  }
+  Serial.println("✓ Saved - applies after reset");
+}
+
+// ===== Stats =====
+
+void FastBoot::printStats() {
+  String line = "Boot:";
+  for (uint8_t i = 0; i < phaseCount; i++) {
+    line += String(i == 0 ? " " : ", ") + phases[i].name + " " + String(phases[i].ms) + " ms";
+  }
+  Serial.println(line);
+  Serial.println("WiFi: " + String(fastJoins) + " cached joins, " + String(scannedJoins) + " scans, " +
+                 String(fallbacks) + " fallbacks, " + String(drops) + " drops, last join " +
+                 String(lastJoinMs) + " ms, " + String(nvsWrites) + " NVS writes");
+}
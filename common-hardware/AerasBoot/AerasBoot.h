@@ -0,0 +1,115 @@
+/*
+ * AERAS Boot - NVS-cached connection settings and Wi-Fi fast reconnect
+ * A cold WiFi.begin() scans every channel for the SSID and then waits on
+ * DHCP, which costs seconds. After the first full connect the AP's BSSID
+ * and channel and the DHCP lease (IP, gateway, mask, DNS) are kept in NVS.
+ * The next boot joins that AP directly on its channel with the lease as a
+ * static address: no scan and no DHCP round trip.
+ *
+ * Connecting never blocks. begin() starts the join and poll() reports the
+ * link coming up or going down. When the cached AP does not answer within
+ * FAST_CONNECT_MS, the join falls back to a full scan with DHCP. If the
+ * first backend reply after a cached join is a transport error, the lease
+ * is assumed stale and the link rejoins with DHCP.
+ *
+ * The SSID, password, backend URL and device ID live in NVS as well. They
+ * are seeded from the compiled-in defaults and can be changed with the
+ * CONFIG console command (applies after a restart). Reflashing with
+ * different defaults replaces them.
+ *
+ * mark() timestamps boot phases since reset; printStats() lists them.
+ *
+ * Threading: UI task only.
+ */
+
+#ifndef AERAS_BOOT_H
+#define AERAS_BOOT_H
+
+#include <Arduino.h>
+#include <WiFi.h>
+
+struct BootConfig {
+  uint32_t defaultsHash;        // Compiled-in defaults these values came from
+  char ssid[33];
+  char password[65];
+  char backendUrl[96];
+  char deviceId[24];
+
+  // Learned on the last scanned connect; channel 0 = nothing cached
+  uint8_t bssid[6];
+  uint8_t channel;
+  uint32_t ip;
+  uint32_t gateway;
+  uint32_t subnet;
+  uint32_t dns;
+};
+
+enum LinkEvent : uint8_t {
+  LINK_NONE,
+  LINK_UP,          // Connected (first time or again)
+  LINK_DOWN,        // Lost; the Wi-Fi driver keeps reconnecting
+  LINK_FAILED       // No connection within SCAN_CONNECT_MS of boot
+};
+
+class FastBoot {
+public:
+  static const uint32_t FAST_CONNECT_MS = 1500;   // Cached AP not joined by then: scan
+  static const uint32_t SCAN_CONNECT_MS = 20000;  // The old 40 x 500 ms wait
+  static const uint32_t TARGET_MS = 1500;         // Reset -> first backend reply
+  static const uint8_t MAX_PHASES = 8;
+
+  FastBoot();
+
+  // Load NVS (seeding it from the defaults) and start joining; never waits
+  void begin(const char* ssid, const char* password, const char* backendUrl, const char* deviceId);
+  // Call every loop pass
+  LinkEvent poll();
+
+  bool connected() const { return state == STATE_UP; }
+  const char* backendUrl() const { return config.backendUrl; }
+  const char* deviceId() const { return config.deviceId; }
+
+  // First backend reply: closes the boot timer and checks a cached lease
+  void backendReply(int httpCode);
+
+  // Record a boot phase (first call per name only)
+  void mark(const char* phase);
+
+  // CONFIG console command: show, SSID/PASS/URL/ID <value>, or FORGET
+  void command(const char* args);
+
+  void printStats();
+
+private:
+  enum State : uint8_t { STATE_IDLE, STATE_FAST, STATE_SCAN, STATE_UP, STATE_OFFLINE };
+
+  void load(const char* ssid, const char* password, const char* backendUrl, const char* deviceId);
+  void save();
+  void joinCached();
+  void joinScanned();
+  void learn();
+  void forget();
+  bool marked(const char* phase) const;
+
+  BootConfig config;
+  State state;
+  bool fastJoin;                 // The current link came up on the cached settings
+  bool leaseChecked;
+  uint32_t attemptStart;
+
+  struct Phase {
+    const char* name;
+    uint32_t ms;
+  };
+  Phase phases[MAX_PHASES];
+  uint8_t phaseCount;
+
+  uint32_t fastJoins;
+  uint32_t scannedJoins;
+  uint32_t fallbacks;            // Cached AP or lease did not work
+  uint32_t drops;
+  uint32_t nvsWrites;
+  uint32_t lastJoinMs;           // Time the last join took
+};
+
+#endif
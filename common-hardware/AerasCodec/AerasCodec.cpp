@@ -0,0 +1,336 @@
+#include "AerasCodec.h"
+#include <ArduinoJson.h>
+
+// Capacities cover the filtered documents only
+static StaticJsonDocument<256> smallDoc;    // single-object responses and list rows
+static StaticJsonDocument<128> filterDoc;
+static StaticJsonDocument<256> encodeDoc;   // requests (UI task)
+
+static void copyString(char* dest, size_t size, JsonVariantConst value) {
+  const char* text = value.as<const char*>();
+  strncpy(dest, text ? text : "", size - 1);
+  dest[size - 1] = '\0';
+}
+
+// Server sends some numbers as strings ("distance":"1.23")
+static float numberOrString(JsonVariantConst value) {
+  if (value.is<const char*>()) return atof(value.as<const char*>());
+  return value.as<float>();
+}
+
+static long idOf(JsonVariantConst value) {
+  if (value.is<const char*>()) return atol(value.as<const char*>());
+  return value.as<long>();
+}
+
+static size_t finish(JsonDocument& doc, char* buf, size_t size) {
+  if (doc.overflowed() || measureJson(doc) >= size) return 0;
+  return serializeJson(doc, buf, size);
+}
+
+// Consume input up to and including `token`; false if the stream ends first
+static bool skipPast(Stream& in, const char* token) {
+  const char* match = token;
+  char c;
+  while (in.readBytes(&c, 1) == 1) {
+    if (c == *match) {
+      if (*++match == '\0') return true;
+    } else {
+      match = (c == *token) ? token + 1 : token;
+    }
+  }
+  return false;
+}
+
+// Next character that is not whitespace, or '\0' at end of stream
+static char nextToken(Stream& in) {
+  char c;
+  while (in.readBytes(&c, 1) == 1) {
+    if (c != ' ' && c != '\n' && c != '\r' && c != '\t') return c;
+  }
+  return '\0';
+}
+
+// Unsigned integer at the stream position; consumes one character past it
+static unsigned long readUnsigned(Stream& in) {
+  unsigned long value = 0;
+  char c = nextToken(in);
+  while (c >= '0' && c <= '9') {
+    value = value * 10 + (c - '0');
+    if (in.readBytes(&c, 1) != 1) break;
+  }
+  return value;
+}
+
+static void fillRideStatus(JsonVariantConst ride, RideStatus& out) {
+  out.rideID = idOf(ride["rideID"]);
+  copyString(out.status, sizeof(out.status), ride["status"]);
+  copyString(out.rickshawID, sizeof(out.rickshawID), ride["rickshawID"]);
+  copyString(out.pickupBlock, sizeof(out.pickupBlock), ride["pickupBlock"]);
+  copyString(out.destination, sizeof(out.destination), ride["destination"]);
+}
+
+static void rideStatusFilter(JsonObject ride) {
+  ride["rideID"] = true;
+  ride["status"] = true;
+  ride["rickshawID"] = true;
+  ride["pickupBlock"] = true;
+  ride["destination"] = true;
+}
+
+namespace codec {
+
+// ===== Encoders =====
+
+size_t encodeRideRequest(char* buf, size_t size, const char* blockID,
+                         const char* destination, const char* userID) {
+  encodeDoc.clear();
+  encodeDoc["blockID"] = blockID;
+  encodeDoc["destination"] = destination;
+  encodeDoc["userID"] = userID;
+  return finish(encodeDoc, buf, size);
+}
+
+size_t encodeRegister(char* buf, size_t size, const char* rickshawID, const char* pullerName,
+                      const char* phoneNumber, double lat, double lng) {
+  encodeDoc.clear();
+  encodeDoc["rickshawID"] = rickshawID;
+  encodeDoc["pullerName"] = pullerName;
+  encodeDoc["phoneNumber"] = phoneNumber;
+  encodeDoc["currentLat"] = lat;
+  encodeDoc["currentLng"] = lng;
+  return finish(encodeDoc, buf, size);
+}
+
+size_t encodeLocation(char* buf, size_t size, const char* rickshawID, double lat, double lng) {
+  encodeDoc.clear();
+  encodeDoc["rickshawID"] = rickshawID;
+  encodeDoc["lat"] = lat;
+  encodeDoc["lng"] = lng;
+  return finish(encodeDoc, buf, size);
+}
+
+size_t encodeTrack(char* buf, size_t size, const char* rickshawID, int32_t latE6, int32_t lngE6,
+                   uint32_t ageMs, const char* deltas) {
+  encodeDoc.clear();
+  encodeDoc["rickshawID"] = rickshawID;
+  encodeDoc["latE6"] = latE6;
+  encodeDoc["lngE6"] = lngE6;
+  encodeDoc["age"] = ageMs;
+  encodeDoc["d"] = deltas;
+  return finish(encodeDoc, buf, size);
+}
+
+size_t encodeHeartbeat(char* buf, size_t size, const char* rickshawID, double lat, double lng,
+                       long rideID, const char* status, uint32_t version) {
+  encodeDoc.clear();
+  encodeDoc["rickshawID"] = rickshawID;
+  encodeDoc["lat"] = lat;
+  encodeDoc["lng"] = lng;
+  if (rideID != 0) {
+    encodeDoc["rideID"] = rideID;
+    encodeDoc["status"] = status;
+  }
+  encodeDoc["v"] = version;
+  return finish(encodeDoc, buf, size);
+}
+
+size_t encodeAccept(char* buf, size_t size, long rideID, const char* rickshawID) {
+  encodeDoc.clear();
+  encodeDoc["rideID"] = rideID;
+  encodeDoc["rickshawID"] = rickshawID;
+  return finish(encodeDoc, buf, size);
+}
+
+size_t encodePickup(char* buf, size_t size, long rideID) {
+  encodeDoc.clear();
+  encodeDoc["rideID"] = rideID;
+  return finish(encodeDoc, buf, size);
+}
+
+size_t encodeComplete(char* buf, size_t size, long rideID, double dropLat, double dropLng) {
+  encodeDoc.clear();
+  encodeDoc["rideID"] = rideID;
+  encodeDoc["dropLat"] = dropLat;
+  encodeDoc["dropLng"] = dropLng;
+  return finish(encodeDoc, buf, size);
+}
+
+// ===== Decoders =====
+
+bool decodeRideCreated(Stream& in, long& rideID) {
+  filterDoc.clear();
+  filterDoc["rideID"] = true;
+
+  smallDoc.clear();
+  if (deserializeJson(smallDoc, in, DeserializationOption::Filter(filterDoc))) return false;
+  if (!smallDoc.containsKey("rideID")) return false;
+
+  rideID = idOf(smallDoc["rideID"]);
+  return true;
+}
+
+bool decodeRideStatus(Stream& in, RideStatus& out) {
+  filterDoc.clear();
+  rideStatusFilter(filterDoc.to<JsonObject>());
+
+  smallDoc.clear();
+  if (deserializeJson(smallDoc, in, DeserializationOption::Filter(filterDoc))) return false;
+
+  fillRideStatus(smallDoc.as<JsonVariantConst>(), out);
+  return out.status[0] != '\0';
+}
+
+bool decodeRideStatus(const char* json, RideStatus& out) {
+  filterDoc.clear();
+  rideStatusFilter(filterDoc.to<JsonObject>());
+
+  smallDoc.clear();
+  if (deserializeJson(smallDoc, json, DeserializationOption::Filter(filterDoc))) return false;
+
+  fillRideStatus(smallDoc.as<JsonVariantConst>(), out);
+  return out.status[0] != '\0';
+}
+
+// Rows of a ride array whose '[' has been consumed. One element per pass,
+// as decodeLocations: rows past capacity are still read, only to count them.
+static int readRideRows(Stream& in, PendingRide* out, int capacity, int* total) {
+  filterDoc.clear();
+  filterDoc["rideID"] = true;
+  filterDoc["pickupBlock"] = true;
+  filterDoc["destination"] = true;
+  filterDoc["distance"] = true;
+  filterDoc["age"] = true;
+
+  int count = 0;
+  int rows = 0;
+  for (;;) {
+    smallDoc.clear();
+    if (deserializeJson(smallDoc, in, DeserializationOption::Filter(filterDoc))) {
+      if (rows > 0) return -1;  // Only an empty array may fail here ("[]")
+      break;
+    }
+    rows++;
+
+    if (count < capacity) {
+      PendingRide& dest = out[count++];
+      dest.rideID = idOf(smallDoc["rideID"]);
+      copyString(dest.pickupBlock, sizeof(dest.pickupBlock), smallDoc["pickupBlock"]);
+      copyString(dest.destination, sizeof(dest.destination), smallDoc["destination"]);
+      dest.distanceKm = numberOrString(smallDoc["distance"]);
+      dest.ageS = smallDoc["age"] | 0;
+    }
+
+    if (nextToken(in) != ',') break;
+  }
+
+  if (total != nullptr) *total = rows;
+  return count;
+}
+
+static void fillPendingList(PendingList& out, int count, int total) {
+  out.count = count;
+  out.total = total > 0xFFFF ? 0xFFFF : total;
+}
+
+int decodePendingRides(Stream& in, PendingRide* out, int capacity, int* total) {
+  if (total != nullptr) *total = 0;
+  if (!skipPast(in, "\"rides\":[")) return -1;
+  return readRideRows(in, out, capacity, total);
+}
+
+bool decodePendingRides(Stream& in, PendingList& out) {
+  int total = 0;
+  int count = decodePendingRides(in, out.rides, CODEC_OFFER_SLOTS, &total);
+  if (count < 0) return false;
+  fillPendingList(out, count, total);
+  return true;
+}
+
+// Keys arrive in a fixed order (v, ride, rides), so each part is read as
+// it streams past; "ride" and "rides" are null when nothing changed
+bool decodeHeartbeat(Stream& in, HeartbeatReply& out) {
+  out.hasRide = false;
+  out.hasOffers = false;
+  if (!skipPast(in, "\"v\":")) return false;
+  out.version = readUnsigned(in);
+
+  if (!skipPast(in, "\"ride\":")) return false;
+  filterDoc.clear();
+  rideStatusFilter(filterDoc.to<JsonObject>());
+  smallDoc.clear();
+  if (deserializeJson(smallDoc, in, DeserializationOption::Filter(filterDoc))) return false;
+  if (!smallDoc.isNull()) {
+    fillRideStatus(smallDoc.as<JsonVariantConst>(), out.ride);
+    out.hasRide = out.ride.status[0] != '\0';
+  }
+
+  if (!skipPast(in, "\"rides\":")) return false;
+  if (nextToken(in) != '[') return true;  // null: the pending list is unchanged
+
+  int total = 0;
+  int count = readRideRows(in, out.offers.rides, CODEC_OFFER_SLOTS, &total);
+  if (count < 0) return false;
+  fillPendingList(out.offers, count, total);
+  out.hasOffers = true;
+  return true;
+}
+
+bool decodeAccept(Stream& in, bool& success) {
+  filterDoc.clear();
+  filterDoc["success"] = true;
+
+  smallDoc.clear();
+  if (deserializeJson(smallDoc, in, DeserializationOption::Filter(filterDoc))) return false;
+
+  success = smallDoc["success"] | false;
+  return true;
+}
+
+bool decodeComplete(Stream& in, CompleteResult& out) {
+  filterDoc.clear();
+  filterDoc["points"] = true;
+  filterDoc["distance"] = true;
+  filterDoc["status"] = true;
+
+  smallDoc.clear();
+  if (deserializeJson(smallDoc, in, DeserializationOption::Filter(filterDoc))) return false;
+
+  out.points = smallDoc["points"] | 0;
+  out.distanceM = numberOrString(smallDoc["distance"]);
+  copyString(out.status, sizeof(out.status), smallDoc["status"]);
+  return true;
+}
+
+bool decodeLocations(Stream& in, LocationSink sink, LocationSet& out) {
+  out.version = 0;
+  out.count = 0;
+
+  // The backend writes "version" ahead of the array
+  if (!skipPast(in, "\"version\":")) return false;
+  out.version = readUnsigned(in);
+  if (!skipPast(in, "\"locations\":[")) return false;
+
+  filterDoc.clear();
+  filterDoc["blockID"] = true;
+  filterDoc["lat"] = true;
+  filterDoc["lng"] = true;
+
+  // One element per pass: deserializeJson stops right after the closing brace
+  for (;;) {
+    smallDoc.clear();
+    if (deserializeJson(smallDoc, in, DeserializationOption::Filter(filterDoc))) {
+      return out.count == 0;  // Only an empty array may fail here ("[]")
+    }
+
+    const char* blockID = smallDoc["blockID"];
+    if (blockID != nullptr) {
+      sink(blockID, smallDoc["lat"] | 0.0, smallDoc["lng"] | 0.0);
+      out.count++;
+    }
+
+    if (nextToken(in) != ',') return true;
+  }
+}
+
+}  // namespace codec
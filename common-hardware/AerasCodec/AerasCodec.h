@@ -0,0 +1,117 @@
+/*
+ * AERAS Codec - fixed-capacity JSON encode/decode for backend messages
+ * Built on ArduinoJson 6. Responses are parsed straight from the HTTP
+ * stream through deserialization filters, so only the fields we use are
+ * stored and the body is never buffered into a String. Documents are
+ * static and sized for the largest expected message; nothing touches the
+ * heap. Not reentrant: encoders and decoders have separate documents, so
+ * one task may encode while another decodes, but each side is single-task.
+ */
+
+#ifndef AERAS_CODEC_H
+#define AERAS_CODEC_H
+
+#include <Arduino.h>
+
+// Field sizes (including terminator)
+const size_t CODEC_STATUS_LEN = 16;
+const size_t CODEC_ID_LEN = 16;
+const size_t CODEC_BLOCK_LEN = 24;
+const uint8_t CODEC_OFFER_SLOTS = 6;    // Pending rides kept per /ride/pending reply
+
+struct RideStatus {
+  long rideID;
+  char status[CODEC_STATUS_LEN];
+  char rickshawID[CODEC_ID_LEN];
+  char pickupBlock[CODEC_BLOCK_LEN];
+  char destination[CODEC_BLOCK_LEN];
+};
+
+struct PendingRide {
+  long rideID;
+  char pickupBlock[CODEC_BLOCK_LEN];
+  char destination[CODEC_BLOCK_LEN];
+  float distanceKm;
+  uint16_t ageS;        // Seconds since the request (0 if the backend did not say)
+};
+
+struct PendingList {
+  uint16_t total;       // Rides in the response
+  uint8_t count;        // Kept in rides[], nearest first as the server sorts them
+  PendingRide rides[CODEC_OFFER_SLOTS];
+};
+
+struct HeartbeatReply {
+  uint32_t version;     // Pending-list version to send with the next heartbeat
+  bool hasRide;         // The held ride changed status, or one was assigned to us
+  RideStatus ride;
+  bool hasOffers;       // The pending list changed since `version` we sent
+  PendingList offers;
+};
+
+struct CompleteResult {
+  int points;
+  float distanceM;
+  char status[CODEC_STATUS_LEN];
+};
+
+struct LocationSet {
+  uint16_t version;
+  int16_t count;        // Rows passed to the sink
+};
+
+// Receives each decoded /locations row; blockID is only valid during the call
+typedef void (*LocationSink)(const char* blockID, double lat, double lng);
+
+namespace codec {
+
+// ----- Encoders: write into buf, return length (0 = did not fit) -----
+size_t encodeRideRequest(char* buf, size_t size, const char* blockID,
+                         const char* destination, const char* userID);
+size_t encodeRegister(char* buf, size_t size, const char* rickshawID, const char* pullerName,
+                      const char* phoneNumber, double lat, double lng);
+size_t encodeLocation(char* buf, size_t size, const char* rickshawID, double lat, double lng);
+// /rickshaw/track batch: first point in microdegrees, its age in ms, the
+// rest as AerasTrack's base64url delta string
+size_t encodeTrack(char* buf, size_t size, const char* rickshawID, int32_t latE6, int32_t lngE6,
+                   uint32_t ageMs, const char* deltas);
+// /rickshaw/heartbeat: live position, the ride held (0 = none) with the
+// status we know for it, and the pending-list version we hold
+size_t encodeHeartbeat(char* buf, size_t size, const char* rickshawID, double lat, double lng,
+                       long rideID, const char* status, uint32_t version);
+size_t encodeAccept(char* buf, size_t size, long rideID, const char* rickshawID);
+size_t encodePickup(char* buf, size_t size, long rideID);
+size_t encodeComplete(char* buf, size_t size, long rideID, double dropLat, double dropLng);
+
+// ----- Decoders: parse from a stream (HTTP body) or a string (push data) -----
+
+// {"success":true,"rideID":12,...} -> rideID
+bool decodeRideCreated(Stream& in, long& rideID);
+
+// {"status":"ACCEPTED","rideID":12,"rickshawID":"RICK001",...}
+// Also the compact /ride/:rideID/state body and "ride" push events
+bool decodeRideStatus(Stream& in, RideStatus& out);
+bool decodeRideStatus(const char* json, RideStatus& out);
+
+// {"rides":[{...}, ...]} -> up to capacity rides, in server order; -1 if
+// malformed. Rows are parsed one at a time, so any list length decodes;
+// total (optional) receives the full row count.
+int decodePendingRides(Stream& in, PendingRide* out, int capacity, int* total = nullptr);
+bool decodePendingRides(Stream& in, PendingList& out);
+
+// {"v":7,"ride":{...}|null,"rides":[...]|null} - only what changed
+bool decodeHeartbeat(Stream& in, HeartbeatReply& out);
+
+// {"success":true,...}
+bool decodeAccept(Stream& in, bool& success);
+
+// {"success":true,"points":8,"distance":"12.34","status":"COMPLETED"}
+bool decodeComplete(Stream& in, CompleteResult& out);
+
+// {"version":2,"locations":[{"blockID":"CUET_CAMPUS","lat":22.4633,"lng":91.9714},...]}
+// Rows are parsed one at a time, so the list length is not bounded by a document
+bool decodeLocations(Stream& in, LocationSink sink, LocationSet& out);
+
+}  // namespace codec
+
+#endif
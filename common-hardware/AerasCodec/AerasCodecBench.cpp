@@ -0,0 +1,96 @@
+#include "AerasCodecBench.h"
+#include "AerasCodec.h"
+
+// Five pending rides with every column the backend returns (r.* + location)
+static const char SAMPLE_PENDING[] PROGMEM =
+  "{\"rides\":["
+  "{\"rideID\":101,\"userID\":\"USER_4821\",\"rickshawID\":null,\"pickupBlock\":\"CUET_CAMPUS\",\"destination\":\"PAHARTOLI\",\"requestTime\":\"2025-01-10 09:12:44\",\"acceptTime\":null,\"pickupTime\":null,\"dropTime\":null,\"status\":\"PENDING\",\"dropLat\":null,\"dropLng\":null,\"dropDistance\":null,\"pointsAwarded\":0,\"latitude\":22.4633,\"longitude\":91.9714,\"locationName\":\"CUET Campus\",\"distance\":\"0.12\"},"
+  "{\"rideID\":102,\"userID\":\"USER_1377\",\"rickshawID\":null,\"pickupBlock\":\"NOAPARA\",\"destination\":\"RAOJAN\",\"requestTime\":\"2025-01-10 09:12:51\",\"acceptTime\":null,\"pickupTime\":null,\"dropTime\":null,\"status\":\"PENDING\",\"dropLat\":null,\"dropLng\":null,\"dropDistance\":null,\"pointsAwarded\":0,\"latitude\":22.458,\"longitude\":91.992,\"locationName\":\"Noapara\",\"distance\":\"2.18\"},"
+  "{\"rideID\":103,\"userID\":\"USER_9034\",\"rickshawID\":null,\"pickupBlock\":\"PAHARTOLI\",\"destination\":\"CUET_CAMPUS\",\"requestTime\":\"2025-01-10 09:13:02\",\"acceptTime\":null,\"pickupTime\":null,\"dropTime\":null,\"status\":\"PENDING\",\"dropLat\":null,\"dropLng\":null,\"dropDistance\":null,\"pointsAwarded\":0,\"latitude\":22.4725,\"longitude\":91.9845,\"locationName\":\"Pahartoli\",\"distance\":\"1.74\"},"
+  "{\"rideID\":104,\"userID\":\"USER_2210\",\"rickshawID\":null,\"pickupBlock\":\"RAOJAN\",\"destination\":\"NOAPARA\",\"requestTime\":\"2025-01-10 09:13:20\",\"acceptTime\":null,\"pickupTime\":null,\"dropTime\":null,\"status\":\"PENDING\",\"dropLat\":null,\"dropLng\":null,\"dropDistance\":null,\"pointsAwarded\":0,\"latitude\":22.452,\"longitude\":91.965,\"locationName\":\"Raojan\",\"distance\":\"1.39\"},"
+  "{\"rideID\":105,\"userID\":\"USER_6652\",\"rickshawID\":null,\"pickupBlock\":\"CUET_CAMPUS\",\"destination\":\"NOAPARA\",\"requestTime\":\"2025-01-10 09:13:31\",\"acceptTime\":null,\"pickupTime\":null,\"dropTime\":null,\"status\":\"PENDING\",\"dropLat\":null,\"dropLng\":null,\"dropDistance\":null,\"pointsAwarded\":0,\"latitude\":22.4633,\"longitude\":91.9714,\"locationName\":\"CUET Campus\",\"distance\":\"0.12\"}"
+  "]}";
+
+// Stream over a constant buffer, standing in for the HTTP body
+class MemoryStream : public Stream {
+public:
+  MemoryStream(const char* data, size_t length) : buffer(data), size(length), position(0) {}
+  int available() override { return size - position; }
+  int read() override { return position < size ? buffer[position++] : -1; }
+  int peek() override { return position < size ? buffer[position] : -1; }
+  size_t write(uint8_t) override { return 0; }
+  void rewind() { position = 0; }
+private:
+  const char* buffer;
+  size_t size;
+  size_t position;
+};
+
+static uint32_t lowestHeap;
+
+static void sampleHeap() {
+  uint32_t freeHeap = ESP.getFreeHeap();
+  if (freeHeap < lowestHeap) lowestHeap = freeHeap;
+}
+
+// The pre-codec parser from checkForRideRequests()
+static void legacyParse(MemoryStream& in) {
+  String response = in.readString();
+  sampleHeap();
+
+  int rideIDStart = response.indexOf("\"rideID\":") + 9;
+  int rideIDEnd = response.indexOf(",", rideIDStart);
+  String rideID = response.substring(rideIDStart, rideIDEnd);
+
+  int pickupStart = response.indexOf("\"pickupBlock\":\"") + 15;
+  int pickupEnd = response.indexOf("\"", pickupStart);
+  String pickup = response.substring(pickupStart, pickupEnd);
+
+  int destStart = response.indexOf("\"destination\":\"") + 15;
+  int destEnd = response.indexOf("\"", destStart);
+  String dest = response.substring(destStart, destEnd);
+
+  int distStart = response.indexOf("\"distance\":\"") + 12;
+  int distEnd = response.indexOf("\"", distStart);
+  String distance = response.substring(distStart, distEnd);
+  sampleHeap();
+}
+
+void runCodecBenchmark(uint16_t iterations) {
+  MemoryStream in(SAMPLE_PENDING, strlen(SAMPLE_PENDING));
+  PendingRide rides[5];
+
+  Serial.println("\n===== CODEC BENCHMARK =====");
+  Serial.println("Payload: " + String(strlen(SAMPLE_PENDING)) + " bytes, 5 rides, " +
+                 String(iterations) + " iterations");
+
+  // Legacy: whole body into a String, then indexOf/substring (first ride only)
+  uint32_t baseline = ESP.getFreeHeap();
+  lowestHeap = baseline;
+  uint32_t start = micros();
+  for (uint16_t i = 0; i < iterations; i++) {
+    in.rewind();
+    legacyParse(in);
+  }
+  uint32_t legacyUs = (micros() - start) / iterations;
+  uint32_t legacyPeak = baseline - lowestHeap;
+
+  // Codec: filtered stream parse into fixed slots (all five rides)
+  baseline = ESP.getFreeHeap();
+  lowestHeap = baseline;
+  int parsed = 0;
+  start = micros();
+  for (uint16_t i = 0; i < iterations; i++) {
+    in.rewind();
+    parsed = codec::decodePendingRides(in, rides, 5);
+    sampleHeap();
+  }
+  uint32_t codecUs = (micros() - start) / iterations;
+  uint32_t codecPeak = baseline - lowestHeap;
+
+  Serial.println("String/indexOf: " + String(legacyUs) + " us/parse, peak heap " +
+                 String(legacyPeak) + " B (1 ride)");
+  Serial.println("Codec:          " + String(codecUs) + " us/parse, peak heap " +
+                 String(codecPeak) + " B (" + String(parsed) + " rides)");
+  Serial.println("===========================\n");
+}
@@ -0,0 +1,15 @@
+/*
+ * AERAS Codec - on-device benchmark
+ * Parses a canned /ride/pending response with the old String/indexOf
+ * approach and with the codec, reporting time per parse and peak heap.
+ * Run from the serial console (BENCH).
+ */
+
+#ifndef AERAS_CODEC_BENCH_H
+#define AERAS_CODEC_BENCH_H
+
+#include <Arduino.h>
+
+void runCodecBenchmark(uint16_t iterations = 200);
+
+#endif
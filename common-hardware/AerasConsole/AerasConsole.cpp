@@ -0,0 +1,110 @@
+/*
+ * AERAS Console - non-blocking serial command reader
+ */
+
+#include "AerasConsole.h"
+
+CommandConsole::CommandConsole(const ConsoleCommand* commands, uint8_t count)
+  : commands(commands), commandCount(count), stream(nullptr), length(0),
+    overflowed(false), lastWasCR(false), lines(0), unknown(0), overflows(0), maxHandlerMicros(0) {
+  line[0] = '\0';
+}
+
+void CommandConsole::begin(HardwareSerial& port) {
+  port.setRxBufferSize(RX_BUFFER);
+  stream = &port;
+}
+
+uint8_t CommandConsole::poll() {
+  if (stream == nullptr) return 0;
+
+  uint8_t ran = 0;
+  // Bounded so a paste cannot hold the loop; the rest waits in the UART ring
+  for (uint8_t n = 0; n < MAX_BYTES_PER_POLL && stream->available() > 0; n++) {
+    int c = stream->read();
+    if (c < 0) break;
+
+    if (c == '\r' || c == '\n') {
+      bool crlf = c == '\n' && lastWasCR;
+      lastWasCR = c == '\r';
+      if (crlf) continue;
+
+      if (overflowed) {
+        overflows++;
+        Serial.println("✗ Command too long (max " + String(LINE_SIZE - 1) + " chars)");
+      } else if (length > 0) {
+        line[length] = '\0';
+        dispatch();
+        ran++;
+      }
+      length = 0;
+      overflowed = false;
+      continue;
+    }
+    lastWasCR = false;
+
+    if (c == '\b' || c == 0x7F) {
+      if (length > 0) length--;
+    } else if (length < LINE_SIZE - 1) {
+      line[length++] = (char)c;
+    } else {
+      overflowed = true;
+    }
+  }
+  return ran;
+}
+
+// ===== Dispatch =====
+
+void CommandConsole::dispatch() {
+  // Trim, upper-case the command word and split off the arguments in place
+  char* name = line;
+  while (*name == ' ' || *name == '\t') name++;
+  if (*name == '\0') return;
+
+  char* args = name;
+  while (*args != '\0' && *args != ' ' && *args != '\t') {
+    if (*args >= 'a' && *args <= 'z') *args -= 'a' - 'A';
+    args++;
+  }
+  if (*args != '\0') *args++ = '\0';
+  while (*args == ' ' || *args == '\t') args++;
+  char* end = args + strlen(args);
+  while (end > args && (end[-1] == ' ' || end[-1] == '\t')) *--end = '\0';
+
+  lines++;
+  if (strcmp(name, "HELP") == 0) {
+    printHelp();
+    return;
+  }
+
+  for (uint8_t i = 0; i < commandCount; i++) {
+    if (strcmp(name, commands[i].name) != 0) continue;
+    uint32_t start = micros();
+    commands[i].run(args);
+    uint32_t elapsed = micros() - start;
+    if (elapsed > maxHandlerMicros) maxHandlerMicros = elapsed;
+    return;
+  }
+
+  unknown++;
+  Serial.println("✗ Unknown command: " + String(name) + " (HELP lists them)");
+}
+
+void CommandConsole::printHelp() {
+  Serial.println("\n===== COMMANDS =====");
+  for (uint8_t i = 0; i < commandCount; i++) {
+    String name = commands[i].name;
+    while (name.length() < 9) name += ' ';
+    Serial.println(name + "- " + commands[i].help);
+  }
+  Serial.println("HELP     - This list");
+  Serial.println("====================\n");
+}
+
+// ===== Stats =====
+
+void CommandConsole::printStats() {
+  Serial.println("Console: " + String(lines) + " commands, " + String(unknown) + " unknown, " +
+                 String(overflows) + " too long, slowest handler " + String(maxHandlerMicros) + " us");
+}
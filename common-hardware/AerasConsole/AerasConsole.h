@@ -0,0 +1,66 @@
+/*
+ * AERAS Console - non-blocking serial command reader
+ * Stream::readStringUntil() waits out the stream timeout (1 s) whenever
+ * half a line has arrived, and allocates a String per command. Here the
+ * UART's interrupt-fed RX ring does the buffering: poll() only drains
+ * what is already there into a fixed line buffer, so it never waits, and
+ * dispatches each complete line through a static command table.
+ *
+ * Commands are matched case-insensitively on the first word; the rest of
+ * the line (trimmed) is passed as args. HELP is built in and lists the
+ * table. Lines longer than LINE_SIZE - 1 are dropped whole. CR, LF and
+ * CRLF all end a line; backspace edits it.
+ *
+ * Threading: poll() and the handlers run on the task that calls poll().
+ */
+
+#ifndef AERAS_CONSOLE_H
+#define AERAS_CONSOLE_H
+
+#include <Arduino.h>
+
+typedef void (*CommandHandler)(const char* args);
+
+struct ConsoleCommand {
+  const char* name;       // Upper case
+  CommandHandler run;
+  const char* help;       // One line for HELP
+};
+
+class CommandConsole {
+public:
+  static const uint8_t LINE_SIZE = 64;
+  static const uint16_t RX_BUFFER = 256;      // UART ring for Serial.setRxBufferSize()
+  static const uint8_t MAX_BYTES_PER_POLL = 64;
+
+  CommandConsole(const ConsoleCommand* commands, uint8_t count);
+
+  // Before Serial.begin(): the RX ring has to be sized first on the ESP32
+  void begin(HardwareSerial& port);
+
+  // Drain buffered input and run complete commands; never blocks.
+  // Returns the number of commands run.
+  uint8_t poll();
+
+  void printHelp();
+  void printStats();
+
+private:
+  void dispatch();
+
+  const ConsoleCommand* commands;
+  uint8_t commandCount;
+  Stream* stream;
+
+  char line[LINE_SIZE];
+  uint8_t length;
+  bool overflowed;        // Current line is too long; drop it at the newline
+  bool lastWasCR;         // Swallow the LF of a CRLF
+
+  uint32_t lines;
+  uint32_t unknown;
+  uint32_t overflows;
+  uint32_t maxHandlerMicros;
+};
+
+#endif
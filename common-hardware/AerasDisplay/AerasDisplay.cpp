@@ -0,0 +1,178 @@
+#include "AerasDisplay.h"
+
+// Largest Wire transmission payload, as Adafruit_SSD1306 sizes its chunks
+#if defined(I2C_BUFFER_LENGTH)
+static const uint16_t WIRE_MAX = I2C_BUFFER_LENGTH > 256 ? 256 : I2C_BUFFER_LENGTH;
+#elif defined(BUFFER_LENGTH)
+static const uint16_t WIRE_MAX = BUFFER_LENGTH > 256 ? 256 : BUFFER_LENGTH;
+#else
+static const uint16_t WIRE_MAX = 32;
+#endif
+
+static const uint8_t NO_SCREEN = 0xFF;
+static const uint8_t CHAR_WIDTH = 6;   // 5x7 font + 1 px spacing at size 1
+static const uint8_t CHAR_HEIGHT = 8;
+
+// Bus cost below counts every byte on the wire, including the address byte
+// and the control byte that start each transmission
+
+static uint16_t chunksFor(uint16_t count) {
+  return (count + WIRE_MAX - 2) / (WIRE_MAX - 1);
+}
+
+static uint32_t commandBytes(uint8_t count) {
+  return 2 + count;
+}
+
+static uint32_t dataBytes(uint16_t count) {
+  return count + 2 * chunksFor(count);
+}
+
+FrameDisplay::FrameDisplay(TwoWire* twi, int8_t resetPin)
+  : Adafruit_SSD1306(PANEL_WIDTH, PANEL_HEIGHT, twi, resetPin),
+    screenId(NO_SCREEN), fullRedraw(true), dryRun(false), frameMs(DEFAULT_FRAME_MS),
+    lastFlush(0), totalBytes(0), frames(0), lastBytes(0) {
+  memset(shadow, 0, sizeof(shadow));
+  clearFields();
+}
+
+bool FrameDisplay::begin(uint8_t vccState, uint8_t address) {
+  if (!Adafruit_SSD1306::begin(vccState, address)) return false;
+  setTextWrap(false);
+  setTextSize(1);
+  setTextColor(SSD1306_WHITE);
+  fullRedraw = true;
+  return true;
+}
+
+void FrameDisplay::clearFields() {
+  for (uint8_t i = 0; i < MAX_FIELDS; i++) {
+    fields[i].used = false;
+    fields[i].value[0] = '\0';
+  }
+}
+
+void FrameDisplay::screen(uint8_t id) {
+  if (id == screenId) return;
+  screenId = id;
+  clearDisplay();
+  clearFields();
+}
+
+void FrameDisplay::text(uint8_t field, int16_t x, int16_t y, const char* value) {
+  if (field >= MAX_FIELDS) return;
+  Field& f = fields[field];
+
+  // Clip to what fits on the row; wrapping would spill into other fields
+  int16_t room = (PANEL_WIDTH - x) / CHAR_WIDTH;
+  if (room < 0) room = 0;
+  if (room > FIELD_CHARS) room = FIELD_CHARS;
+  char clipped[FIELD_CHARS + 1];
+  strncpy(clipped, value, room);
+  clipped[room] = '\0';
+
+  if (f.used && f.x == x && f.y == y && strcmp(f.value, clipped) == 0) return;
+
+  // Erase whatever the field showed before, then draw the new text
+  if (f.used) {
+    fillRect(f.x, f.y, strlen(f.value) * CHAR_WIDTH, CHAR_HEIGHT, SSD1306_BLACK);
+  }
+  setTextSize(1);
+  setTextColor(SSD1306_WHITE);
+  setCursor(x, y);
+  print(clipped);
+
+  f.x = x;
+  f.y = y;
+  strcpy(f.value, clipped);
+  f.used = true;
+}
+
+uint32_t FrameDisplay::fullFrameBytes() {
+  // display(): PAGEADDR/COLUMNADDR list, then the column end as its own
+  // command, then the whole buffer
+  return commandBytes(5) + commandBytes(1) + dataBytes(PANEL_WIDTH * PAGES);
+}
+
+uint32_t FrameDisplay::sendWindow(uint8_t page, uint8_t firstColumn, uint8_t lastColumn,
+                                  const uint8_t* data) {
+  uint16_t count = lastColumn - firstColumn + 1;
+  uint32_t bytes = commandBytes(6) + dataBytes(count);
+  if (dryRun) return bytes;
+
+  // Address window: horizontal addressing mode (set by begin()) fills it
+  // left to right, so the data is exactly the changed span
+  wire->beginTransmission(i2caddr);
+  wire->write((uint8_t)0x00);
+  wire->write((uint8_t)SSD1306_COLUMNADDR);
+  wire->write(firstColumn);
+  wire->write(lastColumn);
+  wire->write((uint8_t)SSD1306_PAGEADDR);
+  wire->write(page);
+  wire->write(page);
+  wire->endTransmission();
+
+  while (count > 0) {
+    uint16_t n = count < WIRE_MAX - 1 ? count : WIRE_MAX - 1;
+    wire->beginTransmission(i2caddr);
+    wire->write((uint8_t)0x40);
+    wire->write(data, n);
+    wire->endTransmission();
+    data += n;
+    count -= n;
+  }
+  return bytes;
+}
+
+bool FrameDisplay::present() {
+  if (millis() - lastFlush < frameMs) return false;
+  presentNow();
+  return true;
+}
+
+void FrameDisplay::presentNow() {
+  lastFlush = millis();
+  const uint8_t* frame = getBuffer();
+  if (frame == nullptr) return;
+
+  uint32_t bytes = 0;
+
+  for (uint8_t page = 0; page < PAGES; page++) {
+    const uint8_t* row = frame + page * PANEL_WIDTH;
+    uint8_t* sent = shadow + page * PANEL_WIDTH;
+
+    int16_t first = -1;
+    int16_t last = -1;
+    if (fullRedraw) {
+      first = 0;
+      last = PANEL_WIDTH - 1;
+    } else {
+      for (uint8_t column = 0; column < PANEL_WIDTH; column++) {
+        if (row[column] == sent[column]) continue;
+        if (first < 0) first = column;
+        last = column;
+      }
+    }
+    if (first < 0) continue;
+
+    // Same fast-clock window Adafruit's display() uses
+    if (bytes == 0 && !dryRun) wire->setClock(wireClk);
+    bytes += sendWindow(page, first, last, row + first);
+    memcpy(sent + first, row + first, last - first + 1);
+  }
+
+  if (bytes > 0 && !dryRun) wire->setClock(restoreClk);
+  fullRedraw = false;
+
+  // Dry runs only report through lastFrameBytes()
+  lastBytes = bytes;
+  if (bytes > 0 && !dryRun) {
+    totalBytes += bytes;
+    frames++;
+  }
+}
+
+void FrameDisplay::printStats() {
+  Serial.println("OLED frames: " + String(frames) + ", I2C bytes: " + String(totalBytes) +
+                 " (full frame = " + String(fullFrameBytes()) + " B)");
+}
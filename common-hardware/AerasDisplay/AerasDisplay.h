@@ -0,0 +1,85 @@
+/*
+ * AERAS Display - retained-mode SSD1306 renderer
+ * Drop-in replacement for Adafruit_SSD1306 on the 128x64 I2C panel.
+ *
+ * Screens are built from text fields. A field is only redrawn when its
+ * text changes, and present() compares the framebuffer against the last
+ * frame sent, pushing only the changed column span of each dirty page
+ * instead of the whole 1 KB buffer. present() is capped to one frame per
+ * frame interval; presentNow() is for one-off screens shown before a pause.
+ */
+
+#ifndef AERAS_DISPLAY_H
+#define AERAS_DISPLAY_H
+
+#include <Arduino.h>
+#include <Wire.h>
+#include <Adafruit_SSD1306.h>
+
+class FrameDisplay : public Adafruit_SSD1306 {
+public:
+  static const uint8_t PANEL_WIDTH = 128;
+  static const uint8_t PANEL_HEIGHT = 64;
+  static const uint8_t PAGES = PANEL_HEIGHT / 8;
+  static const uint8_t MAX_FIELDS = 12;
+  static const uint8_t FIELD_CHARS = 21;  // One full row at text size 1
+  static const uint16_t DEFAULT_FRAME_MS = 100;
+
+  FrameDisplay(TwoWire* twi = &Wire, int8_t resetPin = -1);
+
+  bool begin(uint8_t vccState = SSD1306_SWITCHCAPVCC, uint8_t address = 0x3C);
+  void setFrameInterval(uint16_t ms) { frameMs = ms; }
+
+  // Switching to a different screen clears the framebuffer and all fields
+  void screen(uint8_t screenId);
+  uint8_t currentScreen() const { return screenId; }
+
+  // Text field at (x, y), size 1; redrawn only when the text changes
+  void text(uint8_t field, int16_t x, int16_t y, const char* value);
+  void text(uint8_t field, int16_t x, int16_t y, const String& value) { text(field, x, y, value.c_str()); }
+
+  // Push dirty regions, at most once per frame interval
+  bool present();
+
+  // Push dirty regions now, ignoring the frame cap
+  void presentNow();
+
+  // Resend the whole frame on the next flush (panel content unknown)
+  void invalidate() { fullRedraw = true; }
+
+  // Diff and count without touching the bus or the stats (benchmarks)
+  void setDryRun(bool enabled) { dryRun = enabled; }
+
+  // I2C bytes for one Adafruit display() call - the pre-renderer cost per frame
+  static uint32_t fullFrameBytes();
+
+  uint32_t bytesSent() const { return totalBytes; }
+  uint32_t frameCount() const { return frames; }
+  uint32_t lastFrameBytes() const { return lastBytes; }
+  void resetStats() { totalBytes = 0; frames = 0; lastBytes = 0; }
+  void printStats();
+
+private:
+  struct Field {
+    int16_t x;
+    int16_t y;
+    char value[FIELD_CHARS + 1];
+    bool used;
+  };
+
+  void clearFields();
+  uint32_t sendWindow(uint8_t page, uint8_t firstColumn, uint8_t lastColumn, const uint8_t* data);
+
+  Field fields[MAX_FIELDS];
+  uint8_t shadow[PANEL_WIDTH * PAGES];  // Last frame pushed to the panel
+  uint8_t screenId;
+  bool fullRedraw;
+  bool dryRun;
+  uint16_t frameMs;
+  uint32_t lastFlush;
+  uint32_t totalBytes;
+  uint32_t frames;
+  uint32_t lastBytes;
+};
+
+#endif
@@ -0,0 +1,45 @@
+#include "AerasDisplayBench.h"
+
+static const uint32_t I2C_CLOCK_HZ = 400000;  // Adafruit_SSD1306 transfer clock
+static const uint8_t BITS_PER_BYTE = 9;       // 8 data bits + ACK
+
+static uint32_t busMsPerSecond(uint32_t bytesPerSecond) {
+  return (uint64_t)bytesPerSecond * BITS_PER_BYTE * 1000 / I2C_CLOCK_HZ;
+}
+
+void runDisplayBenchmark(FrameDisplay& display, FrameDrawer drawFrame,
+                         uint16_t frames, uint16_t frameMs) {
+  Serial.println("\n===== DISPLAY BENCHMARK =====");
+  Serial.println(String(frames) + " frames at " + String(1000 / frameMs) + " fps");
+
+  display.setDryRun(true);
+  display.invalidate();
+
+  uint32_t dirtyBytes = 0;
+  uint16_t changedFrames = 0;
+  uint32_t start = micros();
+  for (uint16_t i = 0; i < frames; i++) {
+    drawFrame(i);
+    display.presentNow();
+    dirtyBytes += display.lastFrameBytes();
+    if (display.lastFrameBytes() > 0) changedFrames++;
+  }
+  uint32_t renderUs = (micros() - start) / frames;
+
+  display.setDryRun(false);
+  display.invalidate();
+
+  // Old path: clearDisplay() + display() every frame, changed or not
+  uint32_t seconds = (uint32_t)frames * frameMs / 1000;
+  if (seconds == 0) seconds = 1;
+  uint32_t legacyRate = FrameDisplay::fullFrameBytes() * frames / seconds;
+  uint32_t dirtyRate = dirtyBytes / seconds;
+
+  Serial.println("Full frame:   " + String(legacyRate) + " B/s I2C (~" +
+                 String(busMsPerSecond(legacyRate)) + " ms/s bus)");
+  Serial.println("Dirty region: " + String(dirtyRate) + " B/s I2C (~" +
+                 String(busMsPerSecond(dirtyRate)) + " ms/s bus), " +
+                 String(changedFrames) + "/" + String(frames) + " frames sent");
+  Serial.println("Draw + diff:  " + String(renderUs) + " us/frame");
+  Serial.println("=============================\n");
+}
@@ -0,0 +1,21 @@
+/*
+ * AERAS Display - on-device benchmark
+ * Replays a screen frame by frame and compares I2C traffic for a full
+ * display() per frame against the dirty-region present().
+ * Run from the serial console (BENCH).
+ */
+
+#ifndef AERAS_DISPLAY_BENCH_H
+#define AERAS_DISPLAY_BENCH_H
+
+#include <Arduino.h>
+#include "AerasDisplay.h"
+
+// Draws frame n of the replayed screen into the display's fields
+typedef void (*FrameDrawer)(uint16_t frame);
+
+// Leaves the panel invalidated; the caller redraws its current screen
+void runDisplayBenchmark(FrameDisplay& display, FrameDrawer drawFrame,
+                         uint16_t frames = 600, uint16_t frameMs = 100);
+
+#endif
@@ -0,0 +1,169 @@
+#include "AerasEventStream.h"
+
+EventStream::EventStream()
+  : onEvent(nullptr), port(80), state(DISCONNECTED), lastActivity(0),
+    nextAttempt(0), backoff(RECONNECT_MIN_MS), lineLength(0), lineOverflow(false), dataLength(0),
+    dataOverflow(false), events(0), reconnects(0), dropped(0) {
+  line[0] = '\0';
+  eventName[0] = '\0';
+  data[0] = '\0';
+}
+
+void EventStream::begin(const char* baseUrl, const String& path, EventHandler handler) {
+  onEvent = handler;
+
+  // Split "http://host:port/prefix" into host, port and path prefix
+  String url = baseUrl;
+  int hostStart = url.indexOf("://");
+  hostStart = hostStart >= 0 ? hostStart + 3 : 0;
+  int pathStart = url.indexOf('/', hostStart);
+  if (pathStart < 0) pathStart = url.length();
+  String hostPort = url.substring(hostStart, pathStart);
+
+  int colon = hostPort.indexOf(':');
+  if (colon >= 0) {
+    host = hostPort.substring(0, colon);
+    port = hostPort.substring(colon + 1).toInt();
+  } else {
+    host = hostPort;
+    port = 80;
+  }
+  requestPath = url.substring(pathStart) + path;
+
+  state = DISCONNECTED;
+  nextAttempt = millis();
+}
+
+void EventStream::stop() {
+  client.stop();
+  state = DISCONNECTED;
+}
+
+void EventStream::drop(const char* reason) {
+  Serial.println(String("⚠ Event stream dropped: ") + reason);
+  client.stop();
+  state = DISCONNECTED;
+  nextAttempt = millis() + backoff;
+  backoff *= 2;
+  if (backoff > RECONNECT_MAX_MS) backoff = RECONNECT_MAX_MS;
+}
+
+void EventStream::connect() {
+  if (WiFi.status() != WL_CONNECTED) {
+    nextAttempt = millis() + backoff;
+    return;
+  }
+
+  reconnects++;
+  if (!client.connect(host.c_str(), port, CONNECT_TIMEOUT_MS)) {
+    drop("connect failed");
+    return;
+  }
+
+  client.setNoDelay(true);
+  // HTTP/1.0: no chunked framing in the stream
+  client.print("GET " + requestPath + " HTTP/1.0\r\n"
+               "Host: " + host + "\r\n"
+               "Accept: text/event-stream\r\n"
+               "Cache-Control: no-cache\r\n\r\n");
+
+  state = READING_HEADERS;
+  lineLength = 0;
+  lineOverflow = false;
+  dataLength = 0;
+  dataOverflow = false;
+  eventName[0] = '\0';
+  lastActivity = millis();
+}
+
+void EventStream::poll() {
+  if (onEvent == nullptr) return;
+
+  if (state == DISCONNECTED) {
+    if ((int32_t)(millis() - nextAttempt) >= 0) connect();
+    return;
+  }
+
+  if (!client.connected()) {
+    drop("closed by server");
+    return;
+  }
+
+  uint16_t budget = MAX_BYTES_PER_POLL;
+  while (budget-- > 0 && client.available() > 0) {
+    char c = client.read();
+    lastActivity = millis();
+
+    if (c == '\r') continue;
+    if (c != '\n') {
+      if (lineLength < sizeof(line) - 1) line[lineLength++] = c;
+      else lineOverflow = true;
+      continue;
+    }
+
+    line[lineLength] = '\0';
+    handleLine();
+    lineLength = 0;
+    lineOverflow = false;
+    if (state == DISCONNECTED) return;
+  }
+
+  if (millis() - lastActivity > IDLE_TIMEOUT_MS) {
+    drop("idle timeout");
+  }
+}
+
+void EventStream::handleLine() {
+  if (state == READING_HEADERS) {
+    if (strncmp(line, "HTTP/1.", 7) == 0 && strstr(line, " 200") == nullptr) {
+      drop(line);
+      return;
+    }
+    if (lineLength == 0) {
+      state = STREAMING;
+      backoff = RECONNECT_MIN_MS;
+      Serial.println("✓ Event stream connected");
+    }
+    return;
+  }
+
+  // Blank line terminates an event
+  if (lineLength == 0) {
+    dispatch();
+    return;
+  }
+
+  if (line[0] == ':') return;  // Comment / keep-alive ping
+
+  if (strncmp(line, "event:", 6) == 0) {
+    const char* value = line + 6;
+    while (*value == ' ') value++;
+    strncpy(eventName, value, sizeof(eventName) - 1);
+    eventName[sizeof(eventName) - 1] = '\0';
+  } else if (strncmp(line, "data:", 5) == 0) {
+    const char* value = line + 5;
+    while (*value == ' ') value++;
+    uint16_t length = strlen(value);
+    if (lineOverflow || dataLength + length >= sizeof(data)) {
+      dataOverflow = true;
+    } else {
+      memcpy(data + dataLength, value, length);
+      dataLength += length;
+    }
+  }
+}
+
+void EventStream::dispatch() {
+  if (dataOverflow) {
+    dropped++;
+    Serial.println(String("⚠ Event stream: ") + (eventName[0] ? eventName : "message") +
+                   " event over " + String((int)sizeof(data) - 1) + " bytes dropped");
+  } else if (dataLength > 0) {
+    data[dataLength] = '\0';
+    events++;
+    onEvent(eventName[0] ? eventName : "message", data);
+  }
+  dataLength = 0;
+  dataOverflow = false;
+  eventName[0] = '\0';
+}
@@ -0,0 +1,79 @@
+/*
+ * AERAS Event Stream - Server-Sent Events client
+ * Holds one long-lived connection to the backend's /events endpoint and
+ * dispatches "event:/data:" frames as they arrive. poll() never blocks on
+ * reads; it only consumes bytes that are already buffered. When the stream
+ * drops it reconnects with exponential backoff, and isConnected() lets the
+ * caller fall back to polling in the meantime.
+ *
+ * The request is HTTP/1.0 so the body arrives unframed: Node answers an
+ * HTTP/1.1 stream with chunked encoding, which this parser does not decode.
+ * An event whose data does not fit the buffer is dropped, never dispatched
+ * truncated; the caller's polling fallback picks the change up.
+ */
+
+#ifndef AERAS_EVENT_STREAM_H
+#define AERAS_EVENT_STREAM_H
+
+#include <Arduino.h>
+#include <WiFi.h>
+
+// event = SSE event name ("ride", ...), data = raw data payload (JSON)
+typedef void (*EventHandler)(const char* event, const char* data);
+
+class EventStream {
+public:
+  static const uint16_t CONNECT_TIMEOUT_MS = 1000;
+  static const uint32_t RECONNECT_MIN_MS = 1000;
+  static const uint32_t RECONNECT_MAX_MS = 30000;
+  static const uint32_t IDLE_TIMEOUT_MS = 40000;   // Server pings every 15 s
+  static const uint16_t MAX_BYTES_PER_POLL = 512;
+
+  EventStream();
+
+  // baseUrl e.g. "http://10.0.0.5:3000/api", path e.g. "/events?blockID=X"
+  void begin(const char* baseUrl, const String& path, EventHandler handler);
+
+  // Read whatever is buffered and dispatch complete events; call often
+  void poll();
+
+  void stop();
+
+  bool isConnected() const { return state == STREAMING; }
+  uint32_t eventCount() const { return events; }
+  uint32_t reconnectCount() const { return reconnects; }
+  uint32_t droppedCount() const { return dropped; }
+
+private:
+  enum State { DISCONNECTED, READING_HEADERS, STREAMING };
+
+  void connect();
+  void drop(const char* reason);
+  void handleLine();
+  void dispatch();
+
+  WiFiClient client;
+  EventHandler onEvent;
+  String host;
+  uint16_t port;
+  String requestPath;
+
+  State state;
+  uint32_t lastActivity;
+  uint32_t nextAttempt;
+  uint32_t backoff;
+
+  char line[256];
+  uint16_t lineLength;
+  bool lineOverflow;      // The current line did not fit `line`
+  char eventName[24];
+  char data[256];
+  uint16_t dataLength;
+  bool dataOverflow;      // The current event's data did not fit `data`
+
+  uint32_t events;
+  uint32_t reconnects;
+  uint32_t dropped;
+};
+
+#endif
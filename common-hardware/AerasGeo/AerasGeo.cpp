@@ -0,0 +1,130 @@
+#include "AerasGeo.h"
+
+namespace geo {
+
+double distance(double lat1, double lon1, double lat2, double lon2) {
+  double dLat = (lat2 - lat1) * DEG_TO_RAD;
+  double dLon = (lon2 - lon1) * DEG_TO_RAD;
+
+  double a = sin(dLat / 2) * sin(dLat / 2) +
+             cos(lat1 * DEG_TO_RAD) * cos(lat2 * DEG_TO_RAD) *
+             sin(dLon / 2) * sin(dLon / 2);
+
+  double c = 2 * atan2(sqrt(a), sqrt(1 - a));
+  return EARTH_RADIUS_M * c;
+}
+
+double bearing(double lat1, double lon1, double lat2, double lon2) {
+  double dLon = (lon2 - lon1) * DEG_TO_RAD;
+  lat1 = lat1 * DEG_TO_RAD;
+  lat2 = lat2 * DEG_TO_RAD;
+
+  double y = sin(dLon) * cos(lat2);
+  double x = cos(lat1) * sin(lat2) - sin(lat1) * cos(lat2) * cos(dLon);
+  double degrees = atan2(y, x) * RAD_TO_DEG;
+
+  return fmod(degrees + 360.0, 360.0);
+}
+
+MoveStep step(double& lat, double& lng, double targetLat, double targetLng,
+              double speedKmh, double seconds) {
+  MoveStep result;
+  result.distanceM = distance(lat, lng, targetLat, targetLng);
+  result.bearing = 0;
+  result.arrived = result.distanceM <= ARRIVAL_RADIUS_M;
+  if (result.arrived) return result;
+
+  result.bearing = bearing(lat, lng, targetLat, targetLng);
+
+  double meters = (speedKmh * 1000.0) / 3600.0 * seconds;
+  double latDegreesPerMeter = 1.0 / METERS_PER_DEGREE_LAT;
+  double lngDegreesPerMeter = 1.0 / (METERS_PER_DEGREE_LAT * cos(lat * DEG_TO_RAD));
+
+  double bearingRad = result.bearing * DEG_TO_RAD;
+  lat += meters * cos(bearingRad) * latDegreesPerMeter;
+  lng += meters * sin(bearingRad) * lngDegreesPerMeter;
+  return result;
+}
+
+// ===== Fast paths =====
+
+// The fast paths scale by the haversine's sphere (not METERS_PER_DEGREE_LAT,
+// which the double step() keeps) so they agree with the backend's points check
+static const double SPHERE_M_PER_DEG = EARTH_RADIUS_M * PI / 180.0;
+
+// Millimetres per microdegree of latitude, Q16 (~111.19 mm)
+static const int64_t LAT_MM_Q16 = (int64_t)(SPHERE_M_PER_DEG * 1000.0 / 1e6 * 65536.0 + 0.5);
+
+Target makeTarget(double lat, double lng) {
+  Target target;
+  target.lat = lat;
+  target.lng = lng;
+
+  double metersPerDegLng = SPHERE_M_PER_DEG * cos(lat * DEG_TO_RAD);
+  target.metersPerDegLng = (float)metersPerDegLng;
+  target.latE6 = toE6(lat);
+  target.lngE6 = toE6(lng);
+  target.lngMmQ16 = (int32_t)(metersPerDegLng * 1000.0 / 1e6 * 65536.0 + 0.5);
+  return target;
+}
+
+int32_t toE6(double degrees) {
+  return (int32_t)lround(degrees * 1e6);
+}
+
+// Offsets are taken in double (one software subtract each, no trig) so
+// 7-digit coordinates keep their precision; the rest is float
+static inline void projectOffset(const Target& target, double lat, double lng, float& eastM, float& northM) {
+  northM = (float)(target.lat - lat) * (float)SPHERE_M_PER_DEG;
+  eastM = (float)(target.lng - lng) * target.metersPerDegLng;
+}
+
+float distance(const Target& target, double lat, double lng) {
+  float eastM, northM;
+  projectOffset(target, lat, lng, eastM, northM);
+  float meters = sqrtf(eastM * eastM + northM * northM);
+
+  if (meters <= FAST_RANGE_M) return meters;
+  return (float)distance(lat, lng, target.lat, target.lng);
+}
+
+float bearing(const Target& target, double lat, double lng) {
+  float eastM, northM;
+  projectOffset(target, lat, lng, eastM, northM);
+  float degrees = atan2f(eastM, northM) * (float)RAD_TO_DEG;
+  return degrees < 0 ? degrees + 360.0f : degrees;
+}
+
+int64_t distanceSqMm(const Target& target, int32_t latE6, int32_t lngE6) {
+  int64_t northMm = ((int64_t)(target.latE6 - latE6) * LAT_MM_Q16) >> 16;
+  int64_t eastMm = ((int64_t)(target.lngE6 - lngE6) * target.lngMmQ16) >> 16;
+  return northMm * northMm + eastMm * eastMm;
+}
+
+bool within(const Target& target, int32_t latE6, int32_t lngE6, uint32_t radiusM) {
+  int64_t radiusMm = (int64_t)radiusM * 1000;
+  return distanceSqMm(target, latE6, lngE6) <= radiusMm * radiusMm;
+}
+
+bool within(const Target& target, double lat, double lng, uint32_t radiusM) {
+  return within(target, toE6(lat), toE6(lng), radiusM);
+}
+
+MoveStep step(double& lat, double& lng, const Target& target,
+              double speedKmh, double seconds) {
+  MoveStep result;
+  result.distanceM = distance(target, lat, lng);
+  result.bearing = 0;
+  result.arrived = result.distanceM <= ARRIVAL_RADIUS_M;
+  if (result.arrived) return result;
+
+  result.bearing = bearing(target, lat, lng);
+
+  float meters = (float)(speedKmh / 3.6 * seconds);
+  float bearingRad = (float)result.bearing * (float)DEG_TO_RAD;
+  lat += meters * cosf(bearingRad) / (float)SPHERE_M_PER_DEG;
+  lng += meters * sinf(bearingRad) / target.metersPerDegLng;
+  return result;
+}
+
+}  // namespace geo
@@ -0,0 +1,83 @@
+/*
+ * AERAS Geo - great-circle geometry and simulated rickshaw movement
+ * Shared by the rickshaw firmware and the fleet simulator so both move a
+ * rickshaw with exactly the same kinematics: once per step, head along the
+ * initial great-circle bearing at a fixed speed until within
+ * ARRIVAL_RADIUS_M of the target.
+ *
+ * Fast paths: the ESP32 FPU is single precision only, so every double
+ * sin/cos/atan2 above is a software routine. Rides are a few km, where a
+ * flat-earth (equirectangular) projection around the target is within
+ * about a decimetre of the haversine (5 cm at 2 km). A Target caches everything that depends
+ * only on the target, and the per-fix paths are tiered by distance:
+ *   - within():   fixed-point microdegrees, integer math, no sqrt - for
+ *                 the arrival and 50/100 m points radius checks
+ *   - distance(): float equirectangular up to FAST_RANGE_M, haversine beyond
+ *   - bearing():  float atan2 on the same projection
+ * AerasGeoBench measures all of them against the double haversine.
+ */
+
+#ifndef AERAS_GEO_H
+#define AERAS_GEO_H
+
+#include <Arduino.h>
+
+namespace geo {
+
+const double EARTH_RADIUS_M = 6371000.0;
+const double METERS_PER_DEGREE_LAT = 111320.0;
+const double ARRIVAL_RADIUS_M = 5.0;
+
+// Haversine distance in meters
+double distance(double lat1, double lon1, double lat2, double lon2);
+
+// Initial bearing from point 1 to point 2, degrees clockwise from north [0, 360)
+double bearing(double lat1, double lon1, double lat2, double lon2);
+
+struct MoveStep {
+  double distanceM;   // Distance to target before the step
+  double bearing;     // Heading used (valid when !arrived)
+  bool arrived;       // Already within ARRIVAL_RADIUS_M - position unchanged
+};
+
+// Advance lat/lng toward the target for `seconds` at speedKmh
+MoveStep step(double& lat, double& lng, double targetLat, double targetLng,
+              double speedKmh, double seconds = 1.0);
+
+// ===== Fast paths =====
+
+const float FAST_RANGE_M = 8000.0f;   // Equirectangular error grows with range^2: < 1 m below this
+
+struct Target {
+  double lat;
+  double lng;
+  float metersPerDegLng;  // Haversine sphere, scaled by cos(lat)
+  int32_t latE6;          // Microdegrees, for the fixed-point tier
+  int32_t lngE6;
+  int32_t lngMmQ16;       // Millimetres per microdegree of longitude, Q16
+};
+
+// One cos() per target; redo only when the target block changes
+Target makeTarget(double lat, double lng);
+
+int32_t toE6(double degrees);
+
+// Tiered distance in meters: float equirectangular near the target,
+// double haversine beyond FAST_RANGE_M
+float distance(const Target& target, double lat, double lng);
+
+// Initial bearing toward the target, degrees [0, 360), float equirectangular
+float bearing(const Target& target, double lat, double lng);
+
+// Fixed-point tier: squared distance in mm^2 from microdegree coordinates
+int64_t distanceSqMm(const Target& target, int32_t latE6, int32_t lngE6);
+bool within(const Target& target, int32_t latE6, int32_t lngE6, uint32_t radiusM);
+bool within(const Target& target, double lat, double lng, uint32_t radiusM);
+
+// step() on the fast paths (the firmware and the fleet simulator both use this)
+MoveStep step(double& lat, double& lng, const Target& target,
+              double speedKmh, double seconds = 1.0);
+
+}  // namespace geo
+
+#endif
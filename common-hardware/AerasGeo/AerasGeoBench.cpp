@@ -0,0 +1,135 @@
+#include "AerasGeoBench.h"
+#include "AerasGeo.h"
+
+static const double CENTER_LAT = 22.4633;
+static const double CENTER_LNG = 91.9714;
+static const uint16_t MAX_SAMPLES = 1000;
+static const uint8_t REPEATS = 20;  // Passes over the sample set per timing
+
+struct Fix {
+  double lat;
+  double lng;
+  int32_t latE6;
+  int32_t lngE6;
+};
+
+static Fix fixes[MAX_SAMPLES];
+static volatile float sink;  // Keeps the timed loops from being optimised away
+
+// Every third fix lands within a few meters of the 50 m or 100 m radius,
+// where a wrong answer would change the points awarded
+static void makeFixes(uint16_t count) {
+  uint32_t state = 12345;
+  for (uint16_t i = 0; i < count; i++) {
+    state = state * 1664525u + 1013904223u;
+    float unit = (state >> 8) / 16777216.0f;
+
+    double radiusM;
+    switch (i % 3) {
+      case 0:  radiusM = 45.0 + unit * 10.0; break;
+      case 1:  radiusM = 95.0 + unit * 10.0; break;
+      default: radiusM = unit * 3000.0; break;
+    }
+    double angle = i * 2.399963;  // Golden angle: even spread of headings
+
+    Fix& fix = fixes[i];
+    fix.lat = CENTER_LAT + radiusM * cos(angle) / geo::METERS_PER_DEGREE_LAT;
+    fix.lng = CENTER_LNG + radiusM * sin(angle) /
+              (geo::METERS_PER_DEGREE_LAT * cos(CENTER_LAT * DEG_TO_RAD));
+    fix.latE6 = geo::toE6(fix.lat);
+    fix.lngE6 = geo::toE6(fix.lng);
+  }
+}
+
+static uint32_t nsPerCall(uint32_t startUs, uint16_t count) {
+  return (uint32_t)((uint64_t)(micros() - startUs) * 1000 / ((uint32_t)count * REPEATS));
+}
+
+static float angleError(float a, float b) {
+  float diff = fabsf(a - b);
+  return diff > 180.0f ? 360.0f - diff : diff;
+}
+
+void runGeoBenchmark(uint16_t samples) {
+  if (samples > MAX_SAMPLES) samples = MAX_SAMPLES;
+  makeFixes(samples);
+  geo::Target target = geo::makeTarget(CENTER_LAT, CENTER_LNG);
+
+  Serial.println("\n===== GEO BENCHMARK =====");
+  Serial.println(String(samples) + " fixes within 3 km, " + String(REPEATS) + " passes each");
+
+  // ----- Speed -----
+  uint32_t start = micros();
+  for (uint8_t r = 0; r < REPEATS; r++)
+    for (uint16_t i = 0; i < samples; i++)
+      sink = geo::distance(fixes[i].lat, fixes[i].lng, CENTER_LAT, CENTER_LNG);
+  uint32_t haversineNs = nsPerCall(start, samples);
+
+  start = micros();
+  for (uint8_t r = 0; r < REPEATS; r++)
+    for (uint16_t i = 0; i < samples; i++)
+      sink = geo::bearing(fixes[i].lat, fixes[i].lng, CENTER_LAT, CENTER_LNG);
+  uint32_t bearingNs = nsPerCall(start, samples);
+
+  start = micros();
+  for (uint8_t r = 0; r < REPEATS; r++)
+    for (uint16_t i = 0; i < samples; i++)
+      sink = geo::distance(target, fixes[i].lat, fixes[i].lng);
+  uint32_t fastNs = nsPerCall(start, samples);
+
+  start = micros();
+  for (uint8_t r = 0; r < REPEATS; r++)
+    for (uint16_t i = 0; i < samples; i++)
+      sink = geo::bearing(target, fixes[i].lat, fixes[i].lng);
+  uint32_t fastBearingNs = nsPerCall(start, samples);
+
+  start = micros();
+  for (uint8_t r = 0; r < REPEATS; r++)
+    for (uint16_t i = 0; i < samples; i++)
+      sink = geo::within(target, fixes[i].latE6, fixes[i].lngE6, 100);
+  uint32_t fixedNs = nsPerCall(start, samples);
+
+  // ----- Accuracy against the double haversine -----
+  float fastError = 0, fastBandError = 0, fixedBandError = 0, bearingError = 0;
+  uint16_t fastMisses = 0, fixedMisses = 0;
+  const uint32_t radii[] = {50, 100};
+
+  for (uint16_t i = 0; i < samples; i++) {
+    const Fix& fix = fixes[i];
+    double reference = geo::distance(fix.lat, fix.lng, CENTER_LAT, CENTER_LNG);
+    float fast = geo::distance(target, fix.lat, fix.lng);
+    float fixed = sqrt((double)geo::distanceSqMm(target, fix.latE6, fix.lngE6)) / 1000.0;
+
+    float error = fabs(fast - reference);
+    if (error > fastError) fastError = error;
+    if (reference <= 110.0) {
+      if (error > fastBandError) fastBandError = error;
+      float fixedError = fabs(fixed - reference);
+      if (fixedError > fixedBandError) fixedBandError = fixedError;
+    }
+
+    if (reference > 1.0) {  // Bearing is undefined on top of the target
+      float bearingDiff = angleError(geo::bearing(target, fix.lat, fix.lng),
+                                     geo::bearing(fix.lat, fix.lng, CENTER_LAT, CENTER_LNG));
+      if (bearingDiff > bearingError) bearingError = bearingDiff;
+    }
+
+    for (uint32_t radius : radii) {
+      bool inside = reference <= radius;
+      if ((fast <= radius) != inside) fastMisses++;
+      if (geo::within(target, fix.latE6, fix.lngE6, radius) != inside) fixedMisses++;
+    }
+  }
+
+  Serial.println("Haversine (double):   " + String(haversineNs) + " ns/call  (reference)");
+  Serial.println("Bearing (double):     " + String(bearingNs) + " ns/call  (reference)");
+  Serial.println("Equirect (float):     " + String(fastNs) + " ns/call  max err " +
+                 String(fastError, 3) + " m, <=110 m " + String(fastBandError, 3) + " m");
+  Serial.println("Bearing (float):      " + String(fastBearingNs) + " ns/call  max err " +
+                 String(bearingError, 3) + " deg");
+  Serial.println("Fixed-point within(): " + String(fixedNs) + " ns/call  max err <=110 m " +
+                 String(fixedBandError, 3) + " m");
+  Serial.println("50/100 m radius checks differing: equirect " + String(fastMisses) +
+                 ", fixed " + String(fixedMisses) + " of " + String(samples * 2));
+  Serial.println("=========================\n");
+}
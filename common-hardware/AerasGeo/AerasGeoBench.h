@@ -0,0 +1,16 @@
+/*
+ * AERAS Geo - accuracy/speed benchmark
+ * Times the double haversine/bearing against the fast paths over fixes
+ * scattered 0-3 km around CUET campus, and reports ns per call, the worst
+ * distance/bearing error and how many 50 m / 100 m points-radius checks
+ * came out differently. Runs on the device and in the native env (BENCH).
+ */
+
+#ifndef AERAS_GEO_BENCH_H
+#define AERAS_GEO_BENCH_H
+
+#include <Arduino.h>
+
+void runGeoBenchmark(uint16_t samples = 1000);
+
+#endif
@@ -0,0 +1,159 @@
+#include "AerasGps.h"
+#include <AerasGeo.h>
+
+static const double METERS_PER_DEG = geo::EARTH_RADIUS_M * DEG_TO_RAD;
+static const float UERE_M = 4.0f;           // Range error per unit of HDOP (1-sigma)
+static const float MIN_HDOP = 0.5f;
+static const float DEFAULT_HDOP = 5.0f;     // Sentence carried no HDOP
+static const float ACCEL_NOISE = 0.25f;     // (m/s^2)^2 per s: a rickshaw's speed changes
+static const float INITIAL_SPEED_VAR = 25.0f;
+
+// ===== Kalman filter =====
+
+void GpsReceiver::KalmanAxis::reset(float measured, float variance) {
+  position = measured;
+  velocity = 0;
+  p00 = variance;
+  p01 = 0;
+  p11 = INITIAL_SPEED_VAR;
+}
+
+// x = F x, P = F P F' + Q for white acceleration noise
+void GpsReceiver::KalmanAxis::predict(float dt) {
+  position += velocity * dt;
+
+  float dt2 = dt * dt;
+  p00 += dt * (2 * p01 + dt * p11) + ACCEL_NOISE * dt2 * dt / 3;
+  p01 += dt * p11 + ACCEL_NOISE * dt2 / 2;
+  p11 += ACCEL_NOISE * dt;
+}
+
+// Position-only measurement: H = [1 0]
+void GpsReceiver::KalmanAxis::update(float measured, float variance) {
+  float innovation = measured - position;
+  float s = p00 + variance;
+  float k0 = p00 / s;
+  float k1 = p01 / s;
+
+  position += k0 * innovation;
+  velocity += k1 * innovation;
+
+  p11 -= k1 * p01;
+  p01 -= k0 * p01;
+  p00 -= k0 * p00;
+}
+
+// ===== Receiver =====
+
+GpsReceiver::GpsReceiver()
+  : uart(nullptr), filtering(false), originLat(0), originLng(0), metersPerDegLng(METERS_PER_DEG),
+    lastFixSeconds(0), sequence(0), latestMs(0), fixCount(0) {
+  memset(&latest, 0, sizeof(latest));
+}
+
+void GpsReceiver::begin(HardwareSerial& port, int8_t rxPin, int8_t txPin, uint32_t baud) {
+  uart = &port;
+  uart->setRxBufferSize(RX_BUFFER);  // Must come before begin() on the ESP32 core
+  uart->begin(baud, SERIAL_8N1, rxPin, txPin);
+  Serial.println("✓ GPS UART on RX " + String(rxPin) + " @ " + String(baud) + " baud");
+}
+
+void GpsReceiver::poll() {
+  if (uart == nullptr) return;
+
+  for (uint16_t n = 0; n < POLL_BUDGET && uart->available() > 0; n++) {
+    if (parser.encode(uart->read()) && parser.location.isUpdated() && parser.location.isValid()) {
+      onLocation();
+    }
+  }
+}
+
+// GGA and RMC both carry the location; the second one of an epoch has the
+// same timestamp and is skipped
+void GpsReceiver::onLocation() {
+  double lat = parser.location.lat();
+  double lng = parser.location.lng();
+
+  float hdop = parser.hdop.isValid() ? parser.hdop.hdop() : DEFAULT_HDOP;
+  if (hdop < MIN_HDOP) hdop = MIN_HDOP;
+  float sigma = hdop * UERE_M;
+  float variance = sigma * sigma;
+
+  double seconds = millis() / 1000.0;
+  if (parser.time.isValid()) {
+    seconds = parser.time.hour() * 3600 + parser.time.minute() * 60 +
+              parser.time.second() + parser.time.centisecond() / 100.0;
+  }
+  double dt = seconds - lastFixSeconds;
+  if (dt < -43200) dt += 86400;  // Midnight UTC
+  if (filtering && fabs(dt) < 0.001) return;
+  lastFixSeconds = seconds;
+
+  if (!filtering || dt < 0 || dt > RESET_GAP_S) {
+    originLat = lat;
+    originLng = lng;
+    metersPerDegLng = METERS_PER_DEG * cos(lat * DEG_TO_RAD);
+    north.reset(0, variance);
+    east.reset(0, variance);
+    filtering = true;
+  } else {
+    north.predict(dt);
+    east.predict(dt);
+    north.update((lat - originLat) * METERS_PER_DEG, variance);
+    east.update((lng - originLng) * metersPerDegLng, variance);
+  }
+
+  GpsFix fix;
+  fix.lat = originLat + north.position / METERS_PER_DEG;
+  fix.lng = originLng + east.position / metersPerDegLng;
+  fix.rawLat = lat;
+  fix.rawLng = lng;
+  fix.speedMps = sqrtf(north.velocity * north.velocity + east.velocity * east.velocity);
+  fix.accuracyM = sqrtf(north.p00 + east.p00);
+  fix.hdop = hdop;
+  fix.satellites = parser.satellites.isValid() ? parser.satellites.value() : 0;
+  fix.fixMs = millis();
+  fix.count = ++fixCount;
+  publish(fix);
+}
+
+// Sequence lock: readers retry if the counter was odd or moved under them
+void GpsReceiver::publish(const GpsFix& fix) {
+  uint32_t seq = sequence.load(std::memory_order_relaxed);
+  sequence.store(seq + 1, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+  latest = fix;
+  sequence.store(seq + 2, std::memory_order_release);
+  latestMs.store(fix.fixMs, std::memory_order_relaxed);
+}
+
+bool GpsReceiver::read(GpsFix& fix) const {
+  for (;;) {
+    uint32_t before = sequence.load(std::memory_order_acquire);
+    if (before == 0) return false;
+    if (before & 1) continue;
+
+    fix = latest;
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (sequence.load(std::memory_order_relaxed) == before) return true;
+  }
+}
+
+bool GpsReceiver::fresh() const {
+  if (sequence.load(std::memory_order_acquire) == 0) return false;
+  return millis() - latestMs.load(std::memory_order_relaxed) < STALE_MS;
+}
+
+void GpsReceiver::printStats() {
+  GpsFix fix;
+  if (!read(fix)) {
+    Serial.println("GPS: no fix (" + String(parser.charsProcessed()) + " chars, " +
+                   String(parser.failedChecksum()) + " bad checksums)");
+    return;
+  }
+  Serial.println("GPS: " + String(fix.count) + " fixes, " + String(fix.satellites) + " sats, HDOP " +
+                 String(fix.hdop, 1) + ", +/-" + String(fix.accuracyM, 1) + " m, " +
+                 String(fix.speedMps * 3.6f, 1) + " km/h" + (fresh() ? "" : " (stale)"));
+  Serial.println("GPS raw: " + String(fix.rawLat, 6) + ", " + String(fix.rawLng, 6) + ", " +
+                 String(parser.failedChecksum()) + " bad checksums");
+}
@@ -0,0 +1,91 @@
+/*
+ * AERAS GPS - NMEA receiver with Kalman smoothing and an atomic fix snapshot
+ * The UART driver's interrupt-fed RX ring buffer takes bytes off the wire;
+ * poll() drains at most POLL_BUDGET of them per call through TinyGPSPlus,
+ * so loop() never waits for a sentence to complete. Each new location runs
+ * through a constant-velocity Kalman filter (one per axis, in meters around
+ * the first fix, measurement noise scaled by HDOP, time step from the fix
+ * timestamps) and is published behind a sequence counter: read() returns a
+ * consistent fix from any task without locking.
+ *
+ * On the host, hal::replayNmea() (native --nmea FILE) plays a recorded
+ * trace into the same UART.
+ *
+ * Threading: begin/poll/printStats on one task; read/fresh from any task.
+ */
+
+#ifndef AERAS_GPS_H
+#define AERAS_GPS_H
+
+#include <Arduino.h>
+#include <TinyGPSPlus.h>
+#include <atomic>
+
+struct GpsFix {
+  double lat;           // Filtered
+  double lng;
+  double rawLat;        // As received
+  double rawLng;
+  float speedMps;       // Filtered ground speed
+  float accuracyM;      // 1-sigma horizontal position estimate
+  float hdop;
+  uint8_t satellites;
+  uint32_t fixMs;       // millis() when the fix was published
+  uint32_t count;       // Fixes since begin()
+};
+
+class GpsReceiver {
+public:
+  static const size_t RX_BUFFER = 1024;       // ~1 s of 9600 baud NMEA
+  static const uint16_t POLL_BUDGET = 256;    // Bytes parsed per poll()
+  static const uint32_t STALE_MS = 3000;      // fresh() window
+  static const uint32_t RESET_GAP_S = 10;     // Restart the filter after a longer gap
+
+  GpsReceiver();
+
+  void begin(HardwareSerial& uart, int8_t rxPin, int8_t txPin, uint32_t baud = 9600);
+
+  // Parse what has arrived; call from loop()
+  void poll();
+
+  // Latest filtered fix; false until the first one
+  bool read(GpsFix& fix) const;
+
+  // A fix arrived within STALE_MS
+  bool fresh() const;
+
+  void printStats();
+
+private:
+  // Constant-velocity model along one axis (meters, m/s)
+  struct KalmanAxis {
+    float position;
+    float velocity;
+    float p00, p01, p11;  // Covariance
+
+    void reset(float measured, float variance);
+    void predict(float dt);
+    void update(float measured, float variance);
+  };
+
+  void onLocation();
+  void publish(const GpsFix& fix);
+
+  HardwareSerial* uart;
+  TinyGPSPlus parser;
+
+  KalmanAxis north;
+  KalmanAxis east;
+  bool filtering;
+  double originLat;
+  double originLng;
+  double metersPerDegLng;
+  double lastFixSeconds;
+
+  std::atomic<uint32_t> sequence;  // Odd while `latest` is being written
+  GpsFix latest;
+  std::atomic<uint32_t> latestMs;
+  uint32_t fixCount;
+};
+
+#endif
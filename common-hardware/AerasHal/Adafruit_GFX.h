@@ -0,0 +1,52 @@
+/*
+ * AERAS HAL (native) - minimal Adafruit_GFX
+ * Text is drawn with a synthetic 5x7 glyph per character (not the real
+ * font): cursor movement, clipping and which pixels change match the real
+ * library closely enough for layout and dirty-region checks.
+ */
+
+#ifndef AERAS_HAL_ADAFRUIT_GFX_H
+#define AERAS_HAL_ADAFRUIT_GFX_H
+
+#include <Arduino.h>
+
+class Adafruit_GFX : public Print {
+public:
+  Adafruit_GFX(int16_t w, int16_t h);
+
+  virtual void drawPixel(int16_t x, int16_t y, uint16_t color) = 0;
+  virtual void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+  virtual void fillScreen(uint16_t color) { fillRect(0, 0, _width, _height, color); }
+  void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) { fillRect(x, y, w, 1, color); }
+  void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) { fillRect(x, y, 1, h, color); }
+  void drawChar(int16_t x, int16_t y, unsigned char c, uint16_t color, uint16_t bg, uint8_t size);
+
+  void setCursor(int16_t x, int16_t y) { cursor_x = x; cursor_y = y; }
+  int16_t getCursorX() const { return cursor_x; }
+  int16_t getCursorY() const { return cursor_y; }
+  void setTextSize(uint8_t size) { textsize = size > 0 ? size : 1; }
+  void setTextColor(uint16_t color) { textcolor = textbgcolor = color; }
+  void setTextColor(uint16_t color, uint16_t background) { textcolor = color; textbgcolor = background; }
+  void setTextWrap(bool wrap) { this->wrap = wrap; }
+  void setRotation(uint8_t rotation) {}
+
+  int16_t width() const { return _width; }
+  int16_t height() const { return _height; }
+
+  size_t write(uint8_t c) override;
+  using Print::write;
+
+protected:
+  const int16_t WIDTH;
+  const int16_t HEIGHT;
+  int16_t _width;
+  int16_t _height;
+  int16_t cursor_x;
+  int16_t cursor_y;
+  uint16_t textcolor;
+  uint16_t textbgcolor;
+  uint8_t textsize;
+  bool wrap;
+};
+
+#endif
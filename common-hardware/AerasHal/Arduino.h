@@ -0,0 +1,153 @@
+/*
+ * AERAS HAL (native) - Arduino/ESP32 core API on Linux
+ * Lets the unmodified firmware build with the PlatformIO `native` env.
+ * Time, pins, ADC, Serial, FreeRTOS tasks and the ESP object are backed by
+ * the host HAL (Hal.h), which test harnesses and simulations drive.
+ *
+ * Clock: micros()/millis() follow real time, but delay() fast-forwards
+ * instead of sleeping, so firmware runs faster than real time while code
+ * timing (benchmarks) stays real. hal::setManualClock() makes it fully
+ * simulated.
+ */
+
+#ifndef AERAS_HAL_ARDUINO_H
+#define AERAS_HAL_ARDUINO_H
+
+#include <cstdint>
+#include <cstring>
+#include <cstdlib>
+#include <cstdio>
+#include <cmath>
+#include <algorithm>
+
+#include "WString.h"
+#include "Print.h"
+
+using std::min;
+using std::max;
+
+// ===== Core constants =====
+#define HIGH 0x1
+#define LOW 0x0
+
+#define INPUT 0x01
+#define OUTPUT 0x03
+#define INPUT_PULLUP 0x05
+
+#define RISING 0x01
+#define FALLING 0x02
+#define CHANGE 0x03
+
+#ifndef PI
+#define PI 3.1415926535897932384626433832795
+#endif
+#define HALF_PI 1.5707963267948966192313216916398
+#define TWO_PI 6.283185307179586476925286766559
+#define DEG_TO_RAD 0.017453292519943295769236907684886
+#define RAD_TO_DEG 57.295779513082320876798154814105
+#define radians(deg) ((deg) * DEG_TO_RAD)
+#define degrees(rad) ((rad) * RAD_TO_DEG)
+#define sq(x) ((x) * (x))
+
+// ESP32 placement attributes mean nothing on the host
+#define IRAM_ATTR
+#define PROGMEM
+#define RTC_DATA_ATTR
+#define RTC_NOINIT_ATTR
+#define F(text) (text)
+
+typedef bool boolean;
+typedef uint8_t byte;
+
+// ===== Time =====
+unsigned long millis();
+unsigned long micros();
+void delay(uint32_t ms);
+void delayMicroseconds(uint32_t us);
+void yield();
+
+// ===== GPIO / ADC =====
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t level);
+int digitalRead(uint8_t pin);
+uint16_t analogRead(uint8_t pin);
+unsigned long pulseIn(uint8_t pin, uint8_t level, unsigned long timeoutUs = 1000000UL);
+
+inline int digitalPinToInterrupt(uint8_t pin) { return pin; }
+void attachInterrupt(uint8_t interrupt, void (*isr)(), int mode);
+void detachInterrupt(uint8_t interrupt);
+
+// ===== Random =====
+long random(long maxValue);
+long random(long minValue, long maxValue);
+void randomSeed(unsigned long seed);
+
+// ===== Serial =====
+#define SERIAL_8N1 0x800001c
+
+// Writes go to stdout (and the HAL capture buffer); reads come from hal::feedSerial()
+class HardwareSerial : public Stream {
+public:
+  explicit HardwareSerial(uint8_t port) : port(port) {}
+
+  void begin(unsigned long baud, uint32_t config = 0, int8_t rxPin = -1, int8_t txPin = -1) {}
+  void end() {}
+  size_t setRxBufferSize(size_t size) { return size; }
+  operator bool() const { return true; }
+
+  int available() override;
+  int read() override;
+  int peek() override;
+  size_t write(uint8_t c) override;
+  size_t write(const uint8_t* buffer, size_t size) override;
+  using Print::write;
+
+  uint8_t number() const { return port; }
+
+private:
+  uint8_t port;
+};
+
+extern HardwareSerial Serial;
+extern HardwareSerial Serial1;
+extern HardwareSerial Serial2;
+
+// ===== ESP object =====
+class EspClass {
+public:
+  uint32_t getFreeHeap();
+  uint32_t getMinFreeHeap();
+  uint32_t getMaxAllocHeap();
+  uint32_t getCycleCount();   // 240 MHz worth of cycles of host time
+  void restart();
+};
+
+extern EspClass ESP;
+
+// ===== FreeRTOS (tasks run as host threads) =====
+typedef void* TaskHandle_t;
+typedef void (*TaskFunction_t)(void*);
+typedef uint32_t TickType_t;
+typedef int BaseType_t;
+typedef unsigned int UBaseType_t;
+
+#define pdFALSE 0
+#define pdTRUE 1
+#define pdFAIL 0
+#define pdPASS 1
+#define portMAX_DELAY 0xFFFFFFFFUL
+#define pdMS_TO_TICKS(ms) ((TickType_t)(ms))
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t task, const char* name, uint32_t stackDepth,
+                                   void* parameters, UBaseType_t priority,
+                                   TaskHandle_t* createdTask, BaseType_t coreID);
+uint32_t ulTaskNotifyTake(BaseType_t clearOnExit, TickType_t ticksToWait);
+BaseType_t xTaskNotifyGive(TaskHandle_t task);
+void vTaskDelay(TickType_t ticks);
+BaseType_t xPortGetCoreID();
+
+// Firmware entry points (NativeMain.cpp drives them)
+void setup();
+void loop();
+
+#endif
@@ -0,0 +1,180 @@
+#include "HalInternal.h"
+#include <Adafruit_SSD1306.h>
+
+// ===== Wire =====
+TwoWire Wire;
+
+void TwoWire::beginTransmission(uint8_t address) {
+  pending = 1;   // Address byte
+}
+
+uint8_t TwoWire::endTransmission(bool sendStop) {
+  hal::internal::countI2cBytes(pending);
+  pending = 0;
+  return 0;
+}
+
+size_t TwoWire::write(uint8_t data) {
+  pending++;
+  return 1;
+}
+
+size_t TwoWire::write(const uint8_t* data, size_t size) {
+  pending += size;
+  return size;
+}
+
+// ===== Adafruit_GFX =====
+static const uint8_t GLYPH_COLUMNS = 5;
+static const uint8_t GLYPH_ADVANCE = 6;
+static const uint8_t GLYPH_ROWS = 8;
+
+// Stand-in font: a fixed pseudo-random 7-row column pattern per character
+static uint8_t glyphColumn(unsigned char c, uint8_t column) {
+  if (c == ' ') return 0;
+  uint32_t hash = (c + 1) * 2654435761u;
+  return ((hash >> (column * 5)) & 0x7F) | 0x01;
+}
+
+Adafruit_GFX::Adafruit_GFX(int16_t w, int16_t h)
+  : WIDTH(w), HEIGHT(h), _width(w), _height(h), cursor_x(0), cursor_y(0),
+    textcolor(0xFFFF), textbgcolor(0xFFFF), textsize(1), wrap(true) {}
+
+void Adafruit_GFX::fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+  for (int16_t i = x; i < x + w; i++) {
+    for (int16_t j = y; j < y + h; j++) drawPixel(i, j, color);
+  }
+}
+
+void Adafruit_GFX::drawChar(int16_t x, int16_t y, unsigned char c, uint16_t color, uint16_t bg,
+                            uint8_t size) {
+  if (x >= _width || y >= _height || x + GLYPH_ADVANCE * size <= 0 || y + GLYPH_ROWS * size <= 0) return;
+
+  for (uint8_t column = 0; column < GLYPH_ADVANCE; column++) {
+    uint8_t bits = column < GLYPH_COLUMNS ? glyphColumn(c, column) : 0;
+    for (uint8_t row = 0; row < GLYPH_ROWS; row++, bits >>= 1) {
+      if (bits & 1) {
+        fillRect(x + column * size, y + row * size, size, size, color);
+      } else if (bg != color) {
+        fillRect(x + column * size, y + row * size, size, size, bg);
+      }
+    }
+  }
+}
+
+size_t Adafruit_GFX::write(uint8_t c) {
+  if (c == '\n') {
+    cursor_x = 0;
+    cursor_y += textsize * GLYPH_ROWS;
+  } else if (c != '\r') {
+    if (wrap && cursor_x + textsize * GLYPH_ADVANCE > _width) {
+      cursor_x = 0;
+      cursor_y += textsize * GLYPH_ROWS;
+    }
+    drawChar(cursor_x, cursor_y, c, textcolor, textbgcolor, textsize);
+    cursor_x += textsize * GLYPH_ADVANCE;
+  }
+  return 1;
+}
+
+// ===== Adafruit_SSD1306 =====
+static const uint8_t WIRE_MAX = I2C_BUFFER_LENGTH - 1;   // One byte goes to the control prefix
+
+Adafruit_SSD1306::Adafruit_SSD1306(uint8_t w, uint8_t h, TwoWire* twi, int8_t rst_pin,
+                                   uint32_t clkDuring, uint32_t clkAfter)
+  : Adafruit_GFX(w, h), wire(twi ? twi : &Wire), buffer(nullptr), i2caddr(0),
+    wireClk(clkDuring), restoreClk(clkAfter) {}
+
+Adafruit_SSD1306::~Adafruit_SSD1306() {
+  free(buffer);
+}
+
+bool Adafruit_SSD1306::begin(uint8_t switchvcc, uint8_t i2caddr, bool reset, bool periphBegin) {
+  if (buffer == nullptr) {
+    buffer = (uint8_t*)malloc(WIDTH * ((HEIGHT + 7) / 8));
+    if (buffer == nullptr) return false;
+  }
+  clearDisplay();
+  this->i2caddr = i2caddr ? i2caddr : 0x3C;
+  if (periphBegin) wire->begin();
+
+  // Same length as the real init sequence for a 128x64 panel
+  static const uint8_t init[] = {
+    SSD1306_DISPLAYOFF, 0xD5, 0x80, 0xA8, 0x3F, 0xD3, 0x00, 0x40, 0x8D, 0x14,
+    SSD1306_MEMORYMODE, 0x00, 0xA1, 0xC8, 0xDA, 0x12, 0x81, 0xCF, 0xD9, 0xF1,
+    0xDB, 0x40, 0xA4, 0xA6, 0x2E, SSD1306_DISPLAYON
+  };
+  wire->setClock(wireClk);
+  ssd1306_commandList(init, sizeof(init));
+  if (restoreClk) wire->setClock(restoreClk);
+  return true;
+}
+
+void Adafruit_SSD1306::clearDisplay() {
+  memset(buffer, 0, WIDTH * ((HEIGHT + 7) / 8));
+}
+
+void Adafruit_SSD1306::drawPixel(int16_t x, int16_t y, uint16_t color) {
+  if (buffer == nullptr || x < 0 || x >= _width || y < 0 || y >= _height) return;
+  uint8_t& cell = buffer[x + (y / 8) * WIDTH];
+  uint8_t bit = 1 << (y & 7);
+  switch (color) {
+    case SSD1306_WHITE: cell |= bit; break;
+    case SSD1306_BLACK: cell &= ~bit; break;
+    case SSD1306_INVERSE: cell ^= bit; break;
+  }
+}
+
+bool Adafruit_SSD1306::getPixel(int16_t x, int16_t y) {
+  if (buffer == nullptr || x < 0 || x >= _width || y < 0 || y >= _height) return false;
+  return buffer[x + (y / 8) * WIDTH] & (1 << (y & 7));
+}
+
+void Adafruit_SSD1306::display() {
+  static const uint8_t window[] = { SSD1306_PAGEADDR, 0, 0xFF, SSD1306_COLUMNADDR, 0 };
+  wire->setClock(wireClk);
+  ssd1306_commandList(window, sizeof(window));
+  ssd1306_command1(WIDTH - 1);
+
+  size_t count = WIDTH * ((HEIGHT + 7) / 8);
+  const uint8_t* ptr = buffer;
+  wire->beginTransmission(i2caddr);
+  wire->write((uint8_t)0x40);
+  size_t bytesOut = 1;
+  while (count--) {
+    if (bytesOut >= WIRE_MAX) {
+      wire->endTransmission();
+      wire->beginTransmission(i2caddr);
+      wire->write((uint8_t)0x40);
+      bytesOut = 1;
+    }
+    wire->write(*ptr++);
+    bytesOut++;
+  }
+  wire->endTransmission();
+  if (restoreClk) wire->setClock(restoreClk);
+}
+
+void Adafruit_SSD1306::ssd1306_command1(uint8_t c) {
+  wire->beginTransmission(i2caddr);
+  wire->write((uint8_t)0x00);
+  wire->write(c);
+  wire->endTransmission();
+}
+
+void Adafruit_SSD1306::ssd1306_commandList(const uint8_t* c, uint8_t n) {
+  wire->beginTransmission(i2caddr);
+  wire->write((uint8_t)0x00);
+  uint8_t bytesOut = 1;
+  while (n--) {
+    if (bytesOut >= WIRE_MAX) {
+      wire->endTransmission();
+      wire->beginTransmission(i2caddr);
+      wire->write((uint8_t)0x00);
+      bytesOut = 1;
+    }
+    wire->write(*c++);
+    bytesOut++;
+  }
+  wire->endTransmission();
+}
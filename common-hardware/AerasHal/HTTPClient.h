@@ -0,0 +1,80 @@
+/*
+ * AERAS HAL (native) - HTTPClient routed to the HAL request handler
+ * sendRequest() hands method, URL, body and If-None-Match to whatever
+ * hal::setHttpHandler() installed (a fake backend, a recorded trace...).
+ * With no handler every request fails with HTTPC_ERROR_CONNECTION_REFUSED.
+ */
+
+#ifndef AERAS_HAL_HTTP_CLIENT_H
+#define AERAS_HAL_HTTP_CLIENT_H
+
+#include <Arduino.h>
+#include <WiFi.h>
+#include <map>
+#include <string>
+
+#define HTTPC_ERROR_CONNECTION_REFUSED (-1)
+#define HTTPC_ERROR_SEND_HEADER_FAILED (-2)
+#define HTTPC_ERROR_SEND_PAYLOAD_FAILED (-3)
+#define HTTPC_ERROR_NOT_CONNECTED (-4)
+#define HTTPC_ERROR_CONNECTION_LOST (-5)
+#define HTTPC_ERROR_NO_HTTP_SERVER (-7)
+#define HTTPC_ERROR_READ_TIMEOUT (-11)
+
+#define HTTP_CODE_OK 200
+#define HTTP_CODE_NOT_MODIFIED 304
+#define HTTP_CODE_NOT_FOUND 404
+
+// Response body as a Stream, like the socket behind getStream() on the ESP32
+class ResponseStream : public Stream {
+public:
+  ResponseStream() : position(0) {}
+  void assign(const std::string& data) { body = data; position = 0; }
+  const std::string& contents() const { return body; }
+
+  int available() override { return body.size() - position; }
+  int read() override { return position < body.size() ? (uint8_t)body[position++] : -1; }
+  int peek() override { return position < body.size() ? (uint8_t)body[position] : -1; }
+  size_t write(uint8_t c) override { return 0; }
+  using Print::write;
+
+private:
+  std::string body;
+  size_t position;
+};
+
+class HTTPClient {
+public:
+  bool begin(WiFiClient& client, const String& url);
+  bool begin(const String& url);
+  void end();
+
+  void setReuse(bool reuse) {}
+  void setTimeout(uint16_t timeoutMs) {}
+  void setConnectTimeout(int32_t timeoutMs) {}
+  void addHeader(const String& name, const String& value);
+  void collectHeaders(const char* headerKeys[], const size_t headerKeysCount);
+
+  int sendRequest(const char* method, uint8_t* payload = nullptr, size_t size = 0);
+  int sendRequest(const char* method, const String& payload);
+  int GET() { return sendRequest("GET"); }
+  int POST(const String& payload) { return sendRequest("POST", payload); }
+  int POST(uint8_t* payload, size_t size) { return sendRequest("POST", payload, size); }
+
+  Stream& getStream() { return response; }
+  String getString() { return String(response.contents()); }
+  int getSize() { return response.contents().size(); }
+  String header(const char* name);
+  bool hasHeader(const char* name);
+  bool connected() { return false; }
+
+  static String errorToString(int error);
+
+private:
+  std::string url;
+  std::map<std::string, std::string> requestHeaders;
+  std::map<std::string, std::string> responseHeaders;
+  ResponseStream response;
+};
+
+#endif
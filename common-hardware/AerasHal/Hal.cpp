@@ -0,0 +1,486 @@
+#include "Hal.h"
+#include "HalInternal.h"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <vector>
+
+// ===== Clock =====
+// Time = host steady clock (unless manual) + everything skipped by delay()
+
+static const std::chrono::steady_clock::time_point clockStart = std::chrono::steady_clock::now();
+static const std::thread::id loopThread = std::this_thread::get_id();
+static std::atomic<bool> manualClock(false);
+static std::atomic<int64_t> skippedUs(0);
+
+static std::mutex eventMutex;
+static std::multimap<uint64_t, std::function<void()>> events;
+static bool runningEvents = false;
+static bool eventClockPinned = false;
+static uint64_t eventClockUs = 0;
+
+static uint64_t hostUs() {
+  return std::chrono::duration_cast<std::chrono::microseconds>(
+    std::chrono::steady_clock::now() - clockStart).count();
+}
+
+static uint64_t clockUs() {
+  return (manualClock ? 0 : hostUs()) + skippedUs;
+}
+
+// Fire due device events on the loop thread only. While an event runs the
+// clock reads as the event's own time, so an ISR timestamping an echo edge
+// sees when it happened, not when the firmware next looked at the clock.
+static void runDueEvents(uint64_t untilUs) {
+  if (std::this_thread::get_id() != loopThread || runningEvents) return;
+  runningEvents = true;
+
+  while (true) {
+    std::function<void()> action;
+    uint64_t dueUs;
+    {
+      std::lock_guard<std::mutex> lock(eventMutex);
+      if (events.empty() || events.begin()->first > untilUs) break;
+      dueUs = events.begin()->first;
+      action = std::move(events.begin()->second);
+      events.erase(events.begin());
+    }
+    eventClockPinned = true;
+    eventClockUs = dueUs;
+    action();
+    eventClockPinned = false;
+  }
+
+  runningEvents = false;
+}
+
+namespace hal {
+
+uint64_t nowUs() {
+  if (eventClockPinned && std::this_thread::get_id() == loopThread) return eventClockUs;
+  uint64_t now = clockUs();
+  runDueEvents(now);
+  return now;
+}
+
+void skipUs(uint64_t us) {
+  uint64_t target = clockUs() + us;
+  runDueEvents(target);
+  int64_t behind = (int64_t)(target - clockUs());
+  if (behind > 0) skippedUs += behind;
+}
+
+void setManualClock(bool manual) {
+  // Keep the reading continuous across the switch
+  uint64_t now = clockUs();
+  manualClock = manual;
+  skippedUs += (int64_t)now - (int64_t)clockUs();
+}
+
+void at(uint64_t atUs, std::function<void()> action) {
+  std::lock_guard<std::mutex> lock(eventMutex);
+  events.emplace(atUs, std::move(action));
+}
+
+}  // namespace hal
+
+unsigned long millis() {
+  return (unsigned long)(uint32_t)(hal::nowUs() / 1000);
+}
+
+unsigned long micros() {
+  return (unsigned long)(uint32_t)hal::nowUs();
+}
+
+void delay(uint32_t ms) {
+  hal::skipUs((uint64_t)ms * 1000);
+  yield();
+}
+
+void delayMicroseconds(uint32_t us) {
+  hal::skipUs(us);
+}
+
+void yield() {
+  std::this_thread::yield();
+}
+
+// ===== GPIO / ADC =====
+static const uint8_t PIN_COUNT = 64;
+
+struct PinState {
+  uint8_t mode = INPUT;
+  int level = LOW;
+  uint16_t analog = 0;
+  void (*isr)() = nullptr;
+  int isrMode = 0;
+};
+
+static PinState pins[PIN_COUNT];
+static std::vector<std::function<void(uint8_t, int)>> pinWriteHooks;
+
+void pinMode(uint8_t pin, uint8_t mode) {
+  if (pin >= PIN_COUNT) return;
+  pins[pin].mode = mode;
+  if (mode == INPUT_PULLUP) pins[pin].level = HIGH;
+}
+
+void digitalWrite(uint8_t pin, uint8_t level) {
+  if (pin >= PIN_COUNT) return;
+  pins[pin].level = level ? HIGH : LOW;
+  for (auto& hook : pinWriteHooks) hook(pin, pins[pin].level);
+}
+
+int digitalRead(uint8_t pin) {
+  if (pin >= PIN_COUNT) return LOW;
+  hal::nowUs();   // Let pending device events settle the pin first
+  return pins[pin].level;
+}
+
+uint16_t analogRead(uint8_t pin) {
+  if (pin >= PIN_COUNT) return 0;
+  return pins[pin].analog;
+}
+
+unsigned long pulseIn(uint8_t pin, uint8_t level, unsigned long timeoutUs) {
+  if (pin >= PIN_COUNT) return 0;
+  uint64_t deadline = hal::nowUs() + timeoutUs;
+
+  // Step simulated time in 1us ticks, so scheduled edges land exactly
+  while (digitalRead(pin) == level) {
+    if (hal::nowUs() >= deadline) return 0;
+    hal::skipUs(1);
+  }
+  while (digitalRead(pin) != level) {
+    if (hal::nowUs() >= deadline) return 0;
+    hal::skipUs(1);
+  }
+  uint64_t start = hal::nowUs();
+  while (digitalRead(pin) == level) {
+    if (hal::nowUs() >= deadline) return 0;
+    hal::skipUs(1);
+  }
+  return hal::nowUs() - start;
+}
+
+void attachInterrupt(uint8_t interrupt, void (*isr)(), int mode) {
+  if (interrupt >= PIN_COUNT) return;
+  pins[interrupt].isr = isr;
+  pins[interrupt].isrMode = mode;
+}
+
+void detachInterrupt(uint8_t interrupt) {
+  if (interrupt >= PIN_COUNT) return;
+  pins[interrupt].isr = nullptr;
+}
+
+namespace hal {
+
+void setPin(uint8_t pin, int level) {
+  if (pin >= PIN_COUNT) return;
+  PinState& state = pins[pin];
+  int previous = state.level;
+  state.level = level ? HIGH : LOW;
+  if (state.isr == nullptr || previous == state.level) return;
+
+  bool rose = state.level == HIGH;
+  if (state.isrMode == CHANGE || (state.isrMode == RISING && rose) ||
+      (state.isrMode == FALLING && !rose)) {
+    state.isr();
+  }
+}
+
+int pinLevel(uint8_t pin) {
+  return pin < PIN_COUNT ? pins[pin].level : LOW;
+}
+
+void setAnalog(uint8_t pin, uint16_t value) {
+  if (pin < PIN_COUNT) pins[pin].analog = value;
+}
+
+void onPinWrite(std::function<void(uint8_t pin, int level)> hook) {
+  pinWriteHooks.push_back(std::move(hook));
+}
+
+// ===== HC-SR04 model =====
+static const uint32_t ULTRASONIC_ECHO_DELAY_US = 450;   // Burst + transducer lag
+static const float SOUND_CM_PER_US = 0.0343;
+
+static float ultrasonicCm = 0;
+
+void attachUltrasonic(uint8_t trigPin, uint8_t echoPin) {
+  auto trigLevel = std::make_shared<int>(LOW);
+
+  onPinWrite([=](uint8_t pin, int level) {
+    if (pin != trigPin) return;
+    bool falling = *trigLevel == HIGH && level == LOW;
+    *trigLevel = level;
+    if (!falling || ultrasonicCm <= 0) return;
+
+    uint64_t rise = nowUs() + ULTRASONIC_ECHO_DELAY_US;
+    uint64_t width = (uint64_t)(ultrasonicCm * 2 / SOUND_CM_PER_US);
+    at(rise, [=]() { setPin(echoPin, HIGH); });
+    at(rise + width, [=]() { setPin(echoPin, LOW); });
+  });
+}
+
+void setUltrasonicDistance(float cm) {
+  ultrasonicCm = cm;
+}
+
+// ===== NMEA GPS model =====
+// UTC time of day from field 1 ("$GPRMC,123519.00,...") or -1 for
+// sentences without one (GSA, GSV), which ride along with the last epoch
+static double nmeaSeconds(const std::string& line) {
+  size_t comma = line.find(',');
+  if (comma == std::string::npos || line.size() < comma + 7) return -1;
+  const char* field = line.c_str() + comma + 1;
+  for (int i = 0; i < 6; i++) {
+    if (!isdigit((unsigned char)field[i])) return -1;
+  }
+  int hh = (field[0] - '0') * 10 + (field[1] - '0');
+  int mm = (field[2] - '0') * 10 + (field[3] - '0');
+  return hh * 3600 + mm * 60 + atof(field + 4);
+}
+
+bool replayNmea(const std::string& path, double speed, HardwareSerial& port) {
+  std::ifstream file(path);
+  if (!file || speed <= 0) return false;
+
+  uint64_t startUs = nowUs();
+  double firstSeconds = -1, lastSeconds = -1, dayOffset = 0;
+  uint64_t epochUs = startUs;
+  std::string epoch, line;
+
+  while (std::getline(file, line)) {
+    if (!line.empty() && line.back() == '\r') line.pop_back();
+    if (line.empty() || line[0] == '#') continue;
+
+    double seconds = nmeaSeconds(line);
+    if (seconds >= 0) {
+      if (lastSeconds >= 0 && seconds + dayOffset < lastSeconds - 43200) dayOffset += 86400;  // Midnight
+      seconds += dayOffset;
+      if (firstSeconds < 0) firstSeconds = seconds;
+
+      if (seconds != lastSeconds && !epoch.empty()) {
+        at(epochUs, [epoch, &port]() { feedSerial(epoch, port); });
+        epoch.clear();
+      }
+      lastSeconds = seconds;
+      epochUs = startUs + (uint64_t)((seconds - firstSeconds) / speed * 1e6);
+    }
+    epoch += line + "\r\n";
+  }
+  if (!epoch.empty()) at(epochUs, [epoch, &port]() { feedSerial(epoch, port); });
+  return true;
+}
+
+}  // namespace hal
+
+// ===== Random =====
+static std::mt19937 rng(1);
+
+long random(long maxValue) {
+  return random(0, maxValue);
+}
+
+long random(long minValue, long maxValue) {
+  if (maxValue <= minValue) return minValue;
+  std::uniform_int_distribution<long> range(minValue, maxValue - 1);
+  return range(rng);
+}
+
+void randomSeed(unsigned long seed) {
+  rng.seed(seed);
+}
+
+// ===== Serial =====
+static const uint8_t SERIAL_PORTS = 3;
+
+static std::mutex serialMutex;
+static std::deque<uint8_t> serialInput[SERIAL_PORTS];
+static std::string serialCapture;
+static std::atomic<bool> serialEcho(true);
+
+HardwareSerial Serial(0);
+HardwareSerial Serial1(1);
+HardwareSerial Serial2(2);
+
+int HardwareSerial::available() {
+  std::lock_guard<std::mutex> lock(serialMutex);
+  return serialInput[port].size();
+}
+
+int HardwareSerial::read() {
+  std::lock_guard<std::mutex> lock(serialMutex);
+  if (serialInput[port].empty()) return -1;
+  uint8_t c = serialInput[port].front();
+  serialInput[port].pop_front();
+  return c;
+}
+
+int HardwareSerial::peek() {
+  std::lock_guard<std::mutex> lock(serialMutex);
+  return serialInput[port].empty() ? -1 : serialInput[port].front();
+}
+
+size_t HardwareSerial::write(uint8_t c) {
+  return write(&c, 1);
+}
+
+size_t HardwareSerial::write(const uint8_t* buffer, size_t size) {
+  if (port != 0) return size;   // Peripherals on the other UARTs don't listen
+  std::lock_guard<std::mutex> lock(serialMutex);
+  serialCapture.append((const char*)buffer, size);
+  if (serialEcho) {
+    fwrite(buffer, 1, size, stdout);
+    fflush(stdout);
+  }
+  return size;
+}
+
+namespace hal {
+
+void feedSerial(const std::string& text, HardwareSerial& port) {
+  std::lock_guard<std::mutex> lock(serialMutex);
+  serialInput[port.number()].insert(serialInput[port.number()].end(), text.begin(), text.end());
+}
+
+void setSerialEcho(bool enabled) {
+  serialEcho = enabled;
+}
+
+std::string takeSerialOutput() {
+  std::lock_guard<std::mutex> lock(serialMutex);
+  std::string output;
+  output.swap(serialCapture);
+  return output;
+}
+
+}  // namespace hal
+
+// ===== ESP object =====
+// The host has no meaningful heap figure; a constant keeps heap deltas at zero
+static const uint32_t NATIVE_FREE_HEAP = 256 * 1024;
+
+EspClass ESP;
+
+uint32_t EspClass::getFreeHeap() { return NATIVE_FREE_HEAP; }
+uint32_t EspClass::getMinFreeHeap() { return NATIVE_FREE_HEAP; }
+uint32_t EspClass::getMaxAllocHeap() { return NATIVE_FREE_HEAP; }
+uint32_t EspClass::getCycleCount() { return (uint32_t)(hostUs() * 240); }
+
+void EspClass::restart() {
+  Serial.println("🔄 ESP.restart() - exiting native run");
+  fflush(stdout);
+  _Exit(0);
+}
+
+// ===== FreeRTOS =====
+struct NativeTask {
+  std::mutex mutex;
+  std::condition_variable wake;
+  uint32_t notifications = 0;
+};
+
+static thread_local NativeTask* currentTask = nullptr;
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t task, const char* name, uint32_t stackDepth,
+                                   void* parameters, UBaseType_t priority,
+                                   TaskHandle_t* createdTask, BaseType_t coreID) {
+  NativeTask* handle = new NativeTask();
+  std::thread([=]() {
+    currentTask = handle;
+    task(parameters);
+  }).detach();
+
+  if (createdTask != nullptr) *createdTask = handle;
+  return pdPASS;
+}
+
+uint32_t ulTaskNotifyTake(BaseType_t clearOnExit, TickType_t ticksToWait) {
+  if (currentTask == nullptr) {
+    vTaskDelay(ticksToWait == portMAX_DELAY ? 1 : ticksToWait);
+    return 0;
+  }
+
+  std::unique_lock<std::mutex> lock(currentTask->mutex);
+  auto notified = [] { return currentTask->notifications > 0; };
+  if (ticksToWait == portMAX_DELAY) {
+    currentTask->wake.wait(lock, notified);
+  } else {
+    currentTask->wake.wait_for(lock, std::chrono::milliseconds(ticksToWait), notified);
+  }
+
+  uint32_t value = currentTask->notifications;
+  if (clearOnExit) currentTask->notifications = 0;
+  else if (value > 0) currentTask->notifications--;
+  return value;
+}
+
+BaseType_t xTaskNotifyGive(TaskHandle_t task) {
+  NativeTask* target = (NativeTask*)task;
+  if (target == nullptr) return pdFAIL;
+  {
+    std::lock_guard<std::mutex> lock(target->mutex);
+    target->notifications++;
+  }
+  target->wake.notify_one();
+  return pdPASS;
+}
+
+// Background tasks sleep for real; the loop thread fast-forwards like delay()
+void vTaskDelay(TickType_t ticks) {
+  if (currentTask == nullptr) {
+    delay(ticks);
+  } else {
+    std::this_thread::sleep_for(std::chrono::milliseconds(ticks));
+  }
+}
+
+BaseType_t xPortGetCoreID() {
+  return currentTask == nullptr ? 1 : 0;
+}
+
+// ===== Statistics =====
+static std::atomic<uint64_t> i2cByteCount(0);
+static std::atomic<uint32_t> httpRequestCount(0);
+static std::atomic<bool> wifiUp(true);
+
+namespace hal {
+
+void setWifiAvailable(bool available) {
+  wifiUp = available;
+}
+
+uint64_t i2cBytes() {
+  return i2cByteCount;
+}
+
+uint32_t httpRequests() {
+  return httpRequestCount;
+}
+
+namespace internal {
+
+void countI2cBytes(size_t bytes) {
+  i2cByteCount += bytes;
+}
+
+void countHttpRequest() {
+  httpRequestCount++;
+}
+
+bool wifiAvailable() {
+  return wifiUp;
+}
+
+}  // namespace internal
+}  // namespace hal
@@ -0,0 +1,79 @@
+/*
+ * AERAS HAL (native) - harness-facing control of the fake hardware
+ * The Arduino headers in this library are what the firmware sees; this is
+ * what a test, benchmark or simulation uses to drive it: move the clock,
+ * set input pins and ADC readings, feed the serial console, answer HTTP
+ * requests and read back bus statistics.
+ *
+ * Everything here is meant for the firmware's loop thread, except the HTTP
+ * handler, which is called from the network task's thread.
+ */
+
+#ifndef AERAS_HAL_H
+#define AERAS_HAL_H
+
+#include <Arduino.h>
+#include <functional>
+#include <map>
+#include <string>
+
+namespace hal {
+
+// ===== Clock =====
+uint64_t nowUs();
+
+// Move simulated time forward (what delay() does), firing device events
+void skipUs(uint64_t us);
+
+// true: time only moves through skipUs()/delay() - fully deterministic runs
+void setManualClock(bool manual);
+
+// Run action once simulated time reaches atUs (device models, scripted input)
+void at(uint64_t atUs, std::function<void()> action);
+
+// ===== GPIO / ADC =====
+void setPin(uint8_t pin, int level);        // Drive an input; fires attached interrupts
+int pinLevel(uint8_t pin);                  // Current level, input or output
+void setAnalog(uint8_t pin, uint16_t value);
+void onPinWrite(std::function<void(uint8_t pin, int level)> hook);
+
+// HC-SR04 model: a trigger pulse on trigPin produces an echo pulse on echoPin
+void attachUltrasonic(uint8_t trigPin, uint8_t echoPin);
+void setUltrasonicDistance(float cm);       // <= 0 = nothing in range (no echo)
+
+// GPS receiver model: plays a recorded .nmea file into a UART one fix epoch
+// at a time on the simulated clock, `speed` times faster than recorded.
+// Lines starting with '#' are skipped. false if the file can't be read.
+bool replayNmea(const std::string& path, double speed = 1.0, HardwareSerial& port = Serial2);
+
+// ===== Serial =====
+void feedSerial(const std::string& text, HardwareSerial& port = Serial);
+void setSerialEcho(bool enabled);           // Copy firmware output to stdout (default on)
+std::string takeSerialOutput();             // Output since the last call
+
+// ===== Network =====
+struct HttpRequest {
+  std::string method;
+  std::string url;
+  std::string body;
+  std::map<std::string, std::string> headers;
+};
+
+struct HttpResponse {
+  int code;                                  // < 0 = transport error (HTTPC_ERROR_*)
+  std::string body;
+  std::map<std::string, std::string> headers;
+};
+
+typedef std::function<HttpResponse(const HttpRequest&)> HttpHandler;
+
+void setHttpHandler(HttpHandler handler);
+void setWifiAvailable(bool available);
+
+// ===== Statistics =====
+uint64_t i2cBytes();                         // Bytes on the wire, address bytes included
+uint32_t httpRequests();
+
+}  // namespace hal
+
+#endif
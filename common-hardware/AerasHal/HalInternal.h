@@ -0,0 +1,19 @@
+// Cross-file hooks between the HAL translation units (not for firmware)
+
+#ifndef AERAS_HAL_INTERNAL_H
+#define AERAS_HAL_INTERNAL_H
+
+#include <cstddef>
+#include <cstdint>
+
+namespace hal {
+namespace internal {
+
+void countI2cBytes(size_t bytes);
+void countHttpRequest();
+bool wifiAvailable();
+
+}  // namespace internal
+}  // namespace hal
+
+#endif
@@ -0,0 +1,68 @@
+// Native entry point: setup() once, then loop() forever, like the ESP32 core.
+// Define AERAS_NO_NATIVE_MAIN when a harness (simulator, test) brings its own
+// main() and drives setup()/loop() itself; `pio test` builds (PIO_UNIT_TESTING)
+// always bring their own.
+
+#if !defined(AERAS_NO_NATIVE_MAIN) && !defined(PIO_UNIT_TESTING)
+
+#include "Hal.h"
+#include <iostream>
+#include <string>
+#include <thread>
+
+static const uint32_t LOOP_TICK_US = 1000;   // Simulated time between loop() passes
+
+static void usage(const char* program) {
+  printf("usage: %s [--seconds N] [--manual-clock] [--nmea FILE [--nmea-speed N]]\n", program);
+  printf("  --seconds N      stop after N seconds of simulated time\n");
+  printf("  --manual-clock   time only moves through delay() (deterministic)\n");
+  printf("  --nmea FILE      replay a recorded NMEA trace into Serial2 after setup()\n");
+  printf("  --nmea-speed N   replay N times faster than recorded (default 1)\n");
+  printf("  stdin lines are fed to Serial\n");
+}
+
+int main(int argc, char** argv) {
+  double seconds = 0;
+  std::string nmeaPath;
+  double nmeaSpeed = 1.0;
+  for (int i = 1; i < argc; i++) {
+    std::string arg = argv[i];
+    if (arg == "--seconds" && i + 1 < argc) {
+      seconds = atof(argv[++i]);
+    } else if (arg == "--manual-clock") {
+      hal::setManualClock(true);
+    } else if (arg == "--nmea" && i + 1 < argc) {
+      nmeaPath = argv[++i];
+    } else if (arg == "--nmea-speed" && i + 1 < argc) {
+      nmeaSpeed = atof(argv[++i]);
+    } else {
+      usage(argv[0]);
+      return arg == "--help" ? 0 : 2;
+    }
+  }
+
+  std::thread([]() {
+    std::string line;
+    while (std::getline(std::cin, line)) hal::feedSerial(line + "\n");
+  }).detach();
+
+  uint64_t stopUs = seconds > 0 ? hal::nowUs() + (uint64_t)(seconds * 1000000) : 0;
+
+  setup();
+  if (!nmeaPath.empty() && !hal::replayNmea(nmeaPath, nmeaSpeed)) {
+    fprintf(stderr, "cannot replay %s\n", nmeaPath.c_str());
+    fflush(stdout);
+    _Exit(2);
+  }
+
+  while (stopUs == 0 || hal::nowUs() < stopUs) {
+    loop();
+    hal::skipUs(LOOP_TICK_US);
+  }
+
+  // The network task thread never returns; skip static destructors under it
+  fflush(stdout);
+  _Exit(0);
+}
+
+#endif
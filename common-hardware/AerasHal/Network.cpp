@@ -0,0 +1,149 @@
+#include "Hal.h"
+#include "HalInternal.h"
+#include <HTTPClient.h>
+#include <WiFi.h>
+
+#include <cctype>
+#include <mutex>
+
+// ===== IPAddress =====
+String IPAddress::toString() const {
+  char text[16];
+  snprintf(text, sizeof(text), "%u.%u.%u.%u", address & 0xFF, (address >> 8) & 0xFF,
+           (address >> 16) & 0xFF, (address >> 24) & 0xFF);
+  return String(text);
+}
+
+bool IPAddress::fromString(const char* text) {
+  unsigned int a, b, c, d;
+  char extra;
+  if (sscanf(text, "%u.%u.%u.%u%c", &a, &b, &c, &d, &extra) != 4) return false;
+  if (a > 255 || b > 255 || c > 255 || d > 255) return false;
+  *this = IPAddress(a, b, c, d);
+  return true;
+}
+
+// ===== WiFi =====
+WiFiClass WiFi;
+
+static bool stationStarted = false;
+
+wl_status_t WiFiClass::begin(const char* ssid, const char* password, int32_t channel,
+                             const uint8_t* bssid, bool connect) {
+  this->ssid = ssid;
+  stationStarted = true;
+  return status();
+}
+
+wl_status_t WiFiClass::status() {
+  if (!stationStarted) return WL_IDLE_STATUS;
+  return hal::internal::wifiAvailable() ? WL_CONNECTED : WL_DISCONNECTED;
+}
+
+bool WiFiClass::disconnect(bool wifiOff) {
+  stationStarted = false;
+  return true;
+}
+
+bool WiFiClass::reconnect() {
+  stationStarted = true;
+  return true;
+}
+
+// ===== HTTP =====
+static std::mutex handlerMutex;
+static hal::HttpHandler httpHandler;
+
+namespace hal {
+
+void setHttpHandler(HttpHandler handler) {
+  std::lock_guard<std::mutex> lock(handlerMutex);
+  httpHandler = std::move(handler);
+}
+
+}  // namespace hal
+
+static bool sameHeader(const std::string& a, const char* b) {
+  size_t length = strlen(b);
+  if (a.size() != length) return false;
+  for (size_t i = 0; i < length; i++) {
+    if (tolower((unsigned char)a[i]) != tolower((unsigned char)b[i])) return false;
+  }
+  return true;
+}
+
+bool HTTPClient::begin(WiFiClient& client, const String& url) {
+  return begin(url);
+}
+
+bool HTTPClient::begin(const String& url) {
+  this->url = url.c_str();
+  requestHeaders.clear();
+  return true;
+}
+
+void HTTPClient::end() {
+  requestHeaders.clear();
+  responseHeaders.clear();
+  response.assign("");
+}
+
+void HTTPClient::addHeader(const String& name, const String& value) {
+  requestHeaders[name.c_str()] = value.c_str();
+}
+
+// Every response header is kept; the filter only matters for RAM on the ESP32
+void HTTPClient::collectHeaders(const char* headerKeys[], const size_t headerKeysCount) {}
+
+int HTTPClient::sendRequest(const char* method, uint8_t* payload, size_t size) {
+  hal::HttpHandler handler;
+  {
+    std::lock_guard<std::mutex> lock(handlerMutex);
+    handler = httpHandler;
+  }
+  if (!handler || WiFi.status() != WL_CONNECTED) return HTTPC_ERROR_CONNECTION_REFUSED;
+
+  hal::HttpRequest request;
+  request.method = method;
+  request.url = url;
+  if (payload != nullptr) request.body.assign((const char*)payload, size);
+  request.headers = requestHeaders;
+
+  hal::internal::countHttpRequest();
+  hal::HttpResponse reply = handler(request);
+
+  responseHeaders = reply.headers;
+  response.assign(reply.code > 0 ? reply.body : "");
+  return reply.code;
+}
+
+int HTTPClient::sendRequest(const char* method, const String& payload) {
+  return sendRequest(method, (uint8_t*)payload.c_str(), payload.length());
+}
+
+String HTTPClient::header(const char* name) {
+  for (const auto& entry : responseHeaders) {
+    if (sameHeader(entry.first, name)) return String(entry.second);
+  }
+  return String();
+}
+
+bool HTTPClient::hasHeader(const char* name) {
+  for (const auto& entry : responseHeaders) {
+    if (sameHeader(entry.first, name)) return true;
+  }
+  return false;
+}
+
+String HTTPClient::errorToString(int error) {
+  switch (error) {
+    case HTTPC_ERROR_CONNECTION_REFUSED: return "connection refused";
+    case HTTPC_ERROR_SEND_HEADER_FAILED: return "send header failed";
+    case HTTPC_ERROR_SEND_PAYLOAD_FAILED: return "send payload failed";
+    case HTTPC_ERROR_NOT_CONNECTED: return "not connected";
+    case HTTPC_ERROR_CONNECTION_LOST: return "connection lost";
+    case HTTPC_ERROR_NO_HTTP_SERVER: return "no HTTP server";
+    case HTTPC_ERROR_READ_TIMEOUT: return "read Timeout";
+    default: return String();
+  }
+}
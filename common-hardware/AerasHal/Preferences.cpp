@@ -0,0 +1,62 @@
+#include <Preferences.h>
+
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// ===== Flash =====
+// namespace -> key -> blob, shared by every Preferences handle
+static std::mutex nvsMutex;
+static std::map<std::string, std::map<std::string, std::vector<uint8_t>>> nvs;
+
+bool Preferences::begin(const char* name, bool readOnly) {
+  if (name == nullptr || strlen(name) > 15) return false;  // NVS key/namespace limit
+  space = name;
+  opened = true;
+  this->readOnly = readOnly;
+  return true;
+}
+
+void Preferences::end() {
+  opened = false;
+}
+
+size_t Preferences::getBytesLength(const char* key) {
+  if (!opened) return 0;
+  std::lock_guard<std::mutex> lock(nvsMutex);
+  auto& entries = nvs[space.c_str()];
+  auto entry = entries.find(key);
+  return entry != entries.end() ? entry->second.size() : 0;
+}
+
+size_t Preferences::getBytes(const char* key, void* buffer, size_t maxLength) {
+  if (!opened) return 0;
+  std::lock_guard<std::mutex> lock(nvsMutex);
+  auto& entries = nvs[space.c_str()];
+  auto entry = entries.find(key);
+  if (entry == entries.end() || entry->second.size() > maxLength) return 0;
+  memcpy(buffer, entry->second.data(), entry->second.size());
+  return entry->second.size();
+}
+
+size_t Preferences::putBytes(const char* key, const void* value, size_t length) {
+  if (!opened || readOnly) return 0;
+  std::lock_guard<std::mutex> lock(nvsMutex);
+  const uint8_t* bytes = static_cast<const uint8_t*>(value);
+  nvs[space.c_str()][key].assign(bytes, bytes + length);
+  return length;
+}
+
+bool Preferences::remove(const char* key) {
+  if (!opened || readOnly) return false;
+  std::lock_guard<std::mutex> lock(nvsMutex);
+  return nvs[space.c_str()].erase(key) > 0;
+}
+
+bool Preferences::clear() {
+  if (!opened || readOnly) return false;
+  std::lock_guard<std::mutex> lock(nvsMutex);
+  nvs[space.c_str()].clear();
+  return true;
+}
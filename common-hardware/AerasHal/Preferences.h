@@ -0,0 +1,29 @@
+/*
+ * AERAS HAL (native) - ESP32 Preferences (NVS) stand-in
+ * Namespaces of byte blobs held in memory for the life of the process, so
+ * every native run is a first boot with empty flash.
+ */
+
+#ifndef AERAS_HAL_PREFERENCES_H
+#define AERAS_HAL_PREFERENCES_H
+
+#include <Arduino.h>
+
+class Preferences {
+public:
+  bool begin(const char* name, bool readOnly = false);
+  void end();
+
+  size_t getBytesLength(const char* key);
+  size_t getBytes(const char* key, void* buffer, size_t maxLength);
+  size_t putBytes(const char* key, const void* value, size_t length);
+  bool remove(const char* key);
+  bool clear();
+
+private:
+  String space;
+  bool opened = false;
+  bool readOnly = false;
+};
+
+#endif
@@ -0,0 +1,88 @@
+#include "WString.h"
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+
+bool String::equalsIgnoreCase(const String& other) const {
+  if (s.size() != other.s.size()) return false;
+  for (size_t i = 0; i < s.size(); i++) {
+    if (tolower((unsigned char)s[i]) != tolower((unsigned char)other.s[i])) return false;
+  }
+  return true;
+}
+
+bool String::endsWith(const String& suffix) const {
+  if (suffix.s.size() > s.size()) return false;
+  return s.compare(s.size() - suffix.s.size(), suffix.s.size(), suffix.s) == 0;
+}
+
+String String::substring(unsigned int from, unsigned int to) const {
+  if (from > to) std::swap(from, to);
+  if (from >= s.size()) return String();
+  if (to > s.size()) to = s.size();
+  return String(s.substr(from, to - from));
+}
+
+void String::toUpperCase() {
+  for (char& c : s) c = toupper((unsigned char)c);
+}
+
+void String::toLowerCase() {
+  for (char& c : s) c = tolower((unsigned char)c);
+}
+
+void String::trim() {
+  size_t begin = 0;
+  while (begin < s.size() && isspace((unsigned char)s[begin])) begin++;
+  size_t end = s.size();
+  while (end > begin && isspace((unsigned char)s[end - 1])) end--;
+  s = s.substr(begin, end - begin);
+}
+
+void String::replace(const String& find, const String& with) {
+  if (find.s.empty()) return;
+  size_t position = 0;
+  while ((position = s.find(find.s, position)) != std::string::npos) {
+    s.replace(position, find.s.size(), with.s);
+    position += with.s.size();
+  }
+}
+
+void String::remove(unsigned int index, unsigned int count) {
+  if (index >= s.size()) return;
+  s.erase(index, count);
+}
+
+void String::toCharArray(char* buf, unsigned int size) const {
+  if (size == 0) return;
+  strncpy(buf, s.c_str(), size - 1);
+  buf[size - 1] = '\0';
+}
+
+void String::fromSigned(long long value, unsigned char base) {
+  if (value < 0 && base == DEC) {
+    fromUnsigned((unsigned long long)(-value), base);
+    s.insert(s.begin(), '-');
+  } else {
+    fromUnsigned((unsigned long long)value, base);
+  }
+}
+
+void String::fromUnsigned(unsigned long long value, unsigned char base) {
+  if (base < 2) base = DEC;
+  char digits[72];
+  int n = 0;
+  do {
+    int digit = value % base;
+    digits[n++] = digit < 10 ? '0' + digit : 'A' + digit - 10;
+    value /= base;
+  } while (value > 0);
+  s.assign(digits, n);
+  std::reverse(s.begin(), s.end());
+}
+
+void String::fromDouble(double value, unsigned char decimals) {
+  char buf[64];
+  snprintf(buf, sizeof(buf), "%.*f", decimals, value);
+  s = buf;
+}
@@ -0,0 +1,103 @@
+/*
+ * AERAS HAL (native) - Arduino String on top of std::string
+ * Covers the subset of the Arduino API the firmware and ArduinoJson use.
+ */
+
+#ifndef AERAS_HAL_WSTRING_H
+#define AERAS_HAL_WSTRING_H
+
+#include <string>
+#include <cstdlib>
+#include <cstring>
+
+#define DEC 10
+#define HEX 16
+#define OCT 8
+#define BIN 2
+
+class String {
+public:
+  String() {}
+  String(const char* text) : s(text != nullptr ? text : "") {}
+  String(const std::string& text) : s(text) {}
+  String(char c) : s(1, c) {}
+  String(unsigned char value, unsigned char base = DEC) { fromUnsigned(value, base); }
+  String(int value, unsigned char base = DEC) { fromSigned(value, base); }
+  String(unsigned int value, unsigned char base = DEC) { fromUnsigned(value, base); }
+  String(long value, unsigned char base = DEC) { fromSigned(value, base); }
+  String(unsigned long value, unsigned char base = DEC) { fromUnsigned(value, base); }
+  String(long long value, unsigned char base = DEC) { fromSigned(value, base); }
+  String(unsigned long long value, unsigned char base = DEC) { fromUnsigned(value, base); }
+  String(float value, unsigned char decimals = 2) { fromDouble(value, decimals); }
+  String(double value, unsigned char decimals = 2) { fromDouble(value, decimals); }
+
+  const char* c_str() const { return s.c_str(); }
+  unsigned int length() const { return s.size(); }
+  bool isEmpty() const { return s.empty(); }
+  bool reserve(unsigned int size) { s.reserve(size); return true; }
+
+  bool concat(const String& other) { s += other.s; return true; }
+  bool concat(const char* text) { if (text != nullptr) s += text; return true; }
+  bool concat(const char* text, unsigned int length) { if (text != nullptr) s.append(text, length); return true; }
+  bool concat(char c) { s += c; return true; }
+
+  String& operator+=(const String& other) { s += other.s; return *this; }
+  String& operator+=(const char* text) { concat(text); return *this; }
+  String& operator+=(char c) { s += c; return *this; }
+  String& operator+=(int value) { return *this += String(value); }
+  String& operator+=(long value) { return *this += String(value); }
+  String& operator+=(unsigned long value) { return *this += String(value); }
+  String& operator+=(double value) { return *this += String(value); }
+
+  bool operator==(const String& other) const { return s == other.s; }
+  bool operator==(const char* text) const { return s == (text != nullptr ? text : ""); }
+  bool operator!=(const String& other) const { return s != other.s; }
+  bool operator!=(const char* text) const { return !(*this == text); }
+  bool operator<(const String& other) const { return s < other.s; }
+  bool equals(const String& other) const { return s == other.s; }
+  bool equalsIgnoreCase(const String& other) const;
+
+  char charAt(unsigned int index) const { return index < s.size() ? s[index] : 0; }
+  char operator[](unsigned int index) const { return charAt(index); }
+  char& operator[](unsigned int index) { return s[index]; }
+
+  int indexOf(char c, unsigned int from = 0) const { return found(s.find(c, from)); }
+  int indexOf(const String& text, unsigned int from = 0) const { return found(s.find(text.s, from)); }
+  int lastIndexOf(char c) const { return found(s.rfind(c)); }
+  int lastIndexOf(const String& text) const { return found(s.rfind(text.s)); }
+  bool startsWith(const String& prefix) const { return s.compare(0, prefix.s.size(), prefix.s) == 0; }
+  bool endsWith(const String& suffix) const;
+
+  String substring(unsigned int from) const { return from < s.size() ? String(s.substr(from)) : String(); }
+  String substring(unsigned int from, unsigned int to) const;
+
+  void toUpperCase();
+  void toLowerCase();
+  void trim();
+  void replace(const String& find, const String& with);
+  void remove(unsigned int index, unsigned int count = (unsigned int)-1);
+
+  long toInt() const { return atol(s.c_str()); }
+  float toFloat() const { return atof(s.c_str()); }
+  double toDouble() const { return atof(s.c_str()); }
+  void toCharArray(char* buf, unsigned int size) const;
+
+private:
+  static int found(size_t position) { return position == std::string::npos ? -1 : (int)position; }
+  void fromSigned(long long value, unsigned char base);
+  void fromUnsigned(unsigned long long value, unsigned char base);
+  void fromDouble(double value, unsigned char decimals);
+
+  std::string s;
+};
+
+inline String operator+(const String& a, const String& b) { String r(a); r += b; return r; }
+inline String operator+(const String& a, const char* b) { String r(a); r += b; return r; }
+inline String operator+(const char* a, const String& b) { String r(a); r += b; return r; }
+inline String operator+(const String& a, char b) { String r(a); r += b; return r; }
+inline String operator+(const String& a, int b) { String r(a); r += b; return r; }
+inline String operator+(const String& a, long b) { String r(a); r += b; return r; }
+inline String operator+(const String& a, unsigned long b) { String r(a); r += b; return r; }
+inline String operator+(const String& a, double b) { String r(a); r += b; return r; }
+
+#endif
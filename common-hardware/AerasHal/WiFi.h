@@ -0,0 +1,92 @@
+/*
+ * AERAS HAL (native) - Wi-Fi station and TCP client stand-ins
+ * WiFi.begin() "associates" immediately unless hal::setWifiAvailable(false).
+ * WiFiClient has no real sockets: connect() fails, so the push stream stays
+ * down and the firmware runs on its polling fallback. HTTP goes through
+ * HTTPClient and the HAL's request handler instead.
+ */
+
+#ifndef AERAS_HAL_WIFI_H
+#define AERAS_HAL_WIFI_H
+
+#include <Arduino.h>
+
+typedef enum {
+  WL_IDLE_STATUS = 0,
+  WL_NO_SSID_AVAIL = 1,
+  WL_CONNECTED = 3,
+  WL_CONNECT_FAILED = 4,
+  WL_CONNECTION_LOST = 5,
+  WL_DISCONNECTED = 6
+} wl_status_t;
+
+typedef enum {
+  WIFI_OFF = 0,
+  WIFI_STA = 1,
+  WIFI_AP = 2,
+  WIFI_AP_STA = 3
+} wifi_mode_t;
+
+class IPAddress {
+public:
+  IPAddress() : address(0) {}
+  IPAddress(uint8_t a, uint8_t b, uint8_t c, uint8_t d)
+    : address((uint32_t)a | ((uint32_t)b << 8) | ((uint32_t)c << 16) | ((uint32_t)d << 24)) {}
+  IPAddress(uint32_t raw) : address(raw) {}
+
+  operator uint32_t() const { return address; }
+  String toString() const;
+  bool fromString(const char* text);
+
+private:
+  uint32_t address;
+};
+
+class WiFiClient : public Stream {
+public:
+  int connect(const char* host, uint16_t port, int32_t timeoutMs = 0) { return 0; }
+  int connect(IPAddress ip, uint16_t port, int32_t timeoutMs = 0) { return 0; }
+  uint8_t connected() { return 0; }
+  void stop() {}
+  void setNoDelay(bool enabled) {}
+  operator bool() { return false; }
+
+  int available() override { return 0; }
+  int read() override { return -1; }
+  int read(uint8_t* buffer, size_t size) { return 0; }
+  int peek() override { return -1; }
+  size_t write(uint8_t c) override { return 0; }
+  size_t write(const uint8_t* buffer, size_t size) override { return 0; }
+  using Print::write;
+};
+
+class WiFiClass {
+public:
+  wl_status_t begin(const char* ssid, const char* password = nullptr, int32_t channel = 0,
+                    const uint8_t* bssid = nullptr, bool connect = true);
+  wl_status_t status();
+  bool disconnect(bool wifiOff = false);
+  bool reconnect();
+  bool mode(wifi_mode_t mode) { return true; }
+  bool config(IPAddress localIP, IPAddress gateway, IPAddress subnet,
+              IPAddress dns1 = IPAddress(), IPAddress dns2 = IPAddress()) { return true; }
+  bool setAutoReconnect(bool enabled) { return true; }
+  bool persistent(bool enabled) { return true; }
+
+  IPAddress localIP() { return IPAddress(127, 0, 0, 1); }
+  IPAddress gatewayIP() { return IPAddress(127, 0, 0, 1); }
+  IPAddress subnetMask() { return IPAddress(255, 0, 0, 0); }
+  IPAddress dnsIP(uint8_t index = 0) { return IPAddress(127, 0, 0, 1); }
+  String SSID() { return ssid; }
+  int8_t RSSI() { return -50; }
+  int32_t channel() { return 1; }
+  uint8_t* BSSID() { return bssid; }
+
+private:
+  String ssid;
+  uint8_t bssid[6] = { 0x02, 0, 0, 0, 0, 0x01 };
+};
+
+extern WiFiClass WiFi;
+
+#endif
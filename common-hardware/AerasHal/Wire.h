@@ -0,0 +1,38 @@
+/*
+ * AERAS HAL (native) - I2C bus that counts traffic
+ * Every transmission adds its address byte plus payload to hal::i2cBytes(),
+ * so display benchmarks report real bus cost on the host.
+ */
+
+#ifndef AERAS_HAL_WIRE_H
+#define AERAS_HAL_WIRE_H
+
+#include <Arduino.h>
+
+#define I2C_BUFFER_LENGTH 128
+
+class TwoWire : public Stream {
+public:
+  bool begin(int sda = -1, int scl = -1, uint32_t frequency = 0) { return true; }
+  bool setClock(uint32_t frequency) { clock = frequency; return true; }
+  uint32_t getClock() const { return clock; }
+
+  void beginTransmission(uint8_t address);
+  uint8_t endTransmission(bool sendStop = true);
+  uint8_t requestFrom(uint8_t address, uint8_t quantity, bool sendStop = true) { return 0; }
+
+  size_t write(uint8_t data) override;
+  size_t write(const uint8_t* data, size_t size) override;
+  using Print::write;
+  int available() override { return 0; }
+  int read() override { return -1; }
+  int peek() override { return -1; }
+
+private:
+  uint32_t clock = 100000;
+  size_t pending = 0;
+};
+
+extern TwoWire Wire;
+
+#endif
@@ -0,0 +1,177 @@
+#include "AerasNetTask.h"
+
+static NetTask* pushTarget = nullptr;  // EventStream handlers carry no context
+
+NetTask::NetTask()
+  : handle(nullptr), pushUp(false), droppedPushes(0), inFlight(0), rejectedCommands(0) {
+}
+
+void NetTask::begin(const char* baseUrl, const String& pushPath, const char* pushBaseUrl) {
+  pushTarget = this;
+  transport.begin(baseUrl);
+  events.begin(pushBaseUrl != nullptr ? pushBaseUrl : baseUrl, pushPath, onPush);
+
+  if (xTaskCreatePinnedToCore(taskMain, "aeras-net", STACK_SIZE, this, 1, &handle, CORE) != pdPASS) {
+    Serial.println("✗ Network task failed to start");
+    return;
+  }
+  Serial.println("✓ Network task on core " + String(CORE));
+}
+
+static void copyString(char* dest, size_t size, const char* src) {
+  snprintf(dest, size, "%s", src != nullptr ? src : "");
+}
+
+bool NetTask::submit(const NetCommand& cmd) {
+  if (!commands.push(cmd)) {
+    rejectedCommands++;
+    return false;
+  }
+  if (cmd.job == nullptr) inFlight |= 1UL << cmd.tag;
+  if (handle != nullptr) xTaskNotifyGive(handle);
+  return true;
+}
+
+bool NetTask::get(uint8_t tag, const String& path, NetDecode decode, long rideID,
+                  uint16_t timeoutMs, const char* ifNoneMatch) {
+  NetCommand cmd;
+  cmd.tag = tag;
+  cmd.post = false;
+  cmd.decode = decode;
+  cmd.timeoutMs = timeoutMs;
+  cmd.rideID = rideID;
+  cmd.job = nullptr;
+  copyString(cmd.path, sizeof(cmd.path), path.c_str());
+  cmd.body[0] = '\0';
+  copyString(cmd.ifNoneMatch, sizeof(cmd.ifNoneMatch), ifNoneMatch);
+  return submit(cmd);
+}
+
+bool NetTask::post(uint8_t tag, const String& path, const char* body, NetDecode decode, long rideID,
+                   uint16_t timeoutMs) {
+  NetCommand cmd;
+  cmd.tag = tag;
+  cmd.post = true;
+  cmd.decode = decode;
+  cmd.timeoutMs = timeoutMs;
+  cmd.rideID = rideID;
+  cmd.job = nullptr;
+  copyString(cmd.path, sizeof(cmd.path), path.c_str());
+  copyString(cmd.body, sizeof(cmd.body), body);
+  cmd.ifNoneMatch[0] = '\0';
+  return submit(cmd);
+}
+
+bool NetTask::call(NetJob job) {
+  NetCommand cmd;
+  memset(&cmd, 0, sizeof(cmd));
+  cmd.job = job;
+  return submit(cmd);
+}
+
+bool NetTask::poll(NetEvent& event) {
+  if (!replies.pop(event)) return false;
+  if (event.tag != PUSH_RIDE) inFlight &= ~(1UL << event.tag);
+  return true;
+}
+
+// ===== Network task side =====
+
+void NetTask::taskMain(void* arg) {
+  static_cast<NetTask*>(arg)->run();
+}
+
+void NetTask::run() {
+  for (;;) {
+    NetCommand cmd;
+    while (commands.pop(cmd)) {
+      if (cmd.job != nullptr) {
+        cmd.job();
+      } else {
+        execute(cmd);
+      }
+    }
+
+    events.poll();
+    pushUp.store(events.isConnected(), std::memory_order_relaxed);
+
+    // submit() wakes us early; otherwise keep the push stream serviced
+    ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(IDLE_WAIT_MS));
+  }
+}
+
+bool decodeNetReply(NetDecode decode, Stream& body, NetEvent& event) {
+  switch (decode) {
+    case DECODE_NONE:
+      return false;
+    case DECODE_RIDE_CREATED:
+      return codec::decodeRideCreated(body, event.createdRideID);
+    case DECODE_RIDE_STATUS:
+      return codec::decodeRideStatus(body, event.ride);
+    case DECODE_PENDING:
+      return codec::decodePendingRides(body, event.offers);
+    case DECODE_ACCEPT:
+      return codec::decodeAccept(body, event.accepted);
+    case DECODE_COMPLETE:
+      return codec::decodeComplete(body, event.complete);
+    case DECODE_HEARTBEAT:
+      return codec::decodeHeartbeat(body, event.heartbeat);
+    case DECODE_LOCATIONS:
+      blocks::beginStaging();
+      return codec::decodeLocations(body, blocks::stage, event.locations);
+  }
+  return false;
+}
+
+void NetTask::execute(const NetCommand& cmd) {
+  int httpCode = cmd.post
+    ? transport.post(cmd.path, cmd.body, cmd.timeoutMs)
+    : transport.get(cmd.path, cmd.timeoutMs, cmd.ifNoneMatch[0] != '\0' ? cmd.ifNoneMatch : nullptr);
+
+  NetEvent event;
+  memset(&event, 0, sizeof(event));
+  event.tag = cmd.tag;
+  event.httpCode = httpCode;
+  event.rideID = cmd.rideID;
+  copyString(event.etag, sizeof(event.etag), transport.etag());
+
+  if (httpCode == 200) {
+    event.decoded = decodeNetReply(cmd.decode, transport.stream(), event);
+  }
+
+  transport.end();
+  emitReply(event);
+}
+
+// The UI task clears busy() only when it polls the reply, so a request
+// reply has to get through; the UI drains the queue every loop
+void NetTask::emitReply(const NetEvent& event) {
+  while (!replies.push(event)) vTaskDelay(1);
+}
+
+void NetTask::emitPush(const NetEvent& event) {
+  if (replies.size() >= QUEUE_DEPTH - REPLY_RESERVE || !replies.push(event)) droppedPushes++;
+}
+
+// "ride" events: {"rideID":12,"status":"ACCEPTED","rickshawID":"RICK001",...}
+void NetTask::onPush(const char* event, const char* data) {
+  if (pushTarget == nullptr || strcmp(event, "ride") != 0) return;
+
+  NetEvent pushed;
+  memset(&pushed, 0, sizeof(pushed));
+  pushed.tag = PUSH_RIDE;
+  pushed.httpCode = 200;
+  pushed.decoded = codec::decodeRideStatus(data, pushed.ride);
+  if (!pushed.decoded) return;
+  pushed.rideID = pushed.ride.rideID;
+  pushTarget->emitPush(pushed);
+}
+
+void NetTask::printStats() {
+  transport.printStats();
+  Serial.println("Push: " + String(pushConnected() ? "connected" : "polling") + ", " +
+                 String(events.eventCount()) + " events, " + String(events.droppedCount()) + " oversized");
+  Serial.println("Net queues: " + String(commands.size()) + " queued, " +
+                 String(rejectedCommands) + " rejected, " +
+                 String(droppedPushes.load()) + " push events dropped");
+}
@@ -0,0 +1,135 @@
+/*
+ * AERAS Net Task - all networking on its own FreeRTOS task
+ * The HTTP transport and the push stream run on a task pinned to core 0,
+ * next to the Wi-Fi stack. The sensor/UI code on the Arduino loop task
+ * (core 1) submits typed commands and drains typed replies through two
+ * lock-free SPSC queues, so a slow backend never stalls sensing, the
+ * display or the serial console.
+ *
+ * Responses are decoded on the network task (the codec is single-task),
+ * and replies only carry decoded values. All state changes happen where
+ * the UI side handles those replies - the network task owns no ride state.
+ *
+ * A request reply is never dropped (the network task waits for the UI to
+ * drain a slot), so busy() always clears. Push events may not take the
+ * last REPLY_RESERVE slots and are dropped past that; the heartbeat
+ * catches up on whatever they carried.
+ *
+ * Threading: get/post/call/poll/busy are UI-task only.
+ */
+
+#ifndef AERAS_NET_TASK_H
+#define AERAS_NET_TASK_H
+
+#include <Arduino.h>
+#include <AerasTransport.h>
+#include <AerasEventStream.h>
+#include <AerasCodec.h>
+#include <AerasBlocks.h>
+#include "SpscQueue.h"
+
+// How the network task should decode a 200 response
+enum NetDecode : uint8_t {
+  DECODE_NONE,
+  DECODE_RIDE_CREATED,
+  DECODE_RIDE_STATUS,
+  DECODE_PENDING,
+  DECODE_ACCEPT,
+  DECODE_COMPLETE,
+  DECODE_HEARTBEAT,
+  DECODE_LOCATIONS      // Rows go to blocks::stage(); commit on the UI task
+};
+
+typedef void (*NetJob)();
+
+struct NetCommand {
+  uint8_t tag;          // Caller's request kind, echoed in the reply
+  bool post;
+  NetDecode decode;
+  uint16_t timeoutMs;
+  long rideID;          // Echoed, so replies for an older ride can be ignored
+  NetJob job;           // Set for call(): run on the network task, no HTTP
+  char path[96];
+  char body[192];
+  char ifNoneMatch[48];
+};
+
+struct NetEvent {
+  uint8_t tag;          // Request tag, or NetTask::PUSH_RIDE
+  int16_t httpCode;     // < 0 = transport error
+  bool decoded;         // Body parsed into the union below
+  long rideID;
+  char etag[48];
+  union {
+    long createdRideID;       // DECODE_RIDE_CREATED
+    RideStatus ride;          // DECODE_RIDE_STATUS, PUSH_RIDE
+    PendingList offers;       // DECODE_PENDING (nearest CODEC_OFFER_SLOTS rides)
+    bool accepted;            // DECODE_ACCEPT
+    CompleteResult complete;  // DECODE_COMPLETE
+    HeartbeatReply heartbeat; // DECODE_HEARTBEAT
+    LocationSet locations;    // DECODE_LOCATIONS
+  };
+};
+
+// Decode a 200 response body into the event's union, as the network task
+// does before emitting a reply (also used by the fleet simulator)
+bool decodeNetReply(NetDecode decode, Stream& body, NetEvent& event);
+
+class NetTask {
+public:
+  static const uint8_t QUEUE_DEPTH = 8;
+  static const uint8_t REPLY_RESERVE = 4;     // Reply slots push events can't take
+  static const uint8_t PUSH_RIDE = 31;        // Tag of pushed "ride" events
+  static const uint8_t CORE = 0;              // Same core as the Wi-Fi stack
+  static const uint32_t STACK_SIZE = 8192;
+  static const uint16_t IDLE_WAIT_MS = 20;    // Push stream poll period
+
+  NetTask();
+
+  // Starts the task; baseUrl e.g. "http://10.0.0.5:3000/api". The push
+  // stream comes from pushBaseUrl when given (the native event gateway,
+  // e.g. "http://10.0.0.5:3001/api"), else from the backend itself.
+  void begin(const char* baseUrl, const String& pushPath, const char* pushBaseUrl = nullptr);
+
+  // Queue a request; false if the queue is full. Tags must be < PUSH_RIDE.
+  bool get(uint8_t tag, const String& path, NetDecode decode, long rideID = 0,
+           uint16_t timeoutMs = Transport::DEFAULT_TIMEOUT_MS, const char* ifNoneMatch = nullptr);
+  bool post(uint8_t tag, const String& path, const char* body, NetDecode decode, long rideID = 0,
+            uint16_t timeoutMs = Transport::DEFAULT_TIMEOUT_MS);
+
+  // Run a function on the network task (e.g. a codec benchmark)
+  bool call(NetJob job);
+
+  // Next reply or push event; call from loop()
+  bool poll(NetEvent& event);
+
+  // A request with this tag is queued or in flight (reply not yet polled)
+  bool busy(uint8_t tag) const { return (inFlight & (1UL << tag)) != 0; }
+
+  bool pushConnected() const { return pushUp.load(std::memory_order_relaxed); }
+  void printStats();
+
+private:
+  static void taskMain(void* arg);
+  static void onPush(const char* event, const char* data);
+
+  void run();
+  void execute(const NetCommand& cmd);
+  void emitReply(const NetEvent& event);
+  void emitPush(const NetEvent& event);
+  bool submit(const NetCommand& cmd);
+
+  Transport transport;
+  EventStream events;
+  SpscQueue<NetCommand, QUEUE_DEPTH> commands;  // UI -> network
+  SpscQueue<NetEvent, QUEUE_DEPTH> replies;     // network -> UI
+  TaskHandle_t handle;
+  std::atomic<bool> pushUp;
+  std::atomic<uint32_t> droppedPushes;
+
+  // UI task only
+  uint32_t inFlight;
+  uint32_t rejectedCommands;
+};
+
+#endif
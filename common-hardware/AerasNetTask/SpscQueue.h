@@ -0,0 +1,50 @@
+/*
+ * AERAS SpscQueue - bounded single-producer/single-consumer ring
+ * Lock-free: the producer only writes head, the consumer only writes tail,
+ * and release/acquire ordering publishes the slot contents with the index.
+ * Safe across the two ESP32 cores as long as each side has one task.
+ */
+
+#ifndef AERAS_SPSC_QUEUE_H
+#define AERAS_SPSC_QUEUE_H
+
+#include <Arduino.h>
+#include <atomic>
+
+template <typename T, uint8_t N>
+class SpscQueue {
+  static_assert(N > 0 && (N & (N - 1)) == 0, "SpscQueue size must be a power of two");
+
+public:
+  SpscQueue() : head(0), tail(0) {}
+
+  // Producer side; false when full (the item is not queued)
+  bool push(const T& item) {
+    uint32_t h = head.load(std::memory_order_relaxed);
+    if (h - tail.load(std::memory_order_acquire) >= N) return false;
+    slots[h & (N - 1)] = item;
+    head.store(h + 1, std::memory_order_release);
+    return true;
+  }
+
+  // Consumer side; false when empty
+  bool pop(T& out) {
+    uint32_t t = tail.load(std::memory_order_relaxed);
+    if (head.load(std::memory_order_acquire) == t) return false;
+    out = slots[t & (N - 1)];
+    tail.store(t + 1, std::memory_order_release);
+    return true;
+  }
+
+  // Approximate from either side
+  uint8_t size() const {
+    return head.load(std::memory_order_acquire) - tail.load(std::memory_order_acquire);
+  }
+
+private:
+  T slots[N];
+  std::atomic<uint32_t> head;  // Next slot to write (producer)
+  std::atomic<uint32_t> tail;  // Next slot to read (consumer)
+};
+
+#endif
@@ -0,0 +1,163 @@
+/*
+ * AERAS Offers - ranked buffer of pending ride offers
+ */
+
+#include "AerasOffers.h"
+
+OfferQueue::OfferQueue(DistanceFn distance)
+  : distanceFn(distance), size(0), rejectedNext(0),
+    listed(0), taken(0), expired(0), rejects(0), lastTotal(0) {
+  for (uint8_t i = 0; i < REJECTED_MEMORY; i++) rejected[i] = 0;
+}
+
+// ===== Merge =====
+
+bool OfferQueue::update(const PendingList& list, uint32_t nowMs) {
+  long topBefore = size > 0 ? slots[0].ride.rideID : 0;
+  lastTotal = list.total;
+
+  // A reply that fits whole is the backend's full pending set: anything
+  // queued and missing from it was taken, cancelled or timed out. A
+  // truncated one says nothing about rides past the cutoff.
+  if (list.total <= list.count) {
+    for (uint8_t i = size; i-- > 0;) {
+      bool listedNow = false;
+      for (uint8_t j = 0; j < list.count; j++) {
+        if (list.rides[j].rideID == slots[i].ride.rideID) listedNow = true;
+      }
+      if (!listedNow) {
+        removeAt(i);
+        taken++;
+      }
+    }
+  }
+
+  for (uint8_t j = 0; j < list.count; j++) {
+    const PendingRide& ride = list.rides[j];
+    if (ride.rideID == 0 || wasRejected(ride.rideID)) continue;
+
+    Offer offer;
+    int8_t index = indexOf(ride.rideID);
+    if (index >= 0) {
+      offer = slots[index];
+    } else {
+      offer.requestedMs = nowMs - (uint32_t)ride.ageS * 1000;
+      listed++;
+    }
+    offer.ride = ride;
+    offer.seenMs = nowMs;
+
+    // Re-measured every reply: the rickshaw has moved since the last one
+    float roadM = distanceFn != nullptr ? distanceFn(ride) : -1;
+    offer.road = roadM >= 0;
+    offer.distanceM = offer.road ? roadM : ride.distanceKm * 1000.0f;
+    rank(offer, nowMs);
+
+    if (index >= 0) {
+      slots[index] = offer;
+    } else if (size < CAPACITY) {
+      slots[size++] = offer;
+    } else {
+      // Full of offers from earlier truncated replies: replace the worst
+      uint8_t worst = 0;
+      for (uint8_t i = 1; i < size; i++) {
+        if (slots[i].rankM > slots[worst].rankM) worst = i;
+      }
+      if (offer.rankM < slots[worst].rankM) slots[worst] = offer;
+    }
+  }
+
+  sort();
+  return (size > 0 ? slots[0].ride.rideID : 0) != topBefore;
+}
+
+void OfferQueue::refresh(uint32_t nowMs) {
+  for (uint8_t i = 0; i < size; i++) slots[i].seenMs = nowMs;
+}
+
+bool OfferQueue::remove(long rideID) {
+  int8_t index = indexOf(rideID);
+  if (index < 0) return false;
+  removeAt(index);
+  taken++;
+  return true;
+}
+
+void OfferQueue::reject(long rideID) {
+  int8_t index = indexOf(rideID);
+  if (index >= 0) removeAt(index);
+  if (!wasRejected(rideID)) {
+    rejected[rejectedNext] = rideID;
+    rejectedNext = (rejectedNext + 1) % REJECTED_MEMORY;
+  }
+  rejects++;
+}
+
+bool OfferQueue::expire(uint32_t nowMs) {
+  long topBefore = size > 0 ? slots[0].ride.rideID : 0;
+
+  for (uint8_t i = size; i-- > 0;) {
+    if (nowMs - slots[i].seenMs > TTL_MS) {
+      removeAt(i);
+      expired++;
+    } else {
+      rank(slots[i], nowMs);
+    }
+  }
+
+  sort();
+  return (size > 0 ? slots[0].ride.rideID : 0) != topBefore;
+}
+
+void OfferQueue::clear() {
+  size = 0;
+}
+
+// ===== Ranking =====
+
+void OfferQueue::rank(Offer& offer, uint32_t nowMs) const {
+  uint32_t credit = (nowMs - offer.requestedMs) / 60000.0f * WAIT_CREDIT_M_PER_MIN;
+  if (credit > MAX_WAIT_CREDIT_M) credit = MAX_WAIT_CREDIT_M;
+  offer.rankM = (int32_t)offer.distanceM - (int32_t)credit;
+}
+
+// Insertion sort: at most CAPACITY entries, nearly always already in order
+void OfferQueue::sort() {
+  for (uint8_t i = 1; i < size; i++) {
+    Offer offer = slots[i];
+    uint8_t j = i;
+    while (j > 0 && (slots[j - 1].rankM > offer.rankM ||
+                     (slots[j - 1].rankM == offer.rankM && slots[j - 1].ride.rideID > offer.ride.rideID))) {
+      slots[j] = slots[j - 1];
+      j--;
+    }
+    slots[j] = offer;
+  }
+}
+
+bool OfferQueue::wasRejected(long rideID) const {
+  for (uint8_t i = 0; i < REJECTED_MEMORY; i++) {
+    if (rejected[i] == rideID) return true;
+  }
+  return false;
+}
+
+int8_t OfferQueue::indexOf(long rideID) const {
+  for (uint8_t i = 0; i < size; i++) {
+    if (slots[i].ride.rideID == rideID) return i;
+  }
+  return -1;
+}
+
+void OfferQueue::removeAt(uint8_t index) {
+  for (uint8_t i = index; i + 1 < size; i++) slots[i] = slots[i + 1];
+  size--;
+}
+
+// ===== Stats =====
+
+void OfferQueue::printStats() {
+  Serial.println("Offers: " + String(size) + " queued of " + String(lastTotal) + " pending, " +
+                 String(listed) + " seen, " + String(taken) + " taken elsewhere, " +
+                 String(expired) + " expired, " + String(rejects) + " rejected");
+}
@@ -0,0 +1,93 @@
+/*
+ * AERAS Offers - ranked buffer of pending ride offers
+ * Every /ride/pending reply carries the nearest CODEC_OFFER_SLOTS rides.
+ * The rickshaw keeps all of them in fixed slots, ranked best first, so
+ * rejecting an offer or losing an accept race moves straight to the next
+ * candidate without waiting for another poll.
+ *
+ * Rank is the distance to the pickup (road distance when the DistanceFn
+ * can route it, the backend's straight line otherwise) less a waiting
+ * credit of WAIT_CREDIT_M_PER_MIN per minute since the ride was requested,
+ * capped at MAX_WAIT_CREDIT_M: a rider who has waited long beats a slightly
+ * nearer fresh request. Ties go to the older ride ID.
+ *
+ * Offers leave the buffer when a complete reply no longer lists them
+ * (accepted elsewhere, cancelled, timed out), when remove() is told so by
+ * a push or a lost accept, or when no reply has listed or refreshed them
+ * for TTL_MS.
+ * Rejected ride IDs are remembered (last REJECTED_MEMORY) so the next poll
+ * does not bring them back.
+ *
+ * Threading: UI task only.
+ */
+
+#ifndef AERAS_OFFERS_H
+#define AERAS_OFFERS_H
+
+#include <Arduino.h>
+#include <AerasCodec.h>
+
+struct Offer {
+  PendingRide ride;
+  uint32_t requestedMs;   // millis() at the request, from the backend's age
+  uint32_t seenMs;        // Last reply that listed it
+  float distanceM;        // To the pickup
+  bool road;              // distanceM is by road
+  int32_t rankM;          // distanceM less the waiting credit; lower is better
+};
+
+class OfferQueue {
+public:
+  static const uint8_t CAPACITY = CODEC_OFFER_SLOTS;
+  static const uint8_t REJECTED_MEMORY = 8;
+  static const uint32_t TTL_MS = 20000;             // Not listed for this long: gone
+  static const uint16_t WAIT_CREDIT_M_PER_MIN = 250;
+  static const uint16_t MAX_WAIT_CREDIT_M = 1500;
+
+  // Road distance to the ride's pickup in meters, negative if unknown
+  typedef float (*DistanceFn)(const PendingRide& ride);
+
+  explicit OfferQueue(DistanceFn distance = nullptr);
+
+  // Merge a /ride/pending reply; true if the top offer changed
+  bool update(const PendingList& list, uint32_t nowMs);
+  // The backend says the list is unchanged (heartbeat): every offer still stands
+  void refresh(uint32_t nowMs);
+
+  // Ride taken, cancelled or timed out; true if it was queued
+  bool remove(long rideID);
+  // Puller said no: drop it and keep it out of later replies
+  void reject(long rideID);
+  // Drop offers past TTL_MS and re-rank (waiting credit grows); true if the top changed
+  bool expire(uint32_t nowMs);
+  void clear();
+
+  uint8_t count() const { return size; }
+  const Offer* top() const { return size > 0 ? &slots[0] : nullptr; }
+  const Offer& operator[](uint8_t index) const { return slots[index]; }
+  uint16_t pendingTotal() const { return lastTotal; }   // Rides pending at the last reply
+
+  void printStats();
+
+private:
+  void rank(Offer& offer, uint32_t nowMs) const;
+  void sort();
+  bool wasRejected(long rideID) const;
+  int8_t indexOf(long rideID) const;
+  void removeAt(uint8_t index);
+
+  DistanceFn distanceFn;
+  Offer slots[CAPACITY];        // Best first
+  uint8_t size;
+
+  long rejected[REJECTED_MEMORY];
+  uint8_t rejectedNext;
+
+  uint32_t listed;              // Offers received in replies
+  uint32_t taken;               // Gone from the backend before we got to them
+  uint32_t expired;
+  uint32_t rejects;
+  uint16_t lastTotal;           // Rides pending at the last reply
+};
+
+#endif
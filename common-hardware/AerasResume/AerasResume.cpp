@@ -0,0 +1,112 @@
+/*
+ * AERAS Resume - crash-safe ride state snapshot
+ */
+
+#include "AerasResume.h"
+#include <Preferences.h>
+
+static const uint32_t SNAPSHOT_MAGIC = 0x52494445;  // "RIDE"
+static const char* NVS_NAMESPACE = "aeras";
+static const char* NVS_KEY = "ride";
+
+struct StoredSnapshot {
+  uint32_t magic;
+  uint16_t size;           // sizeof(RideSnapshot): a layout change reads as invalid
+  RideSnapshot data;
+  uint32_t crc;
+};
+
+// Left alone by the bootloader on every reset except power-on
+static RTC_NOINIT_ATTR StoredSnapshot rtcCopy;
+
+static uint32_t crc32(const uint8_t* bytes, size_t length) {
+  uint32_t crc = 0xFFFFFFFF;
+  for (size_t i = 0; i < length; i++) {
+    crc ^= bytes[i];
+    for (uint8_t bit = 0; bit < 8; bit++) {
+      crc = (crc >> 1) ^ (0xEDB88320 & (0 - (crc & 1)));
+    }
+  }
+  return ~crc;
+}
+
+static uint32_t checksum(const StoredSnapshot& stored) {
+  return crc32(reinterpret_cast<const uint8_t*>(&stored), offsetof(StoredSnapshot, crc));
+}
+
+static bool valid(const StoredSnapshot& stored) {
+  return stored.magic == SNAPSHOT_MAGIC && stored.size == sizeof(RideSnapshot) &&
+         stored.crc == checksum(stored);
+}
+
+static void seal(StoredSnapshot& stored) {
+  stored.magic = SNAPSHOT_MAGIC;
+  stored.size = sizeof(RideSnapshot);
+  stored.crc = checksum(stored);
+}
+
+SnapshotStore::SnapshotStore()
+  : sequence(0), rtcWrites(0), nvsWrites(0), restoredFrom(nullptr), restoreMicros(0) {}
+
+// ===== Restore =====
+
+bool SnapshotStore::restore(RideSnapshot& out) {
+  uint32_t start = micros();
+
+  StoredSnapshot flash;
+  bool flashValid = false;
+  Preferences prefs;
+  if (prefs.begin(NVS_NAMESPACE, true)) {
+    flashValid = prefs.getBytes(NVS_KEY, &flash, sizeof(flash)) == sizeof(flash) && valid(flash);
+    prefs.end();
+  }
+  bool rtcValid = valid(rtcCopy);
+
+  if (rtcValid && (!flashValid || rtcCopy.data.sequence >= flash.data.sequence)) {
+    out = rtcCopy.data;
+    restoredFrom = "RTC";
+  } else if (flashValid) {
+    out = flash.data;
+    restoredFrom = "NVS";
+    rtcCopy = flash;  // touch() extends the RTC copy from here
+  } else {
+    memset(&rtcCopy, 0, sizeof(rtcCopy));
+    restoreMicros = micros() - start;
+    return false;
+  }
+
+  sequence = out.sequence;
+  restoreMicros = micros() - start;
+  return true;
+}
+
+// ===== Save =====
+
+void SnapshotStore::save(const RideSnapshot& snapshot) {
+  rtcCopy.data = snapshot;
+  rtcCopy.data.sequence = ++sequence;
+  seal(rtcCopy);
+  rtcWrites++;
+
+  Preferences prefs;
+  if (!prefs.begin(NVS_NAMESPACE, false)) return;
+  if (prefs.putBytes(NVS_KEY, &rtcCopy, sizeof(rtcCopy)) == sizeof(rtcCopy)) nvsWrites++;
+  prefs.end();
+}
+
+void SnapshotStore::touch(double lat, double lng) {
+  if (!valid(rtcCopy)) return;  // Nothing saved yet
+  rtcCopy.data.lat = lat;
+  rtcCopy.data.lng = lng;
+  rtcCopy.data.sequence = ++sequence;
+  seal(rtcCopy);
+  rtcWrites++;
+}
+
+// ===== Stats =====
+
+void SnapshotStore::printStats() {
+  String restored = restoredFrom != nullptr ? "restored from " + String(restoredFrom) : "nothing restored";
+  Serial.println("Snapshot: " + restored + " in " + String(restoreMicros) + " us, " + String(rtcWrites) +
+                 " RTC writes, " + String(nvsWrites) + " NVS writes, seq " + String(sequence));
+}
@@ -0,0 +1,67 @@
+/*
+ * AERAS Resume - crash-safe ride state snapshot
+ * A reset mid-ride used to lose the ride on the device while the backend
+ * still had it ACCEPTED. The ride state (ride ID, phase, pickup and
+ * destination blocks, points) is now written on every transition to two
+ * places:
+ *
+ *   RTC slow memory (RTC_NOINIT_ATTR): survives panics, the watchdog,
+ *   brownouts and ESP.restart(), not power loss. Plain memory, so touch()
+ *   can refresh the position in it on every movement step.
+ *
+ *   NVS: survives power loss. Written on transitions only (a handful per
+ *   ride) to spare the flash.
+ *
+ * Both copies carry a sequence number and a CRC32; restore() takes the
+ * newest copy that checks out. The caller reconciles the restored ride with
+ * the backend in its first heartbeat.
+ *
+ * Threading: UI task only.
+ */
+
+#ifndef AERAS_RESUME_H
+#define AERAS_RESUME_H
+
+#include <Arduino.h>
+#include <AerasCodec.h>
+
+enum RidePhase : uint8_t {
+  PHASE_IDLE,
+  PHASE_TO_PICKUP,         // Accepted, going to the rider
+  PHASE_TO_DESTINATION     // Picked up
+};
+
+struct RideSnapshot {
+  uint32_t sequence;       // Set by save(); newer wins on restore
+  int32_t rideID;
+  uint8_t phase;           // RidePhase
+  char pickup[CODEC_BLOCK_LEN];
+  char destination[CODEC_BLOCK_LEN];
+  double lat;              // Position at the last save or touch()
+  double lng;
+  int32_t totalPoints;
+};
+
+class SnapshotStore {
+public:
+  SnapshotStore();
+
+  // What survived the reset, newest valid copy; false = nothing usable
+  bool restore(RideSnapshot& out);
+
+  // A state transition: RTC and NVS
+  void save(const RideSnapshot& snapshot);
+  // Position only, RTC only: cheap enough for every movement step
+  void touch(double lat, double lng);
+
+  void printStats();
+
+private:
+  uint32_t sequence;
+  uint32_t rtcWrites;
+  uint32_t nvsWrites;
+  const char* restoredFrom;    // "RTC", "NVS" or nullptr
+  uint32_t restoreMicros;
+};
+
+#endif
@@ -0,0 +1,368 @@
+#include "AerasRoute.h"
+
+namespace route {
+
+static const uint16_t UNSEEN = 0xFFFF;    // slot[]: not reached yet
+static const uint16_t CLOSED = 0xFFFE;    // slot[]: expanded
+static const float HEURISTIC_SCALE = 0.999f;  // Keeps float rounding admissible
+
+struct OpenEntry {
+  uint32_t f;
+  uint16_t node;
+};
+
+// Search state, sized for the largest graph; reset per search
+static uint32_t cost[MAX_NODES];
+static uint16_t parent[MAX_NODES];
+static uint16_t slot[MAX_NODES];          // Heap index while open
+static OpenEntry heap[OPEN_CAPACITY];
+static uint16_t heapSize;
+static SearchStats searchStats;
+
+double nodeLat(const RoadGraph& graph, uint16_t node) {
+  return (graph.originLatE5 + graph.nodeLat[node]) / 1e5;
+}
+
+double nodeLng(const RoadGraph& graph, uint16_t node) {
+  return (graph.originLngE5 + graph.nodeLng[node]) / 1e5;
+}
+
+uint16_t nearestNode(const RoadGraph& graph, double lat, double lng, float* distanceM) {
+  float north = (float)(lat * 1e5 - graph.originLatE5);
+  float east = (float)(lng * 1e5 - graph.originLngE5);
+
+  uint16_t best = NO_NODE;
+  float bestSq = 0;
+  for (uint16_t n = 0; n < graph.nodeCount; n++) {
+    float dy = (graph.nodeLat[n] - north) * METERS_PER_STEP;
+    float dx = (graph.nodeLng[n] - east) * graph.metersPerStepLng;
+    float sq = dx * dx + dy * dy;
+    if (best == NO_NODE || sq < bestSq) {
+      best = n;
+      bestSq = sq;
+    }
+  }
+  if (distanceM != nullptr) *distanceM = sqrtf(bestSq);
+  return best;
+}
+
+// ===== Open set: binary min-heap on f, slot[] tracks each node's index =====
+
+static void place(uint16_t index, const OpenEntry& entry) {
+  heap[index] = entry;
+  slot[entry.node] = index;
+}
+
+static void siftUp(uint16_t index) {
+  OpenEntry entry = heap[index];
+  while (index > 0) {
+    uint16_t up = (index - 1) / 2;
+    if (heap[up].f <= entry.f) break;
+    place(index, heap[up]);
+    index = up;
+  }
+  place(index, entry);
+}
+
+static void siftDown(uint16_t index) {
+  OpenEntry entry = heap[index];
+  for (;;) {
+    uint16_t child = index * 2 + 1;
+    if (child >= heapSize) break;
+    if (child + 1 < heapSize && heap[child + 1].f < heap[child].f) child++;
+    if (entry.f <= heap[child].f) break;
+    place(index, heap[child]);
+    index = child;
+  }
+  place(index, entry);
+}
+
+static bool push(uint16_t node, uint32_t f) {
+  if (heapSize == OPEN_CAPACITY) return false;
+  heap[heapSize] = {f, node};
+  siftUp(heapSize++);
+  if (heapSize > searchStats.peakOpen) searchStats.peakOpen = heapSize;
+  return true;
+}
+
+static uint16_t pop() {
+  uint16_t node = heap[0].node;
+  if (--heapSize > 0) {
+    heap[0] = heap[heapSize];
+    siftDown(0);
+  }
+  slot[node] = CLOSED;
+  return node;
+}
+
+// ===== A* =====
+
+static uint32_t heuristic(const RoadGraph& graph, uint16_t node, uint16_t goal) {
+  float dy = (graph.nodeLat[node] - graph.nodeLat[goal]) * METERS_PER_STEP;
+  float dx = (graph.nodeLng[node] - graph.nodeLng[goal]) * graph.metersPerStepLng;
+  return (uint32_t)(sqrtf(dx * dx + dy * dy) * HEURISTIC_SCALE);
+}
+
+// Leaves cost[]/parent[] filled along the path to goal
+static bool search(const RoadGraph& graph, uint16_t start, uint16_t goal) {
+  if (start >= graph.nodeCount || goal >= graph.nodeCount) return false;
+
+  uint32_t startUs = micros();
+  searchStats.searches++;
+  memset(slot, 0xFF, graph.nodeCount * sizeof(slot[0]));
+  heapSize = 0;
+
+  cost[start] = 0;
+  parent[start] = NO_NODE;
+  push(start, heuristic(graph, start, goal));
+
+  uint16_t expanded = 0;
+  bool found = false;
+  bool overflow = false;
+  while (heapSize > 0 && !overflow) {
+    uint16_t node = pop();
+    expanded++;
+    if (node == goal) {
+      found = true;
+      break;
+    }
+
+    for (uint16_t e = graph.firstEdge[node]; e < graph.firstEdge[node + 1]; e++) {
+      uint16_t to = graph.edgeTo[e];
+      uint32_t reached = cost[node] + graph.edgeLengthM[e];
+      uint16_t state = slot[to];
+      if (state != UNSEEN && reached >= cost[to]) continue;
+
+      cost[to] = reached;
+      parent[to] = node;
+      uint32_t f = reached + heuristic(graph, to, goal);
+      if (state != UNSEEN && state != CLOSED) {
+        heap[state].f = f;      // Decrease-key
+        siftUp(state);
+      } else if (!push(to, f)) {
+        overflow = true;        // Reopening a closed node also needs room
+        break;
+      }
+    }
+  }
+
+  uint32_t elapsed = micros() - startUs;
+  searchStats.lastExpanded = expanded;
+  searchStats.lastMicros = elapsed;
+  if (elapsed > searchStats.maxMicros) searchStats.maxMicros = elapsed;
+  if (overflow) searchStats.overflows++;
+  if (!found) searchStats.failures++;
+  return found;
+}
+
+uint16_t findPath(const RoadGraph& graph, uint16_t start, uint16_t goal,
+                  uint16_t* path, uint32_t* costM, uint16_t maxPath) {
+  if (!search(graph, start, goal)) return 0;
+
+  uint16_t length = 0;
+  for (uint16_t n = goal; n != NO_NODE; n = parent[n]) length++;
+  if (length > maxPath) {
+    searchStats.failures++;
+    return 0;
+  }
+
+  uint16_t i = length;
+  for (uint16_t n = goal; n != NO_NODE; n = parent[n]) {
+    i--;
+    path[i] = n;
+    costM[i] = cost[n];
+  }
+  return length;
+}
+
+const SearchStats& stats() {
+  return searchStats;
+}
+
+void resetStats() {
+  memset(&searchStats, 0, sizeof(searchStats));
+}
+
+size_t searchRamBytes() {
+  return sizeof(cost) + sizeof(parent) + sizeof(slot) + sizeof(heap);
+}
+
+size_t flashBytes(const RoadGraph& graph) {
+  return graph.nodeCount * (sizeof(graph.nodeLat[0]) + sizeof(graph.nodeLng[0])) +
+         (graph.nodeCount + 1) * sizeof(graph.firstEdge[0]) +
+         graph.edgeCount * (sizeof(graph.edgeTo[0]) + sizeof(graph.edgeLengthM[0]));
+}
+
+// ===== Navigation =====
+
+RouteNavigator::RouteNavigator(const RoadGraph& graph)
+  : graph(graph), hasTarget(false), goalNode(NO_NODE), goalLegM(0), pathLength(0), leg(0),
+    turnIndex(0), nextTurn(TURN_NONE), lastPlanMs(0), rerouteCount(0) {
+  memset(&current, 0, sizeof(current));
+}
+
+bool RouteNavigator::setTarget(double lat, double lng, const geo::Target& newTarget) {
+  target = newTarget;
+  hasTarget = true;
+  lastPlanMs = millis();
+  bool routed = plan(lat, lng);
+  update(lat, lng);
+  return routed;
+}
+
+void RouteNavigator::clear() {
+  hasTarget = false;
+  pathLength = 0;
+  memset(&current, 0, sizeof(current));
+}
+
+bool RouteNavigator::plan(double lat, double lng) {
+  pathLength = 0;
+  float startSnapM, goalSnapM;
+  uint16_t start = nearestNode(graph, lat, lng, &startSnapM);
+  goalNode = nearestNode(graph, target.lat, target.lng, &goalSnapM);
+
+  if (start != NO_NODE && startSnapM <= MAX_SNAP_M && goalSnapM <= MAX_SNAP_M) {
+    goalLegM = goalSnapM;
+    pathLength = findPath(graph, start, goalNode, path, pathCostM, MAX_PATH);
+  }
+  if (pathLength == 0) {
+    steerFor(0);
+    return false;
+  }
+
+  // Already past the nearest node along the first street: skip it rather
+  // than turn back for it
+  uint16_t first = 0;
+  if (pathLength >= 2) {
+    geo::Target second = geo::makeTarget(nodeLat(graph, path[1]), nodeLng(graph, path[1]));
+    float firstLegM = pathCostM[1] - pathCostM[0];
+    if (geo::distance(second, lat, lng) < firstLegM) first = 1;
+  }
+  steerFor(first);
+  findNextTurn();
+  return true;
+}
+
+void RouteNavigator::steerFor(uint16_t index) {
+  leg = index;
+  if (leg < pathLength) {
+    next = geo::makeTarget(nodeLat(graph, path[leg]), nodeLng(graph, path[leg]));
+  } else {
+    next = target;
+  }
+}
+
+// Distance from the street between the previous waypoint and the next one
+float RouteNavigator::legOffset(double lat, double lng) const {
+  float px = (float)(lng - next.lng) * next.metersPerDegLng;
+  float py = (float)(lat - next.lat) * (METERS_PER_STEP * 1e5f);
+  if (leg == 0) return sqrtf(px * px + py * py);
+
+  float ax = (float)(nodeLng(graph, path[leg - 1]) - next.lng) * next.metersPerDegLng;
+  float ay = (float)(nodeLat(graph, path[leg - 1]) - next.lat) * (METERS_PER_STEP * 1e5f);
+  float lengthSq = ax * ax + ay * ay;
+  float t = lengthSq > 0 ? (px * ax + py * ay) / lengthSq : 0;
+  if (t < 0) t = 0;
+  if (t > 1) t = 1;
+  float dx = px - ax * t;
+  float dy = py - ay * t;
+  return sqrtf(dx * dx + dy * dy);
+}
+
+float RouteNavigator::segmentHeading(uint16_t from, uint16_t to) const {
+  float north = (graph.nodeLat[to] - graph.nodeLat[from]) * METERS_PER_STEP;
+  float east = (graph.nodeLng[to] - graph.nodeLng[from]) * graph.metersPerStepLng;
+  return atan2f(east, north) * (float)RAD_TO_DEG;
+}
+
+// First node from the current leg on where the heading changes by at
+// least TURN_MIN_DEG; positive changes are clockwise, i.e. right
+void RouteNavigator::findNextTurn() {
+  nextTurn = TURN_NONE;
+  turnIndex = pathLength;
+  for (uint16_t j = leg > 0 ? leg : 1; j + 1 < pathLength; j++) {
+    float change = segmentHeading(path[j], path[j + 1]) - segmentHeading(path[j - 1], path[j]);
+    if (change > 180) change -= 360;
+    if (change < -180) change += 360;
+
+    float magnitude = fabsf(change);
+    if (magnitude < TURN_MIN_DEG) continue;
+
+    bool right = change > 0;
+    if (magnitude >= 170) nextTurn = TURN_U;
+    else if (magnitude >= 135) nextTurn = right ? TURN_SHARP_RIGHT : TURN_SHARP_LEFT;
+    else if (magnitude >= 45) nextTurn = right ? TURN_RIGHT : TURN_LEFT;
+    else nextTurn = right ? TURN_SLIGHT_RIGHT : TURN_SLIGHT_LEFT;
+    turnIndex = j;
+    return;
+  }
+}
+
+const Guidance& RouteNavigator::update(double lat, double lng) {
+  if (!hasTarget) return current;
+
+  if (pathLength > 0) {
+    while (leg < pathLength && geo::distance(next, lat, lng) <= WAYPOINT_RADIUS_M) {
+      steerFor(leg + 1);
+      if (leg > turnIndex) findNextTurn();
+    }
+  }
+
+  // Off the street we were sent down, or still off the graph: plan again
+  bool lost = pathLength == 0 || (leg < pathLength && legOffset(lat, lng) > OFF_ROUTE_M);
+  if (lost && millis() - lastPlanMs >= REROUTE_MS) {
+    lastPlanMs = millis();
+    if (pathLength > 0) rerouteCount++;
+    plan(lat, lng);
+  }
+
+  float toNext = geo::distance(next, lat, lng);
+  current.routed = pathLength > 0;
+  current.bearing = geo::bearing(next, lat, lng);
+  current.remainingM = toNext;
+  current.turn = TURN_NONE;
+  if (leg < pathLength) {
+    current.remainingM += (pathCostM[pathLength - 1] - pathCostM[leg]) + goalLegM;
+    if (turnIndex < pathLength) {
+      current.turn = nextTurn;
+      current.turnInM = toNext + (pathCostM[turnIndex] - pathCostM[leg]);
+    }
+  }
+  if (current.turn == TURN_NONE) current.turnInM = current.remainingM;
+  return current;
+}
+
+float RouteNavigator::distance(double fromLat, double fromLng, double toLat, double toLng) {
+  float fromSnapM, toSnapM;
+  uint16_t from = nearestNode(graph, fromLat, fromLng, &fromSnapM);
+  uint16_t to = nearestNode(graph, toLat, toLng, &toSnapM);
+  if (from == NO_NODE || fromSnapM > MAX_SNAP_M || toSnapM > MAX_SNAP_M) return -1;
+  if (!search(graph, from, to)) return -1;
+  return fromSnapM + cost[to] + toSnapM;
+}
+
+void RouteNavigator::printStats() {
+  const SearchStats& s = searchStats;
+  Serial.println("Route: " + String(current.routed ? "on road graph" : "straight line") + ", " +
+                 String(pathLength) + " nodes, " + String(rerouteCount) + " reroutes");
+  Serial.println("A*: " + String(s.searches) + " searches, " + String(s.failures) + " failed (" +
+                 String(s.overflows) + " open-set overflows), last " + String(s.lastExpanded) +
+                 " nodes in " + String(s.lastMicros) + " us, max " + String(s.maxMicros) +
+                 " us, peak open " + String(s.peakOpen) + "/" + String(OPEN_CAPACITY));
+}
+
+const char* turnLabel(Turn turn) {
+  switch (turn) {
+    case TURN_SLIGHT_LEFT:  return "Bear L";
+    case TURN_LEFT:         return "Turn L";
+    case TURN_SHARP_LEFT:   return "Sharp L";
+    case TURN_SLIGHT_RIGHT: return "Bear R";
+    case TURN_RIGHT:        return "Turn R";
+    case TURN_SHARP_RIGHT:  return "Sharp R";
+    case TURN_U:            return "U-turn";
+    default:                return "Ahead";
+  }
+}
+
+}  // namespace route
@@ -0,0 +1,169 @@
+/*
+ * AERAS Route - on-device road graph and A* routing
+ * The road network is built offline by tools/build-road-graph.js into
+ * RoadGraphData.cpp: const arrays, so on the ESP32 they stay in flash
+ * (rodata) and cost no RAM. Layout is CSR - the edges leaving node n are
+ * [firstEdge[n], firstEdge[n + 1]) - with node coordinates quantized to
+ * int16 steps of 1e-5 degrees (~1.1 m) from a per-graph origin and edge
+ * lengths in whole meters, rounded up so the straight-line heuristic
+ * never overestimates.
+ *
+ * findPath() is A* with the flat-earth distance to the goal as heuristic.
+ * All search state is static and sized at compile time: per-node cost,
+ * parent and heap slot for MAX_NODES nodes, and a binary-heap open set of
+ * OPEN_CAPACITY entries with decrease-key. Nothing is allocated. A search
+ * whose frontier outgrows the open set fails (stats().overflows) and the
+ * caller falls back to the straight line.
+ *
+ * RouteNavigator snaps the position and the target to the nearest graph
+ * nodes, routes between them and then follows the rickshaw along the path:
+ * remaining route distance, the next waypoint to steer for, and the next
+ * turn. It reroutes when the position strays OFF_ROUTE_M from the current
+ * leg, at most once per REROUTE_MS. Positions or targets more than
+ * MAX_SNAP_M from the graph get straight-line guidance, as before.
+ *
+ * AerasRouteBench times routes across the built-in graph.
+ *
+ * Threading: UI task only - the search state is shared.
+ */
+
+#ifndef AERAS_ROUTE_H
+#define AERAS_ROUTE_H
+
+#include <Arduino.h>
+#include <AerasGeo.h>
+
+namespace route {
+
+const uint16_t MAX_NODES = 2048;
+const uint16_t OPEN_CAPACITY = 256;
+const uint16_t MAX_PATH = 192;        // Nodes kept per route
+const uint16_t NO_NODE = 0xFFFF;
+
+// 1e-5 degree steps, as stored in the graph
+const float METERS_PER_STEP = (float)(geo::EARTH_RADIUS_M * DEG_TO_RAD / 1e5);
+
+struct RoadGraph {
+  uint16_t nodeCount;
+  uint16_t edgeCount;               // Directed; a two-way street is two edges
+  int32_t originLatE5;
+  int32_t originLngE5;
+  float metersPerStepLng;           // METERS_PER_STEP * cos(origin latitude)
+  const int16_t* nodeLat;           // Steps north of the origin
+  const int16_t* nodeLng;           // Steps east of the origin
+  const uint16_t* firstEdge;        // nodeCount + 1 entries
+  const uint16_t* edgeTo;
+  const uint16_t* edgeLengthM;
+};
+
+// Generated: tools/build-road-graph.js -> RoadGraphData.cpp
+extern const RoadGraph BUILTIN_GRAPH;
+
+struct SearchStats {
+  uint32_t searches;
+  uint32_t failures;                // No path, or the open set overflowed
+  uint32_t overflows;
+  uint16_t lastExpanded;            // Nodes closed by the last search
+  uint16_t peakOpen;                // Largest open set seen
+  uint32_t lastMicros;
+  uint32_t maxMicros;
+};
+
+double nodeLat(const RoadGraph& graph, uint16_t node);
+double nodeLng(const RoadGraph& graph, uint16_t node);
+
+// Nearest node and its distance in meters; NO_NODE for an empty graph
+uint16_t nearestNode(const RoadGraph& graph, double lat, double lng, float* distanceM = nullptr);
+
+// Shortest path from start to goal, written start first into path (up to
+// maxPath nodes) with the route cost to each node in costM. Returns the
+// node count, 0 if there is no path or it does not fit.
+uint16_t findPath(const RoadGraph& graph, uint16_t start, uint16_t goal,
+                  uint16_t* path, uint32_t* costM, uint16_t maxPath);
+
+const SearchStats& stats();
+void resetStats();
+size_t searchRamBytes();              // Static search state, for the benchmark
+size_t flashBytes(const RoadGraph& graph);
+
+// ===== Navigation =====
+
+enum Turn : uint8_t {
+  TURN_NONE,          // Straight on to the target
+  TURN_SLIGHT_LEFT,
+  TURN_LEFT,
+  TURN_SHARP_LEFT,
+  TURN_SLIGHT_RIGHT,
+  TURN_RIGHT,
+  TURN_SHARP_RIGHT,
+  TURN_U
+};
+
+struct Guidance {
+  bool routed;          // false: straight-line fallback
+  float remainingM;     // Along the route (straight line when !routed)
+  float bearing;        // Toward the next waypoint, degrees [0, 360)
+  Turn turn;            // Next turn along the route
+  float turnInM;        // Distance to it (remainingM when TURN_NONE)
+};
+
+class RouteNavigator {
+public:
+  static const uint16_t MAX_SNAP_M = 400;       // Farther from the graph: straight line
+  static const uint16_t WAYPOINT_RADIUS_M = 10; // Waypoint reached, steer for the next
+  static const uint16_t OFF_ROUTE_M = 50;
+  static const uint32_t REROUTE_MS = 5000;
+  static const uint8_t TURN_MIN_DEG = 30;       // Smaller heading changes are "straight on"
+
+  explicit RouteNavigator(const RoadGraph& graph = BUILTIN_GRAPH);
+
+  // Route from the position to a new target
+  bool setTarget(double lat, double lng, const geo::Target& target);
+  void clear();
+
+  // Feed every position: advances along the route, reroutes when off it
+  const Guidance& update(double lat, double lng);
+  const Guidance& guidance() const { return current; }
+
+  // Point to steer for: the next route node, or the target on the last leg
+  const geo::Target& waypoint() const { return next; }
+  bool onFinalLeg() const { return leg >= pathLength; }
+
+  // Route length between two points without touching the active route
+  // (the offer screen); negative when either end is off the graph
+  float distance(double fromLat, double fromLng, double toLat, double toLng);
+
+  uint32_t reroutes() const { return rerouteCount; }
+  void printStats();
+
+private:
+  bool plan(double lat, double lng);
+  void steerFor(uint16_t index);
+  float legOffset(double lat, double lng) const;
+  float segmentHeading(uint16_t from, uint16_t to) const;
+  void findNextTurn();
+
+  const RoadGraph& graph;
+  geo::Target target;
+  geo::Target next;
+  bool hasTarget;
+  uint16_t goalNode;
+  float goalLegM;               // Goal node -> target
+
+  uint16_t path[MAX_PATH];
+  uint32_t pathCostM[MAX_PATH]; // Route cost from path[0]
+  uint16_t pathLength;          // 0 = straight-line fallback
+  uint16_t leg;                 // Index of the waypoint being steered for
+  uint16_t turnIndex;           // Path index of the next turn, or pathLength
+  Turn nextTurn;
+
+  Guidance current;
+  uint32_t lastPlanMs;
+  uint32_t rerouteCount;
+};
+
+const char* turnLabel(Turn turn);   // Short text for the OLED, e.g. "Turn L", "Bear R"
+
+}  // namespace route
+
+#endif
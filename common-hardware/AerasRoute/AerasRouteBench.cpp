@@ -0,0 +1,67 @@
+#include "AerasRouteBench.h"
+#include "AerasRoute.h"
+
+static const float MIN_STRAIGHT_M = 500;   // Shorter pairs say little about detours
+
+// Same path buffers the navigator keeps, off the stack
+static uint16_t path[route::MAX_PATH];
+static uint32_t pathCostM[route::MAX_PATH];
+
+void runRouteBenchmark(uint16_t routes) {
+  const route::RoadGraph& graph = route::BUILTIN_GRAPH;
+  route::resetStats();  // STATUS counts start over after a BENCH
+
+  Serial.println("\n===== ROUTE BENCHMARK =====");
+  Serial.println("Graph: " + String(graph.nodeCount) + " nodes, " + String(graph.edgeCount) +
+                 " edges, " + String(route::flashBytes(graph)) + " bytes flash");
+  Serial.println("Search state: " + String(route::searchRamBytes()) + " bytes RAM, navigator " +
+                 String(sizeof(route::RouteNavigator)) + " bytes");
+
+  uint32_t state = 4242;
+  uint32_t totalUs = 0, maxUs = 0, expanded = 0, pathNodes = 0;
+  uint16_t found = 0, maxExpanded = 0, detourCount = 0;
+  float detourSum = 0, maxRouteM = 0;
+
+  for (uint16_t i = 0; i < routes; i++) {
+    state = state * 1664525u + 1013904223u;
+    uint16_t start = (state >> 8) % graph.nodeCount;
+    state = state * 1664525u + 1013904223u;
+    uint16_t goal = (state >> 8) % graph.nodeCount;
+
+    uint16_t length = route::findPath(graph, start, goal, path, pathCostM, route::MAX_PATH);
+    const route::SearchStats& s = route::stats();
+    totalUs += s.lastMicros;
+    if (s.lastMicros > maxUs) maxUs = s.lastMicros;
+    expanded += s.lastExpanded;
+    if (s.lastExpanded > maxExpanded) maxExpanded = s.lastExpanded;
+    if (length == 0) continue;
+
+    found++;
+    pathNodes += length;
+    float routeM = pathCostM[length - 1];
+    if (routeM > maxRouteM) maxRouteM = routeM;
+    float straightM = geo::distance(route::nodeLat(graph, start), route::nodeLng(graph, start),
+                                    route::nodeLat(graph, goal), route::nodeLng(graph, goal));
+    if (straightM >= MIN_STRAIGHT_M) {
+      detourSum += routeM / straightM;
+      detourCount++;
+    }
+  }
+
+  const route::SearchStats& s = route::stats();
+  Serial.println(String(routes) + " routes, " + String(found) + " found, " + String(s.overflows) +
+                 " open-set overflows");
+  Serial.println("Time:      " + String(totalUs / routes) + " us/route avg, " + String(maxUs) + " us max");
+  Serial.println("Expanded:  " + String(expanded / routes) + " nodes avg, " + String(maxExpanded) +
+                 " max (" + String(100.0f * expanded / routes / graph.nodeCount, 1) + "% of graph)");
+  Serial.println("Open set:  peak " + String(s.peakOpen) + " of " + String(route::OPEN_CAPACITY));
+  if (found > 0) {
+    Serial.println("Paths:     " + String(pathNodes / found) + " nodes avg, longest " +
+                   String(maxRouteM / 1000.0f, 2) + " km");
+  }
+  if (detourCount > 0) {
+    Serial.println("Detour:    road / straight line " + String(detourSum / detourCount, 2) +
+                   " avg over " + String(detourCount) + " pairs >= " + String((int)MIN_STRAIGHT_M) + " m");
+  }
+  Serial.println("===========================\n");
+}
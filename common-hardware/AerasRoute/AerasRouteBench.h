@@ -0,0 +1,17 @@
+/*
+ * AERAS Route - routing benchmark
+ * Runs A* between pseudo-random node pairs of the built-in road graph and
+ * reports time per route, nodes expanded, peak open set, how much longer
+ * the road route is than the straight line, and the flash/RAM the graph
+ * and the search state take. Runs on the device and in the native env
+ * (BENCH).
+ */
+
+#ifndef AERAS_ROUTE_BENCH_H
+#define AERAS_ROUTE_BENCH_H
+
+#include <Arduino.h>
+
+void runRouteBenchmark(uint16_t routes = 200);
+
+#endif
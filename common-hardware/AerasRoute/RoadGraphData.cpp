@@ -0,0 +1,1147 @@
+// Generated by tools/build-road-graph.js - do not edit.
+// Source: synthetic 41x45 grid, 150 m spacing
+// 1842 nodes, 6120 directed edges, 35534 bytes of flash
+
+#include "AerasRoute.h"
+
+namespace route {
+
+static const int16_t NODE_LAT[] PROGMEM = {
+  38, 55, 71, 67, 39, 44, 12, 16, 1, 22, 31, 65, 32, 41, 38, 49,
+  51, 11, 71, 1, 54, 15, 56, 48, 51, 38, 26, 3, 18, 39, 66, 29,
+  21, 11, 68, 61, 2, 33, 18, 7, 16, 6, 5, 12, 63, 178, 186, 190,
+  144, 171, 159, 171, 174, 147, 146, 137, 186, 174, 200, 195, 140, 185, 183, 204,
+  145, 143, 199, 171, 140, 199, 200, 199, 162, 184, 176, 137, 143, 168, 161, 149,
+  161, 143, 188, 196, 204, 198, 188, 144, 172, 169, 273, 286, 335, 286, 285, 313,
+  333, 330, 291, 339, 278, 273, 324, 274, 307, 278, 320, 293, 334, 274, 302, 288,
+  330, 329, 292, 323, 273, 275, 328, 272, 330, 339, 284, 319, 279, 320, 278, 284,
+  306, 327, 332, 306, 329, 290, 318, 426, 406, 451, 442, 415, 420, 448, 414, 436,
+  417, 456, 432, 409, 412, 459, 467, 410, 451, 472, 476, 475, 429, 471, 420, 469,
+  425, 456, 447, 453, 414, 422, 462, 444, 436, 464, 426, 468, 426, 442, 468, 441,
+  425, 415, 445, 406, 589, 553, 587, 600, 550, 577, 567, 543, 570, 608, 578, 546,
+  593, 579, 588, 559, 554, 594, 576, 541, 583, 570, 581, 548, 586, 575, 567, 574,
+  561, 589, 589, 540, 584, 600, 553, 550, 595, 549, 575, 551, 574, 547, 571, 569,
+  587, 712, 719, 698, 709, 746, 705, 687, 720, 708, 684, 725, 675, 708, 715, 719,
+  720, 689, 737, 726, 740, 710, 726, 678, 693, 705, 730, 730, 738, 742, 708, 728,
+  679, 681, 684, 685, 720, 696, 706, 724, 733, 691, 676, 730, 699, 718, 855, 840,
+  874, 842, 812, 874, 818, 863, 875, 849, 831, 870, 854, 826, 827, 841, 826, 823,
+  880, 823, 829, 852, 831, 858, 847, 865, 828, 846, 857, 876, 835, 812, 859, 811,
+  861, 813, 821, 818, 879, 812, 829, 871, 875, 855, 994, 973, 952, 975, 963, 987,
+  955, 946, 980, 982, 1008, 981, 1007, 966, 966, 955, 1014, 960, 973, 976, 973, 955,
+  991, 979, 980, 972, 983, 986, 1015, 991, 992, 967, 960, 980, 1003, 998, 978, 946,
+  1003, 951, 1006, 1007, 955, 986, 959, 1116, 1109, 1131, 1121, 1149, 1127, 1138, 1138, 1126,
+  1109, 1141, 1131, 1132, 1122, 1126, 1086, 1124, 1094, 1100, 1128, 1144, 1147, 1149, 1133, 1117,
+  1111, 1088, 1127, 1101, 1113, 1134, 1093, 1132, 1142, 1097, 1121, 1091, 1105, 1104, 1114, 1093,
+  1086, 1118, 1133, 1113, 1221, 1267, 1283, 1266, 1246, 1229, 1272, 1229, 1236, 1280, 1230, 1238,
+  1269, 1221, 1247, 1267, 1249, 1228, 1273, 1253, 1228, 1217, 1237, 1218, 1279, 1248, 1223, 1262,
+  1217, 1222, 1268, 1225, 1238, 1257, 1224, 1228, 1253, 1286, 1255, 1235, 1282, 1260, 1235, 1214,
+  1266, 1366, 1350, 1375, 1353, 1366, 1367, 1404, 1360, 1394, 1380, 1357, 1419, 1412, 1405, 1365,
+  1408, 1380, 1358, 1390, 1405, 1366, 1382, 1382, 1413, 1407, 1365, 1369, 1362, 1383, 1391, 1369,
+  1388, 1350, 1377, 1392, 1371, 1388, 1419, 1385, 1406, 1405, 1402, 1356, 1385, 1387, 1534, 1501,
+  1505, 1527, 1525, 1541, 1497, 1550, 1555, 1501, 1493, 1488, 1501, 1520, 1525, 1554, 1484, 1498,
+  1533, 1494, 1548, 1493, 1528, 1554, 1531, 1489, 1511, 1522, 1511, 1555, 1534, 1526, 1512, 1511,
+  1523, 1552, 1484, 1492, 1522, 1494, 1488, 1519, 1498, 1513, 1508, 1662, 1685, 1688, 1667, 1621,
+  1682, 1663, 1621, 1681, 1661, 1667, 1637, 1624, 1651, 1633, 1668, 1620, 1689, 1656, 1664, 1656,
+  1684, 1625, 1660, 1625, 1626, 1666, 1637, 1650, 1634, 1674, 1655, 1650, 1640, 1655, 1690, 1639,
+  1624, 1664, 1665, 1620, 1626, 1619, 1690, 1641, 1809, 1775, 1774, 1802, 1756, 1826, 1784, 1813,
+  1825, 1816, 1805, 1790, 1779, 1788, 1781, 1790, 1797, 1775, 1824, 1762, 1754, 1820, 1796, 1807,
+  1789, 1803, 1806, 1824, 1775, 1798, 1774, 1818, 1781, 1797, 1755, 1805, 1810, 1825, 1757, 1803,
+  1798, 1781, 1760, 1784, 1758, 1949, 1926, 1920, 1889, 1918, 1906, 1889, 1932, 1944, 1913, 1918,
+  1932, 1924, 1933, 1920, 1926, 1916, 1950, 1899, 1929, 1901, 1960, 1896, 1919, 1936, 1959, 1942,
+  1953, 1959, 1933, 1899, 1904, 1909, 1889, 1900, 1913, 1943, 1890, 1940, 1954, 1952, 1918, 1930,
+  1898, 1891, 2083, 2046, 2053, 2054, 2070, 2071, 2083, 2044, 2064, 2031, 2052, 2057, 2025, 2088,
+  2035, 2042, 2057, 2040, 2028, 2061, 2053, 2088, 2077, 2042, 2045, 2032, 2093, 2046, 2036, 2077,
+  2025, 2061, 2036, 2081, 2084, 2033, 2086, 2041, 2094, 2058, 2049, 2038, 2051, 2031, 2035, 2179,
+  2229, 2163, 2163, 2193, 2166, 2201, 2199, 2167, 2204, 2164, 2180, 2182, 2166, 2187, 2177, 2209,
+  2194, 2190, 2208, 2181, 2224, 2167, 2228, 2159, 2160, 2197, 2173, 2167, 2180, 2196, 2207, 2181,
+  2175, 2196, 2163, 2225, 2163, 2211, 2196, 2195, 2205, 2204, 2196, 2209, 2356, 2342, 2334, 2327,
+  2296, 2330, 2341, 2331, 2295, 2314, 2338, 2313, 2310, 2328, 2309, 2355, 2319, 2357, 2298, 2338,
+  2364, 2361, 2322, 2357, 2363, 2326, 2338, 2296, 2344, 2334, 2343, 2356, 2298, 2364, 2310, 2314,
+  2318, 2343, 2340, 2320, 2350, 2348, 2352, 2338, 2305, 2474, 2483, 2475, 2499, 2476, 2435, 2435,
+  2470, 2496, 2445, 2494, 2432, 2465, 2460, 2494, 2496, 2485, 2484, 2477, 2484, 2457, 2475, 2480,
+  2455, 2444, 2459, 2430, 2433, 2493, 2481, 2492, 2470, 2464, 2460, 2500, 2489, 2466, 2485, 2493,
+  2472, 2455, 2499, 2486, 2487, 2494, 2622, 2606, 2619, 2598, 2564, 2580, 2584, 2578, 2594, 2599,
+  2590, 2605, 2568, 2629, 2635, 2589, 2622, 2575, 2599, 2625, 2572, 2608, 2627, 2594, 2592, 2594,
+  2630, 2587, 2586, 2607, 2635, 2628, 2620, 2620, 2625, 2567, 2627, 2630, 2575, 2564, 2599, 2611,
+  2619, 2597, 2624, 2750, 2765, 2699, 2754, 2753, 2714, 2754, 2762, 2736, 2720, 2739, 2730, 2720,
+  2742, 2710, 2710, 2744, 2741, 2770, 2750, 2730, 2705, 2708, 2707, 2724, 2714, 2741, 2767, 2734,
+  2721, 2762, 2720, 2724, 2735, 2769, 2738, 2718, 2716, 2736, 2705, 2767, 2736, 2726, 2748, 2731,
+  2833, 2867, 2882, 2865, 2896, 2901, 2845, 2889, 2878, 2882, 2885, 2862, 2871, 2837, 2849, 2868,
+  2902, 2836, 2850, 2834, 2877, 2880, 2859, 2873, 2861, 2880, 2860, 2861, 2850, 2873, 2843, 2905,
+  2883, 2840, 2855, 2891, 2856, 2887, 2901, 2851, 2896, 2892, 2898, 2844, 2860, 3017, 3034, 2999,
+  3034, 2998, 3018, 2976, 2992, 3015, 3015, 3015, 3014, 3034, 3009, 3008, 2994, 2971, 2971, 2993,
+  3006, 2978, 3017, 3026, 3016, 3016, 2979, 3009, 3002, 3038, 2978, 3039, 2991, 2973, 3035, 2993,
+  3014, 3020, 3037, 2992, 2972, 3031, 2976, 3034, 2990, 2995, 3160, 3136, 3109, 3105, 3171, 3112,
+  3145, 3171, 3156, 3155, 3170, 3118, 3110, 3152, 3127, 3161, 3115, 3141, 3116, 3104, 3132, 3138,
+  3166, 3171, 3146, 3146, 3132, 3133, 3153, 3170, 3168, 3125, 3131, 3127, 3165, 3172, 3145, 3122,
+  3119, 3112, 3149, 3112, 3128, 3111, 3130, 3296, 3282, 3254, 3309, 3282, 3240, 3281, 3290, 3266,
+  3279, 3259, 3266, 3243, 3257, 3288, 3281, 3277, 3253, 3256, 3307, 3286, 3263, 3276, 3309, 3301,
+  3240, 3276, 3297, 3295, 3268, 3267, 3294, 3267, 3289, 3266, 3295, 3266, 3250, 3248, 3276, 3297,
+  3306, 3257, 3264, 3253, 3426, 3396, 3393, 3430, 3392, 3444, 3401, 3388, 3409, 3421, 3403, 3400,
+  3433, 3390, 3440, 3431, 3436, 3396, 3403, 3386, 3393, 3425, 3380, 3387, 3383, 3386, 3423, 3430,
+  3406, 3413, 3434, 3421, 3388, 3385, 3405, 3378, 3397, 3414, 3427, 3441, 3409, 3414, 3400, 3401,
+  3426, 3552, 3573, 3540, 3562, 3536, 3550, 3513, 3524, 3570, 3553, 3555, 3563, 3549, 3535, 3550,
+  3567, 3519, 3533, 3535, 3528, 3535, 3510, 3573, 3576, 3527, 3539, 3515, 3564, 3558, 3553, 3569,
+  3513, 3526, 3573, 3527, 3527, 3533, 3571, 3531, 3558, 3562, 3533, 3553, 3516, 3533, 3712, 3695,
+  3645, 3664, 3693, 3680, 3704, 3667, 3660, 3655, 3706, 3687, 3644, 3656, 3644, 3695, 3656, 3704,
+  3674, 3643, 3668, 3649, 3709, 3657, 3652, 3669, 3650, 3680, 3679, 3660, 3677, 3705, 3648, 3712,
+  3662, 3674, 3708, 3680, 3645, 3690, 3681, 3709, 3655, 3673, 3669, 3843, 3789, 3821, 3801, 3838,
+  3826, 3847, 3843, 3845, 3811, 3793, 3805, 3844, 3785, 3821, 3820, 3839, 3809, 3825, 3821, 3802,
+  3779, 3799, 3799, 3781, 3792, 3794, 3820, 3814, 3784, 3827, 3821, 3799, 3805, 3815, 3816, 3808,
+  3840, 3812, 3814, 3787, 3842, 3841, 3849, 3954, 3959, 3934, 3918, 3969, 3953, 3963, 3921, 3984,
+  3974, 3941, 3915, 3982, 3925, 3940, 3949, 3925, 3965, 3916, 3953, 3921, 3979, 3956, 3949, 3938,
+  3923, 3934, 3927, 3946, 3981, 3950, 3958, 3963, 3953, 3959, 3967, 3954, 3958, 3965, 3970, 3923,
+  3938, 3984, 3960, 3927, 4111, 4055, 4102, 4061, 4053, 4072, 4063, 4051, 4083, 4085, 4066, 4101,
+  4106, 4099, 4118, 4095, 4080, 4104, 4080, 4110, 4085, 4109, 4051, 4057, 4061, 4073, 4061, 4099,
+  4064, 4058, 4072, 4050, 4118, 4062, 4071, 4060, 4083, 4071, 4117, 4057, 4061, 4089, 4050, 4109,
+  4091, 4212, 4218, 4199, 4227, 4246, 4190, 4236, 4249, 4211, 4203, 4184, 4240, 4215, 4203, 4193,
+  4200, 4192, 4238, 4243, 4207, 4209, 4223, 4212, 4186, 4191, 4243, 4220, 4196, 4201, 4219, 4239,
+  4242, 4206, 4187, 4195, 4252, 4191, 4223, 4198, 4214, 4183, 4188, 4185, 4204, 4194, 4344, 4329,
+  4343, 4354, 4380, 4334, 4325, 4358, 4321, 4347, 4318, 4322, 4321, 4365, 4385, 4341, 4359, 4381,
+  4326, 4362, 4334, 4371, 4335, 4323, 4320, 4349, 4388, 4367, 4340, 4334, 4370, 4380, 4386, 4370,
+  4373, 4322, 4375, 4324, 4364, 4317, 4361, 4387, 4383, 4372, 4324, 4471, 4462, 4512, 4479, 4505,
+  4474, 4503, 4510, 4483, 4485, 4495, 4521, 4512, 4502, 4498, 4460, 4520, 4483, 4467, 4510, 4458,
+  4524, 4514, 4453, 4492, 4496, 4460, 4476, 4460, 4491, 4459, 4503, 4468, 4503, 4523, 4473, 4465,
+  4471, 4511, 4523, 4515, 4504, 4457, 4455, 4588, 4613, 4644, 4638, 4655, 4593, 4656, 4634, 4639,
+  4599, 4599, 4656, 4648, 4629, 4627, 4594, 4655, 4597, 4650, 4640, 4650, 4612, 4658, 4609, 4588,
+  4602, 4629, 4615, 4657, 4644, 4608, 4655, 4628, 4628, 4588, 4612, 4594, 4630, 4635, 4600, 4655,
+  4625, 4601, 4654, 4624, 4751, 4783, 4756, 4751, 4741, 4783, 4740, 4726, 4768, 4747, 4756, 4757,
+  4773, 4770, 4788, 4760, 4750, 4784, 4775, 4744, 4741, 4766, 4787, 4792, 4735, 4756, 4766, 4786,
+  4776, 4742, 4749, 4791, 4775, 4725, 4723, 4755, 4728, 4730, 4754, 4790, 4787, 4760, 4739, 4776,
+  4734, 4918, 4860, 4896, 4881, 4873, 4914, 4883, 4906, 4909, 4908, 4920, 4888, 4866, 4870, 4858,
+  4920, 4916, 4885, 4918, 4861, 4875, 4911, 4920, 4889, 4886, 4875, 4893, 4884, 4923, 4891, 4923,
+  4877, 4871, 4895, 4877, 4908, 4863, 4913, 4868, 4877, 4907, 4879, 4884, 4877, 4904, 5017, 4995,
+  5006, 5030, 5016, 4995, 4996, 5047, 5061, 5043, 5025, 5044, 5053, 5056, 5035, 5003, 5010, 5014,
+  5060, 4992, 5018, 5007, 5051, 5021, 5034, 5017, 5049, 5003, 5029, 5012, 5051, 5015, 5051, 5061,
+  5010, 5015, 5054, 5040, 5041, 5006, 5003, 5009, 5027, 5013, 5041, 5169, 5150, 5137, 5193, 5167,
+  5151, 5186, 5184, 5136, 5146, 5156, 5154, 5188, 5143, 5196, 5155, 5175, 5160, 5175, 5169, 5198,
+  5188, 5154, 5186, 5136, 5137, 5154, 5137, 5127, 5136, 5170, 5158, 5145, 5167, 5129, 5132, 5162,
+  5191, 5159, 5150, 5128, 5188, 5165, 5167, 5187, 5318, 5278, 5280, 5324, 5323, 5294, 5322, 5305,
+  5263, 5269, 5287, 5263, 5325, 5289, 5329, 5319, 5278, 5291, 5264, 5323, 5302, 5277, 5301, 5276,
+  5280, 5330, 5312, 5272, 5309, 5297, 5318, 5311, 5331, 5284, 5308, 5291, 5323, 5311, 5265, 5299,
+  5266, 5276, 5321, 5279, 5304, 5435, 5455, 5443, 5462, 5446, 5444, 5437, 5458, 5420, 5427, 5401,
+  5422, 5441, 5462, 5397, 5398, 5414, 5464, 5403, 5432, 5457, 5424, 5407, 5442, 5444, 5464, 5447,
+  5433, 5438, 5457, 5463, 5413, 5428, 5418, 5456, 5435, 5446, 5452, 5457, 5411, 5417, 5401, 5443,
+  5422, 5397
+};
+
+static const int16_t NODE_LNG[] PROGMEM = {
+  77, 158, 365, 452, 631, 777, 922, 1097, 1225, 1354, 1495, 1678, 1765, 1913, 2045, 2251,
+  2339, 2550, 2685, 2777, 2973, 3132, 3254, 3374, 3551, 3672, 3852, 3991, 4124, 4275, 4424, 4591,
+  4683, 4816, 4985, 5147, 5323, 5449, 5616, 5755, 5872, 6056, 6146, 6327, 6451, 41, 210, 307,
+  466, 609, 752, 950, 1064, 1183, 1329, 1514, 1605, 1773, 1931, 2091, 2207, 2394, 2517, 2642,
+  2827, 2943, 3117, 3268, 3398, 3504, 3708, 3813, 3949, 4157, 4251, 4378, 4595, 4672, 4890, 5015,
+  5128, 5260, 5450, 5549, 5710, 5889, 6037, 6143, 6323, 6498, 57, 162, 357, 454, 623, 792,
+  885, 1052, 1223, 1389, 1504, 1673, 1817, 1945, 2069, 2214, 2356, 2524, 2697, 2801, 2930, 3077,
+  3242, 3404, 3549, 3688, 3869, 3978, 4153, 4240, 4390, 4555, 4707, 4832, 5005, 5159, 5300, 5455,
+  5561, 5752, 5863, 6024, 6154, 6315, 6430, 41, 219, 316, 458, 602, 785, 909, 1053, 1231,
+  1365, 1504, 1618, 1811, 1906, 2051, 2248, 2351, 2527, 2688, 2832, 2966, 3131, 3221, 3423, 3520,
+  3722, 3818, 3992, 4159, 4256, 4420, 4581, 4735, 4816, 4979, 5141, 5268, 5473, 5575, 5769, 5842,
+  5999, 6200, 6325, 6465, 30, 165, 347, 475, 593, 778, 949, 1074, 1205, 1384, 1509, 1672,
+  1799, 1897, 2054, 2194, 2362, 2542, 2639, 2822, 2986, 3117, 3230, 3415, 3538, 3696, 3825, 3983,
+  4117, 4294, 4420, 4586, 4725, 4884, 4984, 5120, 5269, 5451, 5592, 5763, 5870, 6023, 6176, 6308,
+  6479, 14, 178, 367, 475, 611, 735, 898, 1028, 1209, 1349, 1505, 1634, 1811, 1927, 2058,
+  2258, 2387, 2532, 2681, 2790, 2934, 3086, 3264, 3397, 3572, 3694, 3801, 4010, 4141, 4280, 4452,
+  4530, 4702, 4847, 5038, 5108, 5297, 5432, 5576, 5730, 5911, 5983, 6175, 6279, 6481, 73, 160,
+  336, 586, 784, 906, 1074, 1226, 1377, 1463, 1649, 1828, 1912, 2074, 2230, 2396, 2538, 2678,
+  2811, 2937, 3115, 3247, 3433, 3531, 3711, 3809, 3959, 4094, 4300, 4384, 4581, 4695, 4886, 5009,
+  5134, 5327, 5438, 5612, 5694, 5841, 6025, 6206, 6287, 6434, 38, 198, 311, 477, 608, 786,
+  912, 1048, 1230, 1366, 1498, 1634, 1799, 1935, 2048, 2208, 2399, 2507, 2634, 2776, 2921, 3092,
+  3230, 3427, 3505, 3692, 3811, 3995, 4089, 4294, 4411, 4578, 4710, 4870, 4993, 5139, 5292, 5463,
+  5597, 5720, 5878, 6035, 6141, 6285, 6436, 76, 167, 302, 444, 656, 766, 940, 1060, 1204,
+  1341, 1515, 1645, 1803, 1931, 2084, 2253, 2348, 2508, 2661, 2850, 2974, 3122, 3237, 3378, 3556,
+  3696, 3812, 3950, 4143, 4256, 4421, 4534, 4707, 4815, 5020, 5150, 5272, 5461, 5600, 5726, 5904,
+  6011, 6162, 6305, 6467, 12, 193, 340, 442, 598, 767, 949, 1036, 1191, 1349, 1536, 1633,
+  1762, 1903, 2057, 2223, 2377, 2548, 2648, 2778, 2964, 3088, 3235, 3421, 3516, 3719, 3817, 3989,
+  4100, 4253, 4404, 4526, 4678, 4835, 4993, 5160, 5287, 5413, 5595, 5760, 5866, 5993, 6141, 6283,
+  6444, 25, 186, 336, 491, 620, 787, 881, 1073, 1188, 1375, 1506, 1608, 1824, 1952, 2059,
+  2266, 2398, 2505, 2695, 2791, 2919, 3095, 3248, 3420, 3510, 3692, 3854, 3975, 4161, 4275, 4410,
+  4553, 4718, 4831, 4976, 5173, 5260, 5468, 5553, 5699, 5866, 6031, 6180, 6278, 6465, 47, 162,
+  309, 503, 624, 754, 933, 1075, 1173, 1326, 1486, 1613, 1789, 1902, 2069, 2256, 2354, 2487,
+  2700, 2841, 2960, 3109, 3236, 3404, 3525, 3721, 3796, 3984, 4137, 4258, 4382, 4583, 4683, 4858,
+  5007, 5137, 5284, 5460, 5554, 5721, 5851, 6037, 6149, 6298, 6455, 22, 148, 364, 477, 593,
+  793, 895, 1031, 1189, 1371, 1481, 1669, 1804, 1958, 2050, 2193, 2356, 2500, 2689, 2834, 2946,
+  3140, 3264, 3406, 3575, 3652, 3824, 3992, 4105, 4234, 4379, 4574, 4682, 4879, 5005, 5177, 5315,
+  5401, 5557, 5751, 5846, 6056, 6169, 6320, 6474, 1, 177, 307, 462, 584, 742, 885, 1022,
+  1212, 1339, 1474, 1660, 1790, 1917, 2104, 2213, 2368, 2547, 2675, 2824, 2936, 3092, 3224, 3403,
+  3572, 3666, 3836, 3949, 4161, 4309, 4449, 4562, 4715, 4833, 5018, 5153, 5254, 5448, 5555, 5705,
+  5903, 5989, 6150, 6295, 6475, 63, 145, 336, 471, 634, 741, 878, 1023, 1184, 1345, 1485,
+  1680, 1782, 1956, 2088, 2203, 2385, 2515, 2700, 2818, 2959, 3103, 3244, 3366, 3515, 3720, 3851,
+  3974, 4161, 4255, 4380, 4531, 4680, 4819, 5038, 5130, 5293, 5417, 5604, 5711, 5858, 6052, 6129,
+  6280, 6484, 1, 150, 306, 491, 583, 739, 908, 1062, 1219, 1350, 1499, 1609, 1824, 1961,
+  2066, 2209, 2410, 2533, 2658, 2812, 2987, 3124, 3249, 3416, 3509, 3692, 3806, 4007, 4096, 4299,
+  4396, 4593, 4678, 4843, 5023, 5150, 5307, 5427, 5599, 5745, 5885, 6027, 6174, 6335, 6488, 65,
+  192, 332, 457, 593, 774, 916, 1081, 1194, 1375, 1461, 1626, 1786, 1919, 2093, 2262, 2369,
+  2541, 2647, 2782, 2958, 3072, 3281, 3424, 3519, 3668, 3852, 4016, 4149, 4306, 4385, 4569, 4702,
+  4876, 5001, 5133, 5296, 5465, 5621, 5703, 5873, 5997, 6139, 6316, 6472, 31, 183, 319, 477,
+  603, 796, 904, 1085, 1202, 1369, 1470, 1648, 1771, 1949, 2092, 2233, 2378, 2558, 2647, 2808,
+  2957, 3084, 3260, 3386, 3554, 3720, 3855, 3942, 4154, 4244, 4445, 4574, 4711, 4856, 5014, 5113,
+  5289, 5464, 5579, 5756, 5869, 5995, 6158, 6308, 6425, 51, 201, 328, 479, 641, 755, 883,
+  1077, 1171, 1383, 1481, 1662, 1806, 1945, 2065, 2220, 2372, 2523, 2640, 2847, 2927, 3097, 3240,
+  3393, 3548, 3657, 3821, 4005, 4137, 4281, 4391, 4543, 4686, 4863, 4990, 5130, 5318, 5435, 5603,
+  5737, 5870, 5986, 6143, 6278, 6488, 70, 197, 330, 490, 588, 746, 890, 1090, 1197, 1313,
+  1504, 1666, 1790, 1930, 2105, 2261, 2358, 2509, 2682, 2774, 2992, 3093, 3245, 3357, 3544, 3649,
+  3838, 3953, 4106, 4251, 4437, 4541, 4678, 4884, 4972, 5154, 5268, 5400, 5546, 5748, 5886, 6034,
+  6156, 6301, 6493, 26, 197, 360, 513, 648, 775, 880, 1069, 1231, 1386, 1482, 1664, 1813,
+  1922, 2066, 2189, 2405, 2511, 2691, 2847, 2987, 3109, 3236, 3429, 3505, 3683, 3853, 3973, 4115,
+  4276, 4407, 4596, 4721, 4892, 5018, 5146, 5305, 5417, 5590, 5750, 5865, 6052, 6200, 6315, 6442,
+  60, 154, 368, 502, 632, 731, 908, 1089, 1191, 1331, 1502, 1608, 1810, 1924, 2067, 2221,
+  2359, 2506, 2654, 2786, 2966, 3134, 3286, 3370, 3521, 3649, 3851, 4004, 4141, 4262, 4416, 4585,
+  4680, 4826, 4971, 5181, 5286, 5426, 5604, 5715, 5843, 6052, 6172, 6352, 6460, 10, 153, 316,
+  505, 650, 749, 948, 1071, 1173, 1373, 1534, 1645, 1758, 1912, 2069, 2192, 2370, 2526, 2627,
+  2835, 2929, 3113, 3243, 3357, 3550, 3680, 3864, 4008, 4097, 4286, 4389, 4556, 4747, 4878, 5027,
+  5171, 5320, 5475, 5563, 5722, 5854, 6020, 6195, 6287, 6482, 1, 165, 354, 447, 658, 793,
+  911, 1034, 1241, 1366, 1524, 1675, 1761, 1943, 2116, 2195, 2412, 2556, 2669, 2776, 2974, 3141,
+  3283, 3395, 3508, 3696, 3831, 3978, 4159, 4302, 4419, 4549, 4697, 4829, 4971, 5158, 5258, 5428,
+  5550, 5731, 5898, 6014, 6177, 6315, 6489, 45, 206, 297, 491, 600, 742, 926, 1051, 1169,
+  1337, 1472, 1634, 1820, 1951, 2068, 2210, 2370, 2500, 2639, 2815, 2995, 3096, 3251, 3396, 3505,
+  3708, 3847, 3945, 4124, 4256, 4379, 4593, 4697, 4825, 5016, 5132, 5320, 5460, 5582, 5739, 5875,
+  6000, 6171, 6348, 6428, 13, 180, 357, 445, 599, 732, 897, 1081, 1191, 1352, 1479, 1642,
+  1753, 1934, 2120, 2199, 2345, 2498, 2677, 2817, 2994, 3126, 3258, 3367, 3517, 3676, 3827, 3950,
+  4104, 4272, 4386, 4565, 4687, 4875, 4979, 5159, 5292, 5469, 5577, 5762, 5894, 6028, 6164, 6320,
+  6460, 72, 147, 350, 480, 599, 796, 893, 1064, 1204, 1359, 1500, 1636, 1785, 1905, 2118,
+  2200, 2355, 2514, 2685, 2806, 2955, 3086, 3226, 3395, 3578, 3653, 3871, 4003, 4086, 4272, 4414,
+  4534, 4694, 4882, 4963, 5129, 5274, 5441, 5584, 5721, 5843, 6024, 6190, 6329, 6428, 15, 166,
+  294, 450, 641, 772, 926, 1022, 1175, 1318, 1524, 1662, 1800, 1967, 2117, 2211, 2342, 2524,
+  2633, 2785, 2951, 3131, 3230, 3431, 3570, 3714, 3808, 3954, 4156, 4300, 4424, 4597, 4709, 4859,
+  4975, 5178, 5262, 5475, 5620, 5698, 5843, 6048, 6157, 6345, 6480, 57, 208, 306, 448, 621,
+  792, 895, 1093, 1201, 1369, 1468, 1633, 1828, 1971, 2093, 2227, 2338, 2549, 2695, 2777, 2964,
+  3076, 3239, 3423, 3526, 3701, 3841, 4000, 4111, 4248, 4412, 4549, 4736, 4837, 5015, 5168, 5263,
+  5476, 5595, 5754, 5851, 5992, 6191, 6331, 74, 190, 316, 497, 628, 730, 887, 1051, 1225,
+  1370, 1502, 1615, 1784, 1957, 2046, 2237, 2391, 2525, 2662, 2840, 2958, 3067, 3245, 3406, 3543,
+  3693, 3854, 4000, 4099, 4256, 4451, 4576, 4721, 4838, 5009, 5169, 5327, 5455, 5570, 5707, 5840,
+  6013, 6130, 6292, 6423, 1, 147, 296, 480, 644, 771, 926, 1091, 1226, 1375, 1491, 1654,
+  1799, 1955, 2052, 2253, 2352, 2500, 2695, 2836, 2949, 3133, 3218, 3396, 3551, 3675, 3839, 3964,
+  4086, 4257, 4426, 4567, 4673, 4818, 4978, 5150, 5312, 5415, 5568, 5698, 5882, 6043, 6135, 6331,
+  6462, 75, 176, 316, 465, 592, 743, 908, 1079, 1238, 1385, 1464, 1653, 1773, 1918, 2053,
+  2225, 2397, 2530, 2655, 2834, 2971, 3135, 3274, 3395, 3529, 3661, 3794, 3980, 4125, 4274, 4415,
+  4551, 4735, 4819, 4969, 5166, 5275, 5441, 5601, 5724, 5892, 6041, 6177, 6338, 6454, 22, 170,
+  367, 438, 647, 731, 908, 1086, 1185, 1372, 1475, 1612, 1819, 1957, 2106, 2221, 2407, 2545,
+  2655, 2779, 2974, 3131, 3268, 3410, 3514, 3663, 3855, 3979, 4110, 4267, 4424, 4546, 4740, 4885,
+  5031, 5167, 5328, 5430, 5577, 5736, 5876, 6058, 6157, 6339, 6444, 61, 221, 306, 488, 659,
+  738, 925, 1047, 1213, 1382, 1506, 1642, 1797, 1928, 2107, 2235, 2341, 2525, 2680, 2822, 2933,
+  3134, 3223, 3365, 3544, 3680, 3815, 3964, 4110, 4284, 4391, 4564, 4727, 4874, 5018, 5134, 5278,
+  5600, 5698, 5875, 6060, 6167, 6292, 6493, 11, 179, 357, 460, 633, 780, 894, 1080, 1236,
+  1352, 1503, 1668, 1781, 1938, 2080, 2260, 2344, 2483, 2697, 2809, 2929, 3079, 3278, 3399, 3513,
+  3703, 3824, 3942, 4096, 4237, 4404, 4555, 4678, 4841, 5003, 5116, 5325, 5436, 5604, 5722, 5840,
+  6011, 6198, 6337, 6461, 14, 152, 303, 509, 625, 735, 889, 1052, 1167, 1345, 1506, 1663,
+  1780, 1967, 2113, 2236, 2360, 2482, 2669, 2820, 2978, 3095, 3272, 3417, 3556, 3681, 3806, 3997,
+  4130, 4298, 4402, 4542, 4697, 4852, 5010, 5149, 5258, 5468, 5563, 5693, 5902, 6010, 6181, 6330,
+  6470, 44, 153, 368, 475, 640, 735, 897, 1043, 1201, 1381, 1525, 1612, 1811, 1925, 2094,
+  2202, 2374, 2517, 2645, 2801, 2933, 3081, 3265, 3374, 3537, 3670, 3853, 3985, 4110, 4244, 4441,
+  4577, 4713, 4878, 4969, 5110, 5267, 5400, 5618, 5738, 5904, 5994, 6130, 6332, 6466, 43, 199,
+  332, 450, 630, 765, 942, 1028, 1171, 1342, 1533, 1614, 1770, 1945, 2075, 2204, 2393, 2486,
+  2702, 2795, 2957, 3141, 3263, 3380, 3547, 3701, 3852, 3954, 4132, 4261, 4446, 4589, 4713, 4816,
+  4975, 5137, 5275, 5406, 5597, 5711, 5874, 6044, 6156, 6315, 6442, 65, 204, 303, 469, 644,
+  744, 908, 1089, 1242, 1345, 1485, 1625, 1818, 1973, 2052, 2230, 2361, 2487, 2691, 2803, 2918,
+  3138, 3282, 3384, 3546, 3717, 3794, 3949, 4116, 4294, 4416, 4582, 4743, 4836, 5005, 5129, 5291,
+  5422, 5615, 5762, 5884, 6019, 6183, 6340, 6427, 63, 197, 327, 478, 593, 734, 906, 1047,
+  1239, 1380, 1530, 1650, 1820, 1967, 2109, 2259, 2408, 2493, 2651, 2824, 2986, 3070, 3272, 3429,
+  3539, 3717, 3858, 3996, 4110, 4240, 4398, 4536, 4747, 4820, 4974, 5168, 5259, 5424, 5555, 5763,
+  5870, 6022, 6151, 6280, 6441, 63, 206, 317, 489, 652, 799, 876, 1077, 1211, 1364, 1474,
+  1618, 1813, 1901, 2072, 2240, 2376, 2542, 2643, 2814, 2978, 3115, 3231, 3371, 3549, 3676, 3866,
+  3940, 4114, 4236, 4394, 4590, 4731, 4838, 5028, 5114, 5275, 5449, 5563, 5710, 5853, 6045, 6170,
+  6282, 6446
+};
+
+static const uint16_t FIRST_EDGE[] PROGMEM = {
+  0, 2, 5, 7, 9, 12, 15, 19, 22, 24, 26, 29, 32, 34, 35, 36,
+  38, 41, 44, 47, 49, 50, 52, 54, 57, 60, 63, 66, 69, 72, 74, 77,
+  80, 83, 86, 89, 93, 97, 99, 101, 103, 104, 106, 109, 112, 113, 115, 118,
+  121, 124, 125, 127, 130, 135, 138, 141, 144, 147, 150, 152, 154, 156, 159, 163,
+  166, 170, 174, 178, 180, 183, 188, 192, 196, 200, 203, 206, 209, 212, 216, 220,
+  224, 229, 234, 237, 241, 245, 247, 250, 254, 258, 260, 262, 265, 269, 274, 276,
+  279, 283, 287, 290, 295, 298, 301, 304, 308, 312, 316, 319, 323, 326, 330, 332,
+  335, 338, 340, 343, 346, 349, 352, 356, 359, 361, 363, 367, 371, 374, 375, 378,
+  380, 383, 387, 390, 394, 398, 403, 406, 410, 413, 418, 422, 426, 430, 434, 438,
+  441, 446, 449, 452, 454, 458, 463, 467, 470, 474, 478, 482, 484, 487, 491, 494,
+  496, 499, 502, 505, 508, 510, 513, 516, 520, 524, 528, 531, 534, 537, 540, 544,
+  547, 551, 554, 557, 560, 563, 567, 571, 574, 576, 580, 584, 588, 591, 595, 600,
+  603, 606, 609, 611, 615, 618, 621, 625, 630, 634, 638, 641, 643, 646, 650, 652,
+  654, 657, 658, 660, 662, 666, 670, 674, 678, 682, 686, 688, 691, 694, 697, 700,
+  704, 707, 710, 712, 715, 718, 721, 724, 726, 729, 734, 738, 742, 745, 749, 753,
+  756, 760, 764, 767, 771, 775, 779, 781, 785, 788, 789, 794, 797, 799, 804, 807,
+  810, 812, 816, 820, 824, 828, 832, 835, 837, 840, 843, 847, 851, 856, 859, 862,
+  865, 867, 870, 873, 876, 880, 883, 887, 890, 894, 897, 900, 904, 908, 910, 911,
+  914, 917, 921, 924, 927, 931, 932, 934, 937, 939, 942, 946, 950, 953, 957, 961,
+  965, 969, 972, 975, 980, 984, 987, 990, 994, 997, 1000, 1003, 1008, 1013, 1015, 1017,
+  1019, 1022, 1026, 1030, 1034, 1038, 1042, 1046, 1050, 1054, 1058, 1060, 1063, 1066, 1070, 1074,
+  1079, 1082, 1086, 1088, 1091, 1095, 1098, 1102, 1106, 1110, 1114, 1117, 1120, 1124, 1129, 1133,
+  1137, 1141, 1146, 1150, 1154, 1159, 1163, 1166, 1169, 1173, 1177, 1181, 1185, 1189, 1192, 1198,
+  1202, 1205, 1209, 1212, 1216, 1219, 1222, 1225, 1228, 1232, 1234, 1238, 1243, 1247, 1252, 1256,
+  1260, 1263, 1266, 1269, 1272, 1274, 1278, 1282, 1286, 1290, 1294, 1298, 1303, 1306, 1309, 1313,
+  1318, 1322, 1326, 1331, 1334, 1336, 1340, 1342, 1345, 1349, 1351, 1353, 1356, 1361, 1364, 1367,
+  1369, 1372, 1376, 1379, 1382, 1384, 1386, 1388, 1391, 1394, 1398, 1401, 1406, 1409, 1412, 1415,
+  1417, 1419, 1422, 1427, 1432, 1436, 1439, 1443, 1447, 1451, 1455, 1458, 1461, 1463, 1468, 1471,
+  1475, 1478, 1480, 1484, 1488, 1491, 1495, 1498, 1502, 1504, 1507, 1510, 1514, 1517, 1521, 1525,
+  1529, 1533, 1536, 1540, 1543, 1546, 1550, 1554, 1557, 1561, 1564, 1566, 1567, 1571, 1574, 1579,
+  1583, 1588, 1593, 1596, 1600, 1604, 1608, 1611, 1614, 1618, 1621, 1625, 1628, 1632, 1634, 1637,
+  1640, 1644, 1646, 1648, 1653, 1657, 1659, 1663, 1666, 1670, 1674, 1675, 1676, 1679, 1681, 1687,
+  1691, 1695, 1700, 1704, 1708, 1711, 1715, 1717, 1719, 1721, 1725, 1728, 1730, 1735, 1739, 1743,
+  1747, 1751, 1755, 1759, 1762, 1766, 1770, 1774, 1778, 1781, 1786, 1788, 1791, 1793, 1796, 1799,
+  1802, 1805, 1810, 1813, 1817, 1820, 1822, 1825, 1826, 1828, 1831, 1834, 1838, 1842, 1846, 1850,
+  1855, 1859, 1862, 1865, 1867, 1870, 1873, 1877, 1881, 1882, 1885, 1888, 1893, 1896, 1900, 1904,
+  1908, 1911, 1915, 1919, 1923, 1927, 1930, 1933, 1936, 1939, 1944, 1948, 1952, 1956, 1958, 1962,
+  1966, 1969, 1973, 1976, 1979, 1980, 1983, 1988, 1991, 1994, 1997, 2001, 2004, 2008, 2012, 2014,
+  2015, 2018, 2021, 2024, 2028, 2032, 2035, 2039, 2042, 2046, 2049, 2053, 2056, 2059, 2063, 2065,
+  2067, 2071, 2075, 2079, 2082, 2085, 2088, 2092, 2096, 2101, 2105, 2108, 2111, 2115, 2117, 2121,
+  2125, 2128, 2130, 2133, 2138, 2141, 2144, 2148, 2152, 2154, 2157, 2161, 2165, 2166, 2169, 2173,
+  2178, 2182, 2186, 2190, 2193, 2196, 2199, 2202, 2206, 2210, 2214, 2218, 2220, 2223, 2227, 2232,
+  2235, 2238, 2241, 2243, 2248, 2251, 2254, 2258, 2261, 2262, 2265, 2268, 2272, 2276, 2279, 2283,
+  2287, 2292, 2297, 2300, 2304, 2308, 2311, 2315, 2319, 2322, 2324, 2327, 2330, 2334, 2338, 2341,
+  2345, 2349, 2352, 2355, 2359, 2363, 2366, 2370, 2374, 2375, 2378, 2383, 2386, 2388, 2392, 2395,
+  2398, 2400, 2402, 2406, 2409, 2413, 2417, 2420, 2424, 2427, 2430, 2433, 2434, 2437, 2441, 2445,
+  2447, 2451, 2455, 2458, 2461, 2465, 2467, 2470, 2475, 2479, 2483, 2487, 2491, 2495, 2498, 2500,
+  2503, 2507, 2510, 2512, 2516, 2521, 2525, 2529, 2533, 2538, 2542, 2546, 2548, 2550, 2552, 2554,
+  2557, 2559, 2562, 2566, 2569, 2573, 2577, 2581, 2585, 2588, 2591, 2594, 2598, 2602, 2605, 2609,
+  2614, 2617, 2621, 2623, 2625, 2628, 2633, 2637, 2640, 2642, 2645, 2649, 2653, 2656, 2659, 2664,
+  2667, 2671, 2674, 2679, 2683, 2687, 2691, 2695, 2699, 2701, 2703, 2707, 2709, 2712, 2715, 2716,
+  2718, 2721, 2725, 2728, 2732, 2736, 2740, 2743, 2745, 2749, 2753, 2755, 2758, 2761, 2764, 2767,
+  2769, 2773, 2777, 2780, 2782, 2786, 2790, 2792, 2795, 2799, 2803, 2806, 2809, 2814, 2818, 2820,
+  2822, 2824, 2827, 2831, 2835, 2839, 2842, 2845, 2848, 2852, 2856, 2859, 2862, 2867, 2870, 2874,
+  2876, 2879, 2882, 2885, 2889, 2892, 2896, 2900, 2905, 2909, 2913, 2917, 2919, 2921, 2924, 2927,
+  2931, 2934, 2938, 2942, 2945, 2949, 2952, 2956, 2960, 2964, 2968, 2973, 2976, 2980, 2985, 2989,
+  2993, 2997, 3001, 3004, 3006, 3008, 3012, 3015, 3018, 3022, 3026, 3028, 3030, 3033, 3036, 3038,
+  3041, 3044, 3048, 3052, 3056, 3060, 3065, 3069, 3071, 3073, 3077, 3081, 3084, 3087, 3091, 3095,
+  3097, 3100, 3104, 3107, 3111, 3115, 3118, 3121, 3125, 3128, 3132, 3136, 3141, 3144, 3147, 3151,
+  3154, 3157, 3161, 3165, 3167, 3171, 3174, 3177, 3181, 3185, 3188, 3190, 3194, 3199, 3203, 3207,
+  3211, 3214, 3218, 3220, 3224, 3226, 3228, 3232, 3236, 3240, 3244, 3248, 3252, 3254, 3257, 3260,
+  3263, 3266, 3270, 3274, 3276, 3280, 3284, 3288, 3292, 3296, 3299, 3302, 3305, 3306, 3309, 3313,
+  3317, 3322, 3325, 3327, 3329, 3332, 3336, 3340, 3343, 3347, 3351, 3356, 3360, 3364, 3367, 3369,
+  3370, 3374, 3378, 3381, 3385, 3389, 3393, 3396, 3400, 3404, 3406, 3408, 3410, 3413, 3416, 3420,
+  3424, 3426, 3429, 3433, 3437, 3441, 3446, 3449, 3451, 3454, 3456, 3460, 3464, 3468, 3472, 3475,
+  3478, 3481, 3484, 3487, 3492, 3496, 3500, 3504, 3508, 3512, 3516, 3519, 3521, 3523, 3525, 3527,
+  3530, 3534, 3537, 3540, 3542, 3545, 3549, 3552, 3556, 3559, 3563, 3567, 3570, 3573, 3575, 3577,
+  3580, 3584, 3588, 3592, 3597, 3601, 3605, 3607, 3610, 3615, 3620, 3624, 3628, 3631, 3634, 3638,
+  3639, 3643, 3646, 3648, 3652, 3656, 3660, 3665, 3670, 3674, 3678, 3680, 3683, 3687, 3691, 3695,
+  3699, 3702, 3706, 3711, 3714, 3718, 3720, 3723, 3726, 3730, 3732, 3735, 3737, 3739, 3743, 3747,
+  3751, 3756, 3760, 3764, 3766, 3769, 3773, 3777, 3781, 3784, 3785, 3786, 3789, 3793, 3796, 3798,
+  3801, 3804, 3807, 3811, 3815, 3818, 3821, 3824, 3827, 3830, 3832, 3836, 3840, 3842, 3845, 3849,
+  3852, 3856, 3860, 3863, 3867, 3871, 3875, 3878, 3882, 3886, 3889, 3894, 3897, 3900, 3904, 3909,
+  3912, 3914, 3917, 3921, 3925, 3928, 3931, 3936, 3938, 3942, 3944, 3946, 3949, 3953, 3957, 3962,
+  3966, 3970, 3973, 3977, 3981, 3984, 3986, 3989, 3992, 3994, 3998, 4002, 4005, 4009, 4013, 4018,
+  4021, 4024, 4026, 4030, 4034, 4039, 4042, 4047, 4050, 4055, 4058, 4063, 4067, 4071, 4074, 4076,
+  4080, 4084, 4086, 4089, 4093, 4097, 4102, 4106, 4110, 4113, 4116, 4120, 4124, 4129, 4133, 4137,
+  4140, 4143, 4147, 4149, 4152, 4156, 4159, 4161, 4164, 4168, 4172, 4175, 4178, 4180, 4183, 4186,
+  4190, 4194, 4198, 4203, 4207, 4210, 4212, 4214, 4217, 4220, 4223, 4225, 4227, 4230, 4232, 4235,
+  4239, 4243, 4246, 4250, 4254, 4257, 4260, 4263, 4267, 4270, 4273, 4277, 4280, 4283, 4286, 4291,
+  4294, 4296, 4299, 4302, 4305, 4308, 4312, 4315, 4318, 4322, 4326, 4330, 4334, 4338, 4342, 4345,
+  4348, 4352, 4356, 4359, 4364, 4368, 4372, 4375, 4376, 4378, 4379, 4381, 4385, 4388, 4390, 4394,
+  4397, 4401, 4404, 4409, 4413, 4417, 4420, 4424, 4427, 4430, 4434, 4438, 4442, 4444, 4447, 4450,
+  4454, 4457, 4460, 4463, 4467, 4470, 4473, 4477, 4481, 4483, 4485, 4488, 4491, 4493, 4496, 4500,
+  4505, 4509, 4513, 4517, 4518, 4519, 4523, 4524, 4527, 4530, 4534, 4538, 4542, 4546, 4550, 4555,
+  4559, 4564, 4568, 4571, 4574, 4577, 4580, 4584, 4589, 4592, 4593, 4596, 4600, 4604, 4607, 4608,
+  4612, 4615, 4619, 4623, 4627, 4631, 4633, 4636, 4639, 4643, 4645, 4650, 4654, 4658, 4661, 4665,
+  4670, 4672, 4673, 4677, 4681, 4684, 4687, 4690, 4693, 4697, 4701, 4705, 4709, 4713, 4717, 4721,
+  4724, 4727, 4731, 4734, 4739, 4743, 4746, 4749, 4752, 4755, 4759, 4762, 4764, 4767, 4770, 4774,
+  4779, 4782, 4785, 4788, 4791, 4794, 4797, 4799, 4802, 4808, 4810, 4812, 4816, 4820, 4824, 4826,
+  4830, 4834, 4837, 4840, 4843, 4845, 4848, 4852, 4856, 4859, 4863, 4866, 4870, 4873, 4875, 4878,
+  4880, 4883, 4887, 4891, 4893, 4895, 4898, 4902, 4906, 4908, 4909, 4911, 4914, 4918, 4923, 4926,
+  4931, 4936, 4938, 4942, 4944, 4946, 4950, 4954, 4957, 4961, 4965, 4967, 4971, 4974, 4978, 4981,
+  4983, 4987, 4990, 4992, 4995, 5000, 5003, 5006, 5009, 5012, 5016, 5020, 5025, 5029, 5033, 5036,
+  5041, 5044, 5046, 5048, 5051, 5054, 5056, 5059, 5062, 5066, 5070, 5073, 5076, 5080, 5085, 5089,
+  5093, 5096, 5100, 5104, 5106, 5108, 5111, 5112, 5115, 5118, 5120, 5123, 5126, 5130, 5133, 5136,
+  5140, 5143, 5145, 5149, 5151, 5155, 5158, 5163, 5167, 5172, 5176, 5180, 5183, 5188, 5192, 5196,
+  5199, 5203, 5207, 5211, 5215, 5219, 5222, 5223, 5226, 5229, 5231, 5234, 5237, 5240, 5244, 5248,
+  5252, 5256, 5258, 5261, 5263, 5266, 5268, 5270, 5273, 5275, 5278, 5283, 5286, 5289, 5293, 5297,
+  5301, 5304, 5308, 5311, 5314, 5317, 5319, 5323, 5327, 5330, 5334, 5337, 5339, 5342, 5346, 5349,
+  5351, 5354, 5356, 5360, 5364, 5368, 5372, 5375, 5378, 5382, 5386, 5389, 5392, 5395, 5400, 5402,
+  5406, 5408, 5410, 5412, 5416, 5419, 5422, 5424, 5427, 5430, 5432, 5436, 5438, 5441, 5445, 5449,
+  5452, 5455, 5458, 5461, 5465, 5469, 5472, 5475, 5479, 5481, 5483, 5485, 5487, 5490, 5493, 5495,
+  5500, 5504, 5507, 5510, 5513, 5515, 5518, 5520, 5524, 5528, 5532, 5536, 5541, 5545, 5549, 5551,
+  5554, 5558, 5562, 5565, 5566, 5570, 5574, 5577, 5580, 5582, 5586, 5590, 5594, 5598, 5602, 5605,
+  5609, 5612, 5616, 5619, 5623, 5627, 5630, 5632, 5636, 5639, 5643, 5647, 5649, 5652, 5657, 5660,
+  5663, 5665, 5668, 5671, 5676, 5680, 5684, 5687, 5692, 5696, 5700, 5703, 5706, 5710, 5713, 5716,
+  5718, 5721, 5724, 5727, 5729, 5731, 5734, 5737, 5741, 5745, 5748, 5752, 5755, 5758, 5761, 5764,
+  5767, 5770, 5772, 5775, 5776, 5779, 5783, 5787, 5791, 5794, 5796, 5799, 5803, 5807, 5810, 5814,
+  5818, 5822, 5827, 5830, 5834, 5837, 5841, 5844, 5847, 5850, 5854, 5857, 5861, 5864, 5867, 5869,
+  5873, 5876, 5879, 5882, 5884, 5887, 5890, 5892, 5895, 5900, 5902, 5905, 5908, 5912, 5916, 5920,
+  5924, 5926, 5929, 5932, 5936, 5939, 5943, 5947, 5950, 5954, 5958, 5963, 5967, 5971, 5975, 5979,
+  5982, 5986, 5991, 5995, 5998, 6000, 6002, 6005, 6008, 6011, 6014, 6017, 6020, 6023, 6027, 6030,
+  6033, 6036, 6039, 6042, 6044, 6047, 6049, 6051, 6054, 6057, 6059, 6061, 6064, 6067, 6069, 6070,
+  6072, 6075, 6077, 6080, 6083, 6086, 6089, 6092, 6094, 6097, 6100, 6103, 6105, 6107, 6110, 6113,
+  6117, 6119, 6120
+};
+
+static const uint16_t EDGE_TO[] PROGMEM = {
+  1, 45, 0, 2, 46, 1, 47, 4, 48, 3, 5, 49, 4, 6, 50, 5,
+  7, 51, 52, 6, 8, 52, 7, 9, 8, 10, 9, 11, 55, 10, 12, 56,
+  11, 57, 58, 15, 14, 16, 15, 17, 61, 16, 18, 62, 17, 19, 63, 18,
+  64, 65, 22, 66, 21, 67, 24, 68, 69, 23, 25, 69, 24, 26, 70, 25,
+  27, 71, 26, 28, 72, 27, 29, 73, 28, 30, 29, 31, 75, 30, 32, 76,
+  31, 33, 77, 32, 34, 78, 33, 35, 79, 34, 36, 80, 81, 35, 37, 81,
+  82, 36, 38, 37, 83, 40, 84, 39, 42, 86, 41, 43, 87, 42, 44, 88,
+  43, 0, 46, 1, 45, 91, 2, 48, 92, 3, 47, 93, 4, 5, 95, 6,
+  52, 96, 6, 7, 51, 53, 97, 52, 54, 98, 53, 55, 99, 10, 54, 56,
+  11, 55, 57, 12, 56, 102, 13, 103, 60, 104, 59, 105, 16, 62, 106, 17,
+  61, 63, 107, 18, 62, 64, 19, 63, 65, 109, 20, 64, 66, 110, 21, 65,
+  67, 111, 22, 66, 23, 69, 114, 23, 24, 68, 70, 114, 25, 69, 71, 115,
+  26, 70, 72, 116, 27, 71, 73, 117, 28, 72, 118, 75, 119, 120, 30, 74,
+  76, 31, 75, 77, 32, 76, 78, 122, 33, 77, 79, 123, 34, 78, 80, 124,
+  35, 79, 81, 125, 126, 35, 36, 80, 82, 126, 36, 81, 83, 38, 82, 84,
+  128, 39, 83, 85, 129, 84, 86, 41, 85, 131, 42, 88, 132, 133, 43, 87,
+  89, 133, 88, 134, 91, 135, 46, 90, 92, 47, 91, 93, 137, 48, 92, 94,
+  138, 139, 93, 95, 50, 94, 96, 51, 95, 97, 141, 52, 96, 142, 143, 53,
+  99, 144, 54, 98, 100, 144, 145, 99, 101, 145, 100, 102, 146, 57, 101, 103,
+  58, 102, 104, 148, 59, 103, 105, 149, 60, 104, 106, 150, 61, 105, 107, 62,
+  106, 108, 152, 107, 109, 153, 64, 108, 110, 154, 65, 109, 66, 112, 156, 111,
+  113, 157, 112, 158, 68, 69, 115, 70, 114, 116, 71, 115, 117, 72, 116, 118,
+  73, 117, 119, 163, 74, 118, 164, 74, 165, 122, 166, 77, 121, 123, 167, 78,
+  122, 124, 168, 79, 123, 169, 80, 80, 81, 127, 126, 172, 83, 129, 173, 84,
+  128, 130, 174, 129, 131, 175, 86, 130, 132, 176, 87, 131, 133, 177, 87, 88,
+  132, 134, 178, 89, 133, 179, 90, 136, 180, 181, 135, 137, 182, 92, 136, 138,
+  182, 183, 93, 137, 139, 183, 93, 138, 140, 184, 139, 141, 185, 186, 96, 140,
+  142, 186, 97, 141, 143, 187, 97, 142, 144, 98, 99, 143, 189, 190, 99, 100,
+  190, 101, 147, 191, 146, 148, 103, 147, 149, 193, 104, 148, 150, 194, 195, 105,
+  149, 151, 195, 150, 152, 196, 107, 151, 153, 197, 108, 152, 154, 198, 109, 153,
+  155, 199, 154, 200, 111, 157, 201, 112, 156, 158, 202, 113, 157, 203, 160, 204,
+  159, 161, 205, 160, 162, 206, 161, 163, 207, 118, 162, 208, 119, 165, 120, 164,
+  210, 121, 167, 211, 122, 166, 168, 212, 123, 167, 169, 213, 124, 168, 170, 214,
+  169, 171, 215, 170, 172, 216, 127, 171, 217, 128, 174, 218, 129, 173, 175, 219,
+  130, 174, 176, 131, 175, 177, 221, 132, 176, 222, 133, 179, 223, 134, 178, 224,
+  135, 181, 225, 135, 180, 182, 226, 136, 137, 181, 227, 137, 138, 228, 139, 185,
+  140, 184, 186, 230, 140, 141, 185, 187, 142, 186, 188, 232, 187, 189, 233, 144,
+  188, 190, 234, 144, 145, 189, 191, 235, 146, 190, 192, 191, 193, 237, 148, 192,
+  238, 149, 195, 149, 150, 194, 240, 151, 197, 241, 152, 196, 198, 153, 197, 199,
+  243, 154, 198, 200, 244, 245, 155, 199, 201, 245, 156, 200, 202, 246, 157, 201,
+  247, 158, 248, 159, 205, 250, 160, 204, 206, 250, 161, 205, 162, 208, 163, 207,
+  253, 254, 165, 255, 166, 212, 167, 211, 213, 257, 168, 212, 214, 258, 169, 213,
+  215, 259, 170, 214, 216, 260, 171, 215, 217, 261, 172, 216, 218, 262, 173, 217,
+  174, 220, 264, 219, 221, 265, 176, 220, 266, 177, 223, 267, 178, 222, 224, 268,
+  179, 223, 269, 180, 226, 270, 181, 225, 182, 228, 272, 183, 227, 229, 228, 230,
+  273, 185, 229, 274, 232, 275, 187, 231, 233, 188, 232, 234, 277, 278, 189, 233,
+  235, 278, 190, 234, 236, 279, 235, 237, 280, 192, 236, 238, 281, 193, 237, 239,
+  282, 238, 240, 283, 195, 239, 241, 284, 196, 240, 242, 285, 241, 243, 286, 198,
+  242, 244, 287, 199, 243, 245, 288, 199, 200, 244, 289, 201, 247, 202, 246, 248,
+  291, 203, 247, 292, 250, 204, 205, 249, 251, 294, 250, 252, 295, 251, 253, 208,
+  252, 254, 297, 298, 209, 253, 298, 210, 256, 299, 255, 257, 212, 256, 258, 301,
+  213, 257, 259, 302, 214, 258, 260, 303, 215, 259, 261, 304, 216, 260, 262, 305,
+  217, 261, 306, 264, 307, 219, 263, 308, 220, 266, 309, 221, 265, 267, 310, 222,
+  266, 268, 311, 223, 267, 269, 312, 313, 224, 268, 313, 225, 271, 314, 270, 315,
+  316, 227, 316, 229, 274, 318, 230, 273, 319, 231, 276, 320, 275, 277, 321, 322,
+  233, 276, 322, 233, 234, 323, 324, 235, 280, 324, 236, 279, 281, 325, 237, 280,
+  326, 238, 283, 327, 239, 282, 284, 328, 240, 283, 285, 329, 241, 284, 242, 243,
+  288, 332, 244, 287, 333, 245, 290, 334, 335, 289, 291, 335, 247, 290, 292, 248,
+  291, 293, 337, 292, 250, 339, 251, 296, 340, 295, 297, 253, 296, 342, 253, 254,
+  299, 343, 255, 298, 300, 344, 299, 301, 345, 257, 300, 302, 346, 258, 301, 303,
+  347, 259, 302, 304, 348, 260, 303, 305, 349, 261, 304, 350, 262, 307, 351, 263,
+  306, 308, 352, 353, 264, 307, 309, 353, 265, 308, 354, 266, 311, 355, 267, 310,
+  312, 356, 268, 311, 357, 268, 269, 358, 270, 315, 359, 271, 314, 316, 360, 361,
+  271, 272, 315, 317, 361, 316, 362, 273, 363, 274, 364, 275, 321, 366, 276, 320,
+  322, 366, 276, 277, 321, 367, 278, 324, 368, 369, 278, 279, 323, 369, 280, 326,
+  370, 371, 281, 325, 327, 371, 282, 326, 328, 372, 283, 327, 329, 373, 284, 328,
+  330, 374, 329, 331, 330, 332, 376, 287, 331, 333, 288, 332, 334, 378, 289, 333,
+  335, 379, 289, 290, 334, 336, 380, 335, 337, 381, 292, 336, 338, 382, 337, 383,
+  294, 340, 384, 295, 339, 341, 385, 340, 342, 386, 297, 341, 343, 387, 298, 342,
+  344, 388, 299, 343, 345, 389, 300, 344, 346, 390, 301, 345, 391, 302, 348, 392,
+  303, 347, 349, 393, 304, 348, 350, 394, 395, 305, 349, 351, 395, 306, 350, 352,
+  396, 307, 351, 353, 397, 307, 308, 352, 354, 398, 309, 353, 355, 399, 310, 354,
+  356, 400, 311, 355, 357, 401, 402, 312, 356, 358, 402, 313, 357, 403, 314, 360,
+  404, 315, 359, 361, 405, 315, 316, 360, 362, 317, 361, 363, 407, 318, 362, 364,
+  408, 319, 363, 365, 409, 364, 366, 410, 320, 321, 365, 367, 411, 412, 322, 366,
+  368, 412, 323, 367, 369, 323, 324, 368, 370, 325, 369, 371, 325, 326, 370, 416,
+  327, 373, 417, 328, 372, 418, 329, 375, 419, 374, 376, 420, 331, 375, 377, 421,
+  376, 378, 333, 377, 379, 423, 334, 378, 380, 424, 425, 335, 379, 381, 425, 336,
+  380, 382, 426, 427, 337, 381, 383, 427, 338, 382, 384, 428, 339, 383, 429, 340,
+  386, 430, 341, 385, 387, 342, 386, 432, 343, 389, 344, 388, 390, 434, 345, 389,
+  391, 435, 346, 390, 392, 436, 347, 391, 393, 437, 348, 392, 394, 438, 349, 393,
+  395, 439, 349, 350, 394, 396, 440, 351, 395, 441, 352, 398, 442, 353, 397, 399,
+  443, 354, 398, 400, 444, 445, 355, 399, 401, 445, 356, 400, 402, 446, 356, 357,
+  401, 403, 447, 358, 402, 448, 359, 405, 360, 404, 406, 450, 405, 451, 362, 408,
+  452, 363, 407, 409, 453, 364, 408, 365, 455, 366, 412, 456, 366, 367, 411, 413,
+  457, 412, 414, 458, 413, 415, 459, 414, 461, 371, 417, 461, 372, 416, 418, 462,
+  373, 417, 463, 374, 420, 464, 375, 419, 376, 466, 423, 467, 378, 422, 468, 379,
+  425, 469, 379, 380, 424, 470, 381, 427, 471, 381, 382, 426, 428, 472, 383, 427,
+  473, 384, 430, 474, 385, 429, 431, 430, 476, 387, 433, 432, 434, 478, 389, 433,
+  435, 479, 480, 390, 434, 436, 480, 481, 391, 435, 437, 481, 392, 436, 438, 393,
+  437, 439, 483, 394, 438, 440, 484, 395, 439, 441, 485, 396, 440, 442, 486, 397,
+  441, 443, 398, 442, 488, 399, 445, 399, 400, 444, 446, 490, 401, 445, 447, 402,
+  446, 448, 492, 403, 447, 493, 450, 494, 405, 449, 451, 495, 406, 450, 452, 496,
+  407, 451, 453, 408, 452, 454, 498, 453, 455, 499, 410, 454, 456, 500, 411, 455,
+  412, 458, 502, 413, 457, 459, 414, 458, 460, 504, 459, 461, 505, 415, 416, 460,
+  462, 417, 461, 463, 507, 418, 462, 464, 508, 419, 463, 465, 510, 464, 466, 510,
+  421, 465, 467, 511, 422, 466, 512, 423, 469, 513, 424, 468, 470, 514, 425, 469,
+  471, 515, 426, 470, 472, 427, 471, 473, 517, 428, 472, 518, 429, 519, 476, 431,
+  475, 477, 521, 476, 478, 522, 433, 477, 479, 523, 524, 434, 478, 480, 524, 434,
+  435, 479, 481, 525, 435, 436, 480, 482, 526, 481, 483, 527, 438, 482, 484, 528,
+  439, 483, 485, 529, 440, 484, 486, 530, 441, 485, 487, 486, 488, 532, 443, 487,
+  489, 533, 488, 490, 534, 445, 489, 491, 535, 490, 492, 536, 447, 491, 493, 537,
+  448, 492, 449, 495, 539, 450, 494, 496, 451, 495, 497, 541, 496, 542, 453, 499,
+  454, 498, 500, 544, 545, 455, 499, 501, 545, 500, 502, 457, 501, 503, 547, 502,
+  504, 548, 459, 503, 505, 549, 460, 504, 506, 550, 505, 462, 463, 509, 553, 508,
+  510, 464, 465, 509, 511, 555, 556, 466, 510, 512, 556, 467, 511, 513, 557, 468,
+  512, 514, 558, 559, 469, 513, 515, 559, 470, 514, 516, 560, 515, 517, 561, 472,
+  516, 518, 562, 473, 517, 474, 564, 521, 565, 476, 520, 522, 566, 477, 521, 567,
+  478, 524, 478, 479, 523, 525, 569, 480, 524, 526, 570, 481, 525, 527, 571, 482,
+  526, 528, 572, 483, 527, 529, 573, 484, 528, 530, 574, 485, 529, 531, 575, 530,
+  532, 576, 487, 531, 533, 577, 488, 532, 534, 578, 489, 533, 535, 579, 490, 534,
+  536, 580, 491, 535, 537, 492, 536, 538, 582, 583, 537, 583, 494, 584, 585, 541,
+  585, 496, 540, 586, 497, 543, 587, 542, 544, 588, 499, 543, 545, 499, 500, 544,
+  546, 590, 545, 547, 591, 502, 546, 548, 592, 503, 547, 593, 504, 594, 505, 551,
+  595, 550, 597, 598, 508, 554, 598, 553, 555, 599, 510, 554, 556, 600, 510, 511,
+  555, 557, 512, 556, 558, 602, 513, 557, 559, 603, 513, 514, 558, 560, 604, 515,
+  559, 561, 605, 516, 560, 562, 517, 561, 607, 564, 608, 519, 563, 565, 520, 564,
+  566, 521, 565, 567, 611, 522, 566, 568, 612, 567, 524, 570, 614, 525, 569, 571,
+  526, 570, 572, 616, 617, 527, 571, 573, 528, 572, 574, 618, 529, 573, 575, 619,
+  530, 574, 620, 621, 531, 577, 621, 532, 576, 578, 622, 533, 577, 579, 623, 534,
+  578, 580, 624, 535, 579, 581, 625, 580, 582, 626, 537, 581, 627, 537, 538, 628,
+  539, 585, 629, 539, 540, 584, 586, 630, 541, 585, 587, 631, 542, 586, 588, 632,
+  543, 587, 589, 633, 588, 590, 545, 589, 591, 635, 546, 590, 592, 636, 547, 591,
+  593, 548, 592, 594, 638, 549, 593, 639, 550, 596, 640, 595, 552, 598, 642, 552,
+  553, 597, 599, 643, 554, 598, 644, 555, 601, 645, 600, 602, 646, 557, 601, 603,
+  647, 558, 602, 604, 559, 603, 605, 649, 560, 604, 606, 650, 605, 651, 562, 563,
+  609, 653, 608, 610, 654, 609, 611, 655, 566, 610, 612, 656, 567, 611, 613, 657,
+  612, 614, 658, 569, 613, 615, 659, 614, 616, 660, 571, 615, 617, 661, 571, 616,
+  662, 573, 619, 663, 664, 574, 618, 620, 575, 619, 621, 575, 576, 620, 666, 577,
+  623, 578, 622, 579, 625, 669, 670, 580, 624, 626, 670, 581, 625, 627, 671, 582,
+  626, 628, 583, 627, 673, 584, 630, 675, 585, 629, 631, 675, 586, 630, 632, 676,
+  587, 631, 633, 677, 678, 588, 632, 634, 678, 633, 635, 679, 590, 634, 636, 591,
+  635, 637, 681, 636, 638, 593, 637, 639, 683, 594, 638, 640, 684, 595, 639, 641,
+  640, 686, 597, 643, 687, 598, 642, 644, 688, 689, 599, 643, 689, 600, 646, 690,
+  601, 645, 647, 691, 602, 646, 648, 692, 647, 649, 604, 648, 650, 605, 649, 651,
+  695, 606, 650, 652, 696, 651, 608, 654, 698, 609, 653, 655, 699, 610, 654, 656,
+  700, 701, 611, 655, 657, 701, 612, 656, 658, 702, 613, 657, 659, 703, 614, 658,
+  704, 615, 661, 705, 616, 660, 706, 617, 663, 707, 618, 662, 664, 708, 618, 663,
+  665, 709, 664, 666, 710, 711, 621, 665, 667, 711, 666, 668, 667, 669, 713, 624,
+  668, 670, 714, 624, 625, 669, 671, 715, 626, 670, 672, 671, 673, 717, 628, 672,
+  718, 675, 719, 629, 630, 674, 676, 720, 631, 675, 677, 632, 676, 722, 632, 633,
+  679, 723, 634, 678, 724, 725, 636, 682, 726, 681, 683, 727, 638, 682, 684, 728,
+  639, 683, 685, 729, 684, 686, 730, 641, 685, 687, 731, 642, 686, 688, 732, 643,
+  687, 689, 733, 734, 643, 644, 688, 690, 734, 645, 689, 691, 646, 690, 692, 736,
+  647, 691, 693, 737, 692, 694, 738, 693, 695, 739, 740, 650, 694, 696, 740, 651,
+  695, 741, 698, 742, 653, 697, 743, 654, 700, 744, 655, 699, 701, 745, 655, 656,
+  700, 746, 657, 703, 747, 658, 702, 704, 748, 659, 703, 705, 749, 660, 704, 750,
+  661, 707, 751, 662, 706, 708, 752, 663, 707, 709, 753, 664, 708, 710, 665, 709,
+  711, 755, 665, 666, 710, 756, 757, 668, 714, 758, 669, 713, 715, 759, 760, 670,
+  714, 760, 717, 761, 672, 716, 718, 762, 673, 717, 763, 674, 720, 764, 675, 719,
+  722, 766, 677, 721, 723, 767, 678, 722, 724, 679, 723, 725, 769, 680, 724, 726,
+  770, 681, 725, 727, 682, 726, 728, 772, 683, 727, 773, 684, 730, 774, 685, 729,
+  775, 686, 687, 733, 777, 688, 732, 734, 778, 688, 689, 733, 779, 736, 780, 691,
+  735, 737, 781, 692, 736, 738, 782, 693, 737, 783, 694, 740, 784, 694, 695, 739,
+  785, 696, 786, 697, 743, 787, 698, 742, 744, 788, 789, 699, 743, 745, 789, 700,
+  744, 746, 790, 701, 745, 747, 791, 702, 746, 748, 792, 703, 747, 749, 793, 704,
+  748, 794, 705, 795, 706, 752, 796, 707, 751, 797, 798, 708, 754, 798, 753, 755,
+  710, 754, 756, 800, 711, 755, 757, 801, 802, 712, 756, 758, 802, 713, 757, 759,
+  803, 714, 758, 760, 804, 714, 715, 759, 761, 805, 716, 760, 762, 806, 717, 761,
+  763, 807, 718, 762, 719, 765, 764, 810, 721, 767, 722, 766, 812, 769, 813, 724,
+  768, 770, 725, 769, 771, 815, 770, 772, 816, 727, 771, 773, 817, 728, 772, 774,
+  818, 729, 773, 775, 819, 730, 774, 776, 820, 775, 777, 821, 732, 776, 778, 733,
+  777, 779, 734, 778, 780, 824, 735, 779, 781, 825, 736, 780, 782, 737, 781, 783,
+  827, 738, 782, 784, 828, 829, 739, 783, 785, 740, 784, 786, 830, 741, 785, 742,
+  832, 743, 789, 833, 743, 744, 788, 790, 834, 745, 789, 791, 835, 746, 790, 836,
+  747, 837, 748, 794, 838, 749, 793, 795, 839, 750, 794, 796, 840, 751, 795, 841,
+  752, 798, 842, 752, 753, 797, 799, 843, 798, 800, 844, 755, 799, 801, 845, 756,
+  800, 802, 756, 757, 801, 803, 847, 758, 802, 804, 848, 759, 803, 805, 849, 760,
+  804, 806, 850, 761, 805, 807, 851, 762, 806, 808, 852, 807, 853, 810, 854, 765,
+  809, 811, 855, 810, 856, 767, 813, 857, 768, 812, 858, 860, 770, 860, 771, 817,
+  861, 772, 816, 818, 862, 773, 817, 819, 774, 818, 820, 864, 775, 819, 821, 865,
+  776, 820, 822, 866, 821, 823, 867, 822, 824, 779, 823, 825, 869, 780, 824, 826,
+  870, 825, 871, 782, 828, 872, 783, 827, 873, 783, 830, 874, 785, 829, 875, 832,
+  876, 787, 831, 833, 877, 788, 832, 834, 878, 789, 833, 879, 790, 836, 791, 835,
+  837, 881, 792, 836, 838, 882, 793, 837, 794, 840, 884, 795, 839, 841, 885, 796,
+  840, 842, 886, 797, 841, 887, 798, 844, 888, 799, 843, 845, 889, 890, 800, 844,
+  846, 890, 845, 891, 802, 892, 803, 893, 804, 850, 894, 805, 849, 851, 895, 806,
+  850, 852, 896, 807, 851, 853, 897, 808, 852, 898, 809, 855, 899, 810, 854, 856,
+  811, 855, 857, 901, 812, 856, 858, 902, 813, 857, 859, 858, 860, 904, 814, 815,
+  859, 861, 905, 816, 860, 862, 817, 861, 863, 907, 862, 908, 819, 865, 909, 820,
+  864, 866, 821, 865, 867, 822, 866, 868, 912, 867, 869, 913, 824, 868, 870, 914,
+  825, 869, 871, 915, 826, 870, 872, 916, 917, 827, 871, 873, 917, 828, 872, 874,
+  918, 829, 873, 875, 919, 830, 874, 831, 921, 832, 878, 922, 833, 877, 879, 834,
+  878, 880, 924, 879, 881, 925, 836, 880, 882, 926, 837, 881, 883, 927, 882, 884,
+  928, 839, 883, 885, 929, 840, 884, 886, 841, 885, 887, 931, 842, 886, 888, 932,
+  843, 887, 889, 933, 844, 888, 890, 934, 844, 845, 889, 891, 935, 846, 890, 892,
+  847, 891, 893, 937, 848, 892, 894, 938, 939, 849, 893, 895, 939, 850, 894, 896,
+  940, 851, 895, 897, 941, 852, 896, 898, 942, 853, 897, 943, 854, 944, 901, 945,
+  856, 900, 902, 946, 857, 901, 903, 902, 904, 948, 859, 903, 905, 949, 860, 904,
+  906, 950, 905, 951, 862, 952, 863, 909, 953, 864, 908, 954, 911, 955, 910, 912,
+  956, 867, 911, 913, 868, 912, 914, 958, 869, 913, 915, 959, 870, 914, 916, 960,
+  871, 915, 917, 961, 871, 872, 916, 918, 962, 873, 917, 919, 963, 874, 918, 921,
+  965, 876, 920, 922, 966, 877, 921, 923, 967, 922, 924, 968, 879, 923, 925, 880,
+  924, 926, 970, 881, 925, 927, 971, 882, 926, 883, 929, 973, 884, 928, 930, 974,
+  929, 931, 975, 886, 930, 932, 976, 887, 931, 933, 977, 888, 932, 978, 889, 935,
+  980, 890, 934, 936, 980, 935, 937, 981, 892, 936, 938, 982, 893, 937, 939, 983,
+  893, 894, 938, 940, 984, 895, 939, 985, 896, 942, 986, 897, 941, 943, 987, 898,
+  942, 988, 899, 945, 989, 900, 944, 946, 990, 901, 945, 991, 992, 948, 992, 903,
+  947, 949, 993, 904, 948, 994, 905, 951, 995, 906, 950, 952, 996, 907, 951, 953,
+  997, 908, 952, 998, 909, 955, 910, 954, 956, 1000, 911, 955, 957, 1001, 1002, 956,
+  958, 1002, 1003, 913, 957, 959, 1003, 914, 958, 960, 1004, 915, 959, 961, 916, 960,
+  962, 1006, 917, 961, 918, 964, 1008, 1009, 963, 1009, 920, 966, 921, 965, 967, 1011,
+  922, 966, 968, 1012, 923, 967, 969, 1013, 968, 970, 1014, 1015, 925, 969, 971, 1015,
+  926, 970, 972, 1016, 971, 973, 928, 972, 974, 929, 973, 975, 930, 974, 976, 931,
+  975, 977, 932, 976, 978, 1022, 933, 977, 979, 1023, 978, 980, 934, 935, 979, 981,
+  936, 980, 982, 1026, 937, 981, 983, 1027, 938, 982, 984, 1028, 939, 983, 985, 1029,
+  940, 984, 1030, 941, 987, 1031, 942, 986, 1032, 943, 944, 990, 1034, 945, 989, 991,
+  1035, 946, 990, 992, 1036, 946, 947, 991, 993, 1037, 948, 992, 1038, 949, 1039, 950,
+  1040, 951, 997, 1041, 952, 996, 998, 1042, 953, 997, 999, 1043, 998, 1000, 1044, 955,
+  999, 1001, 1045, 956, 1000, 1002, 1046, 956, 957, 1001, 1003, 1047, 957, 958, 1002, 1004,
+  959, 1003, 1005, 1049, 1004, 1006, 1050, 961, 1005, 1008, 963, 1007, 1009, 1053, 963, 964,
+  1008, 1010, 1009, 1011, 1055, 966, 1010, 1012, 1056, 967, 1011, 1013, 1057, 968, 1012, 1014,
+  1058, 969, 1013, 1059, 969, 970, 1016, 1060, 971, 1015, 1017, 1061, 1016, 1062, 1019, 1063,
+  1018, 1064, 1021, 1065, 1066, 1020, 1022, 1066, 977, 1021, 1023, 1067, 978, 1022, 1024, 1068,
+  1023, 1025, 1024, 1026, 1070, 981, 1025, 1027, 1071, 982, 1026, 1028, 1072, 983, 1027, 1029,
+  1073, 984, 1028, 1030, 1074, 1075, 985, 1029, 1075, 986, 1076, 987, 1033, 1077, 1032, 1078,
+  989, 1035, 1079, 1080, 990, 1034, 1036, 1080, 991, 1035, 1037, 1081, 992, 1036, 1038, 1082,
+  993, 1037, 1083, 994, 1040, 1084, 995, 1039, 1041, 996, 1040, 1086, 997, 1043, 1088, 998,
+  1042, 1044, 1088, 1089, 999, 1043, 1045, 1089, 1000, 1044, 1046, 1090, 1001, 1045, 1047, 1091,
+  1002, 1046, 1048, 1092, 1047, 1049, 1093, 1094, 1004, 1048, 1094, 1095, 1005, 1051, 1095, 1050,
+  1096, 1053, 1097, 1008, 1052, 1055, 1099, 1010, 1054, 1056, 1011, 1055, 1057, 1101, 1012, 1056,
+  1102, 1013, 1059, 1103, 1014, 1058, 1015, 1105, 1106, 1016, 1062, 1106, 1107, 1017, 1061, 1063,
+  1018, 1062, 1064, 1108, 1019, 1063, 1065, 1020, 1064, 1066, 1110, 1020, 1021, 1065, 1111, 1022,
+  1068, 1112, 1023, 1067, 1069, 1068, 1114, 1025, 1115, 1026, 1072, 1116, 1027, 1071, 1073, 1117,
+  1028, 1072, 1074, 1118, 1029, 1073, 1075, 1119, 1029, 1030, 1074, 1076, 1120, 1031, 1075, 1077,
+  1121, 1032, 1076, 1078, 1122, 1033, 1077, 1034, 1080, 1124, 1034, 1035, 1079, 1081, 1125, 1036,
+  1080, 1082, 1126, 1127, 1037, 1081, 1083, 1127, 1038, 1082, 1084, 1128, 1039, 1083, 1085, 1084,
+  1086, 1130, 1041, 1085, 1131, 1132, 1132, 1042, 1043, 1089, 1133, 1043, 1044, 1088, 1045, 1091,
+  1046, 1090, 1092, 1136, 1047, 1091, 1093, 1137, 1048, 1092, 1094, 1138, 1048, 1049, 1093, 1095,
+  1139, 1049, 1050, 1094, 1096, 1140, 1051, 1095, 1097, 1141, 1052, 1096, 1098, 1142, 1097, 1143,
+  1054, 1100, 1144, 1099, 1101, 1145, 1146, 1056, 1100, 1102, 1146, 1057, 1101, 1103, 1147, 1058,
+  1102, 1104, 1148, 1103, 1105, 1149, 1060, 1104, 1106, 1150, 1060, 1061, 1105, 1107, 1151, 1061,
+  1106, 1108, 1063, 1107, 1109, 1153, 1108, 1110, 1065, 1109, 1155, 1066, 1112, 1156, 1067, 1111,
+  1113, 1157, 1112, 1114, 1069, 1113, 1159, 1070, 1160, 1071, 1117, 1072, 1116, 1118, 1162, 1073,
+  1117, 1119, 1163, 1074, 1118, 1120, 1164, 1075, 1119, 1121, 1165, 1166, 1076, 1120, 1122, 1166,
+  1077, 1121, 1123, 1167, 1122, 1168, 1079, 1125, 1169, 1080, 1124, 1126, 1170, 1081, 1125, 1127,
+  1171, 1081, 1082, 1126, 1128, 1083, 1127, 1173, 1174, 1085, 1086, 1132, 1176, 1086, 1087, 1131,
+  1133, 1088, 1132, 1134, 1133, 1135, 1134, 1136, 1180, 1091, 1135, 1181, 1092, 1138, 1182, 1093,
+  1137, 1139, 1183, 1094, 1138, 1140, 1184, 1095, 1139, 1141, 1096, 1140, 1186, 1097, 1143, 1187,
+  1098, 1142, 1188, 1099, 1145, 1189, 1100, 1144, 1100, 1101, 1147, 1191, 1102, 1146, 1192, 1193,
+  1103, 1193, 1104, 1150, 1194, 1105, 1149, 1151, 1196, 1106, 1150, 1152, 1151, 1153, 1197, 1198,
+  1108, 1152, 1154, 1198, 1153, 1155, 1199, 1110, 1154, 1156, 1200, 1111, 1155, 1157, 1201, 1112,
+  1156, 1158, 1202, 1157, 1159, 1203, 1114, 1158, 1160, 1204, 1115, 1159, 1161, 1206, 1160, 1162,
+  1206, 1117, 1161, 1163, 1207, 1208, 1118, 1162, 1208, 1119, 1165, 1210, 1120, 1164, 1166, 1210,
+  1120, 1121, 1165, 1167, 1211, 1122, 1166, 1212, 1123, 1213, 1124, 1170, 1214, 1125, 1169, 1171,
+  1215, 1126, 1170, 1172, 1216, 1171, 1173, 1217, 1128, 1172, 1174, 1129, 1173, 1175, 1219, 1220,
+  1174, 1176, 1131, 1175, 1177, 1221, 1176, 1222, 1179, 1223, 1178, 1180, 1224, 1135, 1179, 1181,
+  1225, 1136, 1180, 1182, 1226, 1137, 1181, 1183, 1227, 1228, 1138, 1182, 1184, 1228, 1139, 1183,
+  1185, 1229, 1184, 1186, 1230, 1141, 1185, 1187, 1231, 1142, 1186, 1188, 1232, 1143, 1187, 1233,
+  1144, 1190, 1189, 1191, 1235, 1146, 1190, 1236, 1147, 1237, 1147, 1148, 1194, 1238, 1149, 1193,
+  1195, 1239, 1194, 1196, 1240, 1150, 1195, 1197, 1241, 1152, 1196, 1198, 1242, 1152, 1153, 1197,
+  1199, 1243, 1154, 1198, 1200, 1155, 1199, 1245, 1156, 1202, 1157, 1201, 1203, 1247, 1158, 1202,
+  1204, 1248, 1159, 1203, 1205, 1249, 1250, 1204, 1206, 1250, 1160, 1161, 1205, 1207, 1251, 1162,
+  1206, 1208, 1162, 1163, 1207, 1209, 1253, 1208, 1210, 1254, 1164, 1165, 1209, 1211, 1255, 1166,
+  1210, 1212, 1256, 1167, 1211, 1213, 1257, 1168, 1212, 1258, 1169, 1215, 1170, 1214, 1216, 1260,
+  1171, 1215, 1261, 1262, 1172, 1218, 1217, 1219, 1263, 1174, 1218, 1220, 1264, 1174, 1219, 1221,
+  1265, 1176, 1220, 1222, 1266, 1267, 1177, 1221, 1223, 1267, 1178, 1222, 1224, 1268, 1179, 1223,
+  1225, 1180, 1224, 1226, 1181, 1225, 1227, 1271, 1182, 1226, 1228, 1272, 1182, 1183, 1227, 1229,
+  1273, 1184, 1228, 1230, 1274, 1185, 1229, 1231, 1275, 1186, 1230, 1276, 1187, 1233, 1277, 1188,
+  1232, 1234, 1278, 1233, 1279, 1190, 1236, 1280, 1191, 1235, 1237, 1281, 1192, 1236, 1282, 1193,
+  1239, 1194, 1238, 1240, 1195, 1239, 1241, 1285, 1196, 1240, 1242, 1286, 1197, 1241, 1287, 1198,
+  1244, 1288, 1243, 1289, 1200, 1246, 1290, 1245, 1247, 1291, 1202, 1246, 1248, 1292, 1203, 1247,
+  1249, 1293, 1204, 1248, 1250, 1294, 1204, 1205, 1249, 1251, 1295, 1206, 1250, 1252, 1296, 1251,
+  1253, 1297, 1208, 1252, 1209, 1299, 1210, 1256, 1300, 1211, 1255, 1301, 1212, 1258, 1302, 1213,
+  1257, 1260, 1303, 1215, 1259, 1261, 1216, 1260, 1216, 1263, 1306, 1218, 1262, 1264, 1307, 1219,
+  1263, 1265, 1308, 1220, 1264, 1266, 1221, 1265, 1267, 1310, 1221, 1222, 1266, 1268, 1223, 1267,
+  1312, 1270, 1313, 1314, 1269, 1271, 1314, 1226, 1270, 1272, 1315, 1227, 1271, 1316, 1228, 1274,
+  1317, 1229, 1273, 1275, 1318, 1230, 1274, 1276, 1231, 1275, 1277, 1232, 1276, 1278, 1233, 1277,
+  1279, 1322, 1323, 1234, 1278, 1323, 1235, 1324, 1236, 1282, 1325, 1237, 1281, 1283, 1282, 1284,
+  1327, 1283, 1285, 1329, 1240, 1284, 1286, 1329, 1241, 1285, 1330, 1242, 1288, 1331, 1243, 1287,
+  1289, 1332, 1244, 1288, 1290, 1333, 1245, 1289, 1291, 1334, 1246, 1290, 1292, 1335, 1247, 1291,
+  1293, 1336, 1248, 1292, 1294, 1337, 1249, 1293, 1338, 1250, 1296, 1339, 1251, 1295, 1297, 1340,
+  1252, 1296, 1298, 1341, 1297, 1299, 1342, 1254, 1298, 1300, 1343, 1344, 1255, 1299, 1301, 1344,
+  1256, 1300, 1302, 1345, 1257, 1301, 1346, 1259, 1305, 1349, 1304, 1262, 1307, 1263, 1306, 1308,
+  1352, 1264, 1307, 1353, 1310, 1354, 1266, 1309, 1311, 1355, 1310, 1312, 1356, 1268, 1311, 1357,
+  1358, 1269, 1314, 1358, 1269, 1270, 1313, 1315, 1359, 1271, 1314, 1316, 1360, 1272, 1315, 1317,
+  1361, 1273, 1316, 1318, 1274, 1317, 1319, 1363, 1318, 1320, 1364, 1319, 1321, 1365, 1320, 1322,
+  1366, 1367, 1278, 1321, 1323, 1367, 1278, 1279, 1322, 1368, 1280, 1369, 1281, 1326, 1370, 1325,
+  1327, 1371, 1283, 1326, 1328, 1372, 1327, 1329, 1373, 1284, 1285, 1328, 1286, 1331, 1375, 1287,
+  1330, 1332, 1376, 1288, 1331, 1377, 1289, 1334, 1378, 1290, 1333, 1335, 1379, 1291, 1334, 1336,
+  1380, 1292, 1335, 1293, 1338, 1294, 1337, 1383, 1295, 1340, 1384, 1296, 1339, 1297, 1342, 1386,
+  1298, 1341, 1343, 1387, 1299, 1342, 1344, 1388, 1389, 1299, 1300, 1343, 1345, 1301, 1344, 1346,
+  1390, 1302, 1345, 1347, 1391, 1346, 1349, 1304, 1348, 1394, 1395, 1351, 1350, 1352, 1396, 1307,
+  1351, 1353, 1308, 1352, 1354, 1398, 1309, 1353, 1355, 1399, 1310, 1354, 1356, 1400, 1311, 1355,
+  1357, 1401, 1312, 1356, 1358, 1402, 1312, 1313, 1357, 1359, 1403, 1314, 1358, 1360, 1404, 1315,
+  1359, 1361, 1405, 1406, 1316, 1360, 1362, 1406, 1361, 1363, 1407, 1318, 1362, 1364, 1319, 1363,
+  1409, 1320, 1366, 1410, 1321, 1365, 1367, 1411, 1321, 1322, 1366, 1368, 1412, 1323, 1367, 1414,
+  1324, 1325, 1371, 1415, 1326, 1370, 1372, 1416, 1327, 1371, 1373, 1417, 1328, 1372, 1418, 1375,
+  1330, 1374, 1376, 1420, 1331, 1375, 1377, 1332, 1376, 1378, 1422, 1333, 1377, 1379, 1423, 1334,
+  1378, 1380, 1424, 1335, 1379, 1381, 1425, 1380, 1382, 1381, 1383, 1427, 1338, 1382, 1384, 1339,
+  1383, 1385, 1429, 1384, 1386, 1341, 1385, 1387, 1431, 1432, 1342, 1386, 1388, 1432, 1343, 1387,
+  1389, 1433, 1343, 1388, 1390, 1345, 1389, 1391, 1435, 1346, 1390, 1392, 1436, 1437, 1391, 1437,
+  1394, 1349, 1393, 1395, 1439, 1349, 1394, 1396, 1440, 1351, 1395, 1397, 1396, 1398, 1442, 1353,
+  1397, 1399, 1354, 1398, 1400, 1355, 1399, 1401, 1445, 1356, 1400, 1402, 1446, 1357, 1401, 1403,
+  1447, 1358, 1402, 1404, 1448, 1359, 1403, 1405, 1449, 1360, 1404, 1406, 1450, 1360, 1361, 1405,
+  1451, 1362, 1408, 1452, 1407, 1409, 1453, 1364, 1408, 1410, 1454, 1365, 1409, 1411, 1366, 1410,
+  1412, 1456, 1457, 1367, 1411, 1413, 1457, 1412, 1414, 1458, 1368, 1413, 1459, 1370, 1416, 1460,
+  1371, 1415, 1417, 1372, 1416, 1418, 1462, 1373, 1417, 1463, 1420, 1464, 1375, 1419, 1421, 1420,
+  1422, 1466, 1377, 1421, 1423, 1467, 1378, 1422, 1424, 1468, 1469, 1379, 1423, 1469, 1380, 1426,
+  1470, 1425, 1471, 1472, 1382, 1428, 1472, 1427, 1429, 1473, 1384, 1428, 1474, 1431, 1475, 1386,
+  1430, 1432, 1386, 1387, 1431, 1433, 1477, 1478, 1388, 1432, 1435, 1479, 1390, 1434, 1436, 1480,
+  1391, 1435, 1437, 1481, 1391, 1392, 1436, 1482, 1439, 1483, 1394, 1438, 1440, 1484, 1395, 1439,
+  1441, 1485, 1440, 1442, 1486, 1397, 1441, 1443, 1442, 1444, 1488, 1443, 1445, 1400, 1444, 1490,
+  1401, 1447, 1491, 1492, 1402, 1446, 1492, 1493, 1403, 1449, 1493, 1404, 1448, 1450, 1494, 1405,
+  1449, 1451, 1406, 1450, 1452, 1496, 1407, 1451, 1497, 1408, 1498, 1409, 1455, 1499, 1454, 1500,
+  1411, 1457, 1501, 1411, 1412, 1456, 1458, 1413, 1457, 1459, 1503, 1414, 1458, 1415, 1461, 1460,
+  1462, 1506, 1417, 1461, 1463, 1507, 1418, 1462, 1464, 1508, 1419, 1463, 1466, 1421, 1465, 1422,
+  1468, 1512, 1423, 1467, 1469, 1513, 1423, 1424, 1468, 1470, 1514, 1425, 1469, 1471, 1426, 1470,
+  1472, 1516, 1517, 1426, 1427, 1471, 1517, 1518, 1428, 1474, 1429, 1473, 1475, 1519, 1430, 1474,
+  1477, 1520, 1432, 1476, 1478, 1521, 1432, 1477, 1479, 1522, 1434, 1478, 1480, 1435, 1479, 1481,
+  1524, 1436, 1480, 1482, 1525, 1437, 1481, 1438, 1484, 1527, 1528, 1439, 1483, 1485, 1440, 1484,
+  1486, 1529, 1441, 1485, 1530, 1488, 1531, 1443, 1487, 1489, 1532, 1488, 1490, 1533, 1445, 1489,
+  1446, 1492, 1535, 1446, 1447, 1491, 1493, 1536, 1447, 1448, 1492, 1449, 1495, 1538, 1494, 1496,
+  1539, 1451, 1495, 1540, 1452, 1498, 1541, 1542, 1453, 1497, 1499, 1542, 1454, 1498, 1500, 1543,
+  1544, 1455, 1499, 1501, 1544, 1456, 1500, 1502, 1545, 1501, 1503, 1546, 1458, 1502, 1504, 1547,
+  1548, 1503, 1505, 1548, 1504, 1549, 1461, 1550, 1462, 1508, 1551, 1463, 1507, 1552, 1510, 1553,
+  1509, 1511, 1554, 1510, 1512, 1555, 1467, 1511, 1513, 1556, 1468, 1512, 1514, 1557, 1469, 1513,
+  1515, 1514, 1516, 1559, 1471, 1515, 1517, 1560, 1471, 1472, 1516, 1518, 1561, 1472, 1517, 1519,
+  1562, 1474, 1518, 1563, 1564, 1476, 1521, 1565, 1477, 1520, 1522, 1566, 1478, 1521, 1523, 1567,
+  1522, 1568, 1480, 1569, 1481, 1526, 1570, 1525, 1483, 1528, 1572, 1483, 1527, 1573, 1485, 1530,
+  1486, 1529, 1575, 1487, 1532, 1576, 1488, 1531, 1577, 1578, 1489, 1534, 1578, 1533, 1535, 1579,
+  1491, 1534, 1536, 1580, 1492, 1535, 1581, 1538, 1582, 1494, 1537, 1539, 1583, 1495, 1538, 1496,
+  1541, 1585, 1586, 1497, 1540, 1542, 1497, 1498, 1541, 1543, 1587, 1499, 1542, 1544, 1588, 1499,
+  1500, 1543, 1545, 1589, 1501, 1544, 1546, 1590, 1502, 1545, 1547, 1591, 1503, 1546, 1548, 1503,
+  1504, 1547, 1549, 1593, 1505, 1548, 1550, 1594, 1506, 1549, 1551, 1595, 1507, 1550, 1552, 1508,
+  1551, 1553, 1597, 1509, 1552, 1554, 1599, 1510, 1553, 1555, 1599, 1511, 1554, 1556, 1600, 1512,
+  1555, 1557, 1602, 1513, 1556, 1602, 1603, 1515, 1560, 1604, 1516, 1559, 1605, 1517, 1562, 1518,
+  1561, 1607, 1519, 1608, 1609, 1519, 1565, 1609, 1520, 1564, 1566, 1610, 1521, 1565, 1567, 1611,
+  1522, 1566, 1568, 1612, 1523, 1567, 1569, 1613, 1524, 1568, 1525, 1571, 1615, 1570, 1616, 1527,
+  1573, 1617, 1528, 1572, 1575, 1619, 1530, 1574, 1576, 1531, 1575, 1532, 1578, 1622, 1532, 1533,
+  1577, 1579, 1623, 1534, 1578, 1580, 1535, 1579, 1581, 1536, 1580, 1582, 1626, 1537, 1581, 1583,
+  1627, 1538, 1582, 1584, 1628, 1583, 1585, 1629, 1540, 1584, 1586, 1630, 1540, 1585, 1631, 1542,
+  1588, 1632, 1543, 1587, 1633, 1544, 1590, 1545, 1589, 1591, 1635, 1546, 1590, 1592, 1636, 1591,
+  1593, 1637, 1548, 1592, 1594, 1638, 1549, 1593, 1639, 1550, 1596, 1595, 1597, 1641, 1552, 1596,
+  1598, 1642, 1597, 1643, 1644, 1553, 1554, 1555, 1601, 1645, 1600, 1602, 1556, 1557, 1601, 1647,
+  1558, 1604, 1648, 1649, 1559, 1603, 1605, 1649, 1560, 1604, 1606, 1650, 1605, 1607, 1651, 1562,
+  1606, 1608, 1563, 1607, 1609, 1653, 1563, 1564, 1608, 1610, 1565, 1609, 1611, 1566, 1610, 1656,
+  1567, 1613, 1657, 1568, 1612, 1614, 1658, 1659, 1613, 1615, 1570, 1614, 1660, 1661, 1571, 1661,
+  1572, 1662, 1619, 1663, 1574, 1618, 1620, 1664, 1619, 1621, 1665, 1620, 1622, 1666, 1577, 1621,
+  1578, 1624, 1668, 1623, 1625, 1669, 1624, 1626, 1581, 1625, 1627, 1671, 1582, 1626, 1583, 1629,
+  1673, 1584, 1628, 1630, 1674, 1585, 1629, 1631, 1675, 1586, 1630, 1676, 1587, 1633, 1677, 1588,
+  1632, 1634, 1633, 1635, 1679, 1590, 1634, 1636, 1680, 1591, 1635, 1637, 1681, 1592, 1636, 1682,
+  1593, 1639, 1683, 1594, 1638, 1640, 1684, 1639, 1685, 1596, 1686, 1597, 1643, 1598, 1642, 1598,
+  1645, 1689, 1600, 1644, 1690, 1647, 1691, 1602, 1646, 1648, 1692, 1693, 1603, 1647, 1649, 1693,
+  1603, 1604, 1648, 1605, 1651, 1695, 1606, 1650, 1696, 1653, 1697, 1608, 1652, 1698, 1655, 1699,
+  1654, 1656, 1700, 1701, 1611, 1655, 1657, 1701, 1612, 1656, 1658, 1702, 1613, 1657, 1659, 1703,
+  1613, 1658, 1660, 1704, 1705, 1615, 1659, 1661, 1705, 1615, 1616, 1660, 1706, 1617, 1707, 1618,
+  1664, 1708, 1619, 1663, 1665, 1709, 1620, 1664, 1666, 1710, 1621, 1665, 1711, 1668, 1623, 1667,
+  1669, 1713, 1624, 1668, 1670, 1714, 1669, 1671, 1715, 1626, 1670, 1716, 1673, 1717, 1628, 1672,
+  1674, 1718, 1629, 1673, 1675, 1719, 1630, 1674, 1676, 1720, 1631, 1675, 1677, 1721, 1632, 1676,
+  1678, 1722, 1677, 1679, 1723, 1634, 1678, 1680, 1724, 1635, 1679, 1681, 1636, 1680, 1682, 1726,
+  1637, 1681, 1683, 1638, 1682, 1684, 1728, 1639, 1683, 1685, 1729, 1640, 1684, 1730, 1641, 1687,
+  1686, 1688, 1732, 1733, 1687, 1689, 1733, 1644, 1688, 1690, 1734, 1645, 1689, 1691, 1735, 1646,
+  1690, 1647, 1693, 1737, 1647, 1648, 1692, 1694, 1738, 1693, 1695, 1739, 1650, 1694, 1740, 1651,
+  1697, 1652, 1696, 1742, 1653, 1699, 1743, 1654, 1698, 1700, 1744, 1745, 1655, 1699, 1701, 1745,
+  1655, 1656, 1700, 1746, 1657, 1703, 1747, 1658, 1702, 1704, 1748, 1749, 1659, 1703, 1705, 1749,
+  1659, 1660, 1704, 1706, 1661, 1705, 1751, 1662, 1708, 1752, 1663, 1707, 1709, 1753, 1664, 1708,
+  1710, 1665, 1709, 1755, 1666, 1712, 1711, 1713, 1757, 1668, 1712, 1714, 1669, 1713, 1715, 1670,
+  1714, 1671, 1717, 1672, 1716, 1762, 1673, 1719, 1763, 1674, 1718, 1720, 1764, 1675, 1719, 1765,
+  1766, 1676, 1722, 1766, 1677, 1721, 1723, 1767, 1678, 1722, 1768, 1679, 1725, 1769, 1724, 1726,
+  1770, 1681, 1725, 1727, 1726, 1728, 1772, 1683, 1727, 1773, 1684, 1774, 1685, 1731, 1775, 1730,
+  1687, 1733, 1777, 1687, 1688, 1732, 1734, 1689, 1733, 1735, 1779, 1690, 1734, 1736, 1780, 1735,
+  1781, 1782, 1692, 1782, 1693, 1739, 1783, 1694, 1738, 1740, 1784, 1695, 1739, 1741, 1785, 1740,
+  1742, 1786, 1697, 1741, 1743, 1787, 1698, 1742, 1744, 1788, 1699, 1743, 1745, 1789, 1699, 1700,
+  1744, 1746, 1790, 1701, 1745, 1747, 1702, 1746, 1748, 1792, 1703, 1747, 1793, 1703, 1704, 1750,
+  1794, 1749, 1751, 1795, 1706, 1750, 1796, 1707, 1753, 1797, 1708, 1752, 1754, 1798, 1753, 1755,
+  1799, 1710, 1754, 1756, 1800, 1755, 1757, 1801, 1712, 1756, 1802, 1759, 1803, 1758, 1760, 1804,
+  1805, 1759, 1761, 1805, 1760, 1762, 1806, 1717, 1761, 1807, 1718, 1808, 1719, 1765, 1809, 1720,
+  1764, 1810, 1720, 1721, 1722, 1768, 1812, 1723, 1767, 1769, 1813, 1814, 1724, 1768, 1725, 1771,
+  1815, 1770, 1772, 1816, 1727, 1771, 1773, 1817, 1728, 1772, 1774, 1818, 1729, 1773, 1775, 1819,
+  1730, 1774, 1776, 1820, 1775, 1821, 1732, 1778, 1822, 1777, 1779, 1823, 1734, 1778, 1780, 1824,
+  1735, 1779, 1781, 1736, 1780, 1782, 1826, 1736, 1737, 1781, 1827, 1738, 1784, 1828, 1739, 1783,
+  1785, 1829, 1740, 1784, 1786, 1830, 1741, 1785, 1787, 1831, 1832, 1742, 1786, 1788, 1832, 1743,
+  1787, 1789, 1833, 1744, 1788, 1790, 1834, 1745, 1789, 1791, 1835, 1790, 1792, 1836, 1747, 1791,
+  1793, 1837, 1748, 1792, 1794, 1838, 1839, 1749, 1793, 1795, 1839, 1750, 1794, 1796, 1751, 1795,
+  1752, 1798, 1753, 1797, 1799, 1754, 1798, 1800, 1755, 1799, 1801, 1756, 1800, 1802, 1757, 1801,
+  1803, 1758, 1802, 1804, 1759, 1803, 1805, 1759, 1760, 1804, 1806, 1761, 1805, 1807, 1762, 1806,
+  1808, 1763, 1807, 1809, 1764, 1808, 1810, 1765, 1809, 1811, 1810, 1812, 1767, 1811, 1813, 1768,
+  1812, 1768, 1815, 1770, 1814, 1816, 1771, 1815, 1817, 1772, 1816, 1773, 1819, 1774, 1818, 1820,
+  1775, 1819, 1821, 1776, 1820, 1777, 1778, 1824, 1779, 1823, 1825, 1824, 1826, 1781, 1825, 1827,
+  1782, 1826, 1828, 1783, 1827, 1829, 1784, 1828, 1830, 1785, 1829, 1831, 1786, 1830, 1786, 1787,
+  1833, 1788, 1832, 1834, 1789, 1833, 1835, 1790, 1834, 1791, 1837, 1792, 1836, 1838, 1793, 1837,
+  1839, 1793, 1794, 1838, 1840, 1839, 1841, 1840
+};
+
+static const uint16_t EDGE_LENGTH_M[] PROGMEM = {
+  93, 196, 93, 215, 164, 215, 158, 212, 92, 212, 172, 182, 172, 161, 155, 161,
+  200, 193, 258, 200, 134, 221, 134, 169, 169, 168, 168, 236, 145, 236, 102, 156,
+  102, 186, 182, 255, 255, 101, 101, 269, 199, 269, 169, 229, 169, 134, 177, 134,
+  169, 111, 148, 225, 148, 145, 199, 128, 254, 199, 138, 195, 138, 210, 194, 210,
+  175, 228, 175, 148, 219, 148, 192, 192, 192, 193, 193, 219, 105, 219, 96, 135,
+  96, 157, 183, 157, 221, 212, 221, 199, 96, 199, 227, 133, 150, 227, 159, 182,
+  305, 159, 190, 190, 244, 139, 274, 139, 102, 234, 102, 226, 160, 226, 149, 194,
+  149, 196, 202, 164, 202, 132, 158, 209, 188, 92, 209, 186, 182, 155, 207, 193,
+  124, 209, 258, 221, 124, 137, 181, 137, 151, 192, 151, 195, 256, 145, 195, 126,
+  156, 126, 192, 186, 192, 174, 182, 94, 159, 141, 159, 157, 199, 129, 173, 229,
+  129, 157, 152, 177, 157, 214, 169, 214, 149, 180, 111, 149, 205, 181, 225, 205,
+  161, 124, 145, 161, 128, 158, 274, 254, 195, 158, 256, 115, 194, 256, 119, 153,
+  228, 119, 146, 110, 219, 146, 240, 134, 192, 240, 188, 150, 117, 242, 105, 150,
+  265, 135, 265, 100, 183, 100, 229, 148, 212, 229, 135, 217, 96, 135, 134, 153,
+  133, 134, 156, 204, 226, 150, 182, 156, 215, 181, 305, 215, 121, 244, 121, 175,
+  149, 274, 175, 218, 174, 218, 159, 234, 159, 157, 160, 226, 249, 259, 194, 226,
+  215, 164, 215, 209, 118, 211, 132, 118, 232, 188, 232, 123, 155, 186, 123, 185,
+  203, 216, 185, 203, 207, 203, 116, 209, 116, 191, 154, 181, 191, 105, 228, 192,
+  193, 234, 256, 193, 149, 101, 219, 149, 205, 226, 205, 182, 222, 174, 182, 175,
+  94, 175, 136, 188, 141, 136, 168, 204, 157, 168, 179, 260, 173, 179, 201, 152,
+  201, 221, 211, 221, 142, 177, 180, 142, 163, 269, 181, 163, 124, 191, 191, 191,
+  180, 185, 180, 122, 274, 115, 171, 153, 171, 220, 110, 220, 124, 134, 124, 219,
+  188, 219, 132, 154, 117, 132, 166, 242, 125, 170, 156, 148, 170, 140, 216, 217,
+  140, 195, 145, 153, 195, 259, 204, 226, 181, 183, 183, 168, 149, 224, 167, 174,
+  224, 119, 171, 119, 188, 134, 157, 188, 146, 163, 249, 146, 209, 117, 259, 164,
+  209, 130, 210, 209, 130, 111, 211, 212, 211, 235, 212, 124, 260, 155, 124, 166,
+  170, 241, 203, 166, 174, 178, 216, 174, 208, 157, 208, 149, 207, 280, 154, 149,
+  174, 144, 105, 174, 193, 158, 228, 193, 150, 234, 101, 150, 216, 262, 219, 226,
+  137, 222, 220, 147, 220, 113, 188, 113, 176, 208, 204, 176, 219, 173, 213, 260,
+  219, 130, 128, 130, 225, 164, 211, 225, 187, 180, 177, 187, 165, 133, 269, 165,
+  162, 87, 162, 125, 191, 125, 163, 185, 125, 218, 131, 122, 218, 169, 247, 150,
+  247, 114, 210, 114, 210, 127, 210, 197, 166, 154, 197, 132, 166, 203, 125, 203,
+  196, 156, 182, 91, 216, 182, 88, 162, 145, 88, 176, 236, 259, 176, 199, 119,
+  199, 163, 162, 163, 257, 159, 168, 257, 146, 167, 246, 178, 171, 246, 94, 96,
+  134, 94, 188, 163, 188, 221, 167, 117, 221, 199, 210, 184, 148, 111, 184, 205,
+  211, 171, 160, 235, 171, 227, 218, 260, 170, 227, 152, 241, 178, 133, 157, 201,
+  207, 201, 219, 150, 280, 144, 219, 139, 158, 139, 152, 219, 152, 204, 180, 216,
+  204, 151, 95, 262, 137, 151, 182, 180, 147, 182, 148, 148, 116, 161, 208, 116,
+  161, 173, 161, 213, 128, 161, 194, 164, 222, 157, 180, 222, 108, 133, 108, 211,
+  204, 87, 211, 183, 277, 275, 125, 183, 167, 165, 163, 167, 135, 178, 131, 135,
+  123, 169, 190, 150, 164, 233, 210, 164, 160, 196, 127, 160, 166, 147, 132, 147,
+  239, 160, 196, 168, 91, 176, 162, 176, 177, 133, 236, 177, 121, 107, 119, 121,
+  168, 179, 162, 168, 162, 208, 159, 162, 240, 138, 146, 240, 156, 220, 178, 156,
+  96, 139, 226, 139, 181, 168, 167, 181, 184, 199, 160, 195, 148, 160, 210, 156,
+  205, 210, 177, 160, 187, 197, 218, 187, 152, 138, 215, 133, 138, 169, 169, 153,
+  137, 150, 153, 159, 157, 259, 219, 157, 226, 180, 226, 160, 175, 273, 95, 160,
+  192, 258, 180, 192, 177, 167, 177, 203, 200, 161, 203, 147, 183, 161, 147, 136,
+  170, 136, 207, 142, 194, 207, 152, 153, 157, 152, 163, 209, 163, 167, 109, 204,
+  167, 123, 117, 277, 123, 165, 190, 275, 165, 165, 147, 178, 198, 123, 198, 167,
+  242, 190, 167, 163, 142, 233, 196, 142, 138, 144, 138, 227, 152, 227, 167, 239,
+  167, 168, 156, 235, 160, 168, 169, 168, 119, 216, 119, 178, 133, 178, 174, 167,
+  107, 174, 206, 233, 179, 206, 88, 170, 208, 88, 240, 171, 138, 240, 145, 146,
+  220, 145, 151, 196, 131, 226, 196, 184, 168, 79, 171, 184, 79, 248, 180, 195,
+  248, 141, 173, 156, 141, 249, 199, 246, 177, 249, 198, 197, 113, 172, 113, 164,
+  222, 215, 103, 137, 258, 169, 159, 258, 216, 259, 192, 106, 192, 184, 172, 281,
+  175, 184, 131, 273, 258, 130, 216, 167, 204, 212, 200, 204, 205, 202, 183, 205,
+  157, 170, 186, 131, 142, 186, 177, 193, 153, 177, 206, 173, 209, 206, 109, 117,
+  188, 184, 190, 188, 123, 147, 188, 202, 220, 188, 168, 163, 242, 168, 199, 163,
+  199, 107, 178, 107, 144, 150, 152, 170, 158, 170, 153, 156, 153, 217, 235, 169,
+  91, 155, 216, 91, 252, 142, 252, 131, 161, 167, 131, 229, 193, 233, 229, 158,
+  142, 170, 158, 174, 261, 171, 174, 214, 157, 146, 214, 219, 151, 198, 168, 131,
+  198, 112, 229, 208, 184, 112, 181, 86, 171, 181, 225, 180, 228, 204, 173, 228,
+  94, 122, 199, 94, 135, 246, 198, 135, 172, 190, 172, 164, 190, 122, 192, 223,
+  222, 103, 122, 186, 230, 186, 177, 169, 250, 216, 172, 106, 148, 275, 172, 148,
+  205, 233, 281, 131, 205, 192, 130, 162, 144, 265, 216, 212, 162, 158, 202, 202,
+  196, 289, 157, 202, 182, 160, 131, 182, 134, 212, 193, 134, 173, 183, 173, 173,
+  239, 154, 239, 153, 153, 134, 159, 184, 134, 181, 123, 181, 153, 194, 202, 153,
+  181, 202, 220, 163, 181, 150, 255, 150, 221, 214, 178, 221, 95, 194, 95, 173,
+  150, 152, 182, 158, 152, 195, 132, 195, 126, 184, 217, 126, 226, 134, 155, 226,
+  147, 164, 142, 147, 205, 183, 161, 205, 168, 169, 193, 168, 235, 142, 130, 223,
+  261, 130, 186, 113, 157, 186, 182, 142, 184, 219, 182, 187, 149, 168, 187, 168,
+  220, 229, 168, 166, 124, 208, 86, 166, 202, 222, 225, 202, 171, 113, 204, 171,
+  141, 92, 122, 141, 161, 226, 268, 135, 161, 191, 173, 135, 191, 192, 172, 106,
+  147, 192, 106, 147, 187, 223, 230, 147, 150, 177, 150, 265, 173, 250, 265, 121,
+  143, 172, 121, 223, 115, 223, 147, 154, 275, 233, 147, 157, 123, 179, 192, 157,
+  155, 146, 144, 155, 211, 265, 158, 211, 163, 196, 163, 183, 289, 160, 183, 159,
+  212, 169, 115, 183, 169, 165, 154, 130, 240, 130, 192, 146, 159, 192, 186, 179,
+  186, 231, 194, 231, 154, 189, 202, 154, 187, 116, 149, 255, 187, 124, 91, 214,
+  124, 172, 104, 219, 194, 172, 213, 113, 173, 213, 153, 206, 182, 153, 177, 132,
+  183, 161, 184, 183, 247, 134, 247, 143, 164, 177, 183, 177, 141, 163, 169, 141,
+  198, 153, 235, 198, 130, 136, 223, 130, 248, 147, 113, 248, 154, 168, 142, 154,
+  145, 137, 184, 149, 145, 211, 190, 220, 211, 214, 124, 136, 208, 222, 136, 199,
+  166, 113, 199, 123, 262, 211, 92, 123, 178, 213, 226, 178, 164, 143, 268, 173,
+  164, 182, 101, 192, 182, 209, 147, 214, 187, 214, 163, 114, 163, 110, 173, 183,
+  123, 143, 183, 211, 162, 115, 211, 154, 188, 123, 178, 151, 179, 146, 178, 200,
+  189, 200, 207, 139, 207, 104, 165, 104, 293, 159, 156, 207, 115, 156, 173, 221,
+  165, 173, 162, 240, 182, 191, 146, 182, 179, 168, 146, 141, 189, 146, 171, 116,
+  155, 185, 149, 91, 155, 209, 104, 200, 178, 219, 113, 200, 135, 239, 206, 135,
+  150, 177, 108, 142, 161, 108, 187, 187, 133, 143, 166, 166, 191, 195, 163, 191,
+  161, 125, 248, 153, 161, 197, 186, 272, 136, 197, 189, 152, 147, 189, 203, 168,
+  203, 200, 221, 137, 200, 138, 187, 190, 138, 165, 168, 214, 165, 209, 182, 208,
+  209, 212, 166, 212, 250, 262, 161, 211, 213, 161, 162, 166, 143, 162, 161, 101,
+  161, 190, 211, 209, 190, 139, 178, 196, 114, 178, 179, 182, 110, 179, 177, 164,
+  123, 177, 139, 162, 139, 189, 180, 189, 108, 224, 188, 108, 229, 119, 151, 229,
+  189, 236, 182, 139, 236, 153, 165, 153, 151, 170, 151, 257, 95, 293, 207, 257,
+  147, 221, 147, 147, 158, 162, 147, 238, 184, 191, 238, 143, 135, 143, 131, 156,
+  168, 131, 242, 164, 141, 242, 169, 171, 157, 129, 185, 157, 212, 225, 209, 212,
+  190, 133, 178, 190, 224, 239, 224, 95, 161, 150, 95, 146, 142, 165, 152, 133,
+  152, 228, 186, 228, 131, 160, 195, 131, 168, 203, 230, 125, 168, 177, 203, 248,
+  186, 177, 200, 181, 272, 152, 200, 131, 190, 131, 158, 175, 221, 158, 232, 151,
+  187, 232, 95, 225, 168, 95, 249, 120, 182, 249, 107, 107, 162, 188, 250, 162,
+  194, 109, 194, 202, 109, 166, 202, 165, 147, 165, 117, 196, 211, 117, 196, 147,
+  139, 196, 196, 138, 169, 182, 138, 187, 164, 187, 249, 242, 249, 172, 180, 135,
+  224, 135, 210, 168, 209, 119, 210, 172, 215, 172, 115, 182, 115, 205, 156, 205,
+  187, 225, 170, 187, 133, 242, 95, 133, 224, 186, 224, 158, 184, 200, 136, 200,
+  135, 135, 156, 135, 154, 173, 317, 164, 154, 252, 225, 169, 252, 177, 141, 129,
+  177, 168, 203, 229, 225, 168, 199, 140, 133, 199, 147, 262, 147, 183, 129, 161,
+  183, 159, 135, 146, 159, 165, 194, 206, 198, 186, 206, 172, 130, 160, 172, 194,
+  203, 157, 230, 203, 157, 248, 160, 181, 248, 128, 149, 190, 128, 210, 180, 175,
+  210, 179, 180, 151, 179, 147, 169, 225, 147, 185, 171, 120, 185, 222, 206, 222,
+  106, 191, 188, 106, 192, 197, 109, 192, 154, 201, 109, 154, 242, 151, 147, 242,
+  139, 129, 196, 139, 156, 147, 156, 188, 215, 265, 188, 186, 169, 172, 228, 223,
+  120, 242, 223, 114, 172, 138, 163, 138, 259, 159, 168, 259, 120, 209, 215, 120,
+  180, 152, 180, 199, 226, 156, 199, 233, 193, 225, 233, 177, 242, 187, 186, 159,
+  210, 159, 165, 217, 136, 179, 193, 179, 214, 157, 173, 214, 173, 234, 317, 225,
+  173, 231, 141, 231, 161, 204, 203, 161, 139, 125, 229, 140, 139, 206, 113, 262,
+  206, 150, 174, 129, 150, 155, 135, 155, 198, 91, 202, 194, 91, 188, 198, 188,
+  218, 130, 218, 131, 256, 194, 131, 158, 160, 158, 160, 237, 144, 149, 237, 137,
+  180, 137, 203, 172, 265, 180, 203, 140, 169, 140, 221, 127, 171, 221, 175, 159,
+  206, 175, 233, 305, 191, 198, 247, 197, 198, 212, 109, 201, 212, 111, 193, 151,
+  111, 227, 220, 129, 227, 121, 217, 121, 178, 178, 215, 178, 134, 265, 186, 131,
+  172, 229, 188, 228, 120, 229, 135, 172, 114, 135, 203, 189, 163, 203, 153, 105,
+  159, 153, 191, 205, 191, 185, 152, 185, 164, 119, 226, 164, 229, 164, 193, 229,
+  134, 177, 134, 146, 128, 187, 146, 139, 210, 153, 197, 153, 165, 214, 175, 217,
+  193, 214, 138, 173, 157, 138, 174, 234, 208, 138, 208, 165, 203, 204, 165, 173,
+  109, 125, 173, 127, 113, 127, 209, 206, 174, 209, 151, 166, 151, 132, 198, 202,
+  115, 212, 115, 208, 191, 208, 129, 173, 256, 129, 269, 150, 160, 269, 173, 206,
+  173, 164, 165, 144, 164, 146, 159, 146, 195, 117, 172, 195, 145, 154, 265, 145,
+  111, 127, 157, 200, 250, 159, 157, 124, 233, 124, 216, 305, 247, 216, 98, 109,
+  175, 193, 175, 220, 97, 192, 213, 217, 97, 192, 173, 178, 192, 167, 193, 134,
+  167, 233, 131, 233, 181, 188, 109, 157, 172, 109, 239, 150, 189, 239, 160, 177,
+  105, 160, 193, 227, 267, 205, 193, 125, 189, 125, 150, 195, 119, 150, 180, 164,
+  180, 201, 155, 201, 209, 128, 209, 159, 156, 139, 159, 234, 157, 197, 234, 127,
+  127, 139, 175, 169, 194, 173, 169, 134, 139, 224, 174, 134, 151, 138, 170, 196,
+  203, 170, 231, 112, 109, 231, 137, 167, 137, 183, 206, 183, 179, 166, 179, 183,
+  147, 132, 183, 149, 238, 149, 212, 234, 143, 191, 234, 143, 97, 173, 143, 131,
+  187, 240, 150, 131, 212, 122, 206, 212, 113, 124, 165, 113, 138, 178, 159, 138,
+  172, 117, 168, 201, 154, 168, 146, 111, 270, 234, 200, 270, 104, 216, 250, 104,
+  185, 168, 185, 165, 166, 197, 98, 165, 225, 180, 225, 119, 119, 183, 125, 192,
+  183, 220, 127, 213, 173, 220, 90, 166, 193, 90, 186, 186, 218, 163, 181, 218,
+  200, 191, 149, 157, 150, 191, 161, 213, 177, 161, 220, 227, 220, 141, 267, 189,
+  172, 163, 195, 172, 125, 164, 155, 173, 208, 173, 144, 127, 156, 144, 192, 198,
+  157, 192, 115, 141, 115, 235, 139, 139, 235, 189, 189, 194, 189, 127, 108, 139,
+  127, 164, 198, 279, 224, 151, 164, 243, 167, 196, 243, 156, 112, 156, 154, 193,
+  167, 154, 176, 182, 176, 205, 179, 205, 172, 153, 221, 147, 172, 143, 164, 238,
+  143, 126, 96, 240, 143, 96, 139, 97, 138, 156, 187, 138, 232, 133, 240, 122,
+  232, 153, 124, 248, 190, 178, 248, 121, 134, 172, 121, 244, 225, 201, 244, 166,
+  146, 221, 168, 234, 221, 224, 117, 216, 224, 158, 144, 168, 158, 202, 166, 202,
+  148, 194, 197, 180, 148, 153, 163, 125, 172, 175, 127, 172, 178, 167, 218, 166,
+  178, 221, 202, 211, 163, 202, 166, 208, 200, 166, 230, 149, 151, 221, 213, 151,
+  139, 238, 141, 139, 162, 223, 163, 162, 235, 125, 235, 184, 215, 164, 184, 170,
+  172, 208, 170, 132, 127, 132, 205, 171, 198, 205, 124, 141, 189, 229, 139, 189,
+  170, 189, 108, 208, 190, 198, 208, 218, 157, 279, 167, 218, 234, 190, 136, 193,
+  190, 115, 184, 182, 115, 157, 121, 179, 157, 148, 153, 135, 210, 221, 164, 135,
+  158, 126, 211, 240, 145, 184, 139, 145, 181, 232, 294, 156, 181, 218, 201, 133,
+  218, 186, 165, 153, 186, 162, 173, 190, 162, 169, 204, 134, 169, 94, 205, 225,
+  94, 176, 166, 184, 168, 216, 153, 117, 216, 264, 259, 144, 148, 139, 148, 223,
+  194, 223, 223, 127, 153, 223, 171, 209, 237, 163, 171, 104, 160, 175, 104, 199,
+  164, 167, 199, 156, 201, 218, 221, 156, 149, 196, 211, 149, 218, 166, 208, 218,
+  175, 163, 230, 175, 221, 170, 170, 187, 238, 175, 223, 175, 235, 233, 252, 215,
+  233, 138, 172, 138, 230, 120, 230, 143, 177, 171, 143, 198, 270, 124, 198, 116,
+  161, 229, 116, 194, 182, 170, 194, 145, 143, 145, 206, 193, 190, 206, 161, 157,
+  161, 166, 234, 166, 173, 164, 136, 173, 206, 206, 184, 206, 125, 121, 125, 189,
+  208, 148, 189, 159, 194, 197, 210, 159, 138, 158, 138, 214, 159, 211, 214, 184,
+  123, 232, 179, 108, 294, 201, 179, 140, 168, 165, 140, 118, 112, 173, 118, 180,
+  204, 184, 205, 213, 210, 176, 213, 138, 191, 184, 138, 184, 152, 153, 184, 193,
+  264, 202, 130, 259, 139, 202, 122, 218, 122, 197, 201, 127, 197, 198, 201, 209,
+  198, 131, 237, 160, 131, 218, 209, 164, 218, 139, 207, 201, 139, 141, 129, 196,
+  141, 169, 174, 166, 169, 157, 175, 163, 157, 147, 191, 147, 228, 192, 174, 187,
+  192, 156, 150, 156, 183, 235, 195, 120, 252, 195, 137, 222, 120, 184, 177, 122,
+  137, 270, 122, 269, 140, 161, 269, 130, 182, 130, 233, 132, 143, 233, 182, 199,
+  193, 182, 166, 130, 166, 143, 216, 143, 181, 164, 181, 195, 137, 206, 195, 159,
+  161, 159, 124, 208, 246, 175, 194, 246, 177, 197, 217, 169, 159, 217, 157, 184,
+  197, 123, 184, 164, 169, 108, 164, 129, 195, 168, 129, 173, 112, 232, 180, 232,
+  178, 194, 184, 178, 159, 120, 210, 159, 191, 195, 175, 152, 195, 162, 189, 193,
+  162, 207, 174, 130, 207, 188, 218, 153, 143, 201, 153, 204, 95, 237, 201, 204,
+  124, 214, 124, 197, 209, 118, 207, 120, 129, 146, 175, 174, 146, 164, 152, 175,
+  164, 147, 157, 191, 147, 265, 134, 228, 265, 177, 174, 148, 180, 150, 148, 157,
+  183, 157, 168, 100, 120, 168, 131, 183, 137, 131, 171, 171, 175, 176, 222, 184,
+  175, 212, 229, 137, 212, 132, 140, 132, 149, 180, 149, 174, 132, 187, 197, 199,
+  187, 161, 130, 161, 173, 216, 173, 215, 139, 215, 194, 108, 137, 194, 124, 182,
+  161, 124, 198, 167, 124, 198, 197, 230, 351, 175, 197, 113, 192, 177, 113, 274,
+  181, 169, 274, 128, 189, 157, 128, 197, 94, 169, 223, 179, 195, 223, 135, 173,
+  135, 241, 141, 241, 146, 126, 194, 146, 174, 229, 120, 174, 160, 166, 160, 226,
+  137, 175, 226, 129, 153, 189, 129, 176, 174, 176, 222, 152, 188, 222, 98, 140,
+  143, 98, 225, 207, 95, 225, 163, 195, 237, 214, 163, 150, 135, 197, 150, 169,
+  118, 169, 235, 231, 120, 235, 161, 161, 269, 175, 161, 174, 202, 152, 174, 139,
+  145, 157, 139, 177, 128, 134, 177, 208, 179, 177, 208, 147, 180, 114, 193, 141,
+  100, 193, 177, 248, 183, 177, 168, 168, 163, 162, 176, 163, 131, 238, 229, 131,
+  203, 114, 203, 171, 180, 179, 174, 117, 213, 197, 117, 178, 179, 160, 179, 127,
+  206, 139, 127, 168, 108, 168, 143, 181, 182, 143, 277, 201, 167, 277, 114, 195,
+  230, 114, 201, 108, 351, 192, 201, 182, 106, 181, 182, 152, 115, 189, 152, 162,
+  207, 94, 162, 218, 178, 179, 218, 96, 240, 96, 202, 157, 141, 202, 196, 126,
+  196, 142, 136, 229, 142, 159, 127, 166, 159, 137, 149, 196, 153, 149, 215, 99,
+  215, 145, 251, 152, 145, 210, 195, 140, 210, 139, 150, 207, 139, 120, 195, 198,
+  210, 135, 198, 139, 193, 139, 210, 222, 231, 210, 191, 217, 161, 191, 158, 191,
+  269, 202, 158, 206, 177, 145, 206, 210, 128, 148, 227, 179, 148, 161, 126, 147,
+  161, 149, 114, 115, 240, 141, 115, 234, 199, 248, 234, 157, 245, 147, 212, 162,
+  147, 105, 142, 238, 105, 135, 114, 200, 159, 171, 200, 108, 118, 179, 108, 176,
+  179, 213, 176, 162, 178, 121, 160, 121, 211, 184, 206, 211, 144, 231, 190, 144,
+  178, 217, 246, 181, 178, 198, 215, 201, 198, 152, 147, 195, 152, 203, 108, 203,
+  163, 179, 106, 163, 115, 229, 230, 270, 229, 142, 207, 163, 178, 163, 93, 233,
+  240, 93, 177, 166, 157, 177, 140, 176, 140, 241, 121, 326, 136, 241, 190, 184,
+  127, 190, 175, 193, 175, 142, 196, 142, 195, 99, 195, 229, 251, 229, 116, 195,
+  116, 163, 150, 163, 181, 262, 120, 181, 236, 201, 236, 133, 210, 193, 133, 167,
+  222, 167, 212, 184, 217, 212, 133, 132, 191, 133, 152, 150, 177, 152, 223, 187,
+  210, 223, 118, 227, 242, 176, 126, 242, 198, 149, 240, 154, 199, 199, 154, 215,
+  143, 157, 215, 214, 140, 245, 212, 214, 155, 108, 142, 155, 235, 135, 125, 159,
+  202, 118, 129, 253, 179, 129, 255, 182, 162, 255, 174, 193, 174, 141, 190, 184,
+  141, 136, 144, 231, 136, 176, 96, 190, 217, 176, 176, 168, 246, 215, 176, 133,
+  147, 133, 207, 226, 207, 197, 203, 179, 197, 227, 230, 227, 126, 139, 270, 142,
+  126, 219, 219, 145, 153, 233, 145, 145, 168, 166, 145, 200, 206, 176, 200, 163,
+  153, 121, 163, 187, 326, 184, 155, 171, 193, 155, 122, 167, 122, 153, 134, 223,
+  134, 157, 203, 182, 235, 203, 167, 225, 262, 167, 196, 126, 201, 196, 175, 214,
+  175, 185, 185, 193, 179, 184, 193, 107, 108, 132, 107, 186, 144, 150, 186, 170,
+  180, 187, 170, 199, 155, 229, 118, 199, 166, 176, 111, 198, 250, 166, 250, 166,
+  199, 174, 168, 259, 143, 174, 226, 175, 140, 226, 97, 211, 108, 97, 252, 242,
+  235, 252, 158, 125, 132, 158, 202, 132, 132, 253, 132, 152, 182, 134, 198, 193,
+  134, 172, 174, 197, 190, 172, 192, 127, 144, 192, 99, 205, 96, 99, 228, 191,
+  168, 228, 218, 121, 218, 110, 228, 213, 226, 110, 153, 277, 203, 182, 203, 182,
+  160, 135, 182, 139, 135, 196, 181, 153, 196, 159, 168, 159, 126, 130, 206, 126,
+  179, 153, 209, 200, 187, 209, 171, 195, 224, 167, 232, 212, 262, 153, 232, 159,
+  223, 159, 132, 122, 157, 132, 163, 182, 163, 177, 231, 235, 225, 177, 166, 126,
+  162, 196, 214, 162, 195, 195, 169, 179, 186, 108, 153, 153, 144, 153, 196, 172,
+  180, 196, 187, 215, 155, 187, 133, 194, 229, 166, 133, 206, 243, 111, 206, 161,
+  157, 166, 161, 198, 199, 166, 198, 168, 168, 175, 259, 175, 168, 118, 147, 211,
+  118, 210, 187, 264, 242, 210, 131, 162, 158, 131, 166, 146, 158, 166, 198, 198,
+  138, 164, 152, 138, 140, 200, 194, 198, 174, 176, 199, 197, 127, 176, 205, 205,
+  191, 205, 151, 239, 121, 151, 136, 158, 228, 136, 173, 200, 213, 153, 173, 174,
+  204, 277, 203, 174, 158, 202, 160, 158, 166, 190, 182, 166, 225, 174, 225, 96,
+  181, 129, 139, 129, 184, 219, 250, 130, 184, 191, 140, 179, 191, 124, 99, 200,
+  124, 248, 100, 248, 176, 192, 195, 176, 110, 190, 224, 212, 110, 218, 162, 262,
+  218, 140, 122, 140, 127, 180, 127, 223, 231, 223, 158, 166, 144, 150, 196, 144,
+  202, 122, 202, 155, 169, 155, 98, 186, 177, 153, 133, 172, 133, 189, 215, 215,
+  189, 143, 197, 194, 143, 150, 157, 243, 150, 227, 152, 226, 157, 227, 191, 195,
+  199, 191, 87, 176, 87, 198, 175, 203, 185, 147, 203, 192, 246, 187, 192, 106,
+  168, 264, 162, 106, 181, 146, 181, 183, 152, 164, 140, 117, 156, 200, 194, 117,
+  207, 199, 207, 154, 154, 185, 185, 147, 221, 239, 147, 146, 158, 248, 189, 200,
+  248, 90, 133, 204, 90, 163, 160, 202, 163, 165, 190, 165, 191, 174, 157, 181,
+  96, 157, 162, 139, 175, 168, 219, 175, 250, 140, 123, 247, 99, 123, 224, 324,
+  100, 195, 192, 187, 190, 190, 187, 158, 272, 162, 158, 180, 180, 202, 202, 278,
+  180, 202, 129, 189, 129, 192, 177, 158, 192, 144, 114, 150, 144, 208, 176, 122,
+  208, 127, 234, 127, 220, 146, 98, 220, 140, 188, 177, 140, 201, 259, 201, 137,
+  207, 215, 137, 221, 135, 259, 197, 221, 169, 157, 140, 219, 152, 140, 150, 154,
+  226, 195, 150, 162, 193, 176, 162, 153, 198, 129, 185, 90, 217, 246, 90, 219,
+  152, 168, 219, 149, 139, 149, 158, 124, 183, 158, 232, 152, 232, 116, 175, 260,
+  116, 186, 156, 186, 169, 169, 169, 111, 154, 125, 154, 161, 177, 221, 161, 185,
+  166, 146, 185, 152, 132, 189, 152, 223, 161, 307, 133, 223, 91, 125, 160, 91,
+  186, 155, 186, 203, 185, 191, 203, 196, 208, 181, 196, 132, 184, 162, 132, 133,
+  168, 153, 153, 180, 166, 247, 180, 183, 224, 119, 324, 195, 91, 164, 190, 91,
+  249, 167, 249, 153, 189, 272, 153, 89, 167, 202, 89, 204, 175, 278, 189, 204,
+  177, 149, 177, 177, 159, 114, 159, 226, 176, 235, 234, 235, 119, 178, 146, 119,
+  184, 182, 188, 184, 153, 176, 277, 153, 197, 198, 259, 207, 197, 155, 140, 135,
+  155, 166, 259, 169, 166, 138, 157, 138, 192, 152, 219, 154, 192, 214, 206, 193,
+  214, 150, 145, 153, 150, 106, 209, 129, 106, 164, 217, 193, 152, 193, 158, 123,
+  139, 158, 200, 247, 124, 200, 200, 160, 169, 175, 160, 188, 189, 260, 188, 110,
+  164, 169, 110, 196, 222, 280, 111, 196, 170, 260, 125, 170, 222, 225, 177, 222,
+  147, 166, 147, 161, 132, 161, 182, 270, 161, 182, 162, 154, 307, 125, 162, 117,
+  202, 155, 117, 151, 150, 185, 151, 205, 227, 208, 205, 137, 184, 178, 200, 133,
+  178, 189, 201, 189, 171, 166, 122, 160, 183, 122, 223, 126, 119, 223, 182, 164,
+  186, 167, 186, 116, 189, 116, 186, 183, 167, 186, 230, 195, 175, 230, 160, 149,
+  160, 182, 160, 194, 226, 157, 172, 157, 201, 174, 178, 201, 162, 112, 182, 162,
+  216, 205, 176, 216, 104, 175, 277, 198, 104, 271, 131, 140, 271, 161, 197, 161,
+  97, 231, 157, 97, 152, 133, 206, 128, 169, 145, 128, 211, 209, 164, 233, 164,
+  164, 168, 130, 123, 168, 127, 200, 127, 247, 227, 164, 169, 227, 196, 162, 189,
+  196, 134, 172, 164, 134, 252, 222, 252, 135, 121, 280, 260, 135, 214, 225, 214,
+  201, 181, 202, 234, 181, 215, 132, 270, 215, 176, 187, 154, 176, 166, 202, 155,
+  159, 150, 155, 136, 153, 227, 136, 226, 137, 226, 164, 200, 164, 103, 201, 103,
+  219, 162, 246, 171, 219, 151, 160, 241, 126, 208, 176, 182, 208, 131, 131, 206,
+  178, 206, 164, 228, 183, 164, 205, 170, 195, 205, 138, 160, 174, 165, 182, 174,
+  192, 235, 194, 192, 143, 158, 172, 143, 220, 170, 174, 220, 107, 221, 112, 107,
+  209, 197, 205, 209, 173, 169, 175, 173, 193, 131, 265, 204, 197, 265, 157, 142,
+  231, 157, 170, 213, 170, 119, 201, 133, 119, 166, 166, 239, 169, 166, 212, 115,
+  211, 212, 176, 196, 233, 176, 141, 130, 147, 141, 147, 164, 153, 162, 153, 121,
+  111, 172, 121, 166, 208, 148, 121, 208, 213, 175, 213, 185, 113, 201, 185, 148,
+  175, 202, 145, 157, 234, 132, 145, 211, 222, 187, 211, 197, 147, 166, 197, 100,
+  214, 159, 100, 240, 153, 240, 172, 175, 172, 146, 208, 146, 187, 179, 187, 205,
+  193, 319, 162, 205, 133, 198, 246, 151, 133, 188, 241, 179, 176, 180, 137, 180,
+  154, 143, 178, 154, 165, 164, 165, 203, 192, 228, 170, 203, 138, 109, 240, 165,
+  109, 175, 142, 235, 175, 95, 158, 154, 152, 170, 154, 179, 116, 221, 179, 151,
+  182, 197, 151, 169, 190, 193, 190, 114, 204, 143, 159, 142, 143, 213, 142, 211,
+  201, 142, 152, 108, 166, 152, 223, 187, 284, 239, 115, 223, 159, 196, 159, 194,
+  80, 141, 194, 156, 183, 156, 197, 141, 197, 206, 288, 241, 241, 182, 219, 111,
+  182, 161, 166, 161, 174, 149, 148, 174, 213, 225, 175, 213, 157, 275, 113, 157,
+  155, 157, 148, 155, 139, 138, 175, 157, 139, 215, 148, 222, 215, 153, 157, 147,
+  153, 192, 149, 164, 214, 192, 114, 129, 114, 228, 103, 175, 228, 129, 208, 129,
+  155, 179, 205, 175, 193, 205, 175, 230, 319, 198, 175, 131, 124, 188, 131, 258,
+  179, 137, 207, 212, 143, 207, 167, 169, 164, 167, 132, 149, 192, 132, 212, 153,
+  240, 153, 133, 131, 142, 133, 218, 95, 218, 213, 196, 152, 213, 171, 196, 116,
+  171, 156, 222, 182, 156, 192, 137, 192, 185, 185, 195, 173, 114, 195, 199, 159,
+  199, 110, 155, 110, 186, 211, 186, 167, 117, 206, 108, 167, 203, 212, 187, 203,
+  183, 165, 284, 183, 128, 80, 128, 229, 174, 183, 229, 149, 119, 185, 149, 126,
+  114, 206, 114, 149, 137, 288, 149, 177, 170, 219, 177, 163, 163, 198, 198, 149,
+  198, 185, 225, 185, 208, 275, 208, 176, 141, 157, 176, 180, 162, 138, 180, 95,
+  176, 148, 95, 211, 169, 157, 211, 132, 102, 149, 132, 157, 142, 164, 129, 157,
+  196, 103, 191, 256, 191, 187, 177, 155, 187, 173, 233, 175, 173, 137, 230, 137,
+  227, 98, 186, 124, 227, 177, 205, 177, 179, 164, 258, 179, 193, 212, 134, 159,
+  169, 134, 156, 149, 156, 178, 153, 212, 178, 120, 234, 240, 131, 234, 163, 163,
+  166, 158, 196, 166, 167, 146, 196, 167, 158, 149, 221, 222, 158, 190, 137, 95,
+  223, 95, 249, 367, 173, 234, 250, 234, 155, 91, 155, 155, 227, 194, 115, 117,
+  194, 158, 206, 212, 158, 208, 119, 228, 165, 208, 172, 233, 174, 172, 182, 255,
+  119, 182, 150, 224, 185, 126, 150, 176, 173, 175, 137, 173, 238, 182, 170, 238,
+  79, 236, 79, 243, 149, 198, 243, 103, 103, 200, 185, 200, 205, 141, 205, 195,
+  162, 216, 224, 298, 176, 216, 181, 267, 169, 165, 248, 102, 165, 242, 231, 142,
+  242, 179, 196, 179, 182, 174, 256, 182, 140, 177, 136, 233, 147, 202, 147, 127,
+  98, 162, 162, 186, 205, 162, 208, 164, 208, 171, 151, 193, 171, 159, 183, 183,
+  119, 159, 153, 119, 177, 238, 120, 177, 221, 204, 240, 221, 143, 158, 143, 146,
+  188, 206, 149, 188, 137, 115, 221, 190, 137, 250, 162, 223, 250, 158, 249, 158,
+  160, 171, 256, 367, 250, 160, 188, 185, 91, 196, 227, 196, 126, 129, 115, 126,
+  194, 130, 119, 194, 186, 272, 228, 186, 206, 198, 233, 206, 103, 255, 103, 213,
+  138, 224, 213, 143, 127, 176, 143, 175, 187, 159, 210, 182, 187, 108, 236, 108,
+  216, 189, 149, 216, 221, 107, 197, 185, 107, 224, 154, 224, 148, 210, 195, 148,
+  224, 186, 197, 298, 181, 186, 153, 136, 267, 248, 153, 231, 195, 186, 195, 136,
+  162, 174, 136, 142, 140, 140, 151, 223, 136, 140, 158, 171, 202, 158, 197, 159,
+  185, 127, 197, 185, 141, 162, 185, 188, 247, 188, 136, 156, 151, 136, 269, 258,
+  270, 269, 106, 141, 106, 174, 159, 210, 238, 171, 119, 204, 171, 124, 178, 235,
+  178, 168, 168, 168, 208, 222, 206, 208, 135, 193, 115, 135, 210, 178, 162, 210,
+  191, 191, 191, 188, 171, 191, 172, 154, 256, 188, 172, 148, 93, 185, 148, 171,
+  183, 129, 171, 187, 255, 130, 133, 216, 272, 133, 227, 112, 198, 227, 238, 163,
+  238, 134, 138, 131, 127, 238, 276, 238, 159, 206, 222, 210, 206, 198, 189, 132,
+  221, 132, 145, 197, 174, 107, 154, 174, 228, 237, 210, 232, 108, 232, 186, 115,
+  197, 186, 145, 161, 136, 145, 171, 221, 207, 186, 221, 138, 123, 162, 138, 142,
+  172, 186, 299, 151, 172, 225, 223, 171, 225, 137, 218, 159, 137, 164, 108, 185,
+  141, 164, 279, 258, 247, 279, 124, 150, 156, 124, 144, 144, 258, 144, 179, 270,
+  141, 179, 260, 183, 174, 260, 142, 145, 210, 142, 144, 221, 119, 144, 242, 124,
+  242, 146, 204, 235, 146, 151, 268, 168, 151, 185, 228, 222, 185, 161, 155, 193,
+  161, 182, 246, 178, 182, 189, 189, 188, 176, 165, 154, 176, 130, 93, 124, 183,
+  124, 174, 187, 169, 260, 255, 214, 136, 216, 214, 151, 156, 112, 151, 144, 218,
+  163, 144, 196, 187, 134, 196, 206, 184, 131, 206, 276, 165, 137, 165, 126, 222,
+  173, 214, 198, 173, 264, 184, 145, 264, 122, 107, 122, 228, 181, 147, 237, 108,
+  181, 195, 176, 115, 195, 154, 161, 154, 197, 171, 197, 183, 185, 207, 183, 185,
+  221, 123, 185, 140, 182, 140, 236, 122, 186, 236, 167, 137, 299, 167, 87, 218,
+  160, 202, 108, 160, 203, 258, 221, 150, 221, 186, 187, 144, 186, 167, 160, 167,
+  142, 180, 183, 142, 194, 169, 145, 194, 177, 221, 190, 190, 133, 179, 204, 133,
+  148, 133, 148, 183, 258, 268, 228, 155, 200, 188, 200, 109, 246, 189, 109, 241,
+  189, 178, 106, 201, 165, 178, 180, 110, 130, 180, 190, 198, 190, 184, 199, 174,
+  184, 132, 169, 132, 268, 188, 260, 136, 268, 110, 156, 110, 166, 218, 166, 132,
+  187, 119, 153, 184, 119, 198, 165, 225, 198, 188, 137, 188, 119, 233, 126, 211,
+  214, 112, 276, 178, 184, 276, 127, 135, 127, 195, 208, 195, 115, 195, 147, 115,
+  176, 165, 163, 165, 167, 178, 167, 230, 185, 230, 158, 157, 221, 158, 182, 255,
+  192, 122, 255, 122, 264, 137, 122, 204, 210, 87, 204, 214, 202, 216, 112, 203,
+  216, 165, 165, 154, 182, 187, 154, 209, 200, 160, 209, 143, 163, 180, 143, 194,
+  169, 213, 132, 177, 213, 146, 172, 146, 172, 179, 205, 133, 207, 183, 207, 258,
+  156, 155, 188, 156, 127, 234, 140, 241, 234, 176, 157, 193, 106, 176, 145, 171,
+  201, 110, 145, 198, 96, 242, 199, 96, 151, 174, 152, 188, 174, 261, 244, 151,
+  244, 145, 227, 222, 132, 145, 216, 163, 153, 216, 100, 136, 165, 100, 152, 158,
+  225, 152, 238, 202, 247, 119, 238, 161, 171, 233, 211, 161, 166, 112, 191, 178,
+  152, 195, 135, 152, 144, 174, 208, 144, 191, 221, 195, 191, 204, 224, 163, 224,
+  128, 225, 178, 128, 149, 174, 149, 188, 136, 157, 188, 117, 97, 192, 192, 97,
+  190, 136, 264, 190, 189, 183, 210, 189, 141, 110, 214, 141, 164, 188, 112, 164,
+  225, 212, 225, 97, 232, 182, 97, 275, 190, 200, 275, 142, 163, 142, 182, 214,
+  194, 182, 219, 132, 219, 140, 242, 172, 140, 137, 124, 172, 137, 222, 205, 184,
+  184, 173, 150, 189, 173, 136, 133, 155, 136, 199, 167, 127, 199, 149, 133, 140,
+  149, 157, 179, 162, 193, 171, 179, 146, 194, 146, 112, 127, 242, 112, 130, 151,
+  207, 152, 207, 142, 261, 165, 150, 151, 165, 234, 175, 273, 227, 234, 137, 159,
+  222, 163, 137, 195, 136, 208, 169, 158, 208, 143, 240, 263, 202, 143, 189, 186,
+  247, 171, 189, 165, 166, 165, 173, 191, 173, 194, 195, 173, 123, 157, 174, 123,
+  223, 221, 223, 180, 204, 123, 123, 196, 175, 225, 196, 231, 174, 231, 181, 136,
+  181, 117, 173, 192, 173, 171, 136, 224, 135, 183, 224, 198, 177, 110, 198, 170,
+  293, 188, 226, 161, 212, 226, 165, 197, 232, 165, 142, 190, 215, 153, 215, 141,
+  116, 214, 141, 126, 126, 249, 156, 242, 249, 134, 124, 178, 222, 203, 134, 203,
+  150, 95, 239, 189, 133, 95, 179, 167, 179, 187, 177, 133, 187, 214, 216, 214,
+  224, 264, 162, 178, 194, 200, 216, 127, 200, 122, 239, 130, 122, 210, 158, 210,
+  137, 213, 142, 137, 177, 221, 150, 177, 162, 208, 175, 162, 241, 158, 273, 159,
+  241, 175, 136, 195, 175, 136, 169, 136, 183, 162, 240, 183, 117, 263, 186, 169,
+  220, 169, 113, 166, 173, 113, 154, 194, 164, 155, 157, 164, 144, 237, 144, 168,
+  204, 180, 168, 140, 191, 140, 153, 154, 175, 153, 220, 148, 156, 148, 208, 181,
+  219, 208, 154, 178, 154, 176, 204, 171, 176, 142, 135, 223, 177, 187, 149, 170,
+  187, 207, 293, 161, 197, 181, 94, 142, 181, 95, 157, 303, 153, 95, 116, 213,
+  179, 213, 177, 138, 156, 177, 96, 214, 134, 96, 212, 211, 178, 212, 168, 128,
+  134, 168, 127, 196, 127, 220, 239, 166, 183, 166, 158, 175, 177, 158, 146, 215,
+  216, 146, 145, 224, 145, 203, 208, 264, 178, 203, 192, 216, 230, 143, 239, 230,
+  112, 132, 158, 112, 174, 169, 213, 174, 250, 191, 202, 221, 250, 106, 176, 208,
+  106, 184, 167, 158, 184, 156, 196, 136, 156, 221, 222, 221, 134, 140, 162, 134,
+  184, 208, 117, 184, 166, 174, 264, 220, 166, 142, 149, 166, 142, 199, 154, 199,
+  155, 164, 237, 164, 129, 204, 129, 220, 191, 220, 195, 154, 195, 162, 220, 162,
+  91, 156, 91, 259, 181, 259, 150, 219, 178, 150, 196, 204, 196, 129, 142, 129,
+  162, 223, 162, 208, 149, 208, 95, 207, 95, 227, 227, 191, 94, 191, 162, 157,
+  162, 303, 141, 179, 141, 190, 138, 190, 192, 214, 192, 211, 146, 128, 146, 183,
+  196, 183, 218, 220, 218, 183, 175, 88, 215, 88, 186, 186, 154, 208, 154, 181,
+  192, 181, 240, 143, 240, 182, 132, 182, 134, 169, 134, 219, 191, 219, 202, 176,
+  170, 167, 170, 180, 196, 180, 124, 222, 124, 140, 165, 208, 165, 226, 174, 226,
+  138, 264, 149, 138, 123, 123, 212, 212
+};
+
+static_assert(sizeof(NODE_LAT) / sizeof(NODE_LAT[0]) <= MAX_NODES, "Road graph exceeds MAX_NODES");
+
+const RoadGraph BUILTIN_GRAPH = {
+  1842, 6120,
+  2243464, 9194462,
+  (float)(METERS_PER_STEP * 0.924315476),
+  NODE_LAT, NODE_LNG, FIRST_EDGE, EDGE_TO, EDGE_LENGTH_M
+};
+
+}  // namespace route
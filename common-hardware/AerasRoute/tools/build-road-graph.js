@@ -0,0 +1,257 @@
+#!/usr/bin/env node
+// Builds common-hardware/AerasRoute/RoadGraphData.cpp, the road graph the
+// rickshaw routes on (format: AerasRoute.h).
+//
+//   node tools/build-road-graph.js                 synthetic Raozan-Pahartoli network
+//   node tools/build-road-graph.js --osm area.json Overpass API JSON export
+//
+// Overpass query for a real export (ways with their nodes):
+//   [out:json];way["highway"](22.435,91.945,22.490,92.010);(._;>;);out;
+//
+// OSM ways are split at junctions and dead ends; the shape points between
+// are folded into the edge length. The synthetic network is a jittered
+// ~150 m street grid over the same box with missing blocks, a few
+// diagonals, and a river (standing in for the Halda) crossed by three
+// bridges, so routes between the banks detour the way real ones do.
+// Output is deterministic for the same input.
+
+'use strict';
+
+const fs = require('fs');
+const path = require('path');
+
+const EARTH_RADIUS_M = 6371000;
+const DEG = Math.PI / 180;
+const METERS_PER_STEP = EARTH_RADIUS_M * DEG / 1e5;   // 1e-5 degree
+const MAX_NODES = 2048;                               // route::MAX_NODES
+
+const BOUNDS = { south: 22.435, west: 91.945, north: 22.490, east: 92.010 };
+const ROADS = new Set([
+  'primary', 'secondary', 'tertiary', 'unclassified', 'residential', 'service',
+  'living_street', 'track', 'road', 'primary_link', 'secondary_link', 'tertiary_link'
+]);
+
+// ===== Synthetic network =====
+
+function lcg(seed) {
+  let state = seed >>> 0;
+  return () => {
+    state = (Math.imul(state, 1664525) + 1013904223) >>> 0;
+    return (state >>> 8) / 16777216;
+  };
+}
+
+function riverLng(lat) {
+  return 91.9775 + 0.0035 * Math.sin((lat - BOUNDS.south) * 140);
+}
+
+function syntheticGraph() {
+  const random = lcg(20240601);
+  const spacingM = 150;
+  const metersPerDegLng = EARTH_RADIUS_M * DEG * Math.cos(BOUNDS.south * DEG);
+  const rows = Math.floor((BOUNDS.north - BOUNDS.south) * EARTH_RADIUS_M * DEG / spacingM) + 1;
+  const cols = Math.floor((BOUNDS.east - BOUNDS.west) * metersPerDegLng / spacingM) + 1;
+  const bridgeRows = new Set([Math.floor(rows * 0.2), Math.floor(rows * 0.55), Math.floor(rows * 0.85)]);
+
+  const nodes = [];
+  for (let r = 0; r < rows; r++) {
+    for (let c = 0; c < cols; c++) {
+      const jitterN = (random() - 0.5) * 80;
+      const jitterE = (random() - 0.5) * 80;
+      nodes.push({
+        lat: BOUNDS.south + (r * spacingM + jitterN) / (EARTH_RADIUS_M * DEG),
+        lng: BOUNDS.west + (c * spacingM + jitterE) / metersPerDegLng
+      });
+    }
+  }
+
+  const edges = [];
+  const id = (r, c) => r * cols + c;
+  const crossesRiver = (a, b) => (a.lng < riverLng(a.lat)) !== (b.lng < riverLng(b.lat));
+  const link = (a, b, keep, bridge) => {
+    if (random() >= keep) return;
+    if (crossesRiver(nodes[a], nodes[b]) && !bridge) return;
+    const winding = 1 + random() * 0.25;   // Streets are not straight
+    edges.push({ from: a, to: b, winding, oneway: false });
+  };
+
+  for (let r = 0; r < rows; r++) {
+    for (let c = 0; c < cols; c++) {
+      if (c + 1 < cols) link(id(r, c), id(r, c + 1), 0.82, bridgeRows.has(r));
+      if (r + 1 < rows) link(id(r, c), id(r + 1, c), 0.82, false);
+      if (r + 1 < rows && c + 1 < cols) link(id(r, c), id(r + 1, c + 1), 0.08, false);
+    }
+  }
+  return { nodes, edges, source: `synthetic ${rows}x${cols} grid, ${spacingM} m spacing` };
+}
+
+// ===== OSM import =====
+
+function osmGraph(file) {
+  const elements = JSON.parse(fs.readFileSync(file, 'utf8')).elements || [];
+  const points = new Map();
+  const ways = [];
+  for (const element of elements) {
+    if (element.type === 'node') points.set(element.id, { lat: element.lat, lng: element.lon });
+    if (element.type === 'way' && element.tags && ROADS.has(element.tags.highway)) ways.push(element);
+  }
+
+  // Junctions and way ends become graph nodes
+  const uses = new Map();
+  for (const way of ways) {
+    way.nodes.forEach((ref, i) => {
+      const end = i === 0 || i === way.nodes.length - 1;
+      uses.set(ref, (uses.get(ref) || 0) + (end ? 2 : 1));
+    });
+  }
+
+  const index = new Map();
+  const nodes = [];
+  const nodeFor = (ref) => {
+    if (!index.has(ref)) {
+      index.set(ref, nodes.length);
+      nodes.push(points.get(ref));
+    }
+    return index.get(ref);
+  };
+
+  const edges = [];
+  for (const way of ways) {
+    const refs = way.nodes.filter(ref => points.has(ref));
+    const oneway = way.tags.oneway === 'yes' || way.tags.oneway === '1';
+    const reverse = way.tags.oneway === '-1';
+    let from = refs[0];
+    let meters = 0;
+    for (let i = 1; i < refs.length; i++) {
+      meters += haversine(points.get(refs[i - 1]), points.get(refs[i]));
+      if (uses.get(refs[i]) < 2 && i < refs.length - 1) continue;
+
+      const a = nodeFor(from), b = nodeFor(refs[i]);
+      if (a !== b) {
+        const straight = haversine(nodes[a], nodes[b]);
+        const edge = { from: a, to: b, winding: straight > 0 ? meters / straight : 1, oneway: oneway || reverse };
+        if (reverse) [edge.from, edge.to] = [b, a];
+        edges.push(edge);
+      }
+      from = refs[i];
+      meters = 0;
+    }
+  }
+  return { nodes, edges, source: `OSM ${path.basename(file)}, ${ways.length} ways` };
+}
+
+function haversine(a, b) {
+  const dLat = (b.lat - a.lat) * DEG;
+  const dLng = (b.lng - a.lng) * DEG;
+  const h = Math.sin(dLat / 2) ** 2 + Math.cos(a.lat * DEG) * Math.cos(b.lat * DEG) * Math.sin(dLng / 2) ** 2;
+  return 2 * EARTH_RADIUS_M * Math.asin(Math.sqrt(h));
+}
+
+// ===== Quantize, keep the largest connected part, pack as CSR =====
+
+function pack({ nodes, edges, source }) {
+  const originLatE5 = Math.floor(Math.min(...nodes.map(n => n.lat)) * 1e5);
+  const originLngE5 = Math.floor(Math.min(...nodes.map(n => n.lng)) * 1e5);
+  const metersPerStepLng = METERS_PER_STEP * Math.cos(originLatE5 / 1e5 * DEG);
+  const quantized = nodes.map(n => ({
+    lat: Math.round(n.lat * 1e5) - originLatE5,
+    lng: Math.round(n.lng * 1e5) - originLngE5
+  }));
+  for (const q of quantized) {
+    if (q.lat > 32767 || q.lng > 32767) throw new Error('area too large for int16 steps');
+  }
+
+  // Directed edges; length from the quantized points, the same flat
+  // projection the firmware's heuristic uses, rounded up
+  const directed = [];
+  for (const edge of edges) {
+    const a = quantized[edge.from], b = quantized[edge.to];
+    const straight = Math.hypot((b.lat - a.lat) * METERS_PER_STEP, (b.lng - a.lng) * metersPerStepLng);
+    const length = Math.max(1, Math.ceil(straight * edge.winding));
+    directed.push([edge.from, edge.to, length]);
+    if (!edge.oneway) directed.push([edge.to, edge.from, length]);
+  }
+
+  // Largest weakly connected component
+  const parent = nodes.map((_, i) => i);
+  const find = (i) => (parent[i] === i ? i : (parent[i] = find(parent[i])));
+  for (const [a, b] of directed) parent[find(a)] = find(b);
+  const sizes = new Map();
+  nodes.forEach((_, i) => sizes.set(find(i), (sizes.get(find(i)) || 0) + 1));
+  const main = [...sizes.entries()].sort((x, y) => y[1] - x[1])[0][0];
+
+  const remap = new Map();
+  nodes.forEach((_, i) => { if (find(i) === main) remap.set(i, remap.size); });
+  if (remap.size > MAX_NODES) throw new Error(`${remap.size} nodes > MAX_NODES ${MAX_NODES}`);
+
+  const kept = [...remap.keys()];
+  const adjacency = kept.map(() => []);
+  for (const [a, b, length] of directed) {
+    if (remap.has(a) && remap.has(b)) adjacency[remap.get(a)].push([remap.get(b), length]);
+  }
+  adjacency.forEach(list => list.sort((x, y) => x[0] - y[0]));
+
+  const firstEdge = [0];
+  const edgeTo = [], edgeLength = [];
+  for (const list of adjacency) {
+    for (const [to, length] of list) {
+      edgeTo.push(to);
+      edgeLength.push(length);
+    }
+    firstEdge.push(edgeTo.length);
+  }
+  if (edgeTo.length > 0xFFFF) throw new Error('too many edges for uint16 indices');
+
+  return {
+    source, originLatE5, originLngE5,
+    nodeLat: kept.map(i => quantized[i].lat),
+    nodeLng: kept.map(i => quantized[i].lng),
+    firstEdge, edgeTo, edgeLength
+  };
+}
+
+// ===== Emit =====
+
+function array(type, name, values) {
+  const lines = [];
+  for (let i = 0; i < values.length; i += 16) lines.push('  ' + values.slice(i, i + 16).join(', '));
+  return `static const ${type} ${name}[] PROGMEM = {\n${lines.join(',\n')}\n};\n`;
+}
+
+function emit(graph, file) {
+  const nodeCount = graph.nodeLat.length;
+  const edgeCount = graph.edgeTo.length;
+  const flashBytes = nodeCount * 4 + (nodeCount + 1) * 2 + edgeCount * 4;
+  const text =
+`// Generated by tools/build-road-graph.js - do not edit.
+// Source: ${graph.source}
+// ${nodeCount} nodes, ${edgeCount} directed edges, ${flashBytes} bytes of flash
+
+#include "AerasRoute.h"
+
+namespace route {
+
+${array('int16_t', 'NODE_LAT', graph.nodeLat)}
+${array('int16_t', 'NODE_LNG', graph.nodeLng)}
+${array('uint16_t', 'FIRST_EDGE', graph.firstEdge)}
+${array('uint16_t', 'EDGE_TO', graph.edgeTo)}
+${array('uint16_t', 'EDGE_LENGTH_M', graph.edgeLength)}
+static_assert(sizeof(NODE_LAT) / sizeof(NODE_LAT[0]) <= MAX_NODES, "Road graph exceeds MAX_NODES");
+
+const RoadGraph BUILTIN_GRAPH = {
+  ${nodeCount}, ${edgeCount},
+  ${graph.originLatE5}, ${graph.originLngE5},
+  (float)(METERS_PER_STEP * ${Math.cos(graph.originLatE5 / 1e5 * DEG).toFixed(9)}),
+  NODE_LAT, NODE_LNG, FIRST_EDGE, EDGE_TO, EDGE_LENGTH_M
+};
+
+}  // namespace route
+`;
+  fs.writeFileSync(file, text);
+  console.log(`${file}: ${nodeCount} nodes, ${edgeCount} edges, ${flashBytes} bytes (${graph.source})`);
+}
+
+const args = process.argv.slice(2);
+const osmIndex = args.indexOf('--osm');
+const raw = osmIndex >= 0 ? osmGraph(args[osmIndex + 1]) : syntheticGraph();
+emit(pack(raw), path.join(__dirname, '..', 'RoadGraphData.cpp'));
@@ -0,0 +1,99 @@
+#include "AerasScheduler.h"
+
+// Handle layout: high byte = slot generation, low byte = slot index
+static TaskHandle makeHandle(uint8_t slot, uint8_t generation) {
+  return (TaskHandle)(((generation & 0x7F) << 8) | slot);
+}
+
+Scheduler::Scheduler() : maxLatenessMs(0) {
+  for (uint8_t i = 0; i < MAX_TASKS; i++) {
+    tasks[i].callback = nullptr;
+    tasks[i].due = 0;
+    tasks[i].period = 0;
+    tasks[i].generation = 0;
+    tasks[i].active = false;
+  }
+}
+
+TaskHandle Scheduler::schedule(uint32_t delayMs, uint32_t periodMs, TaskCallback callback) {
+  if (callback == nullptr) return NO_TASK;
+
+  for (uint8_t i = 0; i < MAX_TASKS; i++) {
+    if (tasks[i].active) continue;
+
+    tasks[i].callback = callback;
+    tasks[i].due = millis() + delayMs;
+    tasks[i].period = periodMs;
+    tasks[i].generation++;
+    tasks[i].active = true;
+    return makeHandle(i, tasks[i].generation);
+  }
+
+  Serial.println("✗ Scheduler full - task dropped");
+  return NO_TASK;
+}
+
+TaskHandle Scheduler::after(uint32_t delayMs, TaskCallback callback) {
+  return schedule(delayMs, 0, callback);
+}
+
+TaskHandle Scheduler::every(uint32_t periodMs, TaskCallback callback) {
+  return schedule(periodMs, periodMs, callback);
+}
+
+void Scheduler::cancel(TaskHandle handle) {
+  if (handle < 0) return;
+  uint8_t slot = handle & 0xFF;
+  if (slot >= MAX_TASKS) return;
+  if (makeHandle(slot, tasks[slot].generation) != handle) return;
+  tasks[slot].active = false;
+}
+
+void Scheduler::cancel(TaskCallback callback) {
+  for (uint8_t i = 0; i < MAX_TASKS; i++) {
+    if (tasks[i].active && tasks[i].callback == callback) {
+      tasks[i].active = false;
+    }
+  }
+}
+
+bool Scheduler::isPending(TaskCallback callback) const {
+  for (uint8_t i = 0; i < MAX_TASKS; i++) {
+    if (tasks[i].active && tasks[i].callback == callback) return true;
+  }
+  return false;
+}
+
+uint8_t Scheduler::activeCount() const {
+  uint8_t count = 0;
+  for (uint8_t i = 0; i < MAX_TASKS; i++) {
+    if (tasks[i].active) count++;
+  }
+  return count;
+}
+
+void Scheduler::run() {
+  for (uint8_t i = 0; i < MAX_TASKS; i++) {
+    Task& task = tasks[i];
+    if (!task.active) continue;
+
+    uint32_t now = millis();
+    // Signed difference keeps this correct across the millis() rollover
+    int32_t late = (int32_t)(now - task.due);
+    if (late < 0) continue;
+
+    if ((uint32_t)late > maxLatenessMs) maxLatenessMs = late;
+
+    TaskCallback callback = task.callback;
+    if (task.period > 0) {
+      // Re-arm from the deadline, not from now, so periodic tasks don't drift
+      task.due += task.period;
+      if ((int32_t)(now - task.due) >= 0) task.due = now + task.period;
+    } else {
+      task.active = false;
+    }
+
+    // Callback may schedule or cancel tasks, including this slot
+    callback();
+  }
+}
@@ -0,0 +1,63 @@
+/*
+ * AERAS Scheduler - cooperative millisecond task scheduler
+ * Replaces blocking delay() calls with timer-driven continuations so
+ * loop() always returns within a few milliseconds.
+ *
+ * Worst-case reaction time to a sensor event is bounded by the period of
+ * the task that polls it plus the longest single task body (see
+ * maxLateness()).
+ */
+
+#ifndef AERAS_SCHEDULER_H
+#define AERAS_SCHEDULER_H
+
+#include <Arduino.h>
+
+typedef void (*TaskCallback)();
+typedef int16_t TaskHandle;
+
+const TaskHandle NO_TASK = -1;
+
+class Scheduler {
+public:
+  static const uint8_t MAX_TASKS = 16;
+
+  Scheduler();
+
+  // Run callback once, delayMs from now
+  TaskHandle after(uint32_t delayMs, TaskCallback callback);
+
+  // Run callback every periodMs, first run periodMs from now
+  TaskHandle every(uint32_t periodMs, TaskCallback callback);
+
+  // Cancel a single task (stale handles are ignored)
+  void cancel(TaskHandle handle);
+
+  // Cancel every pending task bound to this callback
+  void cancel(TaskCallback callback);
+
+  bool isPending(TaskCallback callback) const;
+
+  // Fire all due tasks; call from loop()
+  void run();
+
+  // Largest observed gap between a task's deadline and its execution
+  uint32_t maxLateness() const { return maxLatenessMs; }
+  uint8_t activeCount() const;
+
+private:
+  struct Task {
+    TaskCallback callback;
+    uint32_t due;
+    uint32_t period;   // 0 = one-shot
+    uint8_t generation;
+    bool active;
+  };
+
+  TaskHandle schedule(uint32_t delayMs, uint32_t periodMs, TaskCallback callback);
+
+  Task tasks[MAX_TASKS];
+  uint32_t maxLatenessMs;
+};
+
+#endif
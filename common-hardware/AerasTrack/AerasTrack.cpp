@@ -0,0 +1,162 @@
+#include "AerasTrack.h"
+#include <AerasCodec.h>
+#include <AerasGeo.h>
+
+static const float METERS_PER_E6 = geo::EARTH_RADIUS_M * DEG_TO_RAD / 1e6;
+static const size_t MAX_DELTA_BYTES = TrajectoryRecorder::MAX_DELTA_CHARS * 3 / 4;
+static const char BASE64URL[] =
+  "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_";
+
+// ===== Wire format =====
+
+// Small magnitudes of either sign -> small unsigned values
+static uint32_t zigzag(int32_t value) {
+  return ((uint32_t)value << 1) ^ (uint32_t)(value >> 31);
+}
+
+// 7 bits per byte, high bit = more follows; returns bytes written
+static size_t putVarint(uint8_t* out, uint32_t value) {
+  size_t n = 0;
+  while (value >= 0x80) {
+    out[n++] = (uint8_t)(value | 0x80);
+    value >>= 7;
+  }
+  out[n++] = (uint8_t)value;
+  return n;
+}
+
+// Unpadded; out must hold (length * 4 + 2) / 3 + 1 chars
+static void putBase64url(char* out, const uint8_t* data, size_t length) {
+  size_t i = 0;
+  for (; i + 2 < length; i += 3) {
+    uint32_t v = (data[i] << 16) | (data[i + 1] << 8) | data[i + 2];
+    *out++ = BASE64URL[(v >> 18) & 63];
+    *out++ = BASE64URL[(v >> 12) & 63];
+    *out++ = BASE64URL[(v >> 6) & 63];
+    *out++ = BASE64URL[v & 63];
+  }
+  if (i < length) {
+    uint32_t v = data[i] << 16;
+    if (i + 1 < length) v |= data[i + 1] << 8;
+    *out++ = BASE64URL[(v >> 18) & 63];
+    *out++ = BASE64URL[(v >> 12) & 63];
+    if (i + 1 < length) *out++ = BASE64URL[(v >> 6) & 63];
+  }
+  *out = '\0';
+}
+
+// ===== Recorder =====
+
+TrajectoryRecorder::TrajectoryRecorder()
+  : count(0), inFlight(0), anchored(false), northMps(0), eastMps(0), metersPerE6Lng(METERS_PER_E6),
+    fastPath(false), samples(0), recorded(0), dropped(0), batches(0), bytesSent(0) {
+  memset(&anchor, 0, sizeof(anchor));
+}
+
+// Distance between the sample and where the anchor's velocity puts us by
+// now; the fast path predicts no movement, so every FAST_THRESHOLD_M moved
+// is reported
+float TrajectoryRecorder::predictionError(const TrackPoint& point) const {
+  float seconds = fastPath ? 0 : (point.ms - anchor.ms) / 1000.0f;
+  float north = (point.latE6 - anchor.latE6) * METERS_PER_E6 - northMps * seconds;
+  float east = (point.lngE6 - anchor.lngE6) * metersPerE6Lng - eastMps * seconds;
+  return sqrtf(north * north + east * east);
+}
+
+bool TrajectoryRecorder::sample(double lat, double lng, uint32_t nowMs) {
+  samples++;
+  TrackPoint point = {geo::toE6(lat), geo::toE6(lng), nowMs};
+
+  // A batch about to leave ends on a fresh point, so the backend's position
+  // is current as of the upload
+  bool closing = count > 0 && inFlight == 0 && nowMs - points[0].ms >= BATCH_AGE_MS;
+
+  if (anchored && !closing && nowMs - anchor.ms < KEEPALIVE_MS) {
+    uint16_t threshold = fastPath ? FAST_THRESHOLD_M : THRESHOLD_M;
+    if (predictionError(point) < threshold) return false;
+  }
+
+  record(point);
+  return true;
+}
+
+void TrajectoryRecorder::record(const TrackPoint& point) {
+  if (anchored && point.ms != anchor.ms) {
+    float seconds = (point.ms - anchor.ms) / 1000.0f;
+    northMps = (point.latE6 - anchor.latE6) * METERS_PER_E6 / seconds;
+    eastMps = (point.lngE6 - anchor.lngE6) * metersPerE6Lng / seconds;
+  } else {
+    northMps = 0;
+    eastMps = 0;
+    metersPerE6Lng = METERS_PER_E6 * cosf(point.latE6 / 1e6f * DEG_TO_RAD);
+  }
+  anchor = point;
+  anchored = true;
+  recorded++;
+
+  if (count == CAPACITY) {
+    dropped++;
+    if (inFlight >= count) return;  // Ring is all in flight; this point is lost
+    memmove(&points[inFlight], &points[inFlight + 1], (count - inFlight - 1) * sizeof(TrackPoint));
+    count--;
+  }
+  points[count++] = point;
+}
+
+bool TrajectoryRecorder::flushDue(uint32_t nowMs) const {
+  if (inFlight > 0 || count == 0) return false;
+  if (fastPath || count >= FLUSH_AT) return true;
+  return nowMs - points[0].ms >= BATCH_AGE_MS;
+}
+
+size_t TrajectoryRecorder::encodeBatch(char* buf, size_t size, const char* rickshawID, uint32_t nowMs) {
+  if (inFlight > 0 || count == 0) return 0;
+
+  // Times are rounded against the first point, so the error never accumulates
+  uint8_t bytes[MAX_DELTA_BYTES];
+  size_t used = 0;
+  uint8_t taken = 1;
+  uint32_t lastUnits = 0;
+  for (; taken < count; taken++) {
+    const TrackPoint& previous = points[taken - 1];
+    const TrackPoint& point = points[taken];
+    uint32_t units = (point.ms - points[0].ms + TIME_UNIT_MS / 2) / TIME_UNIT_MS;
+
+    uint8_t encoded[15];
+    size_t n = putVarint(encoded, zigzag(point.latE6 - previous.latE6));
+    n += putVarint(encoded + n, zigzag(point.lngE6 - previous.lngE6));
+    n += putVarint(encoded + n, units - lastUnits);
+    if (used + n > MAX_DELTA_BYTES) break;
+
+    memcpy(bytes + used, encoded, n);
+    used += n;
+    lastUnits = units;
+  }
+
+  char deltas[MAX_DELTA_CHARS + 1];
+  putBase64url(deltas, bytes, used);
+
+  size_t length = codec::encodeTrack(buf, size, rickshawID, points[0].latE6, points[0].lngE6,
+                                     nowMs - points[0].ms, deltas);
+  if (length == 0) return 0;
+
+  inFlight = taken;
+  batches++;
+  bytesSent += length;
+  return length;
+}
+
+void TrajectoryRecorder::acknowledge(bool stored) {
+  if (stored && inFlight > 0) {
+    memmove(&points[0], &points[inFlight], (count - inFlight) * sizeof(TrackPoint));
+    count -= inFlight;
+  }
+  inFlight = 0;
+}
+
+void TrajectoryRecorder::printStats() {
+  Serial.println("Track: " + String(recorded) + "/" + String(samples) + " samples kept, " +
+                 String(count) + " queued, " + String(dropped) + " dropped" +
+                 (fastPath ? " (fast path)" : ""));
+  Serial.println("Track uplink: " + String(batches) + " batches, " + String(bytesSent) + " bytes");
+}
@@ -0,0 +1,97 @@
+/*
+ * AERAS Track - dead-reckoned, delta-encoded trajectory batches
+ * Instead of posting the position on a fixed timer, every sample is checked
+ * against where the rickshaw should be if it kept the velocity of its last
+ * two recorded points. Only samples that miss the prediction by more than
+ * THRESHOLD_M are kept, so a straight run at steady speed records almost
+ * nothing and a parked rickshaw records one keep-alive point every
+ * KEEPALIVE_MS. The backend's stored position can therefore trail a long
+ * straight run by up to KEEPALIVE_MS; dispatch ranking does not depend on
+ * it (the /ride/pending poll carries the live position).
+ *
+ * Kept points wait in a fixed ring and leave in one POST /rickshaw/track:
+ * the first point in microdegrees, the rest as zigzag varints of the
+ * microdegree and 100 ms deltas, base64url packed into a single string
+ * field (~5 bytes a point). A batch goes out when its oldest point is
+ * BATCH_AGE_MS old (ending on the current sample), the ring is nearly
+ * full, or - in fast-path mode, while heading to a pickup - as soon as the
+ * rickshaw has moved FAST_THRESHOLD_M from the last point sent.
+ *
+ * Points stay queued until acknowledge(true); a failed POST resends them
+ * with the next batch. When the ring overflows the oldest unsent point is
+ * dropped.
+ *
+ * Threading: UI task only.
+ */
+
+#ifndef AERAS_TRACK_H
+#define AERAS_TRACK_H
+
+#include <Arduino.h>
+
+struct TrackPoint {
+  int32_t latE6;
+  int32_t lngE6;
+  uint32_t ms;          // millis() of the sample
+};
+
+class TrajectoryRecorder {
+public:
+  static const uint8_t CAPACITY = 16;
+  static const uint8_t FLUSH_AT = 12;             // Send early once this many are queued
+  static const uint16_t THRESHOLD_M = 25;         // Allowed dead-reckoning error
+  static const uint16_t FAST_THRESHOLD_M = 10;    // ... while heading to a pickup
+  static const uint32_t BATCH_AGE_MS = 30000;
+  static const uint32_t KEEPALIVE_MS = 120000;    // Record at least this often
+  static const uint16_t TIME_UNIT_MS = 100;       // Resolution of the time deltas
+  static const size_t MAX_DELTA_CHARS = 96;       // Fits a 15-char ID in a 192-byte body
+
+  TrajectoryRecorder();
+
+  // Feed every position sample; true if it was recorded
+  bool sample(double lat, double lng, uint32_t nowMs);
+
+  // Tighter threshold, and every recorded point is due at once
+  void setFastPath(bool enabled) { fastPath = enabled; }
+  bool fastPathEnabled() const { return fastPath; }
+
+  // Unsent points exist and one of the batch triggers has fired
+  bool flushDue(uint32_t nowMs) const;
+  uint8_t pending() const { return count - inFlight; }
+
+  // Write the /rickshaw/track body for the oldest queued points into buf
+  // and mark them in flight; 0 if there is nothing to send or a batch is
+  // already out
+  size_t encodeBatch(char* buf, size_t size, const char* rickshawID, uint32_t nowMs);
+
+  // Result of the batch from encodeBatch: stored points leave the ring,
+  // failed ones are resent next time
+  void acknowledge(bool stored);
+
+  void printStats();
+
+private:
+  float predictionError(const TrackPoint& point) const;
+  void record(const TrackPoint& point);
+
+  TrackPoint points[CAPACITY];  // Oldest first
+  uint8_t count;
+  uint8_t inFlight;             // Leading points in the outstanding batch
+
+  // Dead-reckoning state: last recorded point and the velocity into it
+  bool anchored;
+  TrackPoint anchor;
+  float northMps;
+  float eastMps;
+  float metersPerE6Lng;
+
+  bool fastPath;
+
+  uint32_t samples;
+  uint32_t recorded;
+  uint32_t dropped;
+  uint32_t batches;
+  uint32_t bytesSent;
+};
+
+#endif
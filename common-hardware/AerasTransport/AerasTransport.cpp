@@ -0,0 +1,114 @@
+#include "AerasTransport.h"
+
+static const char* COLLECTED_HEADERS[] = { "ETag" };
+
+Transport::Transport()
+  : open(false), lastUsedMs(0), connects(0), requests(0), failures(0) {
+  lastETag[0] = '\0';
+}
+
+void Transport::begin(const char* url) {
+  baseUrl = url;
+  http.setReuse(true);
+}
+
+int Transport::get(const String& path, uint16_t timeoutMs, const char* ifNoneMatch) {
+  return send("GET", path, nullptr, timeoutMs, ifNoneMatch);
+}
+
+int Transport::post(const String& path, const char* body, uint16_t timeoutMs) {
+  return send("POST", path, body, timeoutMs);
+}
+
+int Transport::attempt(const char* method, const String& url, const char* body, uint16_t timeoutMs,
+                       const char* ifNoneMatch) {
+  if (!client.connected()) connects++;
+
+  http.begin(client, url);
+  http.setConnectTimeout(timeoutMs);
+  http.setTimeout(timeoutMs);
+  http.collectHeaders(COLLECTED_HEADERS, 1);
+  if (ifNoneMatch != nullptr && ifNoneMatch[0] != '\0') {
+    http.addHeader("If-None-Match", ifNoneMatch);
+  }
+  open = true;
+
+  if (body != nullptr) {
+    http.addHeader("Content-Type", "application/json");
+    return http.sendRequest(method, (uint8_t*)body, strlen(body));
+  }
+  return http.sendRequest(method);
+}
+
+// The server cannot have acted on a request whose headers never went out
+bool Transport::neverSent(int httpCode) {
+  return httpCode == HTTPC_ERROR_CONNECTION_REFUSED || httpCode == HTTPC_ERROR_SEND_HEADER_FAILED ||
+         httpCode == HTTPC_ERROR_NOT_CONNECTED;
+}
+
+int Transport::send(const char* method, const String& path, const char* body, uint16_t timeoutMs,
+                    const char* ifNoneMatch) {
+  if (WiFi.status() != WL_CONNECTED) return HTTPC_ERROR_CONNECTION_REFUSED;
+
+  end();
+  requests++;
+
+  String url = baseUrl + path;
+  bool idempotent = body == nullptr;
+  // A socket the server may already have closed is not worth a POST
+  if (!idempotent && client.connected() && millis() - lastUsedMs >= IDLE_REUSE_MS) reset();
+  bool reused = client.connected();
+  int httpCode = attempt(method, url, body, timeoutMs, ifNoneMatch);
+  lastUsedMs = millis();
+
+  // Server may have closed an idle keep-alive socket - retry once fresh.
+  // A POST that may have reached the server (read timeout, lost reply) is
+  // never sent twice; the caller decides.
+  if (httpCode < 0 && reused && (idempotent || neverSent(httpCode))) {
+    reset();
+    httpCode = attempt(method, url, body, timeoutMs, ifNoneMatch);
+    lastUsedMs = millis();
+  }
+
+  if (httpCode < 0) {
+    failures++;
+    reset();
+    lastETag[0] = '\0';
+    return httpCode;
+  }
+
+  String etagHeader = http.header("ETag");
+  strncpy(lastETag, etagHeader.c_str(), sizeof(lastETag) - 1);
+  lastETag[sizeof(lastETag) - 1] = '\0';
+  return httpCode;
+}
+
+Stream& Transport::stream() {
+  return http.getStream();
+}
+
+String Transport::body() {
+  if (!open) return "";
+  String response = http.getString();
+  end();
+  return response;
+}
+
+void Transport::end() {
+  if (!open) return;
+  http.end();  // Keeps the socket when the server allows keep-alive
+  open = false;
+}
+
+void Transport::reset() {
+  if (open) {
+    http.end();
+    open = false;
+  }
+  client.stop();
+}
+
+void Transport::printStats() {
+  Serial.println("HTTP: " + String(requests) + " requests, " + String(connects) +
+                 " connects, " + String(failures) + " failures");
+}
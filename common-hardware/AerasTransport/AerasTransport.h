@@ -0,0 +1,75 @@
+/*
+ * AERAS Transport - persistent keep-alive HTTP client
+ * One TCP connection to the backend is opened once and reused for every
+ * request. A GET that fails on a reused connection is retried once on a
+ * fresh connection. A POST (accept, pickup, complete are not idempotent) is
+ * retried only when it provably never left - the connect or header send
+ * failed - and is not sent on a socket idle long enough for the server to
+ * have dropped it. connectCount() vs requestCount() shows how much reuse
+ * is actually happening.
+ */
+
+#ifndef AERAS_TRANSPORT_H
+#define AERAS_TRANSPORT_H
+
+#include <Arduino.h>
+#include <WiFi.h>
+#include <HTTPClient.h>
+
+class Transport {
+public:
+  static const uint16_t DEFAULT_TIMEOUT_MS = 3000;
+  // Below the server's keepAliveTimeout (65 s)
+  static const uint32_t IDLE_REUSE_MS = 60000;
+
+  Transport();
+
+  // baseUrl e.g. "http://10.0.0.5:3000/api"; paths are appended to it
+  void begin(const char* baseUrl);
+
+  // Return the HTTP status code (negative = transport error).
+  // The response stays open until body()/end() or the next request.
+  // ifNoneMatch: ETag from a previous response; a 304 means "unchanged"
+  int get(const String& path, uint16_t timeoutMs = DEFAULT_TIMEOUT_MS, const char* ifNoneMatch = nullptr);
+  int post(const String& path, const char* body, uint16_t timeoutMs = DEFAULT_TIMEOUT_MS);
+
+  // Stream the response body of the last request (for AerasCodec decoders)
+  Stream& stream();
+
+  // ETag of the last response ("" if none)
+  const char* etag() const { return lastETag; }
+
+  // Read the whole response body of the last request (debugging only)
+  String body();
+
+  // Finish the last request; the connection is kept for reuse
+  void end();
+
+  // Drop the connection (e.g. after Wi-Fi loss)
+  void reset();
+
+  uint32_t connectCount() const { return connects; }
+  uint32_t requestCount() const { return requests; }
+  uint32_t failureCount() const { return failures; }
+  void printStats();
+
+private:
+  int send(const char* method, const String& path, const char* body, uint16_t timeoutMs,
+           const char* ifNoneMatch = nullptr);
+  int attempt(const char* method, const String& url, const char* body, uint16_t timeoutMs,
+              const char* ifNoneMatch);
+  static bool neverSent(int httpCode);
+
+  WiFiClient client;
+  HTTPClient http;
+  String baseUrl;
+  bool open;
+  uint32_t lastUsedMs;
+  char lastETag[48];
+
+  uint32_t connects;
+  uint32_t requests;
+  uint32_t failures;
+};
+
+#endif
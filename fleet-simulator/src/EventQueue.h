@@ -0,0 +1,63 @@
+/*
+ * Discrete-event core: a virtual millisecond clock and a time-ordered
+ * queue of actions. Events at the same time run in the order they were
+ * scheduled, so a run is fully determined by the seed.
+ */
+
+#ifndef FLEET_EVENT_QUEUE_H
+#define FLEET_EVENT_QUEUE_H
+
+#include <cstdint>
+#include <functional>
+#include <queue>
+#include <vector>
+
+class EventQueue {
+public:
+  typedef std::function<void()> Action;
+
+  uint64_t now() const { return nowMs; }
+  uint64_t executed() const { return executedCount; }
+  size_t pending() const { return events.size(); }
+  bool empty() const { return events.empty(); }
+  uint64_t nextTime() const { return events.top().timeMs; }
+
+  void at(uint64_t timeMs, Action action) {
+    events.push(Event{ timeMs < nowMs ? nowMs : timeMs, sequence++, std::move(action) });
+  }
+
+  void after(uint64_t delayMs, Action action) {
+    at(nowMs + delayMs, std::move(action));
+  }
+
+  // Advance the clock to the earliest event and run it; false when idle
+  bool runNext() {
+    if (events.empty()) return false;
+    Event event = std::move(const_cast<Event&>(events.top()));
+    events.pop();
+    nowMs = event.timeMs;
+    executedCount++;
+    event.action();
+    return true;
+  }
+
+private:
+  struct Event {
+    uint64_t timeMs;
+    uint64_t sequence;
+    Action action;
+  };
+
+  struct Later {
+    bool operator()(const Event& a, const Event& b) const {
+      return a.timeMs != b.timeMs ? a.timeMs > b.timeMs : a.sequence > b.sequence;
+    }
+  };
+
+  std::priority_queue<Event, std::vector<Event>, Later> events;
+  uint64_t nowMs = 0;
+  uint64_t sequence = 0;
+  uint64_t executedCount = 0;
+};
+
+#endif
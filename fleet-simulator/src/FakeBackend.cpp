@@ -0,0 +1,488 @@
+#include "FakeBackend.h"
+#include <AerasGeo.h>
+#include <algorithm>
+#include <cstdio>
+
+// ===== Request helpers =====
+// Bodies come from the firmware codec: flat JSON objects, no escapes
+
+static std::string jsonField(const std::string& body, const char* key) {
+  std::string quoted = std::string("\"") + key + "\"";
+  size_t at = body.find(quoted);
+  if (at == std::string::npos) return "";
+  at = body.find(':', at + quoted.size());
+  if (at == std::string::npos) return "";
+  at++;
+  while (at < body.size() && body[at] == ' ') at++;
+  if (at < body.size() && body[at] == '"') {
+    size_t end = body.find('"', at + 1);
+    return body.substr(at + 1, end - at - 1);
+  }
+  size_t end = body.find_first_of(",}", at);
+  return body.substr(at, end - at);
+}
+
+static std::string queryParam(const std::string& query, const char* key) {
+  std::string prefix = std::string(key) + "=";
+  size_t at = 0;
+  while (at < query.size()) {
+    size_t end = query.find('&', at);
+    if (end == std::string::npos) end = query.size();
+    if (query.compare(at, prefix.size(), prefix) == 0) {
+      return query.substr(at + prefix.size(), end - at - prefix.size());
+    }
+    at = end + 1;
+  }
+  return "";
+}
+
+// Unpadded base64url, as AerasTrack packs its deltas; false on a bad character
+static bool base64urlDecode(const std::string& text, std::vector<uint8_t>& out) {
+  uint32_t bits = 0;
+  int count = 0;
+  for (char c : text) {
+    int value;
+    if (c >= 'A' && c <= 'Z') value = c - 'A';
+    else if (c >= 'a' && c <= 'z') value = c - 'a' + 26;
+    else if (c >= '0' && c <= '9') value = c - '0' + 52;
+    else if (c == '-') value = 62;
+    else if (c == '_') value = 63;
+    else return false;
+
+    bits = (bits << 6) | value;
+    count += 6;
+    if (count >= 8) {
+      count -= 8;
+      out.push_back((uint8_t)(bits >> count));
+    }
+  }
+  return true;
+}
+
+static bool readVarint(const std::vector<uint8_t>& in, size_t& at, uint32_t& value) {
+  value = 0;
+  for (int shift = 0; shift < 35 && at < in.size(); shift += 7) {
+    uint8_t byte = in[at++];
+    value |= (uint32_t)(byte & 0x7f) << shift;
+    if ((byte & 0x80) == 0) return true;
+  }
+  return false;
+}
+
+static hal::HttpResponse reply(int code, const std::string& body) {
+  return hal::HttpResponse{ code, body, {} };
+}
+
+static hal::HttpResponse error(int code, const char* message) {
+  return reply(code, std::string("{\"error\":\"") + message + "\"}");
+}
+
+// Same tiers as calculatePoints() in server.js
+static int pointsFor(double distanceMeters) {
+  if (distanceMeters <= 0) return 10;
+  if (distanceMeters <= 50) return std::max(10 - (int)(distanceMeters / 10), 8);
+  if (distanceMeters <= 100) return 5;
+  return 0;
+}
+
+static std::string nullable(const std::string& value) {
+  return value.empty() ? "null" : "\"" + value + "\"";
+}
+
+// ===== FakeBackend =====
+
+FakeBackend::FakeBackend(EventQueue& clock, const std::vector<Block>& blocks, uint32_t pendingTimeoutMs)
+  : clock(clock), blocks(blocks), pendingTimeoutMs(pendingTimeoutMs) {}
+
+const char* FakeBackend::endpointName(Endpoint endpoint) {
+  switch (endpoint) {
+    case EP_RIDE_REQUEST: return "POST /ride/request";
+    case EP_RIDE_STATUS:  return "GET  /ride/status";
+    case EP_RIDE_STATE:   return "GET  /ride/:id/state";
+    case EP_REGISTER:     return "POST /rickshaw/register";
+    case EP_PENDING:      return "GET  /ride/pending";
+    case EP_ACCEPT:       return "POST /ride/accept";
+    case EP_PICKUP:       return "POST /ride/pickup";
+    case EP_COMPLETE:     return "POST /ride/complete";
+    case EP_LOCATION:     return "POST /rickshaw/location";
+    case EP_TRACK:        return "POST /rickshaw/track";
+    case EP_HEARTBEAT:    return "POST /rickshaw/heartbeat";
+    default:              return "(unknown route)";
+  }
+}
+
+hal::HttpResponse FakeBackend::handle(const hal::HttpRequest& request) {
+  // "http://host:port/api/ride/pending?rickshawID=..." -> "/ride/pending", "rickshawID=..."
+  std::string path = request.url;
+  size_t scheme = path.find("://");
+  if (scheme != std::string::npos) {
+    size_t slash = path.find('/', scheme + 3);
+    path = slash == std::string::npos ? "/" : path.substr(slash);
+  }
+  if (path.compare(0, 4, "/api") == 0) path = path.substr(4);
+
+  std::string query;
+  size_t mark = path.find('?');
+  if (mark != std::string::npos) {
+    query = path.substr(mark + 1);
+    path = path.substr(0, mark);
+  }
+
+  Endpoint endpoint = EP_UNKNOWN;
+  requestWrites = requestRows = 0;
+  hal::HttpResponse response = route(request.method, path, query, request, endpoint);
+
+  EndpointStats& stats = endpoints[endpoint];
+  stats.requests++;
+  stats.bytesOut += response.body.size();
+  stats.bytesIn += request.body.size();
+  stats.writes += requestWrites;
+  stats.rows += requestRows;
+  if (response.code == 304) stats.notModified++;
+  if (response.code >= 400) stats.errors++;
+  return response;
+}
+
+hal::HttpResponse FakeBackend::route(const std::string& method, const std::string& path,
+                                     const std::string& query, const hal::HttpRequest& request,
+                                     Endpoint& endpoint) {
+  bool post = method == "POST";
+
+  if (post && path == "/ride/request")      { endpoint = EP_RIDE_REQUEST; return rideRequest(request.body); }
+  if (!post && path == "/ride/status")      { endpoint = EP_RIDE_STATUS; return rideStatus(query); }
+  if (!post && path == "/ride/pending")     { endpoint = EP_PENDING; return pendingRides(query); }
+  if (post && path == "/ride/accept")       { endpoint = EP_ACCEPT; return acceptRide(request.body); }
+  if (post && path == "/ride/pickup")       { endpoint = EP_PICKUP; return confirmPickup(request.body); }
+  if (post && path == "/ride/complete")     { endpoint = EP_COMPLETE; return completeRide(request.body); }
+  if (post && path == "/rickshaw/register") { endpoint = EP_REGISTER; return registerRickshaw(request.body); }
+  if (post && path == "/rickshaw/location") { endpoint = EP_LOCATION; return updateLocation(request.body); }
+  if (post && path == "/rickshaw/track")    { endpoint = EP_TRACK; return updateTrack(request.body); }
+  if (post && path == "/rickshaw/heartbeat") { endpoint = EP_HEARTBEAT; return heartbeat(request.body); }
+
+  // /ride/:rideID/state
+  const std::string suffix = "/state";
+  if (!post && path.compare(0, 6, "/ride/") == 0 && path.size() > 12 &&
+      path.compare(path.size() - suffix.size(), suffix.size(), suffix) == 0) {
+    endpoint = EP_RIDE_STATE;
+    return rideState(atol(path.c_str() + 6), request);
+  }
+
+  return error(404, "Not found");
+}
+
+// One committed transaction touching `rows` rows; handle() charges it to the route
+void FakeBackend::write(uint64_t rows) {
+  requestWrites++;
+  requestRows += rows;
+}
+
+bool FakeBackend::storedPosition(const std::string& rickshawID, double& lat, double& lng) const {
+  auto rickshaw = rickshaws.find(rickshawID);
+  if (rickshaw == rickshaws.end()) return false;
+  lat = rickshaw->second.lat;
+  lng = rickshaw->second.lng;
+  return true;
+}
+
+BackendRide* FakeBackend::findRide(long rideID) {
+  if (rideID < 1 || rideID > (long)rideTable.size()) return nullptr;
+  return &rideTable[rideID - 1];
+}
+
+int FakeBackend::findBlock(const std::string& id) const {
+  for (size_t i = 0; i < blocks.size(); i++) {
+    if (blocks[i].id == id) return i;
+  }
+  return -1;
+}
+
+// ===== User side =====
+
+hal::HttpResponse FakeBackend::rideRequest(const std::string& body) {
+  std::string blockID = jsonField(body, "blockID");
+  std::string destination = jsonField(body, "destination");
+  std::string userID = jsonField(body, "userID");
+  if (blockID.empty() || destination.empty()) return error(400, "Missing required fields");
+
+  BackendRide ride;
+  ride.rideID = rideTable.size() + 1;
+  ride.userID = userID.empty() ? "GUEST" : userID;
+  ride.pickupBlock = findBlock(blockID);
+  ride.destination = findBlock(destination);
+  ride.status = "PENDING";
+  ride.requestMs = clock.now();
+  ride.acceptMs = ride.pickupMs = ride.dropMs = 0;
+  ride.points = 0;
+  if (ride.pickupBlock < 0 || ride.destination < 0) return error(500, "Unknown block");
+
+  rideTable.push_back(ride);
+  latestRideAt[blockID] = ride.rideID;
+  pendingVersion++;
+  write(1);
+
+  long rideID = ride.rideID;
+  clock.after(pendingTimeoutMs, [this, rideID]() {
+    BackendRide* expiring = findRide(rideID);
+    if (expiring != nullptr && expiring->status == "PENDING") {
+      expiring->status = "TIMEOUT";
+      pendingVersion++;
+    }
+  });
+
+  return reply(200, "{\"success\":true,\"rideID\":" + std::to_string(rideID) +
+                    ",\"message\":\"Ride request sent\"}");
+}
+
+hal::HttpResponse FakeBackend::rideStatus(const std::string& query) {
+  std::string blockID = queryParam(query, "blockID");
+  if (blockID.empty()) return error(400, "blockID required");
+
+  auto latest = latestRideAt.find(blockID);
+  if (latest == latestRideAt.end()) return reply(200, "{\"status\":\"IDLE\"}");
+
+  const BackendRide& ride = rideTable[latest->second - 1];
+  return reply(200, "{\"status\":\"" + ride.status + "\",\"rideID\":" + std::to_string(ride.rideID) +
+                    ",\"rickshawID\":" + nullable(ride.rickshawID) + "}");
+}
+
+hal::HttpResponse FakeBackend::rideState(long rideID, const hal::HttpRequest& request) {
+  const BackendRide* ride = findRide(rideID);
+  if (ride == nullptr) return error(404, "Ride not found");
+
+  std::string etag = "\"" + std::to_string(ride->rideID) + "-" + ride->status + "-" + ride->rickshawID + "\"";
+  hal::HttpResponse response{ 200, "", { { "ETag", etag }, { "Cache-Control", "no-cache" } } };
+
+  auto ifNoneMatch = request.headers.find("If-None-Match");
+  if (ifNoneMatch != request.headers.end() && ifNoneMatch->second == etag) {
+    response.code = 304;
+    return response;
+  }
+
+  response.body = rideJson(*ride);
+  return response;
+}
+
+std::string FakeBackend::rideJson(const BackendRide& ride) const {
+  return "{\"rideID\":" + std::to_string(ride.rideID) + ",\"status\":\"" + ride.status +
+         "\",\"rickshawID\":" + nullable(ride.rickshawID) +
+         ",\"pickupBlock\":\"" + blocks[ride.pickupBlock].id +
+         "\",\"destination\":\"" + blocks[ride.destination].id + "\"}";
+}
+
+// ===== Rickshaw side =====
+
+hal::HttpResponse FakeBackend::registerRickshaw(const std::string& body) {
+  std::string rickshawID = jsonField(body, "rickshawID");
+  Rickshaw& rickshaw = rickshaws[rickshawID];
+  rickshaw.lat = atof(jsonField(body, "currentLat").c_str());
+  rickshaw.lng = atof(jsonField(body, "currentLng").c_str());
+  write(1);
+  return reply(200, "{\"success\":true}");
+}
+
+hal::HttpResponse FakeBackend::updateLocation(const std::string& body) {
+  std::string rickshawID = jsonField(body, "rickshawID");
+  std::string lat = jsonField(body, "lat");
+  std::string lng = jsonField(body, "lng");
+  if (rickshawID.empty() || lat.empty() || lng.empty()) return error(400, "Missing fields");
+
+  auto rickshaw = rickshaws.find(rickshawID);
+  if (rickshaw != rickshaws.end()) {
+    rickshaw->second.lat = atof(lat.c_str());
+    rickshaw->second.lng = atof(lng.c_str());
+    write(1);
+  }
+  return reply(200, "{\"success\":true}");
+}
+
+// First point in microdegrees, then (dLatE6, dLngE6, dt/100 ms) zigzag
+// varints; the rows go into rickshaw_tracks and the last one becomes the
+// stored position, in one transaction
+hal::HttpResponse FakeBackend::updateTrack(const std::string& body) {
+  std::string rickshawID = jsonField(body, "rickshawID");
+  std::string latE6 = jsonField(body, "latE6");
+  std::string lngE6 = jsonField(body, "lngE6");
+  std::vector<uint8_t> deltas;
+  if (rickshawID.empty() || latE6.empty() || lngE6.empty() || !base64urlDecode(jsonField(body, "d"), deltas)) {
+    return error(400, "rickshawID, latE6, lngE6, age and d required");
+  }
+
+  int32_t lat = atol(latE6.c_str());
+  int32_t lng = atol(lngE6.c_str());
+  uint64_t points = 1;
+  size_t at = 0;
+  while (at < deltas.size()) {
+    uint32_t dLat, dLng, dt;
+    if (!readVarint(deltas, at, dLat) || !readVarint(deltas, at, dLng) || !readVarint(deltas, at, dt)) {
+      return error(400, "Malformed track");
+    }
+    lat += (int32_t)(dLat >> 1) ^ -(int32_t)(dLat & 1);
+    lng += (int32_t)(dLng >> 1) ^ -(int32_t)(dLng & 1);
+    points++;
+  }
+
+  auto rickshaw = rickshaws.find(rickshawID);
+  if (rickshaw != rickshaws.end()) {
+    rickshaw->second.lat = lat / 1e6;
+    rickshaw->second.lng = lng / 1e6;
+  }
+  write(points + 1);
+  return reply(200, "{\"success\":true,\"points\":" + std::to_string(points) + "}");
+}
+
+// As pendingRidesNear() in server.js
+static const size_t PENDING_LIMIT = 20;
+static const double PENDING_RADIUS_M = 10000;
+
+// The nearest pending rides, as server.js sends them
+hal::HttpResponse FakeBackend::pendingRides(const std::string& query) {
+  std::string rickshawID = queryParam(query, "rickshawID");
+  if (rickshawID.empty()) return error(400, "rickshawID required");
+
+  auto rickshaw = rickshaws.find(rickshawID);
+  if (rickshaw == rickshaws.end()) return reply(200, "{\"rides\":[]}");
+
+  // Live position sent with the poll wins over the stored one
+  double fromLat = rickshaw->second.lat;
+  double fromLng = rickshaw->second.lng;
+  std::string lat = queryParam(query, "lat");
+  std::string lng = queryParam(query, "lng");
+  if (!lat.empty() && !lng.empty()) {
+    fromLat = atof(lat.c_str());
+    fromLng = atof(lng.c_str());
+  }
+
+  return reply(200, "{\"rides\":" + pendingList(fromLat, fromLng) + "}");
+}
+
+// JSON array of the nearest PENDING_LIMIT pending rides within
+// PENDING_RADIUS_M, nearest first, ties to the older ride
+std::string FakeBackend::pendingList(double fromLat, double fromLng) {
+  std::vector<std::pair<double, const BackendRide*>> offers;
+  for (const BackendRide& ride : rideTable) {
+    scannedRows++;
+    if (ride.status != "PENDING") continue;
+    const Block& pickup = blocks[ride.pickupBlock];
+    double meters = geo::distance(fromLat, fromLng, pickup.lat, pickup.lng);
+    if (meters <= PENDING_RADIUS_M) offers.push_back(std::make_pair(meters, &ride));
+  }
+  // rideTable is in ride ID order, so the stable sort keeps ties oldest first
+  std::stable_sort(offers.begin(), offers.end(),
+                   [](const std::pair<double, const BackendRide*>& a,
+                      const std::pair<double, const BackendRide*>& b) { return a.first < b.first; });
+  if (offers.size() > PENDING_LIMIT) offers.resize(PENDING_LIMIT);
+
+  std::string list = "[";
+  char row[384];
+  for (size_t i = 0; i < offers.size(); i++) {
+    const BackendRide& ride = *offers[i].second;
+    const Block& pickup = blocks[ride.pickupBlock];
+    snprintf(row, sizeof(row),
+             "%s{\"rideID\":%ld,\"userID\":\"%s\",\"rickshawID\":null,\"pickupBlock\":\"%s\","
+             "\"destination\":\"%s\",\"status\":\"PENDING\",\"latitude\":%.4f,\"longitude\":%.4f,"
+             "\"locationName\":\"%s\",\"age\":%lu,\"distance\":\"%.2f\"}",
+             i > 0 ? "," : "", ride.rideID, ride.userID.c_str(), pickup.id.c_str(),
+             blocks[ride.destination].id.c_str(), pickup.lat, pickup.lng, pickup.id.c_str(),
+             (unsigned long)((clock.now() - ride.requestMs) / 1000), offers[i].first / 1000.0);
+    list += row;
+  }
+  return list + "]";
+}
+
+static bool isActive(const std::string& status) {
+  return status == "ACCEPTED" || status == "PICKUP";
+}
+
+// Only what changed since the device's view: its held ride (or one assigned
+// to it elsewhere) and the pending list when the version moved. Position is
+// for ranking only, as in server.js - no write.
+hal::HttpResponse FakeBackend::heartbeat(const std::string& body) {
+  std::string rickshawID = jsonField(body, "rickshawID");
+  std::string lat = jsonField(body, "lat");
+  std::string lng = jsonField(body, "lng");
+  if (rickshawID.empty() || lat.empty() || lng.empty()) return error(400, "rickshawID, lat and lng required");
+
+  long rideID = atol(jsonField(body, "rideID").c_str());
+  std::string status = jsonField(body, "status");
+  uint32_t version = strtoul(jsonField(body, "v").c_str(), nullptr, 10);
+
+  const BackendRide* held = findRide(rideID);
+  const BackendRide* changed = nullptr;
+  if (held != nullptr && (held->status != status || (isActive(status) && held->rickshawID != rickshawID))) {
+    changed = held;
+  } else if (!isActive(status)) {
+    for (const BackendRide& ride : rideTable) {
+      if (ride.rideID != rideID && ride.rickshawID == rickshawID && isActive(ride.status)) changed = &ride;
+    }
+  }
+
+  std::string ride = changed != nullptr ? rideJson(*changed) : "null";
+  bool onRide = isActive(status) || (changed != nullptr && changed->rickshawID == rickshawID &&
+                                     isActive(changed->status));
+  if (onRide || version == pendingVersion) {
+    return reply(200, "{\"v\":" + std::to_string(version) + ",\"ride\":" + ride + ",\"rides\":null}");
+  }
+  return reply(200, "{\"v\":" + std::to_string(pendingVersion) + ",\"ride\":" + ride +
+                    ",\"rides\":" + pendingList(atof(lat.c_str()), atof(lng.c_str())) + "}");
+}
+
+// First accept wins; later ones get success:false with a 200
+hal::HttpResponse FakeBackend::acceptRide(const std::string& body) {
+  long rideID = atol(jsonField(body, "rideID").c_str());
+  std::string rickshawID = jsonField(body, "rickshawID");
+  if (rideID == 0 || rickshawID.empty()) return error(400, "Missing fields");
+
+  BackendRide* ride = findRide(rideID);
+  if (ride == nullptr || ride->status != "PENDING") {
+    return reply(200, "{\"success\":false,\"message\":\"Ride already taken by another puller\"}");
+  }
+
+  ride->status = "ACCEPTED";
+  ride->rickshawID = rickshawID;
+  ride->acceptMs = clock.now();
+  pendingVersion++;
+  write(2);  // Ride row + rickshaw status
+
+  return reply(200, "{\"success\":true,\"rideID\":" + std::to_string(rideID) +
+                    ",\"pickupBlock\":\"" + blocks[ride->pickupBlock].id +
+                    "\",\"destination\":\"" + blocks[ride->destination].id +
+                    "\",\"message\":\"Ride accepted\"}");
+}
+
+hal::HttpResponse FakeBackend::confirmPickup(const std::string& body) {
+  long rideID = atol(jsonField(body, "rideID").c_str());
+  if (rideID == 0) return error(400, "rideID required");
+
+  BackendRide* ride = findRide(rideID);
+  if (ride == nullptr || ride->status != "ACCEPTED") return error(400, "Ride not in accepted state");
+
+  ride->status = "PICKUP";
+  ride->pickupMs = clock.now();
+  write(1);
+  return reply(200, "{\"success\":true}");
+}
+
+hal::HttpResponse FakeBackend::completeRide(const std::string& body) {
+  long rideID = atol(jsonField(body, "rideID").c_str());
+  std::string dropLat = jsonField(body, "dropLat");
+  std::string dropLng = jsonField(body, "dropLng");
+  if (rideID == 0 || dropLat.empty() || dropLng.empty()) return error(400, "Missing fields");
+
+  BackendRide* ride = findRide(rideID);
+  if (ride == nullptr) return error(404, "Ride not found");
+
+  const Block& destination = blocks[ride->destination];
+  double meters = geo::distance(atof(dropLat.c_str()), atof(dropLng.c_str()), destination.lat, destination.lng);
+  int points = pointsFor(meters);
+
+  ride->status = meters <= 100 ? "COMPLETED" : "PENDING_REVIEW";
+  ride->dropMs = clock.now();
+  ride->points = points;
+  rickshaws[ride->rickshawID].totalPoints += points;
+  write(3);  // Ride, rickshaw points, points_history
+
+  char distance[24];
+  snprintf(distance, sizeof(distance), "%.2f", meters);
+  return reply(200, "{\"success\":true,\"points\":" + std::to_string(points) + ",\"distance\":\"" +
+                    distance + "\",\"status\":\"" + ride->status + "\"}");
+}
@@ -0,0 +1,121 @@
+/*
+ * In-process stand-in for the ride endpoints of aeras-backend/server.js.
+ * Same routes, status codes, JSON field names, ETag/304 behaviour, 60 s
+ * pending-ride expiry and point rules, kept in memory so a simulation
+ * can drive thousands of requests per simulated second.
+ */
+
+#ifndef FLEET_FAKE_BACKEND_H
+#define FLEET_FAKE_BACKEND_H
+
+#include <Hal.h>
+#include <map>
+#include <string>
+#include <vector>
+#include "EventQueue.h"
+
+struct Block {
+  std::string id;
+  double lat;
+  double lng;
+};
+
+enum Endpoint {
+  EP_RIDE_REQUEST,
+  EP_RIDE_STATUS,
+  EP_RIDE_STATE,
+  EP_REGISTER,
+  EP_PENDING,
+  EP_ACCEPT,
+  EP_PICKUP,
+  EP_COMPLETE,
+  EP_LOCATION,
+  EP_TRACK,
+  EP_HEARTBEAT,
+  EP_UNKNOWN,
+  ENDPOINT_COUNT
+};
+
+struct BackendRide {
+  long rideID;
+  std::string userID;
+  std::string rickshawID;
+  int pickupBlock;
+  int destination;
+  std::string status;
+  uint64_t requestMs;
+  uint64_t acceptMs;
+  uint64_t pickupMs;
+  uint64_t dropMs;
+  int points;
+};
+
+struct EndpointStats {
+  uint64_t requests = 0;
+  uint64_t notModified = 0;   // 304 replies
+  uint64_t errors = 0;        // 4xx/5xx replies
+  uint64_t bytesOut = 0;      // Response bodies
+  uint64_t bytesIn = 0;       // Request bodies
+  uint64_t writes = 0;        // Database transactions committed
+  uint64_t rows = 0;          // Rows inserted or updated by them
+};
+
+class FakeBackend {
+public:
+  FakeBackend(EventQueue& clock, const std::vector<Block>& blocks, uint32_t pendingTimeoutMs);
+
+  hal::HttpResponse handle(const hal::HttpRequest& request);
+
+  static const char* endpointName(Endpoint endpoint);
+  const EndpointStats& stats(Endpoint endpoint) const { return endpoints[endpoint]; }
+  const std::vector<BackendRide>& rides() const { return rideTable; }
+  uint64_t pendingScanRows() const { return scannedRows; }
+
+  // Stored position of a rickshaw, as a dashboard or dispatcher would see it
+  bool storedPosition(const std::string& rickshawID, double& lat, double& lng) const;
+
+private:
+  struct Rickshaw {
+    double lat;
+    double lng;
+    int totalPoints;
+  };
+
+  hal::HttpResponse route(const std::string& method, const std::string& path,
+                          const std::string& query, const hal::HttpRequest& request,
+                          Endpoint& endpoint);
+
+  hal::HttpResponse rideRequest(const std::string& body);
+  hal::HttpResponse rideStatus(const std::string& query);
+  hal::HttpResponse rideState(long rideID, const hal::HttpRequest& request);
+  hal::HttpResponse registerRickshaw(const std::string& body);
+  hal::HttpResponse pendingRides(const std::string& query);
+  hal::HttpResponse acceptRide(const std::string& body);
+  hal::HttpResponse confirmPickup(const std::string& body);
+  hal::HttpResponse completeRide(const std::string& body);
+  hal::HttpResponse updateLocation(const std::string& body);
+  hal::HttpResponse updateTrack(const std::string& body);
+  hal::HttpResponse heartbeat(const std::string& body);
+
+  std::string pendingList(double fromLat, double fromLng);
+  std::string rideJson(const BackendRide& ride) const;
+
+  void write(uint64_t rows);
+  BackendRide* findRide(long rideID);
+  int findBlock(const std::string& id) const;
+
+  EventQueue& clock;
+  std::vector<Block> blocks;
+  uint32_t pendingTimeoutMs;
+
+  std::vector<BackendRide> rideTable;          // rideID = index + 1
+  std::map<std::string, long> latestRideAt;    // blockID -> newest rideID
+  std::map<std::string, Rickshaw> rickshaws;
+  EndpointStats endpoints[ENDPOINT_COUNT];
+  uint64_t requestWrites = 0;                 // write() calls by the request being handled
+  uint64_t requestRows = 0;
+  uint64_t scannedRows = 0;
+  uint32_t pendingVersion = 1;                // Bumped when the pending set changes
+};
+
+#endif
@@ -0,0 +1,831 @@
+#include "Fleet.h"
+#include <AerasGeo.h>
+#include <HTTPClient.h>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <thread>
+
+static const char* BACKEND_URL = "http://fleet-sim/api";
+
+// Request tags, as in each firmware's RequestTag
+enum UserRequest : uint8_t { REQ_RIDE_REQUEST, REQ_RIDE_STATUS };
+enum RickshawRequest : uint8_t {
+  REQ_REGISTER,
+  REQ_PENDING,
+  REQ_RIDE_STATE,
+  REQ_ACCEPT,
+  REQ_PICKUP,
+  REQ_COMPLETE,
+  REQ_TRACK,
+  REQ_HEARTBEAT,
+  REQ_LOCATION    // --location: fixed-period POSTs from before track batching
+};
+
+// user-side-hardware timing
+static const uint32_t STATE_MACHINE_PERIOD = 50;
+static const uint32_t ULTRASONIC_THRESHOLD = 3000;
+static const uint32_t RESET_HOLD_TIME = 1000;
+static const uint32_t ERROR_HOLD_TIME = 2000;
+static const uint32_t COMPLETE_HOLD_TIME = 3000;
+static const uint32_t TIMEOUT_HOLD_TIME = 5000;
+
+// rickshaw-side-hardware timing
+static const uint32_t LOOP_DELAY = 100;          // delay(100) at the end of loop()
+static const uint32_t MOVE_PERIOD = 1000;
+static const uint32_t MESSAGE_DELAY = 2000;      // delay(2000) after accept/pickup screens
+static const uint32_t COMPLETE_DELAY = 5000;     // Completion screen
+static const uint32_t TOO_FAR_DELAY = 3000;
+static const uint32_t CONFIRM_RADIUS_M = 100;
+static const uint32_t TRACK_SAMPLE_INTERVAL = 1000;
+static const uint32_t POSITION_SAMPLE_MS = 10000;  // Stored-position error sampling
+static const uint32_t HEARTBEAT_EN_ROUTE = 1500;
+static const uint32_t HEARTBEAT_OFFER = 2000;
+static const uint32_t HEARTBEAT_IDLE = 3000;
+static const uint32_t HEARTBEAT_PARKED = 8000;
+static const uint32_t PARKED_AFTER = 60000;
+static const double PARKED_RADIUS_M = 20;
+static const double OFFER_REFRESH_M = 500;
+
+// CUET campus, the first of the firmware's four named locations
+static const double CENTER_LAT = 22.4633;
+static const double CENTER_LNG = 91.9714;
+
+static const Block NAMED_BLOCKS[] = {
+  { "CUET_CAMPUS", 22.4633, 91.9714 },
+  { "PAHARTOLI", 22.4725, 91.9845 },
+  { "NOAPARA", 22.4580, 91.9920 },
+  { "RAOJAN", 22.4520, 91.9650 }
+};
+
+static std::vector<Block> makeBlocks(const SimConfig& config, std::mt19937& rng) {
+  std::vector<Block> blocks;
+  std::uniform_real_distribution<double> unit(0.0, 1.0);
+  uint16_t count = std::max<uint16_t>(config.users, 2);
+
+  for (uint16_t i = 0; i < count; i++) {
+    if (i < sizeof(NAMED_BLOCKS) / sizeof(NAMED_BLOCKS[0])) {
+      blocks.push_back(NAMED_BLOCKS[i]);
+      continue;
+    }
+    // Uniform over the disc
+    double radiusM = config.areaRadiusKm * 1000.0 * sqrt(unit(rng));
+    double angle = unit(rng) * TWO_PI;
+    char id[16];
+    snprintf(id, sizeof(id), "BLOCK_%03u", (unsigned)i + 1);
+    blocks.push_back(Block{ id, CENTER_LAT + radiusM * cos(angle) / geo::METERS_PER_DEGREE_LAT,
+                            CENTER_LNG + radiusM * sin(angle) /
+                              (geo::METERS_PER_DEGREE_LAT * cos(CENTER_LAT * DEG_TO_RAD)) });
+  }
+  return blocks;
+}
+
+Fleet::Fleet(const SimConfig& config)
+  : config(config), rng(config.seed), blocks(makeBlocks(config, rng)),
+    backend(clock, blocks, config.requestTimeoutMs),
+    endMs((uint64_t)(config.hours * 3600000.0)) {
+  for (const Block& block : blocks) {
+    targets.push_back(geo::makeTarget(block.lat, block.lng));
+  }
+
+  users.resize(config.users);
+  for (uint16_t i = 0; i < config.users; i++) {
+    UserBlock& user = users[i];
+    user.block = i;
+    // Each block's firmware has one fixed destination
+    do {
+      user.destination = (int)uniform(0, blocks.size());
+    } while (user.destination == user.block);
+  }
+
+  rickshaws.resize(config.rickshaws);
+  for (uint16_t i = 0; i < config.rickshaws; i++) {
+    Rickshaw& rickshaw = rickshaws[i];
+    char id[16];
+    snprintf(id, sizeof(id), "RICK%03u", (unsigned)i + 1);
+    rickshaw.id = id;
+    const Block& start = blocks[(int)uniform(0, blocks.size())];
+    rickshaw.lat = start.lat;
+    rickshaw.lng = start.lng;
+  }
+}
+
+// ===== Helpers =====
+
+double Fleet::uniform(double low, double high) {
+  std::uniform_real_distribution<double> range(low, high);
+  double value = range(rng);
+  return value < high ? value : low;
+}
+
+double Fleet::exponential(double mean) {
+  std::exponential_distribution<double> wait(1.0 / mean);
+  return wait(rng);
+}
+
+int Fleet::blockIndex(const char* id) const {
+  for (size_t i = 0; i < blocks.size(); i++) {
+    if (blocks[i].id == id) return i;
+  }
+  return -1;
+}
+
+// ===== Network =====
+
+uint32_t Fleet::oneWayMs() {
+  // Half the mean RTT, +-50 % jitter
+  return (uint32_t)(config.rttMs / 2.0 * uniform(0.5, 1.5));
+}
+
+void Fleet::send(Device& device, uint8_t tag, bool post, const std::string& path,
+                 const std::string& body, NetDecode decode, long rideID, const char* ifNoneMatch) {
+  device.inFlight |= 1UL << tag;
+
+  hal::HttpRequest request;
+  request.method = post ? "POST" : "GET";
+  request.url = std::string(BACKEND_URL) + path;
+  request.body = body;
+  if (ifNoneMatch != nullptr && ifNoneMatch[0] != '\0') request.headers["If-None-Match"] = ifNoneMatch;
+
+  Device* target = &device;
+  uint32_t back = oneWayMs();
+  clock.after(oneWayMs(), [this, target, request, tag, decode, rideID, back]() {
+    hal::HttpResponse response = backend.handle(request);
+
+    NetEvent event;
+    memset(&event, 0, sizeof(event));
+    event.tag = tag;
+    event.httpCode = response.code;
+    event.rideID = rideID;
+    auto etag = response.headers.find("ETag");
+    if (etag != response.headers.end()) {
+      strncpy(event.etag, etag->second.c_str(), sizeof(event.etag) - 1);
+    }
+    if (response.code == 200) {
+      ResponseStream stream;
+      stream.assign(response.body);
+      event.decoded = decodeNetReply(decode, stream, event);
+    }
+
+    clock.after(back, [target, event]() { target->replies.push_back(event); });
+  });
+}
+
+bool Fleet::poll(Device& device, NetEvent& reply) {
+  if (device.replies.empty()) return false;
+  reply = device.replies.front();
+  device.replies.pop_front();
+  device.inFlight &= ~(1UL << reply.tag);
+  return true;
+}
+
+// ===== User side =====
+
+void Fleet::passengerArrives(UserBlock& user) {
+  if (clock.now() >= endMs) return;
+  clock.after((uint64_t)exponential(3600000.0 / config.demandPerHour),
+              [this, &user]() { passengerArrives(user); });
+
+  passengers++;
+  if (user.state != STATE_IDLE) {
+    balked++;
+    return;
+  }
+
+  // Presence for ULTRASONIC_THRESHOLD, then laser privilege check and button
+  user.state = STATE_DETECTING;
+  clock.after(ULTRASONIC_THRESHOLD + (uint64_t)uniform(1000, 5000),
+              [this, &user]() { pressButton(user); });
+}
+
+void Fleet::pressButton(UserBlock& user) {
+  char userID[16];
+  snprintf(userID, sizeof(userID), "USER_%ld", (long)uniform(1000, 9999));
+
+  char payload[160];
+  codec::encodeRideRequest(payload, sizeof(payload), blocks[user.block].id.c_str(),
+                           blocks[user.destination].id.c_str(), userID);
+
+  user.state = STATE_REQUEST_SENT;
+  user.pressedAt = clock.now();
+  send(user, REQ_RIDE_REQUEST, true, "/ride/request", payload, DECODE_RIDE_CREATED, 0);
+  startUserTicks(user);
+}
+
+void Fleet::startUserTicks(UserBlock& user) {
+  if (user.ticking) return;
+  user.ticking = true;
+  clock.after(STATE_MACHINE_PERIOD, [this, &user]() { userTick(user); });
+}
+
+// pumpNetwork() + stepStateMachine(); stops ticking once idle
+void Fleet::userTick(UserBlock& user) {
+  NetEvent reply;
+  while (poll(user, reply)) {
+    switch (reply.tag) {
+      case REQ_RIDE_REQUEST: onRideCreatedReply(user, reply); break;
+      case REQ_RIDE_STATUS:
+        if (reply.decoded && isTrackingRide(user)) applyRideStatus(user, reply.ride.status);
+        break;
+    }
+  }
+
+  switch (user.state) {
+    case STATE_WAITING_ACCEPTANCE:
+      checkRideStatus(user);
+      checkTimeout(user);
+      break;
+    case STATE_RIDE_ACCEPTED:
+    case STATE_RIDE_ACTIVE:
+      checkRideStatus(user);
+      break;
+    default:
+      break;
+  }
+
+  if (user.state == STATE_IDLE && user.inFlight == 0) {
+    user.ticking = false;
+    return;
+  }
+  clock.after(STATE_MACHINE_PERIOD, [this, &user]() { userTick(user); });
+}
+
+void Fleet::holdThen(UserBlock& user, uint32_t holdMs, UserHold next) {
+  user.state = STATE_RESETTING;
+  uint32_t generation = ++user.holdGeneration;
+  clock.after(holdMs, [this, &user, generation, next]() {
+    if (generation != user.holdGeneration) return;  // Cancelled by a reset
+    if (next == HOLD_RESET) resetSystem(user);
+    else user.state = STATE_IDLE;
+  });
+}
+
+void Fleet::resetSystem(UserBlock& user) {
+  user.currentRideID = 0;
+  user.requestSentTime = 0;
+  holdThen(user, RESET_HOLD_TIME, HOLD_ENTER_IDLE);
+}
+
+void Fleet::onRideCreatedReply(UserBlock& user, const NetEvent& reply) {
+  if (user.state != STATE_REQUEST_SENT) return;
+
+  if (!reply.decoded) {
+    requestsFailed++;
+    holdThen(user, ERROR_HOLD_TIME, HOLD_RESET);
+    return;
+  }
+
+  requestsCreated++;
+  user.currentRideID = reply.createdRideID;
+  user.requestSentTime = clock.now();
+  user.state = STATE_WAITING_ACCEPTANCE;
+}
+
+bool Fleet::isTrackingRide(const UserBlock& user) const {
+  return user.state == STATE_WAITING_ACCEPTANCE || user.state == STATE_RIDE_ACCEPTED ||
+         user.state == STATE_RIDE_ACTIVE;
+}
+
+void Fleet::checkRideStatus(UserBlock& user) {
+  if (user.busy(REQ_RIDE_STATUS)) return;
+  if (clock.now() - user.lastStatusCheck < config.userPollMs) return;
+  user.lastStatusCheck = clock.now();
+
+  send(user, REQ_RIDE_STATUS, false, "/ride/status?blockID=" + blocks[user.block].id, "",
+       DECODE_RIDE_STATUS, user.currentRideID);
+}
+
+void Fleet::applyRideStatus(UserBlock& user, const char* status) {
+  if (strcmp(status, "ACCEPTED") == 0) {
+    if (user.state == STATE_WAITING_ACCEPTANCE) {
+      user.state = STATE_RIDE_ACCEPTED;
+      dispatchMs.push_back(clock.now() - user.pressedAt);
+    }
+  } else if (strcmp(status, "PICKUP") == 0) {
+    if (user.state != STATE_RIDE_ACTIVE) {
+      user.state = STATE_RIDE_ACTIVE;
+      pickupMs.push_back(clock.now() - user.pressedAt);
+    }
+  } else if (strcmp(status, "COMPLETED") == 0) {
+    ridesSeenComplete++;
+    holdThen(user, COMPLETE_HOLD_TIME, HOLD_RESET);
+  }
+}
+
+void Fleet::checkTimeout(UserBlock& user) {
+  if (user.state != STATE_WAITING_ACCEPTANCE) return;
+  if (clock.now() - user.requestSentTime <= config.requestTimeoutMs) return;
+
+  userTimeouts++;
+  abandonedRides.insert(user.currentRideID);
+  user.state = STATE_TIMEOUT_ERROR;
+  uint32_t generation = ++user.holdGeneration;
+  clock.after(TIMEOUT_HOLD_TIME, [this, &user, generation]() {
+    if (generation == user.holdGeneration) resetSystem(user);
+  });
+}
+
+// ===== Rickshaw side =====
+
+// One pass of the firmware loop(), then delay(100) plus any handler delays
+void Fleet::rickshawLoop(Rickshaw& rickshaw) {
+  rickshaw.stallMs = 0;
+
+  NetEvent reply;
+  while (poll(rickshaw, reply)) {
+    handleNetReply(rickshaw, reply);
+  }
+
+  if (config.locationMs > 0) {
+    sendLocationUpdate(rickshaw);
+  } else {
+    updateTrajectory(rickshaw);
+  }
+
+  if (config.heartbeat) sendHeartbeat(rickshaw);
+
+  if (!rickshaw.onActiveRide) {
+    if (!rickshaw.busy(REQ_ACCEPT) && rickshaw.offers.expire((uint32_t)clock.now())) {
+      showTopOffer(rickshaw);
+    }
+    if (!config.heartbeat) {
+      checkForRideRequests(rickshaw);
+      checkWebAppAcceptance(rickshaw);
+    }
+  } else {
+    if (!config.heartbeat) checkRideStatusUpdates(rickshaw);
+    simulateMovement(rickshaw);
+  }
+
+  // handleSerialCommand()
+  Command typed = rickshaw.typed;
+  rickshaw.typed = CMD_NONE;
+  switch (typed) {
+    case CMD_ACCEPT: acceptRide(rickshaw); break;
+    case CMD_PICKUP: confirmPickup(rickshaw); break;
+    case CMD_COMPLETE: completeRide(rickshaw); break;
+    case CMD_NONE: break;
+  }
+
+  if (clock.now() >= endMs) return;
+  clock.after(LOOP_DELAY + rickshaw.stallMs, [this, &rickshaw]() { rickshawLoop(rickshaw); });
+}
+
+void Fleet::handleNetReply(Rickshaw& rickshaw, const NetEvent& reply) {
+  switch (reply.tag) {
+    case REQ_PENDING:    onPendingReply(rickshaw, reply); break;
+    case REQ_RIDE_STATE: onRideStateReply(rickshaw, reply); break;
+    case REQ_HEARTBEAT:  onHeartbeatReply(rickshaw, reply); break;
+    case REQ_ACCEPT:     onAcceptReply(rickshaw, reply); break;
+    case REQ_PICKUP:     onPickupReply(rickshaw, reply); break;
+    case REQ_COMPLETE:   onCompleteReply(rickshaw, reply); break;
+    case REQ_TRACK:      rickshaw.track.acknowledge(reply.httpCode == 200); break;
+    default: break;
+  }
+}
+
+// The puller reads the screen and types a command after a reaction time
+void Fleet::typeCommand(Rickshaw& rickshaw, Command command) {
+  if (rickshaw.operatorBusy) return;
+  rickshaw.operatorBusy = true;
+  clock.after((uint64_t)(config.operatorReactionMs * uniform(0.5, 1.5)), [&rickshaw, command]() {
+    rickshaw.operatorBusy = false;
+    rickshaw.typed = command;
+  });
+}
+
+void Fleet::updateTrajectory(Rickshaw& rickshaw) {
+  uint32_t now = (uint32_t)clock.now();
+  if (clock.now() - rickshaw.lastTrackSample >= TRACK_SAMPLE_INTERVAL) {
+    rickshaw.lastTrackSample = clock.now();
+    rickshaw.track.setFastPath(rickshaw.onActiveRide && !rickshaw.pickupConfirmed);
+    rickshaw.track.sample(rickshaw.lat, rickshaw.lng, now);
+  }
+  if (!rickshaw.track.flushDue(now)) return;
+
+  char payload[sizeof(NetCommand::body)];
+  if (rickshaw.track.encodeBatch(payload, sizeof(payload), rickshaw.id.c_str(), now) == 0) return;
+  send(rickshaw, REQ_TRACK, true, "/rickshaw/track", payload, DECODE_NONE, 0);
+}
+
+void Fleet::sendLocationUpdate(Rickshaw& rickshaw) {
+  if (clock.now() - rickshaw.lastLocationUpdate < config.locationMs) return;
+  rickshaw.lastLocationUpdate = clock.now();
+  if (rickshaw.busy(REQ_LOCATION)) return;
+
+  char payload[96];
+  codec::encodeLocation(payload, sizeof(payload), rickshaw.id.c_str(), rickshaw.lat, rickshaw.lng);
+  send(rickshaw, REQ_LOCATION, true, "/rickshaw/location", payload, DECODE_NONE, 0);
+}
+
+void Fleet::checkForRideRequests(Rickshaw& rickshaw) {
+  if (clock.now() - rickshaw.lastRideCheck < config.ridePollMs) return;
+  if (rickshaw.busy(REQ_PENDING) || rickshaw.busy(REQ_ACCEPT)) return;
+  rickshaw.lastRideCheck = clock.now();
+
+  char position[48];
+  snprintf(position, sizeof(position), "&lat=%.6f&lng=%.6f", rickshaw.lat, rickshaw.lng);
+  send(rickshaw, REQ_PENDING, false, "/ride/pending?rickshawID=" + rickshaw.id + position, "",
+       DECODE_PENDING, 0);
+}
+
+void Fleet::onPendingReply(Rickshaw& rickshaw, const NetEvent& reply) {
+  if (!reply.decoded) return;
+  if (rickshaw.onActiveRide || rickshaw.busy(REQ_ACCEPT)) return;
+
+  rickshaw.offers.update(reply.offers, (uint32_t)clock.now());
+  showTopOffer(rickshaw);
+}
+
+// Puts the best queued offer up and "types" ACCEPT for it; true if there was one
+bool Fleet::showTopOffer(Rickshaw& rickshaw) {
+  const Offer* best = rickshaw.offers.top();
+  if (best == nullptr) {
+    rickshaw.currentRideID = 0;
+    rickshaw.pickupBlock = rickshaw.destinationBlock = -1;
+    return false;
+  }
+  if (best->ride.rideID != rickshaw.currentRideID) {
+    offersShown++;
+    rickshaw.currentRideID = best->ride.rideID;
+    rickshaw.pickupBlock = blockIndex(best->ride.pickupBlock);
+    rickshaw.destinationBlock = blockIndex(best->ride.destination);
+    typeCommand(rickshaw, CMD_ACCEPT);
+  }
+  return true;
+}
+
+void Fleet::checkWebAppAcceptance(Rickshaw& rickshaw) {
+  if (rickshaw.onActiveRide || rickshaw.currentRideID == 0) return;
+  if (clock.now() - rickshaw.lastStatusCheck < config.acceptPollMs) return;
+  rickshaw.lastStatusCheck = clock.now();
+  requestRideState(rickshaw);
+}
+
+void Fleet::checkRideStatusUpdates(Rickshaw& rickshaw) {
+  if (!rickshaw.onActiveRide || rickshaw.currentRideID == 0) return;
+  if (clock.now() - rickshaw.lastStatusCheck < config.statusPollMs) return;
+  rickshaw.lastStatusCheck = clock.now();
+  requestRideState(rickshaw);
+}
+
+void Fleet::requestRideState(Rickshaw& rickshaw) {
+  if (rickshaw.busy(REQ_RIDE_STATE)) return;
+
+  const char* etag = rickshaw.rideStateETagID == rickshaw.currentRideID ? rickshaw.rideStateETag : nullptr;
+  send(rickshaw, REQ_RIDE_STATE, false, "/ride/" + std::to_string(rickshaw.currentRideID) + "/state", "",
+       DECODE_RIDE_STATUS, rickshaw.currentRideID, etag);
+}
+
+void Fleet::onRideStateReply(Rickshaw& rickshaw, const NetEvent& reply) {
+  if (reply.rideID != rickshaw.currentRideID || !reply.decoded) return;
+
+  memcpy(rickshaw.rideStateETag, reply.etag, sizeof(rickshaw.rideStateETag));
+  rickshaw.rideStateETagID = reply.ride.rideID;
+  applyRideUpdate(rickshaw, reply.ride);
+}
+
+uint32_t Fleet::heartbeatInterval(const Rickshaw& rickshaw) const {
+  if (rickshaw.onActiveRide) return HEARTBEAT_EN_ROUTE;
+  if (rickshaw.currentRideID != 0) return HEARTBEAT_OFFER;
+  if (clock.now() - rickshaw.lastMovedAt > PARKED_AFTER) return HEARTBEAT_PARKED;
+  return HEARTBEAT_IDLE;
+}
+
+void Fleet::sendHeartbeat(Rickshaw& rickshaw) {
+  if (geo::distance(rickshaw.lat, rickshaw.lng, rickshaw.movedFromLat, rickshaw.movedFromLng) > PARKED_RADIUS_M) {
+    rickshaw.movedFromLat = rickshaw.lat;
+    rickshaw.movedFromLng = rickshaw.lng;
+    rickshaw.lastMovedAt = clock.now();
+  }
+
+  if (!rickshaw.heartbeatDue && clock.now() - rickshaw.lastHeartbeat < heartbeatInterval(rickshaw)) return;
+  if (rickshaw.busy(REQ_HEARTBEAT) || rickshaw.busy(REQ_ACCEPT)) return;
+  rickshaw.lastHeartbeat = clock.now();
+  rickshaw.heartbeatDue = false;
+
+  if (geo::distance(rickshaw.lat, rickshaw.lng, rickshaw.offersLat, rickshaw.offersLng) > OFFER_REFRESH_M) {
+    rickshaw.pendingVersion = 0;
+  }
+
+  const char* status = !rickshaw.onActiveRide ? "PENDING" : rickshaw.pickupConfirmed ? "PICKUP" : "ACCEPTED";
+  char payload[sizeof(NetCommand::body)];
+  codec::encodeHeartbeat(payload, sizeof(payload), rickshaw.id.c_str(), rickshaw.lat, rickshaw.lng,
+                         rickshaw.currentRideID, status, rickshaw.pendingVersion);
+  send(rickshaw, REQ_HEARTBEAT, true, "/rickshaw/heartbeat", payload, DECODE_HEARTBEAT,
+       rickshaw.currentRideID);
+}
+
+void Fleet::onHeartbeatReply(Rickshaw& rickshaw, const NetEvent& reply) {
+  if (!reply.decoded) return;
+
+  const HeartbeatReply& beat = reply.heartbeat;
+  if (beat.hasRide) {
+    if (beat.ride.rideID == rickshaw.currentRideID) {
+      applyRideUpdate(rickshaw, beat.ride);
+    } else if (!rickshaw.onActiveRide && rickshaw.id == beat.ride.rickshawID &&
+               strcmp(beat.ride.status, "ACCEPTED") == 0) {
+      rickshaw.currentRideID = beat.ride.rideID;
+      rickshaw.pickupBlock = rickshaw.destinationBlock = -1;
+      applyRideUpdate(rickshaw, beat.ride);
+    }
+  }
+  if (rickshaw.onActiveRide) return;
+
+  if (beat.hasOffers) {
+    rickshaw.pendingVersion = beat.version;
+    rickshaw.offersLat = rickshaw.lat;
+    rickshaw.offersLng = rickshaw.lng;
+    if (rickshaw.busy(REQ_ACCEPT)) return;
+    rickshaw.offers.update(beat.offers, (uint32_t)clock.now());
+    showTopOffer(rickshaw);
+  } else {
+    rickshaw.offers.refresh((uint32_t)clock.now());
+  }
+}
+
+void Fleet::applyRideUpdate(Rickshaw& rickshaw, const RideStatus& ride) {
+  if (!rickshaw.onActiveRide) {
+    if (rickshaw.id == ride.rickshawID && strcmp(ride.status, "ACCEPTED") == 0) {
+      // Accepted elsewhere under our ID (web app)
+      if (rickshaw.pickupBlock < 0) rickshaw.pickupBlock = blockIndex(ride.pickupBlock);
+      if (rickshaw.destinationBlock < 0) rickshaw.destinationBlock = blockIndex(ride.destination);
+      startRide(rickshaw);
+      rickshaw.stallMs += MESSAGE_DELAY;
+    } else if (strcmp(ride.status, "PENDING") != 0) {
+      // Offer went to someone else or expired: on to the next one
+      rickshaw.offers.remove(ride.rideID);
+      showTopOffer(rickshaw);
+    }
+    return;
+  }
+
+  if (strcmp(ride.status, "PICKUP") == 0 && !rickshaw.pickupConfirmed) {
+    rickshaw.pickupConfirmed = true;
+    rickshaw.target = rickshaw.destinationBlock;
+    rickshaw.stallMs += MESSAGE_DELAY;
+  } else if (strcmp(ride.status, "COMPLETED") == 0) {
+    endRide(rickshaw);
+  }
+}
+
+void Fleet::acceptRide(Rickshaw& rickshaw) {
+  if (rickshaw.currentRideID == 0 || rickshaw.onActiveRide) return;
+  if (rickshaw.busy(REQ_ACCEPT)) return;
+
+  char payload[96];
+  codec::encodeAccept(payload, sizeof(payload), rickshaw.currentRideID, rickshaw.id.c_str());
+  send(rickshaw, REQ_ACCEPT, true, "/ride/accept", payload, DECODE_ACCEPT, rickshaw.currentRideID);
+}
+
+void Fleet::onAcceptReply(Rickshaw& rickshaw, const NetEvent& reply) {
+  if (reply.rideID != rickshaw.currentRideID || rickshaw.onActiveRide) return;
+
+  if (reply.httpCode == 200 && reply.decoded && reply.accepted) {
+    startRide(rickshaw);
+  } else if (reply.httpCode == 200) {
+    acceptsLost++;
+    rickshaw.offers.remove(rickshaw.currentRideID);
+    if (showTopOffer(rickshaw)) acceptsRetried++;  // No poll in between
+  }
+  rickshaw.stallMs += MESSAGE_DELAY;
+}
+
+void Fleet::startRide(Rickshaw& rickshaw) {
+  rickshaw.offers.clear();
+  rickshaw.onActiveRide = true;
+  rickshaw.pickupConfirmed = false;
+  rickshaw.target = rickshaw.pickupBlock;
+  rickshaw.activeSince = clock.now();
+}
+
+void Fleet::endRide(Rickshaw& rickshaw) {
+  rickshaw.activeMs += clock.now() - rickshaw.activeSince;
+  rickshaw.onActiveRide = false;
+  rickshaw.pickupConfirmed = false;
+  rickshaw.currentRideID = 0;
+  rickshaw.pickupBlock = rickshaw.destinationBlock = rickshaw.target = -1;
+}
+
+void Fleet::confirmPickup(Rickshaw& rickshaw) {
+  if (!rickshaw.onActiveRide || rickshaw.pickupConfirmed || rickshaw.target < 0) return;
+
+  if (!geo::within(targets[rickshaw.target], rickshaw.lat, rickshaw.lng, CONFIRM_RADIUS_M)) {
+    rickshaw.stallMs += MESSAGE_DELAY;
+    return;
+  }
+  if (rickshaw.busy(REQ_PICKUP)) return;
+
+  char payload[48];
+  codec::encodePickup(payload, sizeof(payload), rickshaw.currentRideID);
+  send(rickshaw, REQ_PICKUP, true, "/ride/pickup", payload, DECODE_NONE, rickshaw.currentRideID);
+}
+
+void Fleet::onPickupReply(Rickshaw& rickshaw, const NetEvent& reply) {
+  if (reply.rideID != rickshaw.currentRideID || !rickshaw.onActiveRide || rickshaw.pickupConfirmed) return;
+
+  if (reply.httpCode == 200) {
+    rickshaw.pickupConfirmed = true;
+    rickshaw.target = rickshaw.destinationBlock;
+    rickshaw.stallMs += MESSAGE_DELAY;
+  }
+}
+
+void Fleet::completeRide(Rickshaw& rickshaw) {
+  if (!rickshaw.onActiveRide || !rickshaw.pickupConfirmed || rickshaw.target < 0) return;
+
+  if (!geo::within(targets[rickshaw.target], rickshaw.lat, rickshaw.lng, CONFIRM_RADIUS_M)) {
+    rickshaw.stallMs += TOO_FAR_DELAY;
+    return;
+  }
+  if (rickshaw.busy(REQ_COMPLETE)) return;
+
+  char payload[96];
+  codec::encodeComplete(payload, sizeof(payload), rickshaw.currentRideID, rickshaw.lat, rickshaw.lng);
+  send(rickshaw, REQ_COMPLETE, true, "/ride/complete", payload, DECODE_COMPLETE, rickshaw.currentRideID);
+}
+
+void Fleet::onCompleteReply(Rickshaw& rickshaw, const NetEvent& reply) {
+  if (reply.rideID != rickshaw.currentRideID || !rickshaw.onActiveRide) return;
+  if (!reply.decoded) return;
+
+  rickshaw.totalPoints += reply.complete.points;
+  rickshaw.stallMs += COMPLETE_DELAY;
+  endRide(rickshaw);
+}
+
+void Fleet::simulateMovement(Rickshaw& rickshaw) {
+  if (rickshaw.target < 0) return;
+  if (clock.now() - rickshaw.lastMoveTime <= MOVE_PERIOD) return;
+  rickshaw.lastMoveTime = clock.now();
+
+  geo::MoveStep move = geo::step(rickshaw.lat, rickshaw.lng, targets[rickshaw.target], config.speedKmh);
+  if (move.arrived) {
+    typeCommand(rickshaw, rickshaw.pickupConfirmed ? CMD_COMPLETE : CMD_PICKUP);
+  }
+}
+
+// What a dashboard reading the rickshaws table would be off by
+void Fleet::samplePositionError() {
+  for (const Rickshaw& rickshaw : rickshaws) {
+    double lat, lng;
+    if (!backend.storedPosition(rickshaw.id, lat, lng)) continue;
+    positionErrorM.push_back((uint32_t)geo::distance(lat, lng, rickshaw.lat, rickshaw.lng));
+  }
+  if (clock.now() + POSITION_SAMPLE_MS < endMs) {
+    clock.after(POSITION_SAMPLE_MS, [this]() { samplePositionError(); });
+  }
+}
+
+// ===== Run =====
+
+void Fleet::run() {
+  for (UserBlock& user : users) {
+    clock.at((uint64_t)exponential(3600000.0 / config.demandPerHour),
+             [this, &user]() { passengerArrives(user); });
+  }
+
+  // Boot (Wi-Fi + register) staggered over the first few seconds
+  for (Rickshaw& rickshaw : rickshaws) {
+    clock.at((uint64_t)uniform(0, 5000), [this, &rickshaw]() {
+      char payload[192];
+      codec::encodeRegister(payload, sizeof(payload), rickshaw.id.c_str(), "Sim Puller", "01712345678",
+                            rickshaw.lat, rickshaw.lng);
+      send(rickshaw, REQ_REGISTER, true, "/rickshaw/register", payload, DECODE_NONE, 0);
+      rickshawLoop(rickshaw);
+    });
+  }
+
+  clock.at(POSITION_SAMPLE_MS, [this]() { samplePositionError(); });
+
+  auto wallStart = std::chrono::steady_clock::now();
+  while (!clock.empty() && clock.nextTime() < endMs) {
+    if (config.speed > 0) {
+      auto due = wallStart + std::chrono::microseconds((uint64_t)(clock.nextTime() * 1000.0 / config.speed));
+      std::this_thread::sleep_until(due);
+    }
+    clock.runNext();
+  }
+  wallSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - wallStart).count();
+
+  for (Rickshaw& rickshaw : rickshaws) {
+    if (rickshaw.onActiveRide) rickshaw.activeMs += endMs - rickshaw.activeSince;
+  }
+}
+
+// ===== Report =====
+
+static uint32_t percentile(std::vector<uint32_t> samples, double p) {
+  if (samples.empty()) return 0;
+  std::sort(samples.begin(), samples.end());
+  size_t index = (size_t)(p * (samples.size() - 1) + 0.5);
+  return samples[index];
+}
+
+static void printLatency(const char* label, const std::vector<uint32_t>& samples) {
+  printf("  %-28s n=%-6zu p50 %6.1f s  p90 %6.1f s  p99 %6.1f s  max %6.1f s\n", label, samples.size(),
+         percentile(samples, 0.50) / 1000.0, percentile(samples, 0.90) / 1000.0,
+         percentile(samples, 0.99) / 1000.0, percentile(samples, 1.0) / 1000.0);
+}
+
+void Fleet::printReport() const {
+  double simSeconds = endMs / 1000.0;
+  double simHours = simSeconds / 3600.0;
+
+  printf("\n=== AERAS FLEET SIMULATION ===\n");
+  printf("%u user blocks, %u rickshaws, %.2f h simulated, seed %u\n", config.users, config.rickshaws,
+         simHours, config.seed);
+  if (config.heartbeat) {
+    printf("Polling: user %u ms, rickshaw heartbeat %u-%u ms, ", config.userPollMs, HEARTBEAT_EN_ROUTE,
+           HEARTBEAT_PARKED);
+  } else {
+    printf("Polling: user %u ms, pending %u ms, accept %u ms, ride %u ms, ", config.userPollMs,
+           config.ridePollMs, config.acceptPollMs, config.statusPollMs);
+  }
+  if (config.locationMs > 0) {
+    printf("location every %u ms\n", config.locationMs);
+  } else {
+    printf("location as track batches\n");
+  }
+  printf("Wall time %.2f s (%.0fx real time), %llu events\n", wallSeconds,
+         wallSeconds > 0 ? simSeconds / wallSeconds : 0.0, (unsigned long long)clock.executed());
+
+  printf("\n--- Backend load ---\n");
+  uint64_t total = 0;
+  uint64_t bytes = 0;
+  uint64_t bytesIn = 0;
+  uint64_t writes = 0;
+  uint64_t rows = 0;
+  for (int i = 0; i < ENDPOINT_COUNT; i++) {
+    const EndpointStats& stats = backend.stats((Endpoint)i);
+    if (stats.requests == 0) continue;
+    total += stats.requests;
+    bytes += stats.bytesOut;
+    bytesIn += stats.bytesIn;
+    writes += stats.writes;
+    rows += stats.rows;
+    printf("  %-26s %9.2f req/s  %5.1f%% 304  %5.1f%% 4xx  %6.1f B/req in  %8.1f B/req  %6.2f writes/s\n",
+           FakeBackend::endpointName((Endpoint)i), stats.requests / simSeconds,
+           100.0 * stats.notModified / stats.requests, 100.0 * stats.errors / stats.requests,
+           (double)stats.bytesIn / stats.requests, (double)stats.bytesOut / stats.requests,
+           stats.writes / simSeconds);
+  }
+  printf("  %-26s %9.2f req/s  %.1f KB/s in, %.1f KB/s out, %.0f pending rows scanned/s\n", "TOTAL",
+         total / simSeconds, bytesIn / simSeconds / 1024.0, bytes / simSeconds / 1024.0,
+         backend.pendingScanRows() / simSeconds);
+  printf("  %-26s %9.2f transactions/s, %.2f rows/s\n", "Database writes", writes / simSeconds,
+         rows / simSeconds);
+  if (!positionErrorM.empty()) {
+    std::vector<uint32_t> sorted = positionErrorM;
+    std::sort(sorted.begin(), sorted.end());
+    printf("  Stored position error      p50 %u m  p90 %u m  p99 %u m  max %u m\n",
+           sorted[sorted.size() / 2], sorted[(size_t)(0.9 * (sorted.size() - 1))],
+           sorted[(size_t)(0.99 * (sorted.size() - 1))], sorted.back());
+  }
+
+  uint64_t accepted = 0, completed = 0, review = 0, expired = 0, lateAccepts = 0;
+  std::vector<uint32_t> backendAcceptMs;
+  std::vector<uint32_t> rideMs;
+  for (const BackendRide& ride : backend.rides()) {
+    if (ride.acceptMs > 0) {
+      accepted++;
+      backendAcceptMs.push_back(ride.acceptMs - ride.requestMs);
+      if (abandonedRides.count(ride.rideID)) lateAccepts++;
+    }
+    if (ride.status == "COMPLETED") completed++;
+    if (ride.status == "PENDING_REVIEW") review++;
+    if (ride.status == "TIMEOUT") expired++;
+    if (ride.dropMs > 0) rideMs.push_back(ride.dropMs - ride.requestMs);
+  }
+
+  printf("\n--- Dispatch ---\n");
+  printf("  Passengers %llu, turned away (block busy) %llu, request failures %llu\n",
+         (unsigned long long)passengers, (unsigned long long)balked, (unsigned long long)requestsFailed);
+  printf("  Ride requests %llu, accepted %llu, expired on backend %llu\n",
+         (unsigned long long)requestsCreated, (unsigned long long)accepted, (unsigned long long)expired);
+  printf("  User timeouts (REQUEST_TIMEOUT %u ms): %llu = %.1f%% of requests\n", config.requestTimeoutMs,
+         (unsigned long long)userTimeouts, requestsCreated ? 100.0 * userTimeouts / requestsCreated : 0.0);
+  printf("  Accepted after the user gave up: %llu\n", (unsigned long long)lateAccepts);
+  printf("  Offers shown %llu, accepts lost to another puller %llu (%llu retried on the next offer)\n",
+         (unsigned long long)offersShown, (unsigned long long)acceptsLost,
+         (unsigned long long)acceptsRetried);
+  printLatency("Backend accept (req->acc)", backendAcceptMs);
+  printLatency("End-to-end dispatch", dispatchMs);
+  printLatency("Press -> pickup", pickupMs);
+  printLatency("Request -> drop", rideMs);
+
+  uint64_t activeMs = 0;
+  int points = 0;
+  for (const Rickshaw& rickshaw : rickshaws) {
+    activeMs += rickshaw.activeMs;
+    points += rickshaw.totalPoints;
+  }
+
+  printf("\n--- Throughput ---\n");
+  printf("  Completed rides %llu (%.1f /h), pending review %llu, seen complete by users %llu\n",
+         (unsigned long long)completed, completed / simHours, (unsigned long long)review,
+         (unsigned long long)ridesSeenComplete);
+  printf("  Rickshaw utilisation %.1f%%, points awarded %d\n",
+         rickshaws.empty() ? 0.0 : 100.0 * activeMs / ((double)endMs * rickshaws.size()), points);
+}
@@ -0,0 +1,213 @@
+/*
+ * Fleet of simulated user blocks and rickshaws on one virtual clock.
+ *
+ * Each device re-hosts its firmware's control flow (user-side SystemState
+ * machine, rickshaw ride flags and poll timers) per object instead of in
+ * globals, and runs on the firmware's own tick: the user state machine
+ * every STATE_MACHINE_PERIOD, the rickshaw loop() every 100 ms plus any
+ * blocking delay() its handlers would make. Requests and replies are the
+ * firmware's NetCommand/NetEvent pair: bodies are built with the codec
+ * encoders, responses are decoded with decodeNetReply(), and a tag stays
+ * busy until its reply is drained, exactly like NetTask. Rickshaws move
+ * with geo::step(), the same kinematics as simulateMovement().
+ *
+ * Humans are modelled as delays: a passenger spends ULTRASONIC_THRESHOLD
+ * plus a random privilege/confirm time on the block; a puller types
+ * ACCEPT, PICKUP and COMPLETE after a random reaction time.
+ */
+
+#ifndef FLEET_FLEET_H
+#define FLEET_FLEET_H
+
+#include <AerasGeo.h>
+#include <AerasNetTask.h>
+#include <AerasTrack.h>
+#include <AerasOffers.h>
+#include <deque>
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+#include "EventQueue.h"
+#include "FakeBackend.h"
+
+struct SimConfig {
+  uint16_t users = 200;                // User-side blocks (one device each)
+  uint16_t rickshaws = 80;
+  double hours = 2.0;                  // Simulated time
+  double demandPerHour = 1.0;          // Passenger arrivals per block per hour (Poisson)
+  uint32_t seed = 1;
+  double areaRadiusKm = 3.0;           // Blocks are spread over this disc
+  uint32_t rttMs = 120;                // Mean request round trip
+  double operatorReactionMs = 4000;    // Mean time for a puller to type a command
+  double speed = 0;                    // Wall-clock pacing (x real time), 0 = flat out
+
+  // Firmware timing - defaults are the values in the two main.cpp files
+  uint32_t requestTimeoutMs = 60000;   // User REQUEST_TIMEOUT and backend expiry
+  uint32_t userPollMs = 2000;          // User STATUS_POLL_INTERVAL
+  uint32_t ridePollMs = 3000;          // Rickshaw RIDE_POLL_INTERVAL
+  uint32_t acceptPollMs = 2000;        // Rickshaw ACCEPT_POLL_INTERVAL
+  uint32_t statusPollMs = 1500;        // Rickshaw STATUS_POLL_INTERVAL
+  uint32_t locationMs = 0;             // Fixed-period /rickshaw/location POSTs instead of track batches
+  bool heartbeat = true;               // One /rickshaw/heartbeat; false = the three polls above
+  double speedKmh = 15.0;              // Rickshaw speedKmPerHour
+};
+
+class Fleet {
+public:
+  explicit Fleet(const SimConfig& config);
+
+  void run();
+  void printReport() const;
+
+private:
+  // ===== Devices =====
+  struct Device {
+    uint32_t inFlight = 0;             // Tags with a reply not yet drained
+    std::deque<NetEvent> replies;
+    bool busy(uint8_t tag) const { return (inFlight & (1UL << tag)) != 0; }
+  };
+
+  // user-side-hardware SystemState (sensor states collapsed into DETECTING)
+  enum UserState {
+    STATE_IDLE,
+    STATE_DETECTING,
+    STATE_REQUEST_SENT,
+    STATE_WAITING_ACCEPTANCE,
+    STATE_RIDE_ACCEPTED,
+    STATE_RIDE_ACTIVE,
+    STATE_TIMEOUT_ERROR,
+    STATE_RESETTING
+  };
+
+  enum UserHold { HOLD_ENTER_IDLE, HOLD_RESET };
+
+  struct UserBlock : Device {
+    int block;
+    int destination;
+    UserState state = STATE_IDLE;
+    long currentRideID = 0;
+    uint64_t pressedAt = 0;            // Button press (request queued)
+    uint64_t requestSentTime = 0;      // Ride created reply
+    uint64_t lastStatusCheck = 0;
+    uint32_t holdGeneration = 0;       // Cancels stale hold continuations
+    bool ticking = false;
+  };
+
+  enum Command { CMD_NONE, CMD_ACCEPT, CMD_PICKUP, CMD_COMPLETE };
+
+  struct Rickshaw : Device {
+    std::string id;
+    double lat;
+    double lng;
+    long currentRideID = 0;
+    int pickupBlock = -1;
+    int destinationBlock = -1;
+    int target = -1;
+    bool onActiveRide = false;
+    bool pickupConfirmed = false;
+    uint64_t lastMoveTime = 0;
+    uint64_t lastLocationUpdate = 0;
+    uint64_t lastTrackSample = 0;
+    TrajectoryRecorder track;
+    OfferQueue offers;                 // Straight-line ranking; the simulator has no road graph
+    uint64_t lastRideCheck = 0;
+    uint64_t lastStatusCheck = 0;
+    char rideStateETag[48] = "";
+    long rideStateETagID = 0;
+    uint64_t lastHeartbeat = 0;
+    bool heartbeatDue = false;
+    uint32_t pendingVersion = 0;       // 0 = ask for the list
+    double offersLat = 0;              // Where the held list was ranked
+    double offersLng = 0;
+    double movedFromLat = 0;
+    double movedFromLng = 0;
+    uint64_t lastMovedAt = 0;
+    uint32_t stallMs = 0;              // delay() calls made during this loop pass
+    Command typed = CMD_NONE;          // Serial command waiting for loop()
+    bool operatorBusy = false;         // A command is being "typed"
+    uint64_t activeSince = 0;
+    uint64_t activeMs = 0;
+    int totalPoints = 0;
+  };
+
+  // ===== Network (NetTask stand-in) =====
+  void send(Device& device, uint8_t tag, bool post, const std::string& path, const std::string& body,
+            NetDecode decode, long rideID, const char* ifNoneMatch = nullptr);
+  bool poll(Device& device, NetEvent& reply);
+  uint32_t oneWayMs();
+
+  // ===== User side =====
+  void passengerArrives(UserBlock& user);
+  void pressButton(UserBlock& user);
+  void userTick(UserBlock& user);
+  void startUserTicks(UserBlock& user);
+  void holdThen(UserBlock& user, uint32_t holdMs, UserHold next);
+  void resetSystem(UserBlock& user);
+  void onRideCreatedReply(UserBlock& user, const NetEvent& reply);
+  void checkRideStatus(UserBlock& user);
+  void applyRideStatus(UserBlock& user, const char* status);
+  void checkTimeout(UserBlock& user);
+  bool isTrackingRide(const UserBlock& user) const;
+
+  // ===== Rickshaw side =====
+  void rickshawLoop(Rickshaw& rickshaw);
+  void handleNetReply(Rickshaw& rickshaw, const NetEvent& reply);
+  void typeCommand(Rickshaw& rickshaw, Command command);
+  void updateTrajectory(Rickshaw& rickshaw);
+  void sendLocationUpdate(Rickshaw& rickshaw);
+  void checkForRideRequests(Rickshaw& rickshaw);
+  void onPendingReply(Rickshaw& rickshaw, const NetEvent& reply);
+  bool showTopOffer(Rickshaw& rickshaw);
+  void checkWebAppAcceptance(Rickshaw& rickshaw);
+  void checkRideStatusUpdates(Rickshaw& rickshaw);
+  void requestRideState(Rickshaw& rickshaw);
+  void onRideStateReply(Rickshaw& rickshaw, const NetEvent& reply);
+  void applyRideUpdate(Rickshaw& rickshaw, const RideStatus& ride);
+  uint32_t heartbeatInterval(const Rickshaw& rickshaw) const;
+  void sendHeartbeat(Rickshaw& rickshaw);
+  void onHeartbeatReply(Rickshaw& rickshaw, const NetEvent& reply);
+  void acceptRide(Rickshaw& rickshaw);
+  void onAcceptReply(Rickshaw& rickshaw, const NetEvent& reply);
+  void confirmPickup(Rickshaw& rickshaw);
+  void onPickupReply(Rickshaw& rickshaw, const NetEvent& reply);
+  void completeRide(Rickshaw& rickshaw);
+  void onCompleteReply(Rickshaw& rickshaw, const NetEvent& reply);
+  void simulateMovement(Rickshaw& rickshaw);
+  void startRide(Rickshaw& rickshaw);
+  void endRide(Rickshaw& rickshaw);
+  void samplePositionError();
+
+  // ===== Helpers =====
+  double uniform(double low, double high);
+  double exponential(double mean);
+  int blockIndex(const char* id) const;
+
+  SimConfig config;
+  std::mt19937 rng;
+  EventQueue clock;
+  std::vector<Block> blocks;
+  std::vector<geo::Target> targets;    // Per block, as the firmware caches navTarget
+  FakeBackend backend;
+  std::vector<UserBlock> users;
+  std::vector<Rickshaw> rickshaws;
+  uint64_t endMs;
+  double wallSeconds = 0;
+
+  // ===== Statistics =====
+  uint64_t passengers = 0;             // Arrivals
+  uint64_t balked = 0;                 // Arrived while the block was busy
+  uint64_t requestsCreated = 0;
+  uint64_t requestsFailed = 0;
+  uint64_t userTimeouts = 0;
+  uint64_t ridesSeenComplete = 0;      // COMPLETED observed by the user block
+  uint64_t offersShown = 0;
+  uint64_t acceptsLost = 0;            // success:false - another puller was first
+  uint64_t acceptsRetried = 0;         // ... and the next queued offer was tried at once
+  std::vector<uint32_t> dispatchMs;    // Button press -> user sees ACCEPTED
+  std::vector<uint32_t> pickupMs;      // Button press -> user sees PICKUP
+  std::vector<uint32_t> positionErrorM;  // Backend's stored position vs the true one
+  std::set<long> abandonedRides;       // User block timed out on these
+};
+
+#endif
@@ -0,0 +1,83 @@
+/*
+ * AERAS Fleet Simulator
+ * Runs hundreds of user blocks and rickshaws against an in-process
+ * backend stand-in on a virtual clock, and reports backend request rates,
+ * dispatch latency, timeout rate and ride throughput. Use it to size the
+ * backend and tune polling intervals before a rollout.
+ */
+
+#include <Arduino.h>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include "Fleet.h"
+
+static void usage(const char* program) {
+  printf("usage: %s [options]\n", program);
+  printf("  --users N            user-side blocks (200)\n");
+  printf("  --rickshaws N        rickshaws (80)\n");
+  printf("  --hours H            simulated hours (2)\n");
+  printf("  --demand R           passengers per block per hour (1.0)\n");
+  printf("  --seed S             random seed (1)\n");
+  printf("  --rtt MS             mean request round trip (120)\n");
+  printf("  --area KM            radius the blocks are spread over (3)\n");
+  printf("  --reaction MS        mean puller reaction time (4000)\n");
+  printf("  --speed X            pace at X times real time, 0 = flat out (0)\n");
+  printf("  --timeout MS         REQUEST_TIMEOUT / backend expiry (60000)\n");
+  printf("  --user-poll MS       user STATUS_POLL_INTERVAL (2000)\n");
+  printf("  --ride-poll MS       rickshaw RIDE_POLL_INTERVAL (3000)\n");
+  printf("  --accept-poll MS     rickshaw ACCEPT_POLL_INTERVAL (2000)\n");
+  printf("  --status-poll MS     rickshaw STATUS_POLL_INTERVAL (1500)\n");
+  printf("  --location MS        fixed-period location POSTs instead of track batches (0 = off)\n");
+  printf("  --heartbeat 0|1      one adaptive heartbeat instead of the three rickshaw polls (1)\n");
+}
+
+int main(int argc, char** argv) {
+  SimConfig config;
+
+  for (int i = 1; i < argc; i++) {
+    std::string arg = argv[i];
+    if (arg == "--help" || arg == "-h") {
+      usage(argv[0]);
+      return 0;
+    }
+    if (i + 1 >= argc) {
+      usage(argv[0]);
+      return 2;
+    }
+    const char* value = argv[++i];
+
+    if (arg == "--users") config.users = atoi(value);
+    else if (arg == "--rickshaws") config.rickshaws = atoi(value);
+    else if (arg == "--hours") config.hours = atof(value);
+    else if (arg == "--demand") config.demandPerHour = atof(value);
+    else if (arg == "--seed") config.seed = strtoul(value, nullptr, 10);
+    else if (arg == "--rtt") config.rttMs = atoi(value);
+    else if (arg == "--area") config.areaRadiusKm = atof(value);
+    else if (arg == "--reaction") config.operatorReactionMs = atof(value);
+    else if (arg == "--speed") config.speed = atof(value);
+    else if (arg == "--timeout") config.requestTimeoutMs = atoi(value);
+    else if (arg == "--user-poll") config.userPollMs = atoi(value);
+    else if (arg == "--ride-poll") config.ridePollMs = atoi(value);
+    else if (arg == "--accept-poll") config.acceptPollMs = atoi(value);
+    else if (arg == "--status-poll") config.statusPollMs = atoi(value);
+    else if (arg == "--location") config.locationMs = atoi(value);
+    else if (arg == "--heartbeat") config.heartbeat = atoi(value) != 0;
+    else {
+      usage(argv[0]);
+      return 2;
+    }
+  }
+
+  if (config.users < 2 || config.demandPerHour <= 0 || config.hours <= 0) {
+    printf("✗ Need at least 2 users, positive demand and duration\n");
+    return 2;
+  }
+
+  printf("🛺 Simulating %u blocks and %u rickshaws for %.2f h...\n", config.users, config.rickshaws,
+         config.hours);
+  Fleet fleet(config);
+  fleet.run();
+  fleet.printReport();
+  return 0;
+}
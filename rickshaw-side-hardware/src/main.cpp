@@ -6,22 +6,61 @@
 
 #include <Arduino.h>
 #include <Wire.h>
-#include <Adafruit_SSD1306.h>
 #include <WiFi.h>
-#include <HTTPClient.h>
+#include <AerasNetTask.h>
+#include <AerasCodec.h>
+#include <AerasCodecBench.h>
+#include <AerasDisplay.h>
+#include <AerasDisplayBench.h>
+#include <AerasGeo.h>
+#include <AerasGeoBench.h>
+#include <AerasRoute.h>
+#include <AerasRouteBench.h>
+#include <AerasBlocks.h>
+#include <AerasGps.h>
+#include <AerasTrack.h>
+#include <AerasOffers.h>
+#include <AerasConsole.h>
+#include <AerasBoot.h>
+#include <AerasResume.h>
+#include <AerasScheduler.h>
 
 // ===== OLED Display =====
-#define SCREEN_WIDTH 128
-#define SCREEN_HEIGHT 64
-Adafruit_SSD1306 display(SCREEN_WIDTH, SCREEN_HEIGHT, &Wire);
+FrameDisplay display(&Wire);  // Sends only what changed since the last frame
+
+// Screen IDs: switching screens clears the display, same screen only redraws changed fields
+enum ScreenID {
+  SCREEN_MESSAGE,
+  SCREEN_STATUS,
+  SCREEN_OFFER,
+  SCREEN_COMPLETE,
+  SCREEN_NAVIGATION
+};
 
 // ===== WiFi Configuration =====
+// Defaults that seed NVS on first boot; CONFIG changes the stored copy
 const char* WIFI_SSID = "Wokwi-GUEST";
 const char* WIFI_PASSWORD = "";
 const char* BACKEND_URL = "http://10.172.129.95:3000/api";
+// Push events from the native gateway (`npm run gateway`); nullptr: the backend
+const char* EVENTS_URL = nullptr;
+const char* RICKSHAW_ID = "RICK001";
+FastBoot boot;      // Joins the cached AP without a scan; boot phase timer
+NetTask network;    // HTTP + push on core 0; replies handled in loop()
+
+// Request kinds; each reply comes back with its tag
+enum RequestTag : uint8_t {
+  REQ_REGISTER,
+  REQ_HEARTBEAT,
+  REQ_ACCEPT,
+  REQ_PICKUP,
+  REQ_COMPLETE,
+  REQ_TRACK,
+  REQ_LOCATIONS
+};
 
 // ===== Rickshaw Info =====
-String rickshawID = "RICK001";
+String rickshawID = RICKSHAW_ID;  // From NVS in setup()
 String pullerName = "Abdul Karim";
 bool isOnline = true;
 int totalPoints = 0;
@@ -33,408 +72,472 @@ struct Location {
   String name;
 };
 
-Location locations[] = {
-  {22.4633, 91.9714, "CUET_CAMPUS"},
-  {22.4725, 91.9845, "PAHARTOLI"},
-  {22.4580, 91.9920, "NOAPARA"},
-  {22.4520, 91.9650, "RAOJAN"}
-};
-
 double currentLat = 22.4633;
 double currentLng = 91.9714;
 
+// ===== GPS =====
+// NEO-6M style module on UART2. While it delivers fresh fixes they replace
+// the simulated position; without one (no module wired, as in the Wokwi
+// diagram) simulateMovement() keeps driving.
+const int8_t GPS_RX_PIN = 16;
+const int8_t GPS_TX_PIN = 17;
+GpsReceiver gps;
+
+// ===== Trajectory upload =====
+// Positions are sampled once a second but only points the dead-reckoning
+// prediction misses are kept, and they go up in batches
+TrajectoryRecorder track;
+const unsigned long TRACK_SAMPLE_INTERVAL = 1000;
+
 // ===== Active ride info =====
-String currentRideID = "";
+long currentRideID = 0;  // 0 = no ride
 String pickupLocation = "";
 String destinationLocation = "";
 bool onActiveRide = false;
 bool pickupConfirmed = false;
+SnapshotStore rideStore;  // The fields above, kept across a reset (RTC + NVS)
 
 // Simulated movement
 Location targetLocation;
+geo::Target navTarget;  // Trig cached for targetLocation, used by the per-loop paths
+route::RouteNavigator router;  // Road route to targetLocation over the flash road graph
 double speedKmPerHour = 15.0;
 unsigned long lastMoveTime = 0;
-unsigned long lastLocationUpdate = 0;
-unsigned long lastRideCheck = 0;
-unsigned long lastStatusCheck = 0;  // NEW: For checking accepted status
+unsigned long lastTrackSample = 0;
+unsigned long lastHeartbeat = 0;
+bool heartbeatDue = false;          // Push said a new offer is waiting
+unsigned long lastMovedAt = 0;      // Last time we left a PARKED_RADIUS_M circle
+double movedFromLat = 0;
+double movedFromLng = 0;
+
+// Heartbeat periods by state; stretched to a slow safety poll while push is connected
+const unsigned long HEARTBEAT_EN_ROUTE = 1500;  // On a ride: web app pickup/complete
+const unsigned long HEARTBEAT_OFFER = 2000;     // Offer on screen: accepted elsewhere?
+const unsigned long HEARTBEAT_IDLE = 3000;      // Available and moving
+const unsigned long HEARTBEAT_PARKED = 8000;    // Available, within PARKED_RADIUS_M for PARKED_AFTER
+const unsigned long PARKED_AFTER = 60000;
+const double PARKED_RADIUS_M = 20;
+const double OFFER_REFRESH_M = 500;             // Re-fetch the list after moving this far
+const unsigned long PUSH_FALLBACK_INTERVAL = 15000;
 
 // ===== Helper Functions =====
 void displayMessage(String line1, String line2, String line3 = "") {
-  display.clearDisplay();
-  display.setTextSize(1);
-  display.setTextColor(SSD1306_WHITE);
-  display.setCursor(0, 10);
-  display.println("AERAS SYSTEM");
-  display.println("================");
-  display.setCursor(0, 28);
-  display.println(line1);
-  display.setCursor(0, 40);
-  display.println(line2);
-  if (line3 != "") {
-    display.setCursor(0, 52);
-    display.println(line3);
-  }
-  display.display();
+  display.screen(SCREEN_MESSAGE);
+  display.text(0, 0, 10, "AERAS SYSTEM");
+  display.text(1, 0, 18, "================");
+  display.text(2, 0, 28, line1);
+  display.text(3, 0, 40, line2);
+  display.text(4, 0, 52, line3);
+  display.presentNow();
+}
+
+// ===== Message hold =====
+// A message stays up for holdMs while the loop and ride state move on
+// underneath it (sensing, console and the GPS UART never wait); the status,
+// offer and navigation screens hold off and are redrawn when it comes down.
+Scheduler scheduler;
+bool messageHeld = false;
+
+void redrawScreen();
+
+void releaseMessage() {
+  messageHeld = false;
+  redrawScreen();
+}
+
+void holdMessage(uint32_t holdMs) {
+  scheduler.cancel(releaseMessage);
+  messageHeld = true;
+  scheduler.after(holdMs, releaseMessage);
 }
 
 double calculateDistance(double lat1, double lon1, double lat2, double lon2) {
-  double R = 6371000.0;
-  double dLat = (lat2 - lat1) * PI / 180.0;
-  double dLon = (lon2 - lon1) * PI / 180.0;
-  
-  double a = sin(dLat/2) * sin(dLat/2) +
-             cos(lat1 * PI / 180.0) * cos(lat2 * PI / 180.0) *
-             sin(dLon/2) * sin(dLon/2);
-  
-  double c = 2 * atan2(sqrt(a), sqrt(1-a));
-  return R * c;
+  return geo::distance(lat1, lon1, lat2, lon2);
 }
 
-void setTargetLocation(String locationName) {
-  locationName.toUpperCase();
-  
-  Serial.println("Searching for location: " + locationName);
-  
-  for (int i = 0; i < 4; i++) {
-    bool match = false;
-    
-    if (locations[i].name == locationName) {
-      match = true;
-    }
-    else if (locations[i].name.indexOf(locationName) >= 0) {
-      match = true;
-    }
-    else if (locationName.indexOf("PAHARTOLI") >= 0 && locations[i].name == "PAHARTOLI") {
-      match = true;
-    }
-    else if (locationName.indexOf("CUET") >= 0 && locations[i].name == "CUET_CAMPUS") {
-      match = true;
-    }
-    else if (locationName.indexOf("NOAPARA") >= 0 && locations[i].name == "NOAPARA") {
-      match = true;
-    }
-    else if (locationName.indexOf("RAOJAN") >= 0 && locations[i].name == "RAOJAN") {
-      match = true;
-    }
-    
-    if (match) {
-      targetLocation = locations[i];
-      Serial.println("✓ Target set: " + targetLocation.name);
-      Serial.println("  Coords: " + String(targetLocation.lat, 6) + ", " + String(targetLocation.lng, 6));
-      
-      double dist = calculateDistance(currentLat, currentLng, targetLocation.lat, targetLocation.lng);
-      Serial.println("  Distance: " + String(dist, 1) + " m");
-      return;
-    }
+// Block IDs come from the backend verbatim: one table lookup, no matching
+void setTargetLocation(const char* blockID) {
+  const blocks::Block* block = blocks::find(blockID);
+  if (block == nullptr) {
+    Serial.println("✗ Unknown block: " + String(blockID) + " (table v" + String(blocks::version()) + ")");
+    return;
   }
   
-  Serial.println("✗ Location not found, trying partial match...");
+  targetLocation.lat = block->lat;
+  targetLocation.lng = block->lng;
+  targetLocation.name = block->id;
+  navTarget = geo::makeTarget(block->lat, block->lng);
+  Serial.println("✓ Target set: " + targetLocation.name);
+  Serial.println("  Coords: " + String(targetLocation.lat, 6) + ", " + String(targetLocation.lng, 6));
+  
+  double dist = calculateDistance(currentLat, currentLng, targetLocation.lat, targetLocation.lng);
+  Serial.println("  Distance: " + String(dist, 1) + " m");
   
-  if (locationName.indexOf("PAHAR") >= 0 || locationName.indexOf("Pahar") >= 0) {
-    targetLocation = locations[1];
-    Serial.println("✓ Matched to PAHARTOLI");
+  if (router.setTarget(currentLat, currentLng, navTarget)) {
+    Serial.println("  Route: " + String(router.guidance().remainingM, 0) + " m by road");
   } else {
-    Serial.println("✗ Could not find location: " + locationName);
+    Serial.println("  Route: off the road graph, straight line");
   }
 }
 
+// Whole minutes at the simulated speed, at least 1
+int etaMinutes(float meters) {
+  int minutes = (int)(meters / (speedKmPerHour / 3.6) / 60.0 + 0.5);
+  return minutes > 0 ? minutes : 1;
+}
+
+// ===== Offer buffer =====
+// Every ride in the /ride/pending reply, ranked by road distance to the
+// pickup and how long the rider has waited; the top one is on offer
+float roadDistanceToPickup(const PendingRide& ride) {
+  const blocks::Block* pickup = blocks::find(ride.pickupBlock);
+  if (pickup == nullptr) return -1;
+  return router.distance(currentLat, currentLng, pickup->lat, pickup->lng);
+}
+
+OfferQueue offers(roadDistanceToPickup);
+const uint8_t OFFER_ROWS = 3;   // Offers listed on the OLED
+void showOffers();
+
 double calculateBearing(double lat1, double lon1, double lat2, double lon2) {
-  double dLon = (lon2 - lon1) * PI / 180.0;
-  lat1 = lat1 * PI / 180.0;
-  lat2 = lat2 * PI / 180.0;
-  
-  double y = sin(dLon) * cos(lat2);
-  double x = cos(lat1) * sin(lat2) - sin(lat1) * cos(lat2) * cos(dLon);
-  double bearing = atan2(y, x) * 180.0 / PI;
-  
-  return fmod((bearing + 360.0), 360.0);
+  return geo::bearing(lat1, lon1, lat2, lon2);
 }
 
 void displayStatus(String status, String message) {
-  display.clearDisplay();
-  display.setTextSize(1);
-  display.setCursor(0, 10);
-  display.println("AERAS Rickshaw");
-  display.println("================");
-  display.print("Status: ");
-  display.println(status);
-  display.println(message);
-  display.print("Points: ");
-  display.println(totalPoints);
-  display.display();
+  if (messageHeld) return;  // Drawn by redrawScreen() once the message is down
+  display.screen(SCREEN_STATUS);
+  display.text(0, 0, 10, "AERAS Rickshaw");
+  display.text(1, 0, 18, "================");
+  display.text(2, 0, 26, "Status: " + status);
+  display.text(3, 0, 34, message);
+  display.text(4, 0, 42, "Points: " + String(totalPoints));
+  display.presentNow();
+}
+
+// ===== Ride snapshot =====
+// Written on every transition so a reset mid-ride picks the ride back up
+void saveRideState() {
+  RideSnapshot snapshot;
+  memset(&snapshot, 0, sizeof(snapshot));
+  snapshot.rideID = onActiveRide ? currentRideID : 0;
+  snapshot.phase = !onActiveRide ? PHASE_IDLE : pickupConfirmed ? PHASE_TO_DESTINATION : PHASE_TO_PICKUP;
+  strncpy(snapshot.pickup, pickupLocation.c_str(), sizeof(snapshot.pickup) - 1);
+  strncpy(snapshot.destination, destinationLocation.c_str(), sizeof(snapshot.destination) - 1);
+  snapshot.lat = currentLat;
+  snapshot.lng = currentLng;
+  snapshot.totalPoints = totalPoints;
+  rideStore.save(snapshot);
+}
+
+// Navigation restarts from the snapshot at once; the first heartbeat
+// after the link comes up checks the ride against the backend
+void resumeRide() {
+  RideSnapshot saved;
+  if (!rideStore.restore(saved)) return;
+  totalPoints = saved.totalPoints;
+  if (saved.phase == PHASE_IDLE || saved.rideID == 0) return;
+  
+  currentRideID = saved.rideID;
+  pickupLocation = saved.pickup;
+  destinationLocation = saved.destination;
+  onActiveRide = true;
+  pickupConfirmed = saved.phase == PHASE_TO_DESTINATION;
+  currentLat = saved.lat;
+  currentLng = saved.lng;
+  
+  Serial.println("\n↻ RESUMED RIDE " + String(currentRideID) + " at " + String(millis()) + " ms");
+  Serial.println("   " + pickupLocation + " → " + destinationLocation +
+                 (pickupConfirmed ? ", rider on board" : ", going to pickup"));
+  setTargetLocation(pickupConfirmed ? destinationLocation.c_str() : pickupLocation.c_str());
+}
+
+// Back to AVAILABLE, however the ride ended
+void resetRide() {
+  onActiveRide = false;
+  pickupConfirmed = false;
+  currentRideID = 0;
+  pickupLocation = "";
+  destinationLocation = "";
+  router.clear();
+  saveRideState();
+  
+  displayStatus("AVAILABLE", "Waiting for rides");
 }
 
 // ===== Register Rickshaw =====
 void registerRickshaw() {
   if (WiFi.status() != WL_CONNECTED) return;
   
-  HTTPClient http;
-  String url = String(BACKEND_URL) + "/rickshaw/register";
-  
-  http.begin(url);
-  http.addHeader("Content-Type", "application/json");
-  
-  String payload = "{";
-  payload += "\"rickshawID\":\"" + rickshawID + "\",";
-  payload += "\"pullerName\":\"" + pullerName + "\",";
-  payload += "\"phoneNumber\":\"01712345678\",";
-  payload += "\"currentLat\":" + String(currentLat, 6) + ",";
-  payload += "\"currentLng\":" + String(currentLng, 6);
-  payload += "}";
+  char payload[192];
+  codec::encodeRegister(payload, sizeof(payload), rickshawID.c_str(), pullerName.c_str(),
+                        "01712345678", currentLat, currentLng);
   
-  int httpCode = http.POST(payload);
-  if (httpCode > 0) {
+  network.post(REQ_REGISTER, "/rickshaw/register", payload, DECODE_NONE);
+}
+
+void onRegisterReply(const NetEvent& reply) {
+  if (reply.httpCode > 0) {
     Serial.println("✓ Registered with backend");
   }
-  
-  http.end();
 }
 
-// ===== NEW: Check if web app accepted a ride =====
-void checkWebAppAcceptance() {
+// ===== Block table overlay =====
+// 304 = the compiled-in table is current; anything newer is staged by the
+// network task and swapped in here
+void loadBlockOverlay() {
   if (WiFi.status() != WL_CONNECTED) return;
-  if (onActiveRide) return;  // Already on a ride
-  if (currentRideID == "") return;  // No pending ride to check
-  if (millis() - lastStatusCheck < 2000) return;  // Check every 2 seconds
-  
-  lastStatusCheck = millis();
+  network.get(REQ_LOCATIONS, "/locations", DECODE_LOCATIONS, 0,
+              Transport::DEFAULT_TIMEOUT_MS, blocks::etag());
+}
+
+void onLocationsReply(const NetEvent& reply) {
+  if (reply.httpCode == 304) {
+    Serial.println("✓ Block table v" + String(blocks::version()) + " is current");
+  } else if (reply.decoded && blocks::commitStaged(reply.locations.version)) {
+    Serial.println("✓ Block table v" + String(blocks::version()) + ": " +
+                   String(blocks::overlayCount()) + " overlay blocks");
+  } else {
+    Serial.println("⚠️ Block overlay not loaded (HTTP " + String(reply.httpCode) +
+                   "), using built-in v" + String(blocks::version()));
+  }
+}
+
+// ===== Apply a ride status change (poll or push) =====
+void applyRideUpdate(const RideStatus& ride) {
+  String status = ride.status;
   
-  HTTPClient http;
-  String url = String(BACKEND_URL) + "/admin/rides?limit=10";
+  if (!onActiveRide) {
+    if (rickshawID == ride.rickshawID && status == "ACCEPTED") {
+      // Web app accepted! Fill in ride details if we don't have them
+      if (pickupLocation == "") pickupLocation = ride.pickupBlock;
+      if (destinationLocation == "") destinationLocation = ride.destination;
+      
+      Serial.println("\n🌐 WEB APP ACCEPTED RIDE!");
+      Serial.println("   Ride ID: " + String(currentRideID));
+      Serial.println("   Pickup: " + pickupLocation);
+      Serial.println("   Destination: " + destinationLocation);
+      
+      onActiveRide = true;
+      pickupConfirmed = false;
+      offers.clear();
+      
+      setTargetLocation(pickupLocation.c_str());
+      saveRideState();
+      
+      displayMessage("Web Accepted!", "Going to pickup", pickupLocation);
+      holdMessage(2000);
+    }
+    else if (status != "PENDING") {
+      // Offer went to someone else or expired: on to the next one
+      Serial.println("Ride " + String(currentRideID) + " no longer available (" + status + ")");
+      offers.remove(ride.rideID);
+      showOffers();
+    }
+    return;
+  }
   
-  http.begin(url);
-  int httpCode = http.GET();
+  // Debug logging
+  static String lastStatus = "";
+  if (status != lastStatus) {
+    Serial.println("Status changed: " + lastStatus + " -> " + status);
+    lastStatus = status;
+  }
   
-  if (httpCode == 200) {
-    String response = http.getString();
+  // NEW: Check if pickup was confirmed from web app
+  if (status == "PICKUP" && !pickupConfirmed) {
+    Serial.println("\n🌐 🌐 🌐 WEB APP CONFIRMED PICKUP! 🌐 🌐 🌐");
+    pickupConfirmed = true;
     
-    // Only look for OUR current pending ride ID
-    String searchString = "\"rideID\":" + currentRideID;
-    int ridePos = response.indexOf(searchString);
+    // Fill in destination if we don't have it
+    if (destinationLocation == "") destinationLocation = ride.destination;
     
-    if (ridePos > 0) {
-      // Found our ride, now check its status
-      int statusPos = response.indexOf("\"status\":\"", ridePos);
-      if (statusPos > 0 && statusPos < ridePos + 500) {  // Within same ride object
-        int statusStart = statusPos + 10;
-        int statusEnd = response.indexOf("\"", statusStart);
-        String status = response.substring(statusStart, statusEnd);
-        
-        // Check if assigned to us
-        int rickshawPos = response.indexOf("\"rickshawID\":\"", ridePos);
-        if (rickshawPos > 0 && rickshawPos < ridePos + 500) {
-          int rickStart = rickshawPos + 14;
-          int rickEnd = response.indexOf("\"", rickStart);
-          String assignedRick = response.substring(rickStart, rickEnd);
-          
-          if (assignedRick == rickshawID && status == "ACCEPTED") {
-            // Web app accepted! Extract ride details if we don't have them
-            if (pickupLocation == "") {
-              int pickupPos = response.indexOf("\"pickupBlock\":\"", ridePos);
-              int pickupStart = pickupPos + 15;
-              int pickupEnd = response.indexOf("\"", pickupStart);
-              pickupLocation = response.substring(pickupStart, pickupEnd);
-            }
-            
-            if (destinationLocation == "") {
-              int destPos = response.indexOf("\"destination\":\"", ridePos);
-              int destStart = destPos + 15;
-              int destEnd = response.indexOf("\"", destStart);
-              destinationLocation = response.substring(destStart, destEnd);
-            }
-            
-            Serial.println("\n🌐 WEB APP ACCEPTED RIDE!");
-            Serial.println("   Ride ID: " + currentRideID);
-            Serial.println("   Pickup: " + pickupLocation);
-            Serial.println("   Destination: " + destinationLocation);
-            
-            onActiveRide = true;
-            pickupConfirmed = false;
-            
-            setTargetLocation(pickupLocation);
-            
-            displayMessage("Web Accepted!", "Going to pickup", pickupLocation);
-            delay(2000);
-            
-            return;
-          }
-        }
-      }
-    }
+    Serial.println("🗺️ Setting navigation to DESTINATION...");
+    Serial.println("   Destination: " + destinationLocation);
+    setTargetLocation(destinationLocation.c_str());
+    saveRideState();
+    
+    displayMessage("Web Pickup OK", "Going to dest", destinationLocation);
+    holdMessage(2000);
+    
+    Serial.println("\n🚗 DRIVING TO DESTINATION...\n");
+  }
+  // Our own COMPLETE is in flight: its reply ends the ride with the points
+  else if (network.busy(REQ_COMPLETE)) {
+    return;
+  }
+  // Check if ride was completed from web app
+  else if (status == "COMPLETED") {
+    Serial.println("\n🌐 🌐 🌐 WEB APP COMPLETED RIDE! 🌐 🌐 🌐");
+    Serial.println("   Resetting system...");
+    resetRide();
+    Serial.println("✓ System reset - Ready for new rides\n");
+  }
+  // Closed or handed to someone else while we were reset or offline
+  else if ((status != "ACCEPTED" && status != "PICKUP") || rickshawID != ride.rickshawID) {
+    Serial.println("\n✗ Ride " + String(currentRideID) + " is " + status + " for " +
+                   String(ride.rickshawID[0] != '\0' ? ride.rickshawID : "nobody") + " - dropping it");
+    resetRide();
   }
-  
-  http.end();
 }
 
-// ===== NEW: Check for ride status updates (pickup/complete) =====
-void checkRideStatusUpdates() {
-  if (WiFi.status() != WL_CONNECTED) return;
-  if (!onActiveRide) return;  // Only check when on active ride
-  if (currentRideID == "") return;
-  if (millis() - lastStatusCheck < 1500) return;  // Check every 1.5 seconds (faster!)
-  
-  lastStatusCheck = millis();
-  
-  HTTPClient http;
-  String url = String(BACKEND_URL) + "/admin/rides?limit=10";
+// ===== Push channel =====
+// "ride" events, decoded on the network task
+void onPushedRide(const RideStatus& ride) {
+  Serial.println("📡 Push: ride " + String(ride.rideID) + " " + ride.status);
+  
+  if (ride.rideID == currentRideID) {
+    applyRideUpdate(ride);
+  } else if (onActiveRide) {
+    return;
+  } else if (strcmp(ride.status, "PENDING") == 0) {
+    heartbeatDue = true;  // Fetch the offer list right away
+  } else if (offers.remove(ride.rideID)) {
+    showOffers();         // A queued offer went elsewhere
+  }
+}
+
+// ===== Heartbeat =====
+// One exchange per cycle carries the live position, the ride we hold with
+// the status we know, and the pending-list version we hold. The reply has
+// only what changed: that ride's new status (or a ride assigned to us from
+// the web app), and the pending list when its version moved.
+uint32_t pendingVersion = 0;        // 0 = ask for the list
+double offersLat = 0;               // Where the held list was ranked
+double offersLng = 0;
+
+const char* knownRideStatus() {
+  if (!onActiveRide) return "PENDING";
+  return pickupConfirmed ? "PICKUP" : "ACCEPTED";
+}
+
+// Period by state: fast while a rider is waiting on us, slow when parked
+unsigned long heartbeatInterval() {
+  unsigned long interval = HEARTBEAT_IDLE;
+  if (onActiveRide) interval = HEARTBEAT_EN_ROUTE;
+  else if (currentRideID != 0) interval = HEARTBEAT_OFFER;
+  else if (millis() - lastMovedAt > PARKED_AFTER) interval = HEARTBEAT_PARKED;
+  
+  // Push delivers changes as they happen; the heartbeat is then a safety net
+  if (network.pushConnected() && interval < PUSH_FALLBACK_INTERVAL) interval = PUSH_FALLBACK_INTERVAL;
+  return interval;
+}
+
+void sendHeartbeat() {
+  if (calculateDistance(currentLat, currentLng, movedFromLat, movedFromLng) > PARKED_RADIUS_M) {
+    movedFromLat = currentLat;
+    movedFromLng = currentLng;
+    lastMovedAt = millis();
+  }
   
-  http.begin(url);
-  http.setTimeout(3000);
-  int httpCode = http.GET();
+  if (WiFi.status() != WL_CONNECTED) return;
+  if (!heartbeatDue && millis() - lastHeartbeat < heartbeatInterval()) return;
+  if (network.busy(REQ_HEARTBEAT) || network.busy(REQ_ACCEPT)) return;
+  lastHeartbeat = millis();
+  heartbeatDue = false;
+  
+  // Moved far since the list was ranked: the nearest rides may differ now
+  if (calculateDistance(currentLat, currentLng, offersLat, offersLng) > OFFER_REFRESH_M) pendingVersion = 0;
+  
+  char payload[sizeof(NetCommand::body)];
+  codec::encodeHeartbeat(payload, sizeof(payload), rickshawID.c_str(), currentLat, currentLng,
+                         currentRideID, knownRideStatus(), pendingVersion);
+  network.post(REQ_HEARTBEAT, "/rickshaw/heartbeat", payload, DECODE_HEARTBEAT, currentRideID,
+               onActiveRide ? 3000 : Transport::DEFAULT_TIMEOUT_MS);
+}
+
+void onHeartbeatReply(const NetEvent& reply) {
+  if (!reply.decoded) {
+    if (onActiveRide) Serial.println("✗ HTTP Error on heartbeat: " + String(reply.httpCode));
+    return;
+  }
   
-  if (httpCode == 200) {
-    String response = http.getString();
-    
-    // Look for our current ride
-    String searchString = "\"rideID\":" + currentRideID;
-    int ridePos = response.indexOf(searchString);
-    
-    if (ridePos > 0) {
-      // Check status
-      int statusPos = response.indexOf("\"status\":\"", ridePos);
-      if (statusPos > 0 && statusPos < ridePos + 500) {
-        int statusStart = statusPos + 10;
-        int statusEnd = response.indexOf("\"", statusStart);
-        String status = response.substring(statusStart, statusEnd);
-        
-        // Debug logging
-        static String lastStatus = "";
-        if (status != lastStatus) {
-          Serial.println("Status changed: " + lastStatus + " -> " + status);
-          lastStatus = status;
-        }
-        
-        // NEW: Check if pickup was confirmed from web app
-        if (status == "PICKUP" && !pickupConfirmed) {
-          Serial.println("\n🌐 🌐 🌐 WEB APP CONFIRMED PICKUP! 🌐 🌐 🌐");
-          pickupConfirmed = true;
-          
-          // Extract destination if we don't have it
-          if (destinationLocation == "") {
-            int destPos = response.indexOf("\"destination\":\"", ridePos);
-            if (destPos > 0) {
-              int destStart = destPos + 15;
-              int destEnd = response.indexOf("\"", destStart);
-              destinationLocation = response.substring(destStart, destEnd);
-            }
-          }
-          
-          Serial.println("🗺️ Setting navigation to DESTINATION...");
-          Serial.println("   Destination: " + destinationLocation);
-          setTargetLocation(destinationLocation);
-          
-          displayMessage("Web Pickup OK", "Going to dest", destinationLocation);
-          delay(2000);
-          
-          Serial.println("\n🚗 DRIVING TO DESTINATION...\n");
-        }
-        // Check if ride was completed from web app
-        else if (status == "COMPLETED" && onActiveRide) {
-          Serial.println("\n🌐 🌐 🌐 WEB APP COMPLETED RIDE! 🌐 🌐 🌐");
-          Serial.println("   Resetting system...");
-          
-          onActiveRide = false;
-          pickupConfirmed = false;
-          currentRideID = "";
-          pickupLocation = "";
-          destinationLocation = "";
-          
-          displayStatus("AVAILABLE", "Waiting for rides");
-          Serial.println("✓ System reset - Ready for new rides\n");
-        }
-      }
-    } else {
-      Serial.println("⚠️ Could not find ride " + currentRideID + " in response");
+  const HeartbeatReply& beat = reply.heartbeat;
+  if (beat.hasRide) {
+    if (beat.ride.rideID == currentRideID) {
+      applyRideUpdate(beat.ride);
+    } else if (!onActiveRide && rickshawID == beat.ride.rickshawID && strcmp(beat.ride.status, "ACCEPTED") == 0) {
+      // Assigned to us from the web app without being on our screen
+      currentRideID = beat.ride.rideID;
+      pickupLocation = "";
+      destinationLocation = "";
+      applyRideUpdate(beat.ride);
     }
+  }
+  if (onActiveRide) return;
+  
+  if (beat.hasOffers) {
+    pendingVersion = beat.version;
+    offersLat = currentLat;
+    offersLng = currentLng;
+    offers.update(beat.offers, millis());
+    showOffers();
   } else {
-    Serial.println("✗ HTTP Error checking status: " + String(httpCode));
+    offers.refresh(millis());  // Unchanged: every queued offer still stands
   }
-  
-  http.end();
 }
 
-// ===== Check for Ride Requests (using /ride/pending) =====
-void checkForRideRequests() {
-  if (WiFi.status() != WL_CONNECTED) return;
-  if (millis() - lastRideCheck < 3000) return;
-  lastRideCheck = millis();
-  
-  HTTPClient http;
-  String url = String(BACKEND_URL) + "/ride/pending?rickshawID=" + rickshawID;
-  
-  http.begin(url);
-  int httpCode = http.GET();
+// Top offers on the OLED; the best one is the ride ACCEPT takes
+void showOffers() {
+  if (onActiveRide || network.busy(REQ_ACCEPT)) return;  // Don't swap the offer mid-accept
+  
+  const Offer* best = offers.top();
+  if (best == nullptr) {
+    if (currentRideID != 0) {
+      currentRideID = 0;
+      pickupLocation = "";
+      destinationLocation = "";
+      displayStatus("AVAILABLE", "Waiting for rides");
+    }
+    return;
+  }
   
-  if (httpCode == 200) {
-    String response = http.getString();
-    
-    if (response.indexOf("\"rides\":[") > 0 && response.indexOf("\"rideID\":") > 0) {
-      int rideIDStart = response.indexOf("\"rideID\":") + 9;
-      int rideIDEnd = response.indexOf(",", rideIDStart);
-      String rideID = response.substring(rideIDStart, rideIDEnd);
-      
-      if (rideID != currentRideID || currentRideID == "") {
-        
-        int pickupStart = response.indexOf("\"pickupBlock\":\"") + 15;
-        int pickupEnd = response.indexOf("\"", pickupStart);
-        String pickup = response.substring(pickupStart, pickupEnd);
-        
-        int destStart = response.indexOf("\"destination\":\"") + 15;
-        int destEnd = response.indexOf("\"", destStart);
-        String dest = response.substring(destStart, destEnd);
-        
-        int distStart = response.indexOf("\"distance\":\"") + 12;
-        int distEnd = response.indexOf("\"", distStart);
-        String distance = response.substring(distStart, distEnd);
-        
-        display.clearDisplay();
-        display.setTextSize(1);
-        display.setCursor(0, 0);
-        display.println("NEW RIDE REQUEST");
-        display.println("================");
-        
-        display.print("Pickup: ");
-        display.println(pickup);
-        
-        display.print("Dest: ");
-        display.println(dest);
-        
-        display.print("Distance: ");
-        display.print(distance);
-        display.println(" km");
-        
-        display.print("Est.Points: ");
-        float dist = distance.toFloat();
-        if (dist <= 2) display.println("10");
-        else if (dist <= 5) display.println("8-10");
-        else display.println("5-10");
-        
-        display.println("");
-        display.println("ACCEPT or REJECT?");
-        display.display();
-        
-        Serial.println("\n📢 📢 📢 NEW RIDE REQUEST! 📢 📢 📢");
-        Serial.println("Ride ID: " + rideID);
-        Serial.println("Pickup: " + pickup + " → Destination: " + dest);
-        Serial.println("Distance: " + distance + " km");
-        Serial.println("=====================================");
-        Serial.println("Type 'ACCEPT' to accept this ride");
-        Serial.println("Type 'REJECT' to reject this ride");
-        Serial.println("=====================================\n");
-        
-        currentRideID = rideID;
-        pickupLocation = pickup;
-        destinationLocation = dest;
+  const PendingRide& offer = best->ride;
+  float km = best->distanceM / 1000.0f;
+  String distance = String(km, 2);
+  String eta = best->road ? " ~" + String(etaMinutes(best->distanceM)) + "m" : "";
+  
+  const char* estPoints = "5-10";
+  if (km <= 2) estPoints = "10";
+  else if (km <= 5) estPoints = "8-10";
+  
+  if (!messageHeld) {
+    display.screen(SCREEN_OFFER);
+    display.text(0, 0, 0, "RIDE OFFERS " + String(offers.count()) + "/" + String(offers.pendingTotal()));
+    display.text(1, 0, 8, "================");
+    for (uint8_t i = 0; i < OFFER_ROWS; i++) {
+      String row = "";
+      if (i < offers.count()) {
+        const Offer& entry = offers[i];
+        row = String(i + 1) + " " + String(entry.ride.pickupBlock).substring(0, 7) + ">" +
+              String(entry.ride.destination).substring(0, 7) + " " + String(entry.distanceM / 1000.0f, 1);
       }
+      display.text(2 + i, 0, 16 + i * 8, row);
     }
+    display.text(5, 0, 40, "1: " + distance + " km" + eta);
+    display.text(6, 0, 48, "Est.Points: " + String(estPoints));
+    display.text(7, 0, 56, "ACCEPT or REJECT?");
+    display.presentNow();
   }
   
-  http.end();
+  if (offer.rideID != currentRideID) {
+    Serial.println("\n📢 📢 📢 NEW RIDE REQUEST! 📢 📢 📢");
+    Serial.println("Ride ID: " + String(offer.rideID) + " (best of " + String(offers.count()) + ")");
+    Serial.println("Pickup: " + String(offer.pickupBlock) + " → Destination: " + offer.destination);
+    Serial.println("Distance: " + distance + " km" + (best->road ? " by road" : ""));
+    Serial.println("=====================================");
+    Serial.println("Type 'ACCEPT' to accept this ride");
+    Serial.println("Type 'REJECT' to see the next one");
+    Serial.println("=====================================\n");
+    
+    currentRideID = offer.rideID;
+    pickupLocation = offer.pickupBlock;
+    destinationLocation = offer.destination;
+  }
 }
 
 // ===== Accept Ride =====
 void acceptRide() {
-  if (currentRideID == "" || onActiveRide) {
+  if (currentRideID == 0 || onActiveRide) {
     Serial.println("✗ No ride to accept or already on ride");
     return;
   }
@@ -444,53 +547,58 @@ void acceptRide() {
     return;
   }
   
-  HTTPClient http;
-  String url = String(BACKEND_URL) + "/ride/accept";
-  
-  http.begin(url);
-  http.addHeader("Content-Type", "application/json");
-  http.setTimeout(5000);  // 5 second timeout
+  if (network.busy(REQ_ACCEPT)) {
+    Serial.println("⏳ Already accepting ride " + String(currentRideID));
+    return;
+  }
   
-  String payload = "{";
-  payload += "\"rideID\":" + currentRideID + ",";
-  payload += "\"rickshawID\":\"" + rickshawID + "\"";
-  payload += "}";
+  char payload[96];
+  codec::encodeAccept(payload, sizeof(payload), currentRideID, rickshawID.c_str());
   
-  Serial.println("\n🤝 Accepting ride " + currentRideID + "...");
-  int httpCode = http.POST(payload);
+  Serial.println("\n🤝 Accepting ride " + String(currentRideID) + "...");
+  if (!network.post(REQ_ACCEPT, "/ride/accept", payload, DECODE_ACCEPT, currentRideID, 5000)) {
+    Serial.println("✗ Network busy - try again");
+    return;
+  }
+  displayMessage("Accepting...", "Please wait");
+}
+
+void onAcceptReply(const NetEvent& reply) {
+  // Web app acceptance (push/poll) may have got there first
+  if (reply.rideID != currentRideID || onActiveRide) return;
   
-  if (httpCode == 200) {
-    String response = http.getString();
+  if (reply.httpCode == 200) {
+    bool accepted = reply.decoded && reply.accepted;
     
-    if (response.indexOf("\"success\":true") > 0) {
+    if (accepted) {
       Serial.println("✓ ✓ ✓ RIDE ACCEPTED! ✓ ✓ ✓");
       Serial.println("Pickup: " + pickupLocation);
       Serial.println("Destination: " + destinationLocation);
       
       onActiveRide = true;
       pickupConfirmed = false;
+      offers.clear();
       
       Serial.println("\n🚗 Setting navigation to PICKUP location...");
-      setTargetLocation(pickupLocation);
+      setTargetLocation(pickupLocation.c_str());
+      saveRideState();
       
       displayMessage("Ride Accepted!", "Going to pickup");
-      delay(2000);
+      holdMessage(2000);
       
       Serial.println("\n🗺️ NAVIGATION STARTED - Moving to pickup...\n");
     } else {
       Serial.println("✗ Ride already taken by another puller");
-      displayMessage("Ride Taken", "Try another");
-      delay(2000);
-      currentRideID = "";
-      displayStatus("AVAILABLE", "Waiting for rides");
+      displayMessage("Ride Taken", offers.count() > 1 ? "Next offer" : "Try another");
+      holdMessage(2000);
+      offers.remove(currentRideID);
+      showOffers();  // Next candidate is already queued; drawn after the hold
     }
   } else {
-    Serial.println("✗ HTTP Error: " + String(httpCode));
+    Serial.println("✗ HTTP Error: " + String(reply.httpCode));
     displayMessage("Accept Failed", "Try again");
-    delay(2000);
+    holdMessage(2000);
   }
-  
-  http.end();
 }
 
 // ===== Confirm Pickup =====
@@ -500,48 +608,45 @@ void confirmPickup() {
     return;
   }
   
-  double distanceToPickup = calculateDistance(
-    currentLat, currentLng,
-    targetLocation.lat, targetLocation.lng
-  );
+  double distanceToPickup = geo::distance(navTarget, currentLat, currentLng);
   
   Serial.println("\n📍 Checking pickup location...");
   Serial.println("   Distance to pickup: " + String(distanceToPickup, 1) + " m");
   
-  if (distanceToPickup > 100) {
+  if (!geo::within(navTarget, currentLat, currentLng, 100)) {
     Serial.println("✗ TOO FAR from pickup location!");
     Serial.println("   You must be within 100m to confirm pickup");
     Serial.println("   Current distance: " + String(distanceToPickup, 1) + " m");
     displayMessage("Too Far!", "Distance: " + String((int)distanceToPickup) + "m");
-    delay(2000);
+    holdMessage(2000);
     return;
   }
   
-  HTTPClient http;
-  String url = String(BACKEND_URL) + "/ride/pickup";
-  
-  http.begin(url);
-  http.addHeader("Content-Type", "application/json");
+  if (network.busy(REQ_PICKUP)) return;  // Already confirming
   
-  String payload = "{\"rideID\":" + currentRideID + "}";
+  char payload[48];
+  codec::encodePickup(payload, sizeof(payload), currentRideID);
   
-  int httpCode = http.POST(payload);
+  network.post(REQ_PICKUP, "/ride/pickup", payload, DECODE_NONE, currentRideID);
+}
+
+void onPickupReply(const NetEvent& reply) {
+  if (reply.rideID != currentRideID || !onActiveRide || pickupConfirmed) return;
   
-  if (httpCode == 200) {
+  if (reply.httpCode == 200) {
     Serial.println("✓ ✓ ✓ PICKUP CONFIRMED! ✓ ✓ ✓");
     pickupConfirmed = true;
     
     Serial.println("\n🗺️ Setting navigation to DESTINATION...");
     Serial.println("   Destination: " + destinationLocation);
-    setTargetLocation(destinationLocation);
+    setTargetLocation(destinationLocation.c_str());
+    saveRideState();
     
     displayMessage("Pickup OK", "Going to dest");
-    delay(2000);
+    holdMessage(2000);
     
     Serial.println("\n🚗 DRIVING TO DESTINATION...\n");
   }
-  
-  http.end();
 }
 
 // ===== Complete Ride =====
@@ -551,58 +656,40 @@ void completeRide() {
     return;
   }
   
-  double distanceToTarget = calculateDistance(
-    currentLat, currentLng,
-    targetLocation.lat, targetLocation.lng
-  );
+  double distanceToTarget = geo::distance(navTarget, currentLat, currentLng);
   
   Serial.println("Distance to destination: " + String(distanceToTarget, 2) + " m");
   
-  if (distanceToTarget > 100) {
+  if (!geo::within(navTarget, currentLat, currentLng, 100)) {
     Serial.println("✗ TOO FAR from destination!");
     Serial.println("  Current: " + String(currentLat, 6) + ", " + String(currentLng, 6));
     Serial.println("  Target: " + String(targetLocation.lat, 6) + ", " + String(targetLocation.lng, 6));
     Serial.println("  Must be within 100m for auto-approval");
     displayMessage("Too Far!", "Distance: " + String((int)distanceToTarget) + "m");
-    delay(3000);
+    holdMessage(3000);
     return;
   }
   
-  HTTPClient http;
-  String url = String(BACKEND_URL) + "/ride/complete";
+  if (network.busy(REQ_COMPLETE)) return;  // Already completing
   
-  http.begin(url);
-  http.addHeader("Content-Type", "application/json");
-  
-  String payload = "{";
-  payload += "\"rideID\":" + currentRideID + ",";
-  payload += "\"dropLat\":" + String(currentLat, 6) + ",";
-  payload += "\"dropLng\":" + String(currentLng, 6);
-  payload += "}";
+  char payload[96];
+  codec::encodeComplete(payload, sizeof(payload), currentRideID, currentLat, currentLng);
   
   Serial.println("Completing ride with drop location:");
   Serial.println("  Lat: " + String(currentLat, 6));
   Serial.println("  Lng: " + String(currentLng, 6));
   
-  int httpCode = http.POST(payload);
-  
-  if (httpCode == 200) {
-    String response = http.getString();
-    Serial.println("Response: " + response);
-    
-    int pointsStart = response.indexOf("\"points\":") + 9;
-    int pointsEnd = response.indexOf(",", pointsStart);
-    if (pointsEnd == -1) pointsEnd = response.indexOf("}", pointsStart);
-    int pointsEarned = response.substring(pointsStart, pointsEnd).toInt();
-    
-    int distStart = response.indexOf("\"distance\":\"") + 12;
-    int distEnd = response.indexOf("\"", distStart);
-    String dropDist = response.substring(distStart, distEnd);
-    
-    String status = "COMPLETED";
-    if (response.indexOf("\"PENDING_REVIEW\"") > 0) {
-      status = "PENDING_REVIEW";
-    }
+  network.post(REQ_COMPLETE, "/ride/complete", payload, DECODE_COMPLETE, currentRideID);
+}
+
+void onCompleteReply(const NetEvent& reply) {
+  if (reply.rideID != currentRideID || !onActiveRide) return;  // Web app completed it first
+  
+  if (reply.decoded) {
+    const CompleteResult& result = reply.complete;
+    int pointsEarned = result.points;
+    String dropDist = String(result.distanceM, 2);
+    String status = strcmp(result.status, "PENDING_REVIEW") == 0 ? "PENDING_REVIEW" : "COMPLETED";
     
     totalPoints += pointsEarned;
     
@@ -612,52 +699,56 @@ void completeRide() {
     Serial.println("  Drop Distance: " + dropDist + " m");
     Serial.println("  Total Points: " + String(totalPoints));
     
-    display.clearDisplay();
-    display.setTextSize(1);
-    display.setCursor(0, 0);
-    display.println("RIDE COMPLETED!");
-    display.println("================");
-    
-    if (pointsEarned == 10) {
-      display.println("PERFECT DROP!");
-    } else if (pointsEarned >= 8) {
-      display.println("GREAT DROP!");
-    } else if (pointsEarned >= 5) {
-      display.println("GOOD DROP");
-    } else if (pointsEarned > 0) {
-      display.println("COMPLETED");
-    } else {
-      display.println("UNDER REVIEW");
-    }
+    const char* verdict = "UNDER REVIEW";
+    if (pointsEarned == 10) verdict = "PERFECT DROP!";
+    else if (pointsEarned >= 8) verdict = "GREAT DROP!";
+    else if (pointsEarned >= 5) verdict = "GOOD DROP";
+    else if (pointsEarned > 0) verdict = "COMPLETED";
     
-    display.println("");
-    display.print("Points: +");
-    display.println(pointsEarned);
-    display.print("Distance: ");
-    display.print(dropDist);
-    display.println(" m");
-    display.print("Total: ");
-    display.println(totalPoints);
-    display.println("");
-    display.println("Resetting...");
-    display.display();
-    
-    delay(5000);
+    display.screen(SCREEN_COMPLETE);
+    display.text(0, 0, 0, "RIDE COMPLETED!");
+    display.text(1, 0, 8, "================");
+    display.text(2, 0, 16, verdict);
+    display.text(3, 0, 32, "Points: +" + String(pointsEarned));
+    display.text(4, 0, 40, "Distance: " + dropDist + " m");
+    display.text(5, 0, 48, "Total: " + String(totalPoints));
+    display.text(6, 0, 56, "Resetting...");
+    display.presentNow();
+    holdMessage(5000);  // The summary stays up; new offers queue behind it
     
     Serial.println("\n🔄 Resetting system for next ride...");
-    onActiveRide = false;
-    pickupConfirmed = false;
-    currentRideID = "";
-    pickupLocation = "";
-    destinationLocation = "";
-    
-    displayStatus("AVAILABLE", "Waiting for rides");
+    resetRide();
     Serial.println("✓ System reset - Ready for new rides\n");
   } else {
-    Serial.println("✗ HTTP Error: " + String(httpCode));
+    Serial.println("✗ HTTP Error: " + String(reply.httpCode));
   }
-  
-  http.end();
+}
+
+// ===== GPS Position =====
+void updatePositionFromGps() {
+  gps.poll();
+  
+  GpsFix fix;
+  if (!gps.fresh() || !gps.read(fix)) return;
+  currentLat = fix.lat;
+  currentLng = fix.lng;
+}
+
+// Progress toward the target from the GPS position, without moving
+geo::MoveStep trackGpsMovement() {
+  geo::MoveStep move;
+  move.distanceM = geo::distance(navTarget, currentLat, currentLng);
+  move.bearing = router.guidance().bearing;
+  move.arrived = move.distanceM <= geo::ARRIVAL_RADIUS_M;
+  return move;
+}
+
+// One simulated second along the road route: steer for the next waypoint,
+// arrived only at the end of the last leg
+geo::MoveStep driveRoute() {
+  geo::MoveStep move = geo::step(currentLat, currentLng, router.waypoint(), speedKmPerHour);
+  if (!router.onFinalLeg()) move.arrived = false;
+  return move;
 }
 
 // ===== GPS Movement Simulation =====
@@ -665,26 +756,21 @@ void simulateMovement() {
   if (!onActiveRide) return;
   
   if (millis() - lastMoveTime > 1000) {
-    double distance = calculateDistance(currentLat, currentLng, targetLocation.lat, targetLocation.lng);
+    router.update(currentLat, currentLng);  // Advance to the next waypoint first
+    geo::MoveStep move = gps.fresh() ? trackGpsMovement() : driveRoute();
+    double distance = move.distanceM;
     
-    if (distance > 5) {
-      double bearing = calculateBearing(currentLat, currentLng, targetLocation.lat, targetLocation.lng);
-      
-      double metersPerSecond = (speedKmPerHour * 1000.0) / 3600.0;
-      
-      double latDegreesPerMeter = 1.0 / 111320.0;
-      double lngDegreesPerMeter = 1.0 / (111320.0 * cos(currentLat * PI / 180.0));
-      
-      double bearingRad = bearing * PI / 180.0;
-      double deltaLatMeters = metersPerSecond * cos(bearingRad);
-      double deltaLngMeters = metersPerSecond * sin(bearingRad);
-      
-      currentLat += deltaLatMeters * latDegreesPerMeter;
-      currentLng += deltaLngMeters * lngDegreesPerMeter;
+    if (!move.arrived) {
+      const route::Guidance& guide = router.update(currentLat, currentLng);
       
       Serial.println("📍 Moving to " + targetLocation.name);
-      Serial.println("   Distance: " + String(distance, 1) + " m");
-      Serial.println("   Bearing: " + String((int)bearing) + "°");
+      Serial.println("   Distance: " + String(guide.remainingM, 1) + " m" +
+                     (guide.routed ? " by road" : ""));
+      Serial.println("   Bearing: " + String((int)guide.bearing) + "°");
+      if (guide.turn != route::TURN_NONE) {
+        Serial.println("   Next: " + String(route::turnLabel(guide.turn)) + " in " +
+                       String((int)guide.turnInM) + " m");
+      }
       Serial.println("   Current: " + String(currentLat, 6) + ", " + String(currentLng, 6));
     } else {
       Serial.println("\n✓ ✓ ✓ ARRIVED at " + targetLocation.name + " ✓ ✓ ✓");
@@ -701,198 +787,307 @@ void simulateMovement() {
       }
     }
     
+    rideStore.touch(currentLat, currentLng);  // RTC only; resume starts from here
     lastMoveTime = millis();
   }
 }
 
 // ===== Navigation Display =====
+const char* compassPoint(double bearing) {
+  if (bearing >= 337.5 || bearing < 22.5) return "N";
+  else if (bearing >= 22.5 && bearing < 67.5) return "NE";
+  else if (bearing >= 67.5 && bearing < 112.5) return "E";
+  else if (bearing >= 112.5 && bearing < 157.5) return "SE";
+  else if (bearing >= 157.5 && bearing < 202.5) return "S";
+  else if (bearing >= 202.5 && bearing < 247.5) return "SW";
+  else if (bearing >= 247.5 && bearing < 292.5) return "W";
+  return "NW";
+}
+
+// Only fields whose text changed are redrawn; present() caps the frame rate.
+// Distance, heading and the turn line follow the road route; the points
+// hint stays on the straight-line distance, which is what the backend scores.
+void drawNavigationScreen(bool toDestination, double lat, double lng, const String& targetName,
+                          double distance, const route::Guidance& guide, int rideSeconds) {
+  int minutes = rideSeconds / 60;
+  int seconds = rideSeconds % 60;
+  
+  String time = "Time: ";
+  if (minutes > 0) time += String(minutes) + "m ";
+  time += String(seconds) + "s";
+  
+  const char* estPoints = "Review";
+  if (distance <= 50) estPoints = "8-10";
+  else if (distance <= 100) estPoints = "5-8";
+  
+  String next = route::turnLabel(guide.turn);
+  if (guide.turn != route::TURN_NONE) next += " " + String((int)guide.turnInM) + "m";
+  
+  display.screen(SCREEN_NAVIGATION);
+  display.text(0, 0, 0, toDestination ? ">> TO DESTINATION <<" : ">> TO PICKUP <<");
+  display.text(1, 0, 8, "================");
+  display.text(2, 0, 16, "Now: " + String(lat, 4) + "," + String(lng, 4));
+  display.text(3, 0, 24, "To: " + targetName);
+  display.text(4, 0, 32, "Dist: " + String((int)guide.remainingM) + "m " + compassPoint(guide.bearing));
+  display.text(5, 0, 40, time);
+  display.text(6, 0, 48, "Est.Points: " + String(estPoints));
+  display.text(7, 0, 56, next + " ETA " + String(etaMinutes(guide.remainingM)) + "m");
+  display.present();
+}
+
+// BENCH: CUET -> Pahartoli at the simulated speed, one frame per 100 ms
+void drawBenchNavigationFrame(uint16_t frame) {
+  const blocks::Block& from = blocks::BUILTIN[0];
+  const blocks::Block& to = blocks::BUILTIN[1];
+  double total = calculateDistance(from.lat, from.lng, to.lat, to.lng);
+  double travelled = speedKmPerHour / 3.6 * frame * 0.1;
+  if (travelled > total) travelled = total;
+  double t = travelled / total;
+  
+  double lat = from.lat + (to.lat - from.lat) * t;
+  double lng = from.lng + (to.lng - from.lng) * t;
+  route::Guidance guide = {false, (float)(total - travelled),
+                           (float)calculateBearing(lat, lng, to.lat, to.lng), route::TURN_NONE, 0};
+  drawNavigationScreen(false, lat, lng, to.id, total - travelled, guide, frame / 10);
+}
+
 void updateNavigationDisplay() {
-  if (!onActiveRide) return;
+  if (!onActiveRide || messageHeld) return;
   
-  double distance = calculateDistance(currentLat, currentLng, targetLocation.lat, targetLocation.lng);
-  double bearing = calculateBearing(currentLat, currentLng, targetLocation.lat, targetLocation.lng);
+  float distance = geo::distance(navTarget, currentLat, currentLng);
+  const route::Guidance& guide = router.update(currentLat, currentLng);
   
   static unsigned long rideStartTime = 0;
   if (rideStartTime == 0) rideStartTime = millis();
   int rideDuration = (millis() - rideStartTime) / 1000;
-  int minutes = rideDuration / 60;
-  int seconds = rideDuration % 60;
-  
-  display.clearDisplay();
-  display.setTextSize(1);
-  display.setCursor(0, 0);
-  
-  if (!pickupConfirmed) {
-    display.println(">> TO PICKUP <<");
-  } else {
-    display.println(">> TO DESTINATION <<");
-  }
-  
-  display.println("================");
-  
-  display.print("Now: ");
-  display.print(currentLat, 4);
-  display.print(",");
-  display.println(currentLng, 4);
-  
-  display.print("To: ");
-  display.println(targetLocation.name);
-  
-  display.print("Dist: ");
-  display.print((int)distance);
-  display.print("m ");
-  
-  if (bearing >= 337.5 || bearing < 22.5) display.print("N");
-  else if (bearing >= 22.5 && bearing < 67.5) display.print("NE");
-  else if (bearing >= 67.5 && bearing < 112.5) display.print("E");
-  else if (bearing >= 112.5 && bearing < 157.5) display.print("SE");
-  else if (bearing >= 157.5 && bearing < 202.5) display.print("S");
-  else if (bearing >= 202.5 && bearing < 247.5) display.print("SW");
-  else if (bearing >= 247.5 && bearing < 292.5) display.print("W");
-  else display.print("NW");
-  
-  display.println();
-  
-  display.print("Time: ");
-  if (minutes > 0) {
-    display.print(minutes);
-    display.print("m ");
-  }
-  display.print(seconds);
-  display.println("s");
-  
-  display.print("Est.Points: ");
-  if (distance <= 50) display.println("8-10");
-  else if (distance <= 100) display.println("5-8");
-  else display.println("Review");
   
-  display.display();
+  drawNavigationScreen(pickupConfirmed, currentLat, currentLng, targetLocation.name,
+                       distance, guide, rideDuration);
   
   if (distance <= 5) {
     rideStartTime = 0;
   }
 }
 
-// ===== Send Location Update =====
-void sendLocationUpdate() {
-  if (WiFi.status() != WL_CONNECTED) return;
-  if (millis() - lastLocationUpdate < 5000) return;
-  lastLocationUpdate = millis();
-  
-  HTTPClient http;
-  String url = String(BACKEND_URL) + "/rickshaw/location";
+// Whatever the ride state calls for, after a held message
+void redrawScreen() {
+  if (onActiveRide) updateNavigationDisplay();
+  else if (offers.top() != nullptr) showOffers();
+  else displayStatus("AVAILABLE", "Waiting for rides");
+}
+
+// ===== Trajectory Upload =====
+void updateTrajectory() {
+  if (millis() - lastTrackSample >= TRACK_SAMPLE_INTERVAL) {
+    lastTrackSample = millis();
+    track.setFastPath(onActiveRide && !pickupConfirmed);  // Rider is watching us approach
+    track.sample(currentLat, currentLng, millis());
+  }
   
-  http.begin(url);
-  http.addHeader("Content-Type", "application/json");
+  if (WiFi.status() != WL_CONNECTED) return;
+  if (!track.flushDue(millis())) return;  // Also false while a batch is in flight
   
-  String payload = "{";
-  payload += "\"rickshawID\":\"" + rickshawID + "\",";
-  payload += "\"lat\":" + String(currentLat, 6) + ",";
-  payload += "\"lng\":" + String(currentLng, 6);
-  payload += "}";
+  char payload[sizeof(NetCommand::body)];
+  if (track.encodeBatch(payload, sizeof(payload), rickshawID.c_str(), millis()) == 0) return;
   
-  http.POST(payload);
-  http.end();
+  if (!network.post(REQ_TRACK, "/rickshaw/track", payload, DECODE_NONE)) {
+    track.acknowledge(false);  // Queue full; retry with the next batch
+  }
+}
+
+void onTrackReply(const NetEvent& reply) {
+  track.acknowledge(reply.httpCode == 200);
+}
+
+// ===== Network replies =====
+// Every backend result lands here on the loop task, so ride state is only
+// ever changed from this core
+void handleNetReply(const NetEvent& reply) {
+  boot.backendReply(reply.httpCode);
+  switch (reply.tag) {
+    case REQ_REGISTER:   onRegisterReply(reply); break;
+    case REQ_HEARTBEAT:  onHeartbeatReply(reply); break;
+    case REQ_ACCEPT:     onAcceptReply(reply); break;
+    case REQ_PICKUP:     onPickupReply(reply); break;
+    case REQ_COMPLETE:   onCompleteReply(reply); break;
+    case REQ_TRACK:      onTrackReply(reply); break;
+    case REQ_LOCATIONS:  onLocationsReply(reply); break;
+    case NetTask::PUSH_RIDE: onPushedRide(reply.ride); break;
+    default: break;
+  }
 }
 
 // ===== Serial Commands =====
-void handleSerialCommand() {
-  String command = Serial.readStringUntil('\n');
-  command.trim();
-  command.toUpperCase();
-  
-  if (command == "ACCEPT") {
-    acceptRide();
-  }
-  else if (command == "REJECT") {
-    Serial.println("Ride rejected");
-    currentRideID = "";
-    displayStatus("AVAILABLE", "Waiting for rides");
-  }
-  else if (command == "PICKUP") {
-    confirmPickup();
-  }
-  else if (command == "COMPLETE") {
-    completeRide();
-  }
-  else if (command == "STATUS") {
-    Serial.println("\n===== RICKSHAW STATUS =====");
-    Serial.println("ID: " + rickshawID);
-    Serial.println("Location: " + String(currentLat, 6) + ", " + String(currentLng, 6));
-    Serial.println("Points: " + String(totalPoints));
-    Serial.println("On Ride: " + String(onActiveRide ? "YES" : "NO"));
-    if (onActiveRide) {
-      Serial.println("Pickup Confirmed: " + String(pickupConfirmed ? "YES" : "NO"));
-      Serial.println("Target: " + targetLocation.name);
-      double dist = calculateDistance(currentLat, currentLng, targetLocation.lat, targetLocation.lng);
-      Serial.println("Distance to target: " + String(dist, 1) + " m");
-    }
-    Serial.println("===========================\n");
+extern CommandConsole console;  // Defined after the command table
+
+void runCodecBenchmarkJob() {
+  runCodecBenchmark();
+}
+
+void cmdAccept(const char* args) {
+  acceptRide();
+}
+
+void cmdReject(const char* args) {
+  if (currentRideID == 0 || onActiveRide || network.busy(REQ_ACCEPT)) {
+    Serial.println("✗ No ride to reject");
+    return;
+  }
+  Serial.println("Ride " + String(currentRideID) + " rejected");
+  offers.reject(currentRideID);
+  showOffers();  // Next candidate, no network round trip
+}
+
+void cmdPickup(const char* args) {
+  confirmPickup();
+}
+
+void cmdComplete(const char* args) {
+  completeRide();
+}
+
+void cmdStatus(const char* args) {
+  Serial.println("\n===== RICKSHAW STATUS =====");
+  Serial.println("ID: " + rickshawID);
+  Serial.println("Location: " + String(currentLat, 6) + ", " + String(currentLng, 6));
+  Serial.println("Points: " + String(totalPoints));
+  gps.printStats();
+  track.printStats();
+  rideStore.printStats();
+  offers.printStats();
+  router.printStats();
+  network.printStats();
+  display.printStats();
+  console.printStats();
+  Serial.println("On Ride: " + String(onActiveRide ? "YES" : "NO"));
+  if (onActiveRide) {
+    Serial.println("Pickup Confirmed: " + String(pickupConfirmed ? "YES" : "NO"));
+    Serial.println("Target: " + targetLocation.name);
+    double dist = calculateDistance(currentLat, currentLng, targetLocation.lat, targetLocation.lng);
+    Serial.println("Distance to target: " + String(dist, 1) + " m");
   }
-  else if (command == "HELP") {
-    Serial.println("\n===== COMMANDS =====");
-    Serial.println("ACCEPT   - Accept pending ride");
-    Serial.println("REJECT   - Reject pending ride");
-    Serial.println("PICKUP   - Confirm pickup");
-    Serial.println("COMPLETE - Complete ride");
-    Serial.println("STATUS   - Show status");
-    Serial.println("====================\n");
+  Serial.println("===========================\n");
+}
+
+void cmdOffers(const char* args) {
+  Serial.println("\n===== OFFERS =====");
+  for (uint8_t i = 0; i < offers.count(); i++) {
+    const Offer& offer = offers[i];
+    Serial.println(String(i + 1) + ". Ride " + String(offer.ride.rideID) + " " + offer.ride.pickupBlock +
+                   " → " + offer.ride.destination + ", " + String(offer.distanceM, 0) + " m" +
+                   (offer.road ? " by road" : "") + ", waiting " +
+                   String((millis() - offer.requestedMs) / 1000) + " s, rank " + String(offer.rankM));
   }
+  offers.printStats();
+  Serial.println("==================\n");
+}
+
+void cmdNet(const char* args) {
+  network.printStats();
+  boot.printStats();
+  Serial.println("Push: " + String(network.pushConnected() ? "connected" : "down") +
+                 ", WiFi RSSI " + String(WiFi.RSSI()) + " dBm");
+}
+
+void cmdConfig(const char* args) {
+  boot.command(args);
 }
 
+void cmdHeap(const char* args) {
+  Serial.println("Heap: " + String(ESP.getFreeHeap()) + " B free, " + String(ESP.getMinFreeHeap()) +
+                 " B lowest, " + String(ESP.getMaxAllocHeap()) + " B largest block");
+}
+
+void cmdBench(const char* args) {
+  runDisplayBenchmark(display, drawBenchNavigationFrame);
+  runGeoBenchmark();
+  runRouteBenchmark();
+  network.call(runCodecBenchmarkJob);  // Codec belongs to the network task
+  if (!onActiveRide) displayStatus("AVAILABLE", "Waiting for rides");
+}
+
+const ConsoleCommand COMMANDS[] = {
+  {"ACCEPT",   cmdAccept,   "Accept the top offer"},
+  {"REJECT",   cmdReject,   "Reject the top offer, show the next"},
+  {"PICKUP",   cmdPickup,   "Confirm pickup"},
+  {"COMPLETE", cmdComplete, "Complete ride"},
+  {"STATUS",   cmdStatus,   "Show status"},
+  {"OFFERS",   cmdOffers,   "List queued offers with their rank"},
+  {"NET",      cmdNet,      "Network task and push stats"},
+  {"HEAP",     cmdHeap,     "Free heap and largest block"},
+  {"CONFIG",   cmdConfig,   "WiFi/backend/ID in NVS; CONFIG URL <url> etc."},
+  {"BENCH",    cmdBench,    "JSON codec, display, geo + route benchmarks"}
+};
+
+CommandConsole console(COMMANDS, sizeof(COMMANDS) / sizeof(COMMANDS[0]));
+
 // ===== Setup =====
 void setup() {
+  console.begin(Serial);  // Sizes the RX ring, so before Serial.begin()
   Serial.begin(115200);
-  delay(1000);
   Serial.println("\n\n=== AERAS RICKSHAW SIDE ===");
   
+  // Join first: the radio associates while the rest of setup() runs
+  boot.begin(WIFI_SSID, WIFI_PASSWORD, BACKEND_URL, RICKSHAW_ID);
+  rickshawID = boot.deviceId();
+  
   if(!display.begin(SSD1306_SWITCHCAPVCC, 0x3C)) {
     Serial.println(F("✗ OLED failed"));
     for(;;);
   }
+  boot.mark("display");
   
   displayMessage("Rickshaw System", "Initializing...");
+  gps.begin(Serial2, GPS_RX_PIN, GPS_TX_PIN);
+  resumeRide();
+  boot.mark("resume");
   
-  WiFi.begin(WIFI_SSID, WIFI_PASSWORD);
-  Serial.print("Connecting WiFi");
-  int attempts = 0;
-  while (WiFi.status() != WL_CONNECTED && attempts < 40) {
-    delay(500);
-    Serial.print(".");
-    attempts++;
-  }
+  // Requests queued before the link is up fail fast and are retried
+  network.begin(boot.backendUrl(), "/events?rickshawID=" + rickshawID, EVENTS_URL);
+  boot.mark("setup");
   
-  if (WiFi.status() == WL_CONNECTED) {
-    Serial.println("\n✓ WiFi Connected");
-    Serial.println("IP: " + WiFi.localIP().toString());
-    displayMessage("WiFi Connected", rickshawID);
-    delay(2000);
-  } else {
-    Serial.println("\n✗ WiFi Failed");
-    displayMessage("WiFi Error", "Offline Mode");
-    delay(2000);
-  }
-  
-  registerRickshaw();
-  
-  displayStatus("AVAILABLE", "Waiting for rides");
+  if (!onActiveRide) displayStatus("AVAILABLE", "Connecting WiFi...");
   Serial.println("\n=== Rickshaw " + rickshawID + " Ready ===");
   Serial.println("Location: " + String(currentLat, 6) + ", " + String(currentLng, 6));
   Serial.println("\n✅ WEB APP SYNC ENABLED");
   Serial.println("Hardware will detect web app acceptances automatically");
-  Serial.println("\nCommands: ACCEPT, REJECT, PICKUP, COMPLETE, STATUS\n");
+  Serial.println("\nCommands: ACCEPT, REJECT, PICKUP, COMPLETE, STATUS (HELP for all)\n");
+}
+
+// Registration and the block overlay wait for the link instead of setup()
+void watchLink() {
+  switch (boot.poll()) {
+    case LINK_UP:
+      loadBlockOverlay();
+      registerRickshaw();
+      heartbeatDue = true;
+      if (!onActiveRide && currentRideID == 0) displayStatus("AVAILABLE", "Waiting for rides");
+      break;
+    case LINK_FAILED:
+      if (!onActiveRide && currentRideID == 0) displayStatus("AVAILABLE", "Offline - retrying");
+      break;
+    default:
+      break;
+  }
 }
 
 // ===== Main Loop =====
 void loop() {
-  sendLocationUpdate();
+  scheduler.run();
+  watchLink();
+  
+  NetEvent reply;
+  while (network.poll(reply)) {
+    handleNetReply(reply);
+  }
+  
+  updatePositionFromGps();
+  updateTrajectory();
+  sendHeartbeat();  // Offers, web app accept/pickup/complete - one round trip
   
   if (!onActiveRide) {
-    checkForRideRequests();
-    checkWebAppAcceptance();  // Check if web app accepted
+    if (offers.expire(millis())) showOffers();  // Stale offers drop, waiting ones move up
   } else {
-    // Active ride - check for status updates from web app
-    checkRideStatusUpdates();  // Check for pickup/complete from web app
     simulateMovement();
     updateNavigationDisplay();
     
@@ -901,16 +1096,14 @@ void loop() {
     if (millis() - lastDebug > 5000) {
       lastDebug = millis();
       Serial.println("\n--- STATUS ---");
-      Serial.println("Ride ID: " + currentRideID);
+      Serial.println("Ride ID: " + String(currentRideID));
       Serial.println("Pickup Confirmed: " + String(pickupConfirmed ? "YES" : "NO"));
       Serial.println("Target: " + targetLocation.name);
       Serial.println("Checking web app status...");
     }
   }
   
-  if (Serial.available()) {
-    handleSerialCommand();
-  }
+  console.poll();  // Never waits on a partial line
   
   delay(100);
 }
\ No newline at end of file
@@ -0,0 +1,132 @@
+/*
+ * AERAS Blocks - perfect-hash lookup and overlay table
+ * Every built-in block must resolve through its own hash slot to the row
+ * the backend seeds, unknown IDs must miss, and a /locations overlay must
+ * shadow moved blocks, add new ones and leave unchanged built-ins alone.
+ * The overlay is global state, so the built-in tests run first.
+ *
+ *   pio test -e native -f test_blocks
+ */
+
+#include <AerasBlocks.h>
+#include <string.h>
+#include <unity.h>
+
+struct Row {
+  const char* id;
+  double lat;
+  double lng;
+};
+
+// The backend's `locations` seed (aeras-backend/server.js)
+static const Row SEEDED[] = {
+  {"CUET_CAMPUS", 22.4633, 91.9714},
+  {"PAHARTOLI",   22.4725, 91.9845},
+  {"NOAPARA",     22.4580, 91.9920},
+  {"RAOJAN",      22.4520, 91.9650}
+};
+static const size_t SEEDED_COUNT = sizeof(SEEDED) / sizeof(SEEDED[0]);
+
+void setUp() {}
+void tearDown() {}
+
+static void test_every_builtin_has_its_own_slot() {
+  TEST_ASSERT_TRUE(blocks::BUILTIN_HASH.found);
+  size_t used = 0;
+  for (size_t s = 0; s < sizeof(blocks::BUILTIN_HASH.slot); s++) {
+    if (blocks::BUILTIN_HASH.slot[s] != blocks::EMPTY_SLOT) used++;
+  }
+  TEST_ASSERT_EQUAL_UINT32(SEEDED_COUNT, used);
+}
+
+static void test_builtins_match_the_seed() {
+  for (size_t i = 0; i < SEEDED_COUNT; i++) {
+    const blocks::Block* block = blocks::find(SEEDED[i].id);
+    TEST_ASSERT_NOT_NULL(block);
+    TEST_ASSERT_EQUAL_STRING(SEEDED[i].id, block->id);
+    TEST_ASSERT_TRUE(block->lat == SEEDED[i].lat && block->lng == SEEDED[i].lng);
+  }
+  TEST_ASSERT_EQUAL_UINT32(AERAS_BLOCKS_VERSION, blocks::version());
+  TEST_ASSERT_EQUAL_STRING("\"locations-1\"", blocks::etag());
+}
+
+static void test_unknown_ids_miss() {
+  // Whatever slot these hash to, the strcmp must turn them away
+  const char* misses[] = {"", "CUET", "CUET_CAMPUS_", "cuet_campus", "PAHARTOLI ", "UNKNOWN", "RAOJA"};
+  for (const char* id : misses) TEST_ASSERT_TRUE(blocks::find(id) == nullptr);
+  TEST_ASSERT_TRUE(blocks::find(nullptr) == nullptr);
+}
+
+static void test_overlay_shadows_and_adds() {
+  blocks::beginStaging();
+  blocks::stage("CUET_CAMPUS", 22.4633, 91.9714);     // Unchanged: no overlay slot
+  blocks::stage("PAHARTOLI", 22.4730, 91.9850);       // Moved
+  blocks::stage("GEC_CIRCLE", 22.3590, 91.8210);      // New
+  blocks::stage("A_BLOCK_ID_FAR_TOO_LONG_TO_STORE", 1, 1);
+  TEST_ASSERT_TRUE(blocks::commitStaged(2));
+
+  TEST_ASSERT_EQUAL_UINT32(2, blocks::overlayCount());
+  TEST_ASSERT_EQUAL_UINT32(2, blocks::version());
+  TEST_ASSERT_EQUAL_STRING("\"locations-2\"", blocks::etag());
+
+  const blocks::Block* moved = blocks::find("PAHARTOLI");
+  TEST_ASSERT_TRUE(moved != nullptr && moved->lat == 22.4730 && moved->lng == 91.9850);
+  TEST_ASSERT_TRUE(blocks::findBuiltin("PAHARTOLI")->lat == 22.4725);
+  const blocks::Block* added = blocks::find("GEC_CIRCLE");
+  TEST_ASSERT_TRUE(added != nullptr && added->lat == 22.3590);
+  TEST_ASSERT_TRUE(blocks::find("CUET_CAMPUS") == blocks::findBuiltin("CUET_CAMPUS"));
+  TEST_ASSERT_TRUE(blocks::find("A_BLOCK_ID_FAR_TOO_LONG_TO_STORE") == nullptr);
+
+  // Not newer than the active table: the staged rows are not swapped in
+  blocks::beginStaging();
+  blocks::stage("NEW_BLOCK", 22.0, 91.0);
+  TEST_ASSERT_FALSE(blocks::commitStaged(2));
+  TEST_ASSERT_TRUE(blocks::find("NEW_BLOCK") == nullptr);
+  TEST_ASSERT_TRUE(blocks::find("GEC_CIRCLE") != nullptr);
+}
+
+static void test_overlay_capacity() {
+  char ids[blocks::OVERLAY_CAPACITY + 8][12];
+  blocks::beginStaging();
+  for (uint8_t i = 0; i < blocks::OVERLAY_CAPACITY + 8; i++) {
+    snprintf(ids[i], sizeof(ids[i]), "BLOCK_%02u", i);
+    blocks::stage(ids[i], 22.0 + i * 0.001, 91.0);
+  }
+  // A repeated row updates its slot instead of taking another
+  blocks::stage("BLOCK_00", 23.0, 92.0);
+  TEST_ASSERT_TRUE(blocks::commitStaged(3));
+  TEST_ASSERT_EQUAL_UINT32(blocks::OVERLAY_CAPACITY, blocks::overlayCount());
+
+  for (uint8_t i = 0; i < blocks::OVERLAY_CAPACITY; i++) {
+    const blocks::Block* block = blocks::find(ids[i]);
+    TEST_ASSERT_TRUE(block != nullptr && strcmp(block->id, ids[i]) == 0);
+  }
+  TEST_ASSERT_TRUE(blocks::find("BLOCK_00")->lat == 23.0);
+  TEST_ASSERT_TRUE(blocks::find(ids[blocks::OVERLAY_CAPACITY]) == nullptr);
+  // The previous overlay is gone, the built-ins are not
+  TEST_ASSERT_TRUE(blocks::find("GEC_CIRCLE") == nullptr);
+  TEST_ASSERT_TRUE(blocks::find("PAHARTOLI")->lat == 22.4725);
+}
+
+static int runTests() {
+  UNITY_BEGIN();
+  RUN_TEST(test_every_builtin_has_its_own_slot);
+  RUN_TEST(test_builtins_match_the_seed);
+  RUN_TEST(test_unknown_ids_miss);
+  RUN_TEST(test_overlay_shadows_and_adds);
+  RUN_TEST(test_overlay_capacity);
+  return UNITY_END();
+}
+
+#ifdef AERAS_NATIVE
+int main() {
+  return runTests();
+}
+#else
+void setup() {
+  delay(2000);  // Let the test runner attach to the serial port
+  runTests();
+}
+
+void loop() {}
+#endif
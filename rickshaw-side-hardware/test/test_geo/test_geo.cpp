@@ -0,0 +1,154 @@
+/*
+ * AERAS Geo - fast paths against the double haversine
+ * A table of fixes around CUET_CAMPUS (every 22 degrees of heading, from
+ * 10 m to 25 km) checks the error bounds AerasGeo.h promises: 5 cm on the
+ * float projection at 2 km, about a decimetre across a ride, under 1 m out
+ * to FAST_RANGE_M and the haversine itself beyond. The fixed-point within() must agree with
+ * the haversine on either side of the 50 m and 100 m points radii.
+ *
+ *   pio test -e native -f test_geo
+ */
+
+#include <AerasGeo.h>
+#include <unity.h>
+
+static const double CENTER_LAT = 22.4633;   // CUET_CAMPUS
+static const double CENTER_LNG = 91.9714;
+static const double SPHERE_M_PER_DEG = geo::EARTH_RADIUS_M * PI / 180.0;
+
+static const double RANGES_M[] = {10, 50, 100, 500, 1000, 2000, 3000, 5000, 7900, 8100, 15000, 25000};
+
+static geo::Target center;
+
+// A point rangeM from the center on an initial heading, on the sphere
+static void offset(double rangeM, double headingDeg, double& lat, double& lng) {
+  double d = rangeM / geo::EARTH_RADIUS_M;
+  double h = headingDeg * DEG_TO_RAD;
+  double lat1 = CENTER_LAT * DEG_TO_RAD;
+  double lat2 = asin(sin(lat1) * cos(d) + cos(lat1) * sin(d) * cos(h));
+  double lng2 = CENTER_LNG * DEG_TO_RAD + atan2(sin(h) * sin(d) * cos(lat1), cos(d) - sin(lat1) * sin(lat2));
+  lat = lat2 * RAD_TO_DEG;
+  lng = lng2 * RAD_TO_DEG;
+}
+
+static double angleError(double a, double b) {
+  double diff = fabs(a - b);
+  return diff > 180.0 ? 360.0 - diff : diff;
+}
+
+void setUp() {
+  center = geo::makeTarget(CENTER_LAT, CENTER_LNG);
+}
+void tearDown() {}
+
+static void test_haversine_reference() {
+  // One degree along a meridian is exactly the sphere's degree
+  TEST_ASSERT_TRUE(fabs(geo::distance(22.0, 91.0, 23.0, 91.0) - SPHERE_M_PER_DEG) <= 1e-6);
+  TEST_ASSERT_TRUE(geo::distance(CENTER_LAT, CENTER_LNG, CENTER_LAT, CENTER_LNG) <= 1e-9);
+  TEST_ASSERT_TRUE(geo::bearing(22.0, 91.0, 23.0, 91.0) <= 1e-6);
+  TEST_ASSERT_TRUE(fabs(geo::bearing(23.0, 91.0, 22.0, 91.0) - 180.0) <= 1e-6);
+  TEST_ASSERT_TRUE(fabs(geo::bearing(0.0, 91.0, 0.0, 92.0) - 90.0) <= 0.01);
+
+  // The offset() generator lands where it says
+  double lat, lng;
+  for (double rangeM : RANGES_M) {
+    offset(rangeM, 37.0, lat, lng);
+    TEST_ASSERT_TRUE(fabs(geo::distance(CENTER_LAT, CENTER_LNG, lat, lng) - rangeM) <= 1e-6 * rangeM);
+  }
+}
+
+static void test_fast_distance_error_bound() {
+  double worstNear = 0, worstRide = 0, worstFast = 0, worstFar = 0;
+  for (double rangeM : RANGES_M) {
+    for (int heading = 0; heading < 360; heading += 22) {
+      double lat, lng;
+      offset(rangeM, heading + 0.5, lat, lng);
+      double exact = geo::distance(lat, lng, CENTER_LAT, CENTER_LNG);
+      double error = fabs(geo::distance(center, lat, lng) - exact);
+      if (rangeM <= 2000) worstNear = fmax(worstNear, error);
+      if (rangeM <= 3000) worstRide = fmax(worstRide, error);
+      else if (rangeM <= geo::FAST_RANGE_M) worstFast = fmax(worstFast, error);
+      else worstFar = fmax(worstFar, error);
+    }
+  }
+  TEST_ASSERT_LESS_THAN_FLOAT(0.05, worstNear);
+  TEST_ASSERT_LESS_THAN_FLOAT(0.15, worstRide);
+  TEST_ASSERT_LESS_THAN_FLOAT(1.0, worstFast);    // The FAST_RANGE_M promise
+  TEST_ASSERT_LESS_THAN_FLOAT(0.01, worstFar);    // Haversine beyond it (float rounding only)
+}
+
+static void test_fast_bearing_error_bound() {
+  double worst = 0;
+  for (double rangeM : RANGES_M) {
+    if (rangeM < 50 || rangeM > 3000) continue;
+    for (int heading = 0; heading < 360; heading += 22) {
+      double lat, lng;
+      offset(rangeM, heading + 0.5, lat, lng);
+      worst = fmax(worst, angleError(geo::bearing(center, lat, lng), geo::bearing(lat, lng, CENTER_LAT, CENTER_LNG)));
+    }
+  }
+  TEST_ASSERT_LESS_THAN_FLOAT(0.1, worst);
+}
+
+static void test_within_agrees_at_points_radii() {
+  // 20 cm either side of each radius, all round: integer math must call
+  // every one the same way as the haversine
+  const uint32_t radii[] = {5, 50, 100};
+  uint32_t wrong = 0;
+  for (uint32_t radiusM : radii) {
+    for (int heading = 0; heading < 360; heading += 10) {
+      double inLat, inLng, outLat, outLng;
+      offset(radiusM - 0.2, heading, inLat, inLng);
+      offset(radiusM + 0.2, heading, outLat, outLng);
+      if (!geo::within(center, inLat, inLng, radiusM)) wrong++;
+      if (geo::within(center, outLat, outLng, radiusM)) wrong++;
+      if (!geo::within(center, geo::toE6(inLat), geo::toE6(inLng), radiusM)) wrong++;
+    }
+  }
+  TEST_ASSERT_EQUAL_UINT32(0, wrong);
+  TEST_ASSERT_TRUE(geo::within(center, CENTER_LAT, CENTER_LNG, 0));
+}
+
+static void test_step_arrives_like_the_double_path() {
+  // 500 m out at 18 km/h (5 m/s): ~99 one-second steps on either path
+  double fastLat, fastLng, exactLat, exactLng;
+  offset(500, 200, fastLat, fastLng);
+  exactLat = fastLat;
+  exactLng = fastLng;
+
+  int fastSteps = 0, exactSteps = 0;
+  while (!geo::step(fastLat, fastLng, center, 18.0).arrived && fastSteps < 200) fastSteps++;
+  while (!geo::step(exactLat, exactLng, CENTER_LAT, CENTER_LNG, 18.0).arrived && exactSteps < 200) exactSteps++;
+
+  TEST_ASSERT_TRUE(fastSteps >= 98 && fastSteps <= 100);
+  TEST_ASSERT_TRUE(abs(fastSteps - exactSteps) <= 1);
+  TEST_ASSERT_TRUE(geo::distance(fastLat, fastLng, CENTER_LAT, CENTER_LNG) <= geo::ARRIVAL_RADIUS_M);
+
+  // Already there: the position is left alone
+  double lat = CENTER_LAT, lng = CENTER_LNG;
+  TEST_ASSERT_TRUE(geo::step(lat, lng, center, 18.0).arrived);
+  TEST_ASSERT_TRUE(lat == CENTER_LAT && lng == CENTER_LNG);
+}
+
+static int runTests() {
+  UNITY_BEGIN();
+  RUN_TEST(test_haversine_reference);
+  RUN_TEST(test_fast_distance_error_bound);
+  RUN_TEST(test_fast_bearing_error_bound);
+  RUN_TEST(test_within_agrees_at_points_radii);
+  RUN_TEST(test_step_arrives_like_the_double_path);
+  return UNITY_END();
+}
+
+#ifdef AERAS_NATIVE
+int main() {
+  return runTests();
+}
+#else
+void setup() {
+  delay(2000);  // Let the test runner attach to the serial port
+  runTests();
+}
+
+void loop() {}
+#endif
@@ -0,0 +1,112 @@
+/*
+ * AERAS GPS - NMEA trace replay through GpsReceiver
+ * traces/cuet-to-pahartoli.nmea is played into Serial2 on the simulated
+ * clock (hal::replayNmea) and every filtered fix is collected. The trace
+ * starts at CUET_CAMPUS, waits 30 s, rides to PAHARTOLI with one ~20 m
+ * multipath burst on the way and waits 40 s there.
+ *
+ *   pio test -e native -f test_gps_replay
+ */
+
+#include <AerasGeo.h>
+#include <AerasGps.h>
+#include <Hal.h>
+#include <algorithm>
+#include <string>
+#include <unity.h>
+#include <vector>
+
+static const size_t EPOCHS = 475;          // GGA + RMC pairs in the trace
+static const double CUET_LAT = 22.4633, CUET_LNG = 91.9714;
+static const double PAHARTOLI_LAT = 22.4725, PAHARTOLI_LNG = 91.9845;
+static const size_t DROP_WAIT = 30;        // Last fixes of the 40 s wait, after settling
+
+static GpsReceiver gps;
+static std::vector<GpsFix> fixes;
+static bool replayed = false;
+
+static std::string tracePath() {
+  std::string here = __FILE__;
+  return here.substr(0, here.find_last_of("/\\") + 1) + "../../traces/cuet-to-pahartoli.nmea";
+}
+
+// At 10x the trace is 48 s of simulated time; poll() every 5 ms as loop() would
+static bool replayTrace() {
+  hal::setManualClock(true);
+  hal::setSerialEcho(false);
+  gps.begin(Serial2, 16, 17);
+  if (!hal::replayNmea(tracePath(), 10.0)) return false;
+
+  uint32_t seen = 0;
+  for (uint32_t step = 0; step < 12000; step++) {
+    gps.poll();
+    GpsFix fix;
+    if (gps.read(fix) && fix.count != seen) {
+      seen = fix.count;
+      fixes.push_back(fix);
+    }
+    hal::skipUs(5000);
+  }
+  return true;
+}
+
+static double filteredError(const GpsFix& fix, double lat, double lng) {
+  return geo::distance(fix.lat, fix.lng, lat, lng);
+}
+
+static double rawError(const GpsFix& fix, double lat, double lng) {
+  return geo::distance(fix.rawLat, fix.rawLng, lat, lng);
+}
+
+void setUp() {
+  if (!replayed) TEST_FAIL_MESSAGE("cannot read traces/cuet-to-pahartoli.nmea");
+}
+void tearDown() {}
+
+static void test_one_fix_per_epoch() {
+  // RMC repeats GGA's timestamp and must not run the filter twice
+  TEST_ASSERT_EQUAL_UINT32(EPOCHS, fixes.size());
+  TEST_ASSERT_EQUAL_UINT32(EPOCHS, fixes.back().count);
+}
+
+static void test_route_ends() {
+  TEST_ASSERT_TRUE(rawError(fixes.front(), CUET_LAT, CUET_LNG) < 15);
+  TEST_ASSERT_TRUE(filteredError(fixes.back(), PAHARTOLI_LAT, PAHARTOLI_LNG) < 10);
+}
+
+// The wait's drift is correlated and survives any filter; the fix-to-fix
+// jitter on top of it is what smoothing removes
+static void test_drop_wait_steadier_than_raw() {
+  double rawSteps = 0, filteredSteps = 0, worstFiltered = 0;
+  for (size_t i = fixes.size() - DROP_WAIT; i < fixes.size(); i++) {
+    rawSteps += geo::distance(fixes[i - 1].rawLat, fixes[i - 1].rawLng, fixes[i].rawLat, fixes[i].rawLng);
+    filteredSteps += geo::distance(fixes[i - 1].lat, fixes[i - 1].lng, fixes[i].lat, fixes[i].lng);
+    worstFiltered = std::max(worstFiltered, filteredError(fixes[i], PAHARTOLI_LAT, PAHARTOLI_LNG));
+  }
+  TEST_ASSERT_TRUE(filteredSteps < rawSteps * 0.6);
+  TEST_ASSERT_TRUE(worstFiltered < 12);
+  TEST_ASSERT_TRUE(fixes.back().speedMps < 1.0f);
+}
+
+static void test_multipath_burst_damped() {
+  // ~4 m/s of riding between fixes; the burst jumps the raw track ~20 m
+  double rawJump = 0, filteredJump = 0;
+  for (size_t i = 1; i < fixes.size(); i++) {
+    rawJump = std::max(rawJump, geo::distance(fixes[i - 1].rawLat, fixes[i - 1].rawLng,
+                                              fixes[i].rawLat, fixes[i].rawLng));
+    filteredJump = std::max(filteredJump, geo::distance(fixes[i - 1].lat, fixes[i - 1].lng,
+                                                        fixes[i].lat, fixes[i].lng));
+  }
+  TEST_ASSERT_TRUE(rawJump > 15);
+  TEST_ASSERT_TRUE(filteredJump < rawJump * 0.6);
+}
+
+int main() {
+  replayed = replayTrace();
+  UNITY_BEGIN();
+  RUN_TEST(test_one_fix_per_epoch);
+  RUN_TEST(test_route_ends);
+  RUN_TEST(test_drop_wait_steadier_than_raw);
+  RUN_TEST(test_multipath_burst_damped);
+  return UNITY_END();
+}
@@ -0,0 +1,187 @@
+/*
+ * AERAS Offers - ranking and expiry of the pending-offer buffer
+ * Table-driven /ride/pending replies check the rank (pickup distance less
+ * the capped waiting credit, ties to the older ride), the road distance
+ * taking over from the backend's straight line, whole versus truncated
+ * replies, the rejected-ride memory and TTL expiry with re-ranking.
+ *
+ *   pio test -e native -f test_offers
+ */
+
+#include <AerasOffers.h>
+#include <string.h>
+#include <unity.h>
+
+struct Row {
+  long rideID;
+  float distanceKm;
+  uint16_t ageS;
+};
+
+static const uint32_t NOW_MS = 1000000;
+
+static PendingList reply(const Row* rows, uint8_t count, uint16_t total = 0) {
+  PendingList list;
+  memset(&list, 0, sizeof(list));
+  list.count = count;
+  list.total = total > 0 ? total : count;
+  for (uint8_t i = 0; i < count; i++) {
+    list.rides[i].rideID = rows[i].rideID;
+    list.rides[i].distanceKm = rows[i].distanceKm;
+    list.rides[i].ageS = rows[i].ageS;
+    strcpy(list.rides[i].pickupBlock, "CUET_CAMPUS");
+  }
+  return list;
+}
+
+static long idAt(const OfferQueue& queue, uint8_t index) {
+  return queue[index].ride.rideID;
+}
+
+// Ride 2 routes 300 m by road; ride 3 is off the graph
+static float roadDistance(const PendingRide& ride) {
+  if (ride.rideID == 2) return 300;
+  return -1;
+}
+
+void setUp() {}
+void tearDown() {}
+
+static void test_rank_is_distance_less_waiting_credit() {
+  const Row rows[] = {
+    {1, 0.800f, 0},      // 800
+    {2, 1.000f, 120},    // 1000 - 500 = 500
+    {3, 3.000f, 1800},   // 3000 - 1500 (capped, not 7500)
+    {4, 1.600f, 0},      // 1600
+    {5, 0.800f, 0},      // Ties 1 on rank: the older ID goes first
+  };
+  OfferQueue queue;
+  TEST_ASSERT_TRUE(queue.update(reply(rows, 5), NOW_MS));
+  TEST_ASSERT_EQUAL_UINT32(5, queue.count());
+
+  const long expected[] = {2, 1, 5, 3, 4};
+  const int32_t rankM[] = {500, 800, 800, 1500, 1600};
+  for (uint8_t i = 0; i < 5; i++) {
+    TEST_ASSERT_EQUAL_INT32(expected[i], idAt(queue, i));
+    TEST_ASSERT_EQUAL_INT32(rankM[i], queue[i].rankM);
+    TEST_ASSERT_FALSE(queue[i].road);
+  }
+  TEST_ASSERT_EQUAL_UINT32(NOW_MS - 120000, queue[0].requestedMs);
+}
+
+static void test_road_distance_replaces_straight_line() {
+  const Row rows[] = {{1, 0.500f, 0}, {2, 0.400f, 0}, {3, 0.450f, 0}};
+  OfferQueue queue(roadDistance);
+  queue.update(reply(rows, 3), NOW_MS);
+  TEST_ASSERT_EQUAL_INT32(2, idAt(queue, 0));
+  TEST_ASSERT_TRUE(queue[0].road && queue[0].distanceM == 300);
+  TEST_ASSERT_EQUAL_INT32(3, idAt(queue, 1));
+  TEST_ASSERT_FALSE(queue[1].road);
+  TEST_ASSERT_EQUAL_INT32(450, queue[1].rankM);
+}
+
+static void test_whole_and_truncated_replies() {
+  const Row first[] = {{1, 0.2f, 0}, {2, 0.4f, 0}, {3, 0.6f, 0}};
+  OfferQueue queue;
+  queue.update(reply(first, 3), NOW_MS);
+
+  // Truncated (9 pending, 1 listed): rides past the cutoff may still stand
+  const Row truncated[] = {{4, 0.1f, 0}};
+  TEST_ASSERT_TRUE(queue.update(reply(truncated, 1, 9), NOW_MS + 1000));
+  TEST_ASSERT_EQUAL_UINT32(4, queue.count());
+  TEST_ASSERT_EQUAL_UINT32(9, queue.pendingTotal());
+
+  // Whole: anything it does not list was taken elsewhere
+  const Row whole[] = {{3, 0.6f, 0}, {4, 0.1f, 0}};
+  TEST_ASSERT_FALSE(queue.update(reply(whole, 2), NOW_MS + 2000));
+  TEST_ASSERT_EQUAL_UINT32(2, queue.count());
+  TEST_ASSERT_EQUAL_INT32(4, idAt(queue, 0));
+  TEST_ASSERT_EQUAL_INT32(3, idAt(queue, 1));
+
+  // A re-listed ride keeps its original request time
+  TEST_ASSERT_EQUAL_UINT32(NOW_MS, queue[1].requestedMs);
+  TEST_ASSERT_EQUAL_UINT32(NOW_MS + 2000, queue[1].seenMs);
+
+  // Full from truncated replies: a newcomer replaces the worst only if better
+  OfferQueue full;
+  const Row six[] = {{10, 1.0f, 0}, {11, 1.1f, 0}, {12, 1.2f, 0}, {13, 1.3f, 0}, {14, 1.4f, 0}, {15, 1.5f, 0}};
+  full.update(reply(six, 6, 20), NOW_MS);
+  const Row worse[] = {{16, 2.0f, 0}};
+  full.update(reply(worse, 1, 20), NOW_MS);
+  TEST_ASSERT_EQUAL_INT32(15, idAt(full, OfferQueue::CAPACITY - 1));
+  const Row better[] = {{17, 0.5f, 0}};
+  TEST_ASSERT_TRUE(full.update(reply(better, 1, 20), NOW_MS));
+  TEST_ASSERT_EQUAL_INT32(17, idAt(full, 0));
+  TEST_ASSERT_EQUAL_INT32(14, idAt(full, OfferQueue::CAPACITY - 1));
+}
+
+static void test_rejected_rides_stay_out() {
+  const Row rows[] = {{1, 0.2f, 0}, {2, 0.4f, 0}};
+  OfferQueue queue;
+  queue.update(reply(rows, 2), NOW_MS);
+  queue.reject(1);
+  TEST_ASSERT_EQUAL_INT32(2, idAt(queue, 0));
+  queue.update(reply(rows, 2), NOW_MS + 1000);
+  TEST_ASSERT_EQUAL_UINT32(1, queue.count());
+
+  // Remembered for REJECTED_MEMORY rejects, then it may come back
+  for (long id = 100; id < 100 + OfferQueue::REJECTED_MEMORY - 1; id++) queue.reject(id);
+  queue.update(reply(rows, 2), NOW_MS + 2000);
+  TEST_ASSERT_EQUAL_UINT32(1, queue.count());
+  queue.reject(200);
+  queue.update(reply(rows, 2), NOW_MS + 3000);
+  TEST_ASSERT_EQUAL_UINT32(2, queue.count());
+
+  TEST_ASSERT_TRUE(queue.remove(2));
+  TEST_ASSERT_FALSE(queue.remove(2));
+}
+
+static void test_ttl_expiry_and_reranking() {
+  // 2 has waited 5 min 12 s: 48 s more reaches the credit cap
+  const Row rows[] = {{1, 0.700f, 0}, {2, 2.250f, 312}};
+  OfferQueue queue;
+  queue.update(reply(rows, 2), NOW_MS);
+  TEST_ASSERT_EQUAL_INT32(1, idAt(queue, 0));
+  TEST_ASSERT_EQUAL_INT32(2250 - 1300, queue[1].rankM);
+
+  // Only 2 is listed again (truncated reply); 1 lives out its TTL_MS
+  const Row later[] = {{2, 2.250f, 322}};
+  queue.update(reply(later, 1, 5), NOW_MS + 10000);
+  TEST_ASSERT_FALSE(queue.expire(NOW_MS + OfferQueue::TTL_MS));
+  TEST_ASSERT_EQUAL_UINT32(2, queue.count());
+
+  // Past it: 1 goes, 2 takes the top
+  TEST_ASSERT_TRUE(queue.expire(NOW_MS + OfferQueue::TTL_MS + 1));
+  TEST_ASSERT_EQUAL_UINT32(1, queue.count());
+  TEST_ASSERT_EQUAL_INT32(2, idAt(queue, 0));
+
+  // A heartbeat refresh keeps it alive; expire() re-ranks it at the cap
+  queue.refresh(NOW_MS + 45000);
+  TEST_ASSERT_FALSE(queue.expire(NOW_MS + 48000));
+  TEST_ASSERT_EQUAL_INT32(2250 - OfferQueue::MAX_WAIT_CREDIT_M, queue[0].rankM);
+  TEST_ASSERT_TRUE(queue.expire(NOW_MS + 45000 + OfferQueue::TTL_MS + 1));
+  TEST_ASSERT_TRUE(queue.top() == nullptr);
+}
+
+static int runTests() {
+  UNITY_BEGIN();
+  RUN_TEST(test_rank_is_distance_less_waiting_credit);
+  RUN_TEST(test_road_distance_replaces_straight_line);
+  RUN_TEST(test_whole_and_truncated_replies);
+  RUN_TEST(test_rejected_rides_stay_out);
+  RUN_TEST(test_ttl_expiry_and_reranking);
+  return UNITY_END();
+}
+
+#ifdef AERAS_NATIVE
+int main() {
+  return runTests();
+}
+#else
+void setup() {
+  delay(2000);  // Let the test runner attach to the serial port
+  runTests();
+}
+
+void loop() {}
+#endif
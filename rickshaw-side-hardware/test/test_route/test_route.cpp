@@ -0,0 +1,200 @@
+/*
+ * AERAS Route - A* paths on the built-in road graph
+ * Routes between pseudo-random node pairs must be real paths (start to
+ * goal, every hop an edge, costs the edge sums) and exactly as short as a
+ * plain Dijkstra over the same CSR arrays finds - the heuristic may never
+ * cost optimality. RouteNavigator must then report the route, count it
+ * down as the rickshaw drives it, and fall back to the straight line off
+ * the graph.
+ *
+ *   pio test -e native -f test_route
+ */
+
+#include <AerasRoute.h>
+#include <functional>
+#include <queue>
+#include <unity.h>
+#include <vector>
+
+using route::BUILTIN_GRAPH;
+
+static const uint32_t PAIRS = 60;
+
+static uint16_t path[route::MAX_PATH];
+static uint32_t pathCost[route::MAX_PATH];
+
+// Reference: Dijkstra, no heuristic, no open-set limit
+static uint32_t shortest(uint16_t start, uint16_t goal) {
+  const route::RoadGraph& g = BUILTIN_GRAPH;
+  std::vector<uint32_t> best(g.nodeCount, UINT32_MAX);
+  typedef std::pair<uint32_t, uint16_t> Entry;
+  std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> open;
+  best[start] = 0;
+  open.push({0, start});
+  while (!open.empty()) {
+    Entry top = open.top();
+    open.pop();
+    if (top.second == goal) return top.first;
+    if (top.first > best[top.second]) continue;
+    for (uint16_t e = g.firstEdge[top.second]; e < g.firstEdge[top.second + 1]; e++) {
+      uint32_t reached = top.first + g.edgeLengthM[e];
+      if (reached < best[g.edgeTo[e]]) {
+        best[g.edgeTo[e]] = reached;
+        open.push({reached, g.edgeTo[e]});
+      }
+    }
+  }
+  return UINT32_MAX;
+}
+
+static bool hasEdge(uint16_t from, uint16_t to, uint32_t lengthM) {
+  for (uint16_t e = BUILTIN_GRAPH.firstEdge[from]; e < BUILTIN_GRAPH.firstEdge[from + 1]; e++) {
+    if (BUILTIN_GRAPH.edgeTo[e] == to && BUILTIN_GRAPH.edgeLengthM[e] == lengthM) return true;
+  }
+  return false;
+}
+
+static geo::Target nodeTarget(uint16_t node) {
+  return geo::makeTarget(route::nodeLat(BUILTIN_GRAPH, node), route::nodeLng(BUILTIN_GRAPH, node));
+}
+
+void setUp() {
+  route::resetStats();
+}
+void tearDown() {}
+
+static void test_graph_is_well_formed() {
+  const route::RoadGraph& g = BUILTIN_GRAPH;
+  TEST_ASSERT_TRUE(g.nodeCount > 0 && g.nodeCount <= route::MAX_NODES);
+  TEST_ASSERT_EQUAL_UINT32(0, g.firstEdge[0]);
+  TEST_ASSERT_EQUAL_UINT32(g.edgeCount, g.firstEdge[g.nodeCount]);
+
+  // Edge lengths are rounded up: never shorter than the straight line
+  uint32_t bad = 0;
+  for (uint16_t n = 0; n < g.nodeCount; n++) {
+    if (g.firstEdge[n] > g.firstEdge[n + 1]) bad++;
+    geo::Target from = nodeTarget(n);
+    for (uint16_t e = g.firstEdge[n]; e < g.firstEdge[n + 1]; e++) {
+      if (g.edgeTo[e] >= g.nodeCount) bad++;
+      else if (g.edgeLengthM[e] + 0.5f < geo::distance(from, route::nodeLat(g, g.edgeTo[e]), route::nodeLng(g, g.edgeTo[e]))) bad++;
+    }
+  }
+  TEST_ASSERT_EQUAL_UINT32(0, bad);
+}
+
+static void test_astar_paths_are_optimal() {
+  const route::RoadGraph& g = BUILTIN_GRAPH;
+  uint32_t seed = 12345, broken = 0, suboptimal = 0, unrouted = 0;
+  for (uint32_t i = 0; i < PAIRS; i++) {
+    seed = seed * 1103515245u + 12345u;
+    uint16_t start = (seed >> 8) % g.nodeCount;
+    seed = seed * 1103515245u + 12345u;
+    uint16_t goal = (seed >> 8) % g.nodeCount;
+
+    uint16_t length = route::findPath(g, start, goal, path, pathCost, route::MAX_PATH);
+    uint32_t optimum = shortest(start, goal);
+    if (length == 0) {
+      if (optimum != UINT32_MAX) unrouted++;
+      continue;
+    }
+
+    if (path[0] != start || path[length - 1] != goal || pathCost[0] != 0) broken++;
+    for (uint16_t k = 1; k < length; k++) {
+      if (!hasEdge(path[k - 1], path[k], pathCost[k] - pathCost[k - 1])) broken++;
+    }
+    if (pathCost[length - 1] != optimum) suboptimal++;
+  }
+  TEST_ASSERT_EQUAL_UINT32(0, broken);
+  TEST_ASSERT_EQUAL_UINT32(0, suboptimal);
+  TEST_ASSERT_EQUAL_UINT32(0, unrouted);
+  TEST_ASSERT_EQUAL_UINT32(0, route::stats().overflows);
+  TEST_ASSERT_EQUAL_UINT32(PAIRS, route::stats().searches);
+}
+
+static void test_trivial_and_bad_requests() {
+  TEST_ASSERT_EQUAL_UINT32(1, route::findPath(BUILTIN_GRAPH, 7, 7, path, pathCost, route::MAX_PATH));
+  TEST_ASSERT_TRUE(path[0] == 7 && pathCost[0] == 0);
+  TEST_ASSERT_EQUAL_UINT32(0, route::findPath(BUILTIN_GRAPH, 0, BUILTIN_GRAPH.nodeCount, path, pathCost, route::MAX_PATH));
+
+  // A route longer than the caller's buffer is refused, not truncated
+  uint16_t corner = route::nearestNode(BUILTIN_GRAPH, 22.4346, 91.9446);
+  uint16_t across = route::nearestNode(BUILTIN_GRAPH, 22.4950, 92.0100);
+  TEST_ASSERT_TRUE(route::findPath(BUILTIN_GRAPH, corner, across, path, pathCost, route::MAX_PATH) > 8);
+  TEST_ASSERT_EQUAL_UINT32(0, route::findPath(BUILTIN_GRAPH, corner, across, path, pathCost, 8));
+}
+
+static void test_navigator_follows_the_route() {
+  // CUET_CAMPUS to PAHARTOLI, both on the graph
+  const double fromLat = 22.4633, fromLng = 91.9714;
+  geo::Target to = geo::makeTarget(22.4725, 91.9845);
+  route::RouteNavigator navigator;
+
+  float quoted = navigator.distance(fromLat, fromLng, to.lat, to.lng);
+  TEST_ASSERT_TRUE(quoted >= geo::distance(to, fromLat, fromLng));
+  TEST_ASSERT_TRUE(navigator.setTarget(fromLat, fromLng, to));
+
+  const route::Guidance& start = navigator.guidance();
+  TEST_ASSERT_TRUE(start.routed);
+  TEST_ASSERT_TRUE(start.remainingM <= quoted + route::RouteNavigator::WAYPOINT_RADIUS_M * 2);
+  TEST_ASSERT_TRUE(start.remainingM >= geo::distance(to, fromLat, fromLng));
+  TEST_ASSERT_TRUE(start.turnInM <= start.remainingM);
+
+  // Drive the route node by node: the count-down never goes up, and no
+  // position on it is far enough off to reroute
+  uint16_t snapped = route::nearestNode(BUILTIN_GRAPH, fromLat, fromLng);
+  uint16_t goal = route::nearestNode(BUILTIN_GRAPH, to.lat, to.lng);
+  uint16_t length = route::findPath(BUILTIN_GRAPH, snapped, goal, path, pathCost, route::MAX_PATH);
+  TEST_ASSERT_TRUE(length > 1);
+
+  float last = start.remainingM;
+  uint32_t rises = 0;
+  for (uint16_t k = 0; k < length; k++) {
+    const route::Guidance& now = navigator.update(route::nodeLat(BUILTIN_GRAPH, path[k]),
+                                                  route::nodeLng(BUILTIN_GRAPH, path[k]));
+    if (now.remainingM > last + 1.0f) rises++;
+    last = now.remainingM;
+  }
+  TEST_ASSERT_EQUAL_UINT32(0, rises);
+  TEST_ASSERT_EQUAL_UINT32(0, navigator.reroutes());
+  TEST_ASSERT_TRUE(navigator.onFinalLeg());
+  TEST_ASSERT_TRUE(last <= route::RouteNavigator::MAX_SNAP_M);
+}
+
+static void test_off_graph_falls_back_to_straight_line() {
+  // 30 km north: farther than MAX_SNAP_M from every node
+  geo::Target far = geo::makeTarget(22.7300, 91.9714);
+  route::RouteNavigator navigator;
+  TEST_ASSERT_TRUE(navigator.distance(22.4633, 91.9714, far.lat, far.lng) < 0);
+  TEST_ASSERT_FALSE(navigator.setTarget(22.4633, 91.9714, far));
+
+  const route::Guidance& guidance = navigator.guidance();
+  TEST_ASSERT_FALSE(guidance.routed);
+  TEST_ASSERT_TRUE(navigator.onFinalLeg());
+  TEST_ASSERT_TRUE(fabsf(guidance.remainingM - geo::distance(far, 22.4633, 91.9714)) < 1.0f);
+  TEST_ASSERT_TRUE(fabsf(guidance.bearing - geo::bearing(far, 22.4633, 91.9714)) < 0.1f);
+  TEST_ASSERT_EQUAL_UINT32(route::TURN_NONE, guidance.turn);
+  TEST_ASSERT_EQUAL_STRING("Ahead", route::turnLabel(guidance.turn));
+}
+
+static int runTests() {
+  UNITY_BEGIN();
+  RUN_TEST(test_graph_is_well_formed);
+  RUN_TEST(test_astar_paths_are_optimal);
+  RUN_TEST(test_trivial_and_bad_requests);
+  RUN_TEST(test_navigator_follows_the_route);
+  RUN_TEST(test_off_graph_falls_back_to_straight_line);
+  return UNITY_END();
+}
+
+#ifdef AERAS_NATIVE
+int main() {
+  return runTests();
+}
+#else
+void setup() {
+  delay(2000);  // Let the test runner attach to the serial port
+  runTests();
+}
+
+void loop() {}
+#endif
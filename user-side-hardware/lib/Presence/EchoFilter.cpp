@@ -0,0 +1,58 @@
+#include "EchoFilter.h"
+
+// Missing echoes sort above any real distance
+static int32_t sortKey(int32_t v) {
+  return v == ECHO_NONE ? INT32_MAX : v;
+}
+
+EchoFilter::EchoFilter(int32_t enterCm, int32_t exitCm)
+  : enterThreshold(enterCm), exitThreshold(exitCm) {
+  reset();
+}
+
+void EchoFilter::reset() {
+  for (uint8_t i = 0; i < WINDOW; i++) window[i] = ECHO_NONE;
+  head = 0;
+  median = ECHO_NONE;
+  present = false;
+  presentSinceMs = 0;
+  samples = 0;
+}
+
+int32_t EchoFilter::computeMedian() const {
+  // Insertion sort of WINDOW values. The window starts full of ECHO_NONE,
+  // so presence needs a majority of real echoes even right after reset.
+  int32_t sorted[WINDOW];
+  for (uint8_t i = 0; i < WINDOW; i++) {
+    int32_t v = window[i];
+    int8_t j = i - 1;
+    while (j >= 0 && sortKey(sorted[j]) > sortKey(v)) {
+      sorted[j + 1] = sorted[j];
+      j--;
+    }
+    sorted[j + 1] = v;
+  }
+  return sorted[WINDOW / 2];
+}
+
+void EchoFilter::push(int32_t distanceCm, uint32_t nowMs) {
+  if (distanceCm <= 0) distanceCm = ECHO_NONE;
+
+  window[head] = distanceCm;
+  head = (head + 1) % WINDOW;
+  samples++;
+
+  median = computeMedian();
+
+  if (!present) {
+    if (median != ECHO_NONE && median <= enterThreshold) {
+      present = true;
+      presentSinceMs = nowMs;
+    }
+  } else {
+    if (median == ECHO_NONE || median > exitThreshold) {
+      present = false;
+      presentSinceMs = 0;
+    }
+  }
+}
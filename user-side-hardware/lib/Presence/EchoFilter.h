@@ -0,0 +1,47 @@
+/*
+ * AERAS Presence - Echo filter
+ * Median + hysteresis filter over the last few ultrasonic samples.
+ * Pure logic (no Arduino calls) so recorded echo traces can be replayed
+ * through it off-device.
+ */
+
+#ifndef AERAS_ECHO_FILTER_H
+#define AERAS_ECHO_FILTER_H
+
+#include <stdint.h>
+
+// Sample value for "no echo within the timeout" (out of range)
+const int32_t ECHO_NONE = -1;
+
+class EchoFilter {
+public:
+  static const uint8_t WINDOW = 5;  // Median window (odd)
+
+  // enterCm: median at/below this means "present"
+  // exitCm:  median above this (or no echo) means "gone"
+  EchoFilter(int32_t enterCm, int32_t exitCm);
+
+  // Feed one sample (distance in cm or ECHO_NONE) taken at nowMs
+  void push(int32_t distanceCm, uint32_t nowMs);
+
+  void reset();
+
+  bool isPresent() const { return present; }
+  int32_t distanceCm() const { return median; }      // ECHO_NONE if unknown
+  uint32_t presentSince() const { return presentSinceMs; }
+  uint32_t sampleCount() const { return samples; }
+
+private:
+  int32_t window[WINDOW];
+  uint8_t head;
+  int32_t enterThreshold;
+  int32_t exitThreshold;
+  int32_t median;
+  bool present;
+  uint32_t presentSinceMs;
+  uint32_t samples;
+
+  int32_t computeMedian() const;
+};
+
+#endif
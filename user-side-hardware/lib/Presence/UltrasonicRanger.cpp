@@ -0,0 +1,56 @@
+#include "UltrasonicRanger.h"
+
+UltrasonicRanger* UltrasonicRanger::instance = nullptr;
+
+UltrasonicRanger::UltrasonicRanger(uint8_t trigPin, uint8_t echoPin, int32_t enterCm, int32_t exitCm, int32_t scale)
+  : trig(trigPin), echo(echoPin), scaleFactor(scale), filter(enterCm, exitCm),
+    lastRaw(ECHO_NONE), missed(0), triggered(false),
+    echoRiseUs(0), echoWidthUs(0), echoReady(false) {
+}
+
+void UltrasonicRanger::begin() {
+  instance = this;
+  pinMode(trig, OUTPUT);
+  pinMode(echo, INPUT);
+  digitalWrite(trig, LOW);
+  attachInterrupt(digitalPinToInterrupt(echo), onEchoChange, CHANGE);
+}
+
+void IRAM_ATTR UltrasonicRanger::onEchoChange() {
+  UltrasonicRanger* self = instance;
+  if (self == nullptr) return;
+
+  uint32_t now = micros();
+  if (digitalRead(self->echo) == HIGH) {
+    self->echoRiseUs = now;
+  } else if (self->echoRiseUs != 0) {
+    self->echoWidthUs = now - self->echoRiseUs;
+    self->echoRiseUs = 0;
+    self->echoReady = true;
+  }
+}
+
+void UltrasonicRanger::sample() {
+  // 1. Collect the echo from the previous trigger (60 ms ago)
+  if (triggered) {
+    int32_t distance = ECHO_NONE;
+    if (echoReady && echoWidthUs <= ECHO_TIMEOUT_US) {
+      distance = (int32_t)(echoWidthUs * 0.034 / 2) * scaleFactor;
+    } else {
+      missed++;
+    }
+    echoReady = false;
+    echoRiseUs = 0;
+
+    lastRaw = distance;
+    filter.push(distance, millis());
+  }
+
+  // 2. Fire the next trigger pulse (10 us, the only busy-wait left)
+  digitalWrite(trig, LOW);
+  delayMicroseconds(2);
+  digitalWrite(trig, HIGH);
+  delayMicroseconds(10);
+  digitalWrite(trig, LOW);
+  triggered = true;
+}
@@ -0,0 +1,52 @@
+/*
+ * AERAS Presence - Interrupt-driven HC-SR04 ranger
+ * The echo pulse is timed by a CHANGE interrupt instead of pulseIn(), so a
+ * measurement never blocks the loop. sample() is called at a fixed rate
+ * (from the scheduler): it collects the previous echo and fires the next
+ * trigger pulse. Results go through an EchoFilter; callers only read the
+ * cached presence/distance.
+ */
+
+#ifndef AERAS_ULTRASONIC_RANGER_H
+#define AERAS_ULTRASONIC_RANGER_H
+
+#include <Arduino.h>
+#include "EchoFilter.h"
+
+class UltrasonicRanger {
+public:
+  static const uint32_t SAMPLE_PERIOD_MS = 60;   // HC-SR04 minimum cycle
+  static const uint32_t ECHO_TIMEOUT_US = 30000; // ~5 m round trip
+
+  // scale multiplies the measured distance (Wokwi range stretch)
+  UltrasonicRanger(uint8_t trigPin, uint8_t echoPin, int32_t enterCm, int32_t exitCm, int32_t scale = 1);
+
+  void begin();
+
+  // Collect the last echo and fire the next trigger; call every SAMPLE_PERIOD_MS
+  void sample();
+
+  bool isPresent() const { return filter.isPresent(); }
+  int32_t distanceCm() const { return filter.distanceCm(); }
+  uint32_t presentSince() const { return filter.presentSince(); }
+  int32_t lastRawCm() const { return lastRaw; }
+  uint32_t missedEchoes() const { return missed; }
+
+private:
+  static void IRAM_ATTR onEchoChange();
+  static UltrasonicRanger* instance;
+
+  uint8_t trig;
+  uint8_t echo;
+  int32_t scaleFactor;
+  EchoFilter filter;
+  int32_t lastRaw;
+  uint32_t missed;
+  bool triggered;
+
+  volatile uint32_t echoRiseUs;
+  volatile uint32_t echoWidthUs;
+  volatile bool echoReady;
+};
+
+#endif
@@ -5,10 +5,15 @@
  */
 
 #include <Wire.h>
-#include <Adafruit_GFX.h>
-#include <Adafruit_SSD1306.h>
 #include <WiFi.h>
-#include <HTTPClient.h>
+#include <AerasScheduler.h>
+#include <AerasNetTask.h>
+#include <AerasCodec.h>
+#include <AerasDisplay.h>
+#include <AerasBlocks.h>
+#include <AerasConsole.h>
+#include <AerasBoot.h>
+#include <UltrasonicRanger.h>
 
 // ===== PIN DEFINITIONS =====
 #define TRIG_PIN 5
@@ -21,18 +26,27 @@
 #define BUZZER_PIN 27
 
 // ===== OLED DISPLAY =====
-#define SCREEN_WIDTH 128
-#define SCREEN_HEIGHT 64
 #define OLED_RESET -1
-Adafruit_SSD1306 display(SCREEN_WIDTH, SCREEN_HEIGHT, &Wire, OLED_RESET);
+FrameDisplay display(&Wire, OLED_RESET);  // Sends only what changed since the last frame
 
 // ===== WIFI & BACKEND =====
+// Defaults that seed NVS on first boot; CONFIG changes the stored copy
 const char* ssid = "Wokwi-GUEST";
 const char* password = "";
 const char* backendURL = "http://10.172.129.95:3000/api";
+// Push events from the native gateway (`npm run gateway`); nullptr: the backend
+const char* eventsURL = nullptr;
+FastBoot boot;      // Joins the cached AP without a scan; boot phase timer
+NetTask network;    // HTTP + push on core 0; replies drained by pumpNetwork()
+
+// Request kinds; each reply comes back with its tag
+enum RequestTag : uint8_t {
+  REQ_RIDE_REQUEST,
+  REQ_RIDE_STATUS
+};
 
 // ===== LOCATION INFO =====
-const char* blockID = "CUET_CAMPUS";
+const char* blockID = "CUET_CAMPUS";    // Default; setup() takes the NVS copy
 const char* destination = "PAHARTOLI";  // User chooses this block
 
 // ===== STATE MACHINE =====
@@ -45,13 +59,20 @@ enum SystemState {
   STATE_WAITING_ACCEPTANCE,
   STATE_RIDE_ACCEPTED,
   STATE_RIDE_ACTIVE,
-  STATE_TIMEOUT_ERROR
+  STATE_TIMEOUT_ERROR,
+  STATE_RESETTING      // Holding a message on screen before going idle
 };
 
 SystemState currentState = STATE_IDLE;
 
+const char* const STATE_NAMES[] = {
+  "IDLE", "DETECTING", "PRIVILEGE_CHECK", "WAITING_CONFIRM", "REQUEST_SENT",
+  "WAITING_ACCEPTANCE", "RIDE_ACCEPTED", "RIDE_ACTIVE", "TIMEOUT_ERROR", "RESETTING"
+};
+
 // ===== TIMING VARIABLES =====
 unsigned long ultrasonicStartTime = 0;
+unsigned long idleSince = 0;            // Dwell is never counted from before this
 unsigned long requestSentTime = 0;
 unsigned long lastButtonTime = 0;
 unsigned long lastStatusCheck = 0;
@@ -59,40 +80,70 @@ unsigned long lastLEDBlink = 0;
 const int DEBOUNCE_DELAY = 200;
 const int ULTRASONIC_THRESHOLD = 3000; // 3 seconds
 const int REQUEST_TIMEOUT = 60000;     // 60 seconds
+const int STATE_MACHINE_PERIOD = 50;   // Sensor/state poll period (ms)
+const int RESET_HOLD_TIME = 1000;      // "System Ready" hold after reset
+const int ERROR_HOLD_TIME = 2000;      // Request failure message hold
+const int COMPLETE_HOLD_TIME = 3000;   // Ride complete message hold
+const int TIMEOUT_HOLD_TIME = 5000;    // Timeout message hold
+const int STATUS_POLL_INTERVAL = 2000;     // Status polling without push
+const int STATUS_FALLBACK_INTERVAL = 15000; // Safety poll while push is up
+const int NET_PUMP_PERIOD = 20;            // Network reply drain period (ms)
+const int CONSOLE_PERIOD = 20;             // Serial command poll period (ms)
+const int LINK_PERIOD = 100;               // Wi-Fi join/drop check period (ms)
+
+// ===== PRESENCE DETECTION =====
+const int PRESENCE_ENTER_CM = 1000;    // 10 m (scaled) - person present
+const int PRESENCE_EXIT_CM = 1100;     // Hysteresis band before "left"
+const int ULTRASONIC_SCALE = 4;        // Scale to ~16m range (HC-SR04 is 4m)
+UltrasonicRanger ranger(TRIG_PIN, ECHO_PIN, PRESENCE_ENTER_CM, PRESENCE_EXIT_CM, ULTRASONIC_SCALE);
 
 // ===== FLAGS =====
 bool ultrasonicTriggered = false;
 bool privilegeVerified = false;
 bool requestSent = false;
-String currentRideID = "";
+long currentRideID = 0;  // 0 = no ride
+
+// ===== SCHEDULER =====
+Scheduler scheduler;
+
+// Buzzer pattern state (driven by beepOn/beepOff continuations)
+int beepsRemaining = 0;
+int beepDuration = 100;
 
 // ===== HELPER FUNCTIONS =====
 
+// Single layout: only lines whose text changed are redrawn and sent
 void displayMessage(String line1, String line2, String line3 = "") {
-  display.clearDisplay();
-  display.setTextSize(1);
-  display.setTextColor(SSD1306_WHITE);
-  display.setCursor(0, 10);
-  display.println("AERAS SYSTEM");
-  display.println("================");
-  display.setCursor(0, 28);
-  display.println(line1);
-  display.setCursor(0, 40);
-  display.println(line2);
-  if (line3 != "") {
-    display.setCursor(0, 52);
-    display.println(line3);
-  }
-  display.display();
+  display.text(0, 0, 10, "AERAS SYSTEM");
+  display.text(1, 0, 18, "================");
+  display.text(2, 0, 28, line1);
+  display.text(3, 0, 40, line2);
+  display.text(4, 0, 52, line3);
+  display.presentNow();
+}
+
+void beepOff();
+
+void beepOn() {
+  if (beepsRemaining <= 0) return;
+  beepsRemaining--;
+  digitalWrite(BUZZER_PIN, HIGH);
+  scheduler.after(beepDuration, beepOff);
 }
 
+void beepOff() {
+  digitalWrite(BUZZER_PIN, LOW);
+  if (beepsRemaining > 0) scheduler.after(100, beepOn);
+}
+
+// Non-blocking: starts the pattern and returns immediately.
+// A new pattern replaces any pattern still playing.
 void beep(int times, int duration = 100) {
-  for (int i = 0; i < times; i++) {
-    digitalWrite(BUZZER_PIN, HIGH);
-    delay(duration);
-    digitalWrite(BUZZER_PIN, LOW);
-    if (i < times - 1) delay(100);
-  }
+  scheduler.cancel(beepOn);
+  scheduler.cancel(beepOff);
+  beepsRemaining = times;
+  beepDuration = duration;
+  beepOn();
 }
 
 void setLEDs(bool yellow, bool red, bool green) {
@@ -101,103 +152,119 @@ void setLEDs(bool yellow, bool red, bool green) {
   digitalWrite(LED_GREEN, green ? HIGH : LOW);
 }
 
+void showReadyScreen() {
+  displayMessage("System Ready", "Stand on block", "for 3+ seconds");
+}
+
+void enterIdle() {
+  currentState = STATE_IDLE;
+  idleSince = millis();
+}
+
 void resetSystem() {
   Serial.println("\n=== SYSTEM RESET ===");
-  currentState = STATE_IDLE;
+  scheduler.cancel(resetSystem);
+  scheduler.cancel(enterIdle);
+  currentState = STATE_RESETTING;
   ultrasonicTriggered = false;
   privilegeVerified = false;
   requestSent = false;
   ultrasonicStartTime = 0;
   requestSentTime = 0;
-  currentRideID = "";
+  currentRideID = 0;
   
   setLEDs(false, false, false);
-  displayMessage("System Ready", "Stand on block", "for 3+ seconds");
-  delay(1000);
+  showReadyScreen();
+  scheduler.after(RESET_HOLD_TIME, enterIdle);
+}
+
+// Show a message for holdMs, then run the continuation
+void holdThen(uint32_t holdMs, TaskCallback next) {
+  currentState = STATE_RESETTING;
+  scheduler.after(holdMs, next);
+}
+
+void userLeftDone() {
+  showReadyScreen();
+  enterIdle();
 }
 
 // ===== BACKEND COMMUNICATION =====
+// Queues the request; the reply arrives in onRideCreatedReply()
 bool sendRideRequest() {
   if (WiFi.status() != WL_CONNECTED) {
     Serial.println("✗ WiFi not connected");
     return false;
   }
   
-  HTTPClient http;
-  String url = String(backendURL) + "/ride/request";
+  char userID[16];
+  snprintf(userID, sizeof(userID), "USER_%ld", random(1000, 9999));
   
-  http.begin(url);
-  http.addHeader("Content-Type", "application/json");
-  http.setTimeout(5000);
+  char payload[160];
+  codec::encodeRideRequest(payload, sizeof(payload), blockID, destination, userID);
   
-  String payload = "{";
-  payload += "\"blockID\":\"" + String(blockID) + "\",";
-  payload += "\"destination\":\"" + String(destination) + "\",";
-  payload += "\"userID\":\"USER_" + String(random(1000, 9999)) + "\"";
-  payload += "}";
+  Serial.print("Sending: ");
+  Serial.println(payload);
   
-  Serial.println("Sending: " + payload);
-  
-  int httpCode = http.POST(payload);
-  bool success = false;
+  return network.post(REQ_RIDE_REQUEST, "/ride/request", payload, DECODE_RIDE_CREATED, 0, 5000);
+}
+
+void rideRequestFailed() {
+  displayMessage("Error!", "Check WiFi", "Try again");
+  beep(1, 500);
+  Serial.println("✗ Request failed");
+  holdThen(ERROR_HOLD_TIME, resetSystem);
+}
+
+void onRideCreatedReply(const NetEvent& reply) {
+  if (currentState != STATE_REQUEST_SENT) return;  // Reset while in flight
   
-  if (httpCode == 200) {
-    String response = http.getString();
-    Serial.println("Response: " + response);
-    
-    // Extract ride ID
-    int rideIDStart = response.indexOf("\"rideID\":") + 9;
-    if (rideIDStart > 8) {
-      int rideIDEnd = response.indexOf(",", rideIDStart);
-      if (rideIDEnd == -1) rideIDEnd = response.indexOf("}", rideIDStart);
-      currentRideID = response.substring(rideIDStart, rideIDEnd);
-      Serial.println("Ride ID: " + currentRideID);
-      success = true;
-    }
-  } else {
-    Serial.println("HTTP Error: " + String(httpCode));
+  if (!reply.decoded) {
+    if (reply.httpCode != 200) Serial.println("HTTP Error: " + String(reply.httpCode));
+    rideRequestFailed();
+    return;
   }
   
-  http.end();
-  return success;
+  currentRideID = reply.createdRideID;
+  Serial.println("Ride ID: " + String(currentRideID));
+  
+  requestSent = true;
+  requestSentTime = millis();
+  currentState = STATE_WAITING_ACCEPTANCE;
+  setLEDs(false, false, false); // ALL OFF while waiting
+  displayMessage("Request Sent!", "Waiting for", "rickshaw...");
+  beep(3, 80);
+  Serial.println("✓ Request sent to backend");
+  Serial.println("⏳ Waiting for rickshaw acceptance (60s timeout)...");
 }
 
 // ===== TEST CASE 1: ULTRASONIC DETECTION =====
+// Background sampling task - echo timing happens in the ranger's interrupt
+void sampleUltrasonic() {
+  ranger.sample();
+}
+
 void checkUltrasonicSensor() {
-  // Trigger pulse
-  digitalWrite(TRIG_PIN, LOW);
-  delayMicroseconds(2);
-  digitalWrite(TRIG_PIN, HIGH);
-  delayMicroseconds(10);
-  digitalWrite(TRIG_PIN, LOW);
-  
-  // Measure echo
-  long duration = pulseIn(ECHO_PIN, HIGH, 30000); // 30ms timeout
-  if (duration == 0) {
-    // No echo received - out of range
-    if (ultrasonicStartTime > 0) {
-      Serial.println("Person moved away - resetting timer");
-      ultrasonicStartTime = 0;
-    }
-    return;
-  }
-  
-  long distanceCm = duration * 0.034 / 2;
-  long scaledDistance = distanceCm * 4; // Scale to ~16m range (HC-SR04 is 4m)
+  // Cached, median-filtered reading - never blocks
+  long scaledDistance = ranger.distanceCm();
   
   // Debug output every 2 seconds
   static unsigned long lastDebug = 0;
   if (millis() - lastDebug > 2000) {
     Serial.print("Distance: ");
     Serial.print(scaledDistance);
-    Serial.println(" cm");
+    Serial.print(" cm (raw ");
+    Serial.print(ranger.lastRawCm());
+    Serial.println(" cm)");
     lastDebug = millis();
   }
   
-  // TEST CASE 1: Check if within 10m (1000cm)
-  if (scaledDistance > 0 && scaledDistance <= 1000) {
+  // TEST CASE 1: Check if within 10m (1000cm), with hysteresis
+  if (ranger.isPresent()) {
     if (ultrasonicStartTime == 0) {
-      ultrasonicStartTime = millis();
+      // A rider still standing there after a reset waits the full 3 s again
+      unsigned long since = ranger.presentSince();
+      ultrasonicStartTime = (long)(since - idleSince) > 0 ? since : idleSince;
       currentState = STATE_DETECTING;
       Serial.println("✓ Person detected - waiting 3 seconds...");
       displayMessage("User Detected!", "Stay for 3 sec", "Distance: " + String(scaledDistance) + "cm");
@@ -215,14 +282,12 @@ void checkUltrasonicSensor() {
       Serial.println("   Time: " + String(elapsed) + " ms");
     }
   } else {
-    // Person moved out of range
+    // Person moved out of range (filtered - a single bad echo doesn't count)
     if (ultrasonicStartTime > 0 && !ultrasonicTriggered) {
       Serial.println("⚠ Person moved away - resetting");
       ultrasonicStartTime = 0;
-      currentState = STATE_IDLE;
       displayMessage("User Left", "Stand again", "for 3+ seconds");
-      delay(1000);
-      displayMessage("System Ready", "Stand on block", "for 3+ seconds");
+      holdThen(RESET_HOLD_TIME, userLeftDone);
     }
   }
 }
@@ -265,77 +330,94 @@ void checkButtonPress() {
       
       Serial.println("🔘 Button pressed - Sending request...");
       
-      // Send ride request
+      // Send ride request; sensing keeps running while it is in flight
       if (sendRideRequest()) {
-        requestSent = true;
-        requestSentTime = millis();
-        currentState = STATE_WAITING_ACCEPTANCE;
-        setLEDs(false, false, false); // ALL OFF while waiting
-        displayMessage("Request Sent!", "Waiting for", "rickshaw...");
-        beep(3, 80);
-        Serial.println("✓ Request sent to backend");
-        Serial.println("⏳ Waiting for rickshaw acceptance (60s timeout)...");
+        currentState = STATE_REQUEST_SENT;
+        displayMessage("Sending...", "Please wait", "");
       } else {
-        displayMessage("Error!", "Check WiFi", "Try again");
-        beep(1, 500);
-        Serial.println("✗ Request failed");
-        delay(2000);
-        resetSystem();
+        rideRequestFailed();
       }
     }
   }
 }
 
 // ===== TEST CASE 4 & 5: LED STATUS + RIDE MONITORING =====
+// Shared by the status poll and the push channel
+void applyRideStatus(const char* status) {
+  if (strcmp(status, "ACCEPTED") == 0) {
+    // TEST CASE 4b: Yellow LED - Rickshaw accepted (ONLY NOW, not before!)
+    if (currentState == STATE_WAITING_ACCEPTANCE) {
+      currentState = STATE_RIDE_ACCEPTED;
+      setLEDs(true, false, false); // Yellow ON - rickshaw is coming!
+      displayMessage("Ride Accepted!", "Rickshaw coming", "Please wait...");
+      beep(2, 100);
+      Serial.println("✓ Status: ACCEPTED - Yellow LED ON (rickshaw coming)");
+    }
+  }
+  else if (strcmp(status, "PICKUP") == 0) {
+    // TEST CASE 4d: Green LED - Rickshaw arrived at your location
+    if (currentState != STATE_RIDE_ACTIVE) {
+      currentState = STATE_RIDE_ACTIVE;
+      setLEDs(false, false, true); // Green ON - rickshaw is here!
+      displayMessage("Rickshaw Here!", "Have a safe", "journey!");
+      beep(3, 100);
+      Serial.println("✓ Status: PICKUP - Green LED ON (rickshaw arrived)");
+    }
+  }
+  else if (strcmp(status, "COMPLETED") == 0) {
+    // Ride completed - show message and reset
+    displayMessage("Ride Complete", "Thank you!", "Resetting...");
+    beep(2, 150);
+    Serial.println("✓ Ride completed - Resetting system...");
+    holdThen(COMPLETE_HOLD_TIME, resetSystem);
+  }
+}
+
+bool isTrackingRide() {
+  return currentState == STATE_WAITING_ACCEPTANCE ||
+         currentState == STATE_RIDE_ACCEPTED ||
+         currentState == STATE_RIDE_ACTIVE;
+}
+
 void checkRideStatus() {
   if (WiFi.status() != WL_CONNECTED) return;
+  if (network.busy(REQ_RIDE_STATUS)) return;
   
-  // Check every 2 seconds
-  if (millis() - lastStatusCheck < 2000) return;
+  // Poll every 2 seconds; only a slow safety poll while push is connected
+  unsigned long interval = network.pushConnected() ? STATUS_FALLBACK_INTERVAL : STATUS_POLL_INTERVAL;
+  if (millis() - lastStatusCheck < interval) return;
   lastStatusCheck = millis();
   
-  HTTPClient http;
-  String url = String(backendURL) + "/ride/status?blockID=" + String(blockID);
-  
-  http.begin(url);
-  http.setTimeout(3000);
-  int httpCode = http.GET();
-  
-  if (httpCode == 200) {
-    String response = http.getString();
-    
-    // Parse status
-    if (response.indexOf("\"ACCEPTED\"") > 0) {
-      // TEST CASE 4b: Yellow LED - Rickshaw accepted (ONLY NOW, not before!)
-      if (currentState == STATE_WAITING_ACCEPTANCE) {
-        currentState = STATE_RIDE_ACCEPTED;
-        setLEDs(true, false, false); // Yellow ON - rickshaw is coming!
-        displayMessage("Ride Accepted!", "Rickshaw coming", "Please wait...");
-        beep(2, 100);
-        Serial.println("✓ Status: ACCEPTED - Yellow LED ON (rickshaw coming)");
-      }
-    }
-    else if (response.indexOf("\"PICKUP\"") > 0) {
-      // TEST CASE 4d: Green LED - Rickshaw arrived at your location
-      if (currentState != STATE_RIDE_ACTIVE) {
-        currentState = STATE_RIDE_ACTIVE;
-        setLEDs(false, false, true); // Green ON - rickshaw is here!
-        displayMessage("Rickshaw Here!", "Have a safe", "journey!");
-        beep(3, 100);
-        Serial.println("✓ Status: PICKUP - Green LED ON (rickshaw arrived)");
-      }
-    }
-    else if (response.indexOf("\"COMPLETED\"") > 0) {
-      // Ride completed - show message and reset
-      displayMessage("Ride Complete", "Thank you!", "Resetting...");
-      beep(2, 150);
-      Serial.println("✓ Ride completed - Resetting system...");
-      delay(3000);
-      resetSystem();
+  network.get(REQ_RIDE_STATUS, "/ride/status?blockID=" + String(blockID), DECODE_RIDE_STATUS,
+              currentRideID, 3000);
+}
+
+void onRideStatusReply(const NetEvent& reply) {
+  if (!reply.decoded || !isTrackingRide()) return;
+  applyRideStatus(reply.ride.status);
+}
+
+// Push channel: {"rideID":12,"status":"ACCEPTED",...} for rides at this block
+void onPushedRide(const RideStatus& ride) {
+  if (!isTrackingRide()) return;
+  if (ride.rideID != currentRideID) return;  // Older ride
+
+  Serial.println("📡 Push: " + String(ride.status));
+  applyRideStatus(ride.status);
+}
+
+// Every backend result is applied here, on the loop task, so ride state
+// never changes from the network core
+void pumpNetwork() {
+  NetEvent reply;
+  while (network.poll(reply)) {
+    boot.backendReply(reply.httpCode);
+    switch (reply.tag) {
+      case REQ_RIDE_REQUEST:   onRideCreatedReply(reply); break;
+      case REQ_RIDE_STATUS:    onRideStatusReply(reply); break;
+      case NetTask::PUSH_RIDE: onPushedRide(reply.ride); break;
     }
   }
-  
-  http.end();
 }
 
 // ===== TIMEOUT CHECKER =====
@@ -357,21 +439,133 @@ void checkTimeout() {
       displayMessage("TIMEOUT!", "No rickshaw", "available");
       beep(1, 500);
       Serial.println("✗ TIMEOUT after 60 seconds");
-      delay(5000);
-      resetSystem();
+      scheduler.after(TIMEOUT_HOLD_TIME, resetSystem);
     }
   }
 }
 
+// ===== STATE MACHINE STEP =====
+void stepStateMachine() {
+  switch (currentState) {
+    case STATE_IDLE:
+    case STATE_DETECTING:
+      checkUltrasonicSensor();
+      break;
+      
+    case STATE_PRIVILEGE_CHECK:
+      checkPrivilegeVerification();
+      break;
+      
+    case STATE_WAITING_CONFIRM:
+      checkButtonPress();
+      break;
+      
+    case STATE_REQUEST_SENT:
+      // Reply handled in onRideCreatedReply()
+      break;
+      
+    case STATE_WAITING_ACCEPTANCE:
+      checkRideStatus();
+      checkTimeout();
+      break;
+      
+    case STATE_RIDE_ACCEPTED:
+    case STATE_RIDE_ACTIVE:
+      checkRideStatus();
+      break;
+      
+    case STATE_TIMEOUT_ERROR:
+      // Handled in checkTimeout()
+      break;
+
+    case STATE_RESETTING:
+      // Waiting for a scheduled continuation
+      break;
+  }
+}
+
+void reportLoopHealth() {
+  Serial.println("Scheduler: " + String(scheduler.activeCount()) + " tasks, max lateness " +
+                 String(scheduler.maxLateness()) + " ms");
+  network.printStats();
+  display.printStats();
+}
+
+// Same table the rickshaw navigates by; an unknown ID would leave it without a target
+void printBlock(const char* label, const char* id) {
+  const blocks::Block* block = blocks::find(id);
+  if (block == nullptr) {
+    Serial.println(String(label) + id + " ⚠️ not in block table v" + String(blocks::version()));
+    return;
+  }
+  Serial.println(String(label) + id + " (" + String(block->lat, 4) + ", " + String(block->lng, 4) + ")");
+}
+
+// ===== SERIAL COMMANDS =====
+extern CommandConsole console;  // Defined after the command table
+
+void cmdStatus(const char* args) {
+  Serial.println("\n===== BLOCK STATUS =====");
+  Serial.println("State: " + String(STATE_NAMES[currentState]));
+  Serial.println("Ride ID: " + String(currentRideID));
+  printBlock("Block ID: ", blockID);
+  printBlock("Destination: ", destination);
+  Serial.println("Ultrasonic: " + String(ranger.lastRawCm()) + " cm raw, LDR " + String(analogRead(LDR_PIN)));
+  reportLoopHealth();
+  console.printStats();
+  Serial.println("========================\n");
+}
+
+void cmdNet(const char* args) {
+  network.printStats();
+  boot.printStats();
+  Serial.println("Push: " + String(network.pushConnected() ? "connected" : "down") +
+                 ", WiFi RSSI " + String(WiFi.RSSI()) + " dBm");
+}
+
+void cmdConfig(const char* args) {
+  boot.command(args);
+}
+
+void cmdHeap(const char* args) {
+  Serial.println("Heap: " + String(ESP.getFreeHeap()) + " B free, " + String(ESP.getMinFreeHeap()) +
+                 " B lowest, " + String(ESP.getMaxAllocHeap()) + " B largest block");
+}
+
+const ConsoleCommand COMMANDS[] = {
+  {"STATUS", cmdStatus, "State, ride, sensors, loop health"},
+  {"NET",    cmdNet,    "Network task and push stats"},
+  {"HEAP",   cmdHeap,   "Free heap and largest block"},
+  {"CONFIG", cmdConfig, "WiFi/backend/ID in NVS; CONFIG URL <url> etc."}
+};
+
+CommandConsole console(COMMANDS, sizeof(COMMANDS) / sizeof(COMMANDS[0]));
+
+void pollConsole() {
+  console.poll();
+}
+
+// The connect beeps the old blocking setup() made, now when the link changes
+void watchLink() {
+  switch (boot.poll()) {
+    case LINK_UP:     beep(2, 100); break;
+    case LINK_FAILED: beep(1, 500); break;
+    default: break;
+  }
+}
+
 // ===== SETUP =====
 void setup() {
+  console.begin(Serial);  // Sizes the RX ring, so before Serial.begin()
   Serial.begin(115200);
-  delay(1000);
   Serial.println("\n\n=== AERAS USER SIDE SYSTEM ===");
   
+  // Join first: the radio associates while the rest of setup() runs
+  boot.begin(ssid, password, backendURL, blockID);
+  blockID = boot.deviceId();
+  
   // Pin modes
-  pinMode(TRIG_PIN, OUTPUT);
-  pinMode(ECHO_PIN, INPUT);
+  ranger.begin();
   pinMode(LDR_PIN, INPUT);
   pinMode(BUTTON_PIN, INPUT);
   pinMode(LED_YELLOW, OUTPUT);
@@ -393,77 +587,35 @@ void setup() {
     }
   }
   
-  display.clearDisplay();
-  display.setTextSize(1);
-  display.setTextColor(SSD1306_WHITE);
   displayMessage("AERAS System", "Initializing...", "Please wait");
+  boot.mark("display");
   
-  // Connect WiFi
-  WiFi.begin(ssid, password);
-  Serial.print("Connecting to WiFi");
-  int attempts = 0;
-  while (WiFi.status() != WL_CONNECTED && attempts < 40) {
-    delay(500);
-    Serial.print(".");
-    attempts++;
-  }
-  
-  if (WiFi.status() == WL_CONNECTED) {
-    Serial.println("\n✓ WiFi Connected");
-    Serial.println("IP: " + WiFi.localIP().toString());
-    displayMessage("WiFi Connected", "System Ready", "");
-    beep(2, 100);
-  } else {
-    Serial.println("\n✗ WiFi Failed - Offline Mode");
-    displayMessage("WiFi Error", "Check network", "");
-    beep(1, 500);
-  }
-  
-  delay(2000);
+  // Requests made before the link is up fail fast; watchLink() reports it
+  network.begin(boot.backendUrl(), "/events?blockID=" + String(blockID), eventsURL);
+  boot.mark("setup");
   
   Serial.println("\n=== SYSTEM READY ===");
-  Serial.println("Block ID: " + String(blockID));
-  Serial.println("Destination: " + String(destination));
+  printBlock("Block ID: ", blockID);
+  printBlock("Destination: ", destination);
   Serial.println("\nTest Cases Active:");
   Serial.println("1. Ultrasonic: Stand within 10m for 3+ sec");
   Serial.println("2. LDR: Direct laser at sensor");
   Serial.println("3. Button: Press to confirm");
   Serial.println("4. LEDs: Watch status indicators");
-  Serial.println("5. OLED: Check display updates\n");
+  Serial.println("5. OLED: Check display updates");
+  Serial.println("Commands: STATUS, NET, HEAP, CONFIG (HELP for all)\n");
   
   resetSystem();
+
+  scheduler.every(UltrasonicRanger::SAMPLE_PERIOD_MS, sampleUltrasonic);
+  scheduler.every(STATE_MACHINE_PERIOD, stepStateMachine);
+  scheduler.every(NET_PUMP_PERIOD, pumpNetwork);
+  scheduler.every(CONSOLE_PERIOD, pollConsole);
+  scheduler.every(LINK_PERIOD, watchLink);
+  scheduler.every(30000, reportLoopHealth);
 }
 
 // ===== MAIN LOOP =====
 void loop() {
-  switch (currentState) {
-    case STATE_IDLE:
-    case STATE_DETECTING:
-      checkUltrasonicSensor();
-      break;
-      
-    case STATE_PRIVILEGE_CHECK:
-      checkPrivilegeVerification();
-      break;
-      
-    case STATE_WAITING_CONFIRM:
-      checkButtonPress();
-      break;
-      
-    case STATE_WAITING_ACCEPTANCE:
-      checkRideStatus();
-      checkTimeout();
-      break;
-      
-    case STATE_RIDE_ACCEPTED:
-    case STATE_RIDE_ACTIVE:
-      checkRideStatus();
-      break;
-      
-    case STATE_TIMEOUT_ERROR:
-      // Handled in checkTimeout()
-      break;
-  }
-  
-  delay(50); // Small delay to prevent CPU overload
+  scheduler.run();
 }
\ No newline at end of file
@@ -0,0 +1,159 @@
+/*
+ * AERAS Presence - EchoFilter trace replay
+ * Echo traces at the ranger's 60 ms sample period (scaled cm, ECHO_NONE for
+ * a missed echo) are replayed through the filter with the firmware's
+ * 1000/1100 cm thresholds; each test checks the median it reports and the
+ * samples where presence flips.
+ *
+ *   pio test -e native -f test_echo_filter
+ */
+
+#include <EchoFilter.h>
+#include <unity.h>
+#ifndef AERAS_NATIVE
+#include <Arduino.h>
+#endif
+
+static const int32_t ENTER_CM = 1000;   // PRESENCE_ENTER_CM in src/main.cpp
+static const int32_t EXIT_CM = 1100;    // PRESENCE_EXIT_CM
+static const uint32_t SAMPLE_MS = 60;   // UltrasonicRanger::SAMPLE_PERIOD_MS
+static const int32_t N = ECHO_NONE;
+
+// Someone walks up to the block, waits, and walks away. Carries a missed
+// echo on the way in, a 3020 cm multipath spike right after the threshold
+// and two more misses while standing.
+static const int32_t WALK_UP_AND_LEAVE[] = {
+  1480, 1450, 1390, N, 1330, 1260, 1190, 1120, 1060, 990, 3020, 940, 900, 870,
+  860, N, 850, 870, 910, 980, 1040, 1090, 1130, 1180, N, 1260, 1340
+};
+
+// Loitering inside the hysteresis band without ever coming within 10 m
+static const int32_t LOITER_OUTSIDE[] = {
+  1200, 1150, 1080, 1060, 1050, 1070, 1040, 1090, 1060, 1050
+};
+
+// Close, then drifting into the band and staying there: still present
+static const int32_t DRIFT_INTO_BAND[] = {
+  960, 950, 940, 980, 1020, 1060, 1080, 1090, 1070, 1095, 1050, 1120, 1150, 1180
+};
+
+// Present, then the echo is lost (sensor blocked or person gone sideways)
+static const int32_t ECHO_LOST[] = {
+  950, 960, 955, N, 970, N, N, N, N, 960
+};
+
+struct Replay {
+  int32_t medians[32];
+  int enteredAt;      // Sample index where presence started, -1 if never
+  int leftAt;         // Sample index where it ended, -1 if never
+  uint32_t presentSince;
+};
+
+static Replay replay(const int32_t* trace, size_t length) {
+  EchoFilter filter(ENTER_CM, EXIT_CM);
+  Replay out = {};
+  out.enteredAt = -1;
+  out.leftAt = -1;
+  bool was = false;
+  for (size_t i = 0; i < length; i++) {
+    filter.push(trace[i], (uint32_t)i * SAMPLE_MS);
+    out.medians[i] = filter.distanceCm();
+    if (filter.isPresent() && !was && out.enteredAt < 0) {
+      out.enteredAt = (int)i;
+      out.presentSince = filter.presentSince();
+    }
+    if (!filter.isPresent() && was && out.leftAt < 0) out.leftAt = (int)i;
+    was = filter.isPresent();
+  }
+  return out;
+}
+
+#define REPLAY(trace) replay(trace, sizeof(trace) / sizeof(trace[0]))
+
+void setUp() {}
+void tearDown() {}
+
+static void test_median_rejects_spikes_and_misses() {
+  Replay r = REPLAY(WALK_UP_AND_LEAVE);
+  // Fresh window is all ECHO_NONE: no distance until three real echoes
+  TEST_ASSERT_EQUAL_INT32(N, r.medians[0]);
+  TEST_ASSERT_EQUAL_INT32(N, r.medians[1]);
+  TEST_ASSERT_EQUAL_INT32(1480, r.medians[2]);
+  // The missed echo at 3 and the 3020 cm spike at 10 never reach the output
+  TEST_ASSERT_EQUAL_INT32(1480, r.medians[3]);
+  TEST_ASSERT_EQUAL_INT32(1120, r.medians[10]);
+  TEST_ASSERT_EQUAL_INT32(1060, r.medians[11]);
+  // Nor does the missed echo while standing
+  TEST_ASSERT_EQUAL_INT32(900, r.medians[15]);
+  TEST_ASSERT_EQUAL_INT32(870, r.medians[16]);
+}
+
+static void test_enters_at_threshold_and_leaves_past_band() {
+  Replay r = REPLAY(WALK_UP_AND_LEAVE);
+  // Median first reaches 990 <= 1000 at sample 12
+  TEST_ASSERT_EQUAL_INT(12, r.enteredAt);
+  TEST_ASSERT_EQUAL_UINT32(12 * SAMPLE_MS, r.presentSince);
+  // 1040 and 1090 are inside the band; 1130 at sample 24 is past it
+  TEST_ASSERT_EQUAL_INT32(1090, r.medians[23]);
+  TEST_ASSERT_EQUAL_INT(24, r.leftAt);
+}
+
+static void test_band_does_not_enter() {
+  Replay r = REPLAY(LOITER_OUTSIDE);
+  TEST_ASSERT_EQUAL_INT(-1, r.enteredAt);
+  TEST_ASSERT_EQUAL_INT32(1060, r.medians[9]);
+}
+
+static void test_band_does_not_leave() {
+  Replay r = REPLAY(DRIFT_INTO_BAND);
+  TEST_ASSERT_EQUAL_INT(2, r.enteredAt);
+  // Medians 1060..1090 hold presence; leaves when the median tops 1100
+  TEST_ASSERT_EQUAL_INT32(1080, r.medians[10]);
+  TEST_ASSERT_EQUAL_INT32(1090, r.medians[11]);
+  TEST_ASSERT_EQUAL_INT32(1095, r.medians[12]);
+  TEST_ASSERT_EQUAL_INT(13, r.leftAt);
+  TEST_ASSERT_EQUAL_INT32(1120, r.medians[13]);
+}
+
+static void test_lost_echo_ends_presence() {
+  Replay r = REPLAY(ECHO_LOST);
+  TEST_ASSERT_EQUAL_INT(2, r.enteredAt);
+  // Two misses out of five are outvoted; the third empties the median
+  TEST_ASSERT_EQUAL_INT32(970, r.medians[5]);
+  TEST_ASSERT_EQUAL_INT(6, r.leftAt);
+  TEST_ASSERT_EQUAL_INT32(N, r.medians[6]);
+}
+
+static void test_reset_clears_presence() {
+  EchoFilter filter(ENTER_CM, EXIT_CM);
+  for (int i = 0; i < 5; i++) filter.push(800, i * SAMPLE_MS);
+  TEST_ASSERT_TRUE(filter.isPresent());
+  filter.reset();
+  TEST_ASSERT_FALSE(filter.isPresent());
+  TEST_ASSERT_EQUAL_INT32(N, filter.distanceCm());
+  TEST_ASSERT_EQUAL_UINT32(0, filter.sampleCount());
+}
+
+static int runTests() {
+  UNITY_BEGIN();
+  RUN_TEST(test_median_rejects_spikes_and_misses);
+  RUN_TEST(test_enters_at_threshold_and_leaves_past_band);
+  RUN_TEST(test_band_does_not_enter);
+  RUN_TEST(test_band_does_not_leave);
+  RUN_TEST(test_lost_echo_ends_presence);
+  RUN_TEST(test_reset_clears_presence);
+  return UNITY_END();
+}
+
+#ifdef AERAS_NATIVE
+int main() {
+  return runTests();
+}
+#else
+void setup() {
+  delay(2000);  // Let the test runner attach to the serial port
+  runTests();
+}
+
+void loop() {}
+#endif